@@ -10,6 +10,36 @@ DSL_PAD_SRC = 1
 DSL_RTP_TCP = 4
 DSL_RTP_ALL = 7
 
+DSL_RTSP_BUFFER_MODE_NONE = 0
+DSL_RTSP_BUFFER_MODE_SLAVE = 1
+DSL_RTSP_BUFFER_MODE_BUFFER = 2
+DSL_RTSP_BUFFER_MODE_AUTO = 3
+DSL_RTSP_BUFFER_MODE_SYNCED = 4
+
+DSL_RTSP_PRESET_ULTRA_LOW_LATENCY = 0
+DSL_RTSP_PRESET_ROBUST = 1
+
+DSL_SURFACE_BUDGET_POLICY_REFUSE = 0
+DSL_SURFACE_BUDGET_POLICY_SHRINK = 1
+
+DSL_PLAYLIST_FILE_STARTED = 0
+DSL_PLAYLIST_FILE_ENDED = 1
+
+DSL_TRACE_FORMAT_CHROME_JSON = 0
+DSL_TRACE_FORMAT_PERFETTO = 1
+
+DSL_SGIE_LINK_MODE_PARALLEL = 0
+DSL_SGIE_LINK_MODE_SERIAL = 1
+
+DSL_THREAD_ROLE_DECODE = 0
+DSL_THREAD_ROLE_INFERENCE = 1
+DSL_THREAD_ROLE_SINK = 2
+DSL_THREAD_ROLE_OTHER = 3
+
+DSL_QUEUE_LEAKY_NO = 0
+DSL_QUEUE_LEAKY_UPSTREAM = 1
+DSL_QUEUE_LEAKY_DOWNSTREAM = 2
+
 DSL_CUDADEC_MEMTYPE_DEVICE = 0
 DSL_CUDADEC_MEMTYPE_PINNED = 1
 DSL_CUDADEC_MEMTYPE_UNIFIED = 2
@@ -37,6 +67,7 @@ DSL_UINT_P = POINTER(c_uint)
 DSL_BOOL_P = POINTER(c_bool)
 DSL_WCHAR_PP = POINTER(c_wchar_p)
 DSL_DOUBLE_P = POINTER(c_double)
+DSL_INT_P = POINTER(c_int)
 
 ##
 ## Callback Typedefs
@@ -44,9 +75,12 @@ DSL_DOUBLE_P = POINTER(c_double)
 DSL_META_BATCH_HANDLER = CFUNCTYPE(c_bool, c_void_p, c_void_p)
 DSL_STATE_CHANGE_LISTENER = CFUNCTYPE(None, c_uint, c_uint, c_void_p)
 DSL_EOS_LISTENER = CFUNCTYPE(None, c_void_p)
+DSL_PREPARE_COMPLETE_LISTENER = CFUNCTYPE(None, c_uint, c_void_p)
+DSL_PERF_LISTENER = CFUNCTYPE(None, c_uint, c_double, c_double, c_double, c_double, c_uint, c_void_p)
 DSL_XWINDOW_KEY_EVENT_HANDLER = CFUNCTYPE(None, c_wchar_p, c_void_p)
 DSL_XWINDOW_BUTTON_EVENT_HANDLER = CFUNCTYPE(None, c_uint, c_uint, c_void_p)
 DSL_XWINDOW_DELETE_EVENT_HANDLER = CFUNCTYPE(None, c_void_p)
+DSL_PLAYLIST_FILE_LISTENER = CFUNCTYPE(None, c_uint, c_wchar_p, c_uint, c_double, c_void_p)
 
 ##
 ## TODO: CTYPES callback management needs to be completed before any of
@@ -95,6 +129,182 @@ def dsl_source_rtsp_new(name, uri, protocol, cudadec_mem_type, intra_decode, dro
     result = _dsl.dsl_source_rtsp_new(name, uri, protocol, cudadec_mem_type, intra_decode, drop_frame_interval)
     return int(result)
 
+##
+## dsl_source_image_multi_new()
+##
+_dsl.dsl_source_image_multi_new.argtypes = [c_wchar_p, c_wchar_p, c_uint]
+_dsl.dsl_source_image_multi_new.restype = c_uint
+def dsl_source_image_multi_new(name, location, readahead):
+    global _dsl
+    result = _dsl.dsl_source_image_multi_new(name, location, readahead)
+    return int(result)
+
+##
+## dsl_source_image_multi_stats_get()
+##
+_dsl.dsl_source_image_multi_stats_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_double)]
+_dsl.dsl_source_image_multi_stats_get.restype = c_uint
+def dsl_source_image_multi_stats_get(name):
+    global _dsl
+    files_read = c_uint(0)
+    files_per_second = c_double(0)
+    result = _dsl.dsl_source_image_multi_stats_get(name, DSL_UINT_P(files_read), DSL_DOUBLE_P(files_per_second))
+    return int(result), files_read.value, files_per_second.value 
+
+##
+## dsl_source_uri_playlist_add()
+##
+_dsl.dsl_source_uri_playlist_add.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_source_uri_playlist_add.restype = c_uint
+def dsl_source_uri_playlist_add(name, uri):
+    global _dsl
+    result = _dsl.dsl_source_uri_playlist_add(name, uri)
+    return int(result)
+
+##
+## dsl_source_uri_playlist_clear()
+##
+_dsl.dsl_source_uri_playlist_clear.argtypes = [c_wchar_p]
+_dsl.dsl_source_uri_playlist_clear.restype = c_uint
+def dsl_source_uri_playlist_clear(name):
+    global _dsl
+    result = _dsl.dsl_source_uri_playlist_clear(name)
+    return int(result)
+
+##
+## dsl_source_uri_playlist_size_get()
+##
+_dsl.dsl_source_uri_playlist_size_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_source_uri_playlist_size_get.restype = c_uint
+def dsl_source_uri_playlist_size_get(name):
+    global _dsl
+    size = c_uint(0)
+    result = _dsl.dsl_source_uri_playlist_size_get(name, DSL_UINT_P(size))
+    return int(result), size.value 
+
+##
+## dsl_source_uri_playlist_file_listener_add()
+##
+_dsl.dsl_source_uri_playlist_file_listener_add.argtypes = [c_wchar_p, DSL_PLAYLIST_FILE_LISTENER, c_void_p]
+_dsl.dsl_source_uri_playlist_file_listener_add.restype = c_uint
+def dsl_source_uri_playlist_file_listener_add(name, listener, user_data):
+    global _dsl
+    client_listener = DSL_PLAYLIST_FILE_LISTENER(listener)
+    callbacks.append(client_listener)
+    result = _dsl.dsl_source_uri_playlist_file_listener_add(name, client_listener, user_data)
+    return int(result)
+
+##
+## dsl_source_uri_playlist_file_listener_remove()
+##
+_dsl.dsl_source_uri_playlist_file_listener_remove.argtypes = [c_wchar_p, DSL_PLAYLIST_FILE_LISTENER]
+_dsl.dsl_source_uri_playlist_file_listener_remove.restype = c_uint
+def dsl_source_uri_playlist_file_listener_remove(name, listener):
+    global _dsl
+    client_listener = DSL_PLAYLIST_FILE_LISTENER(listener)
+    result = _dsl.dsl_source_uri_playlist_file_listener_remove(name, client_listener)
+    return int(result)
+
+##
+## dsl_source_decode_surfaces_get()
+##
+_dsl.dsl_source_decode_surfaces_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_decode_surfaces_get.restype = c_uint
+def dsl_source_decode_surfaces_get(name):
+    global _dsl
+    num_decode_surfaces = c_uint(0)
+    num_extra_surfaces = c_uint(0)
+    result = _dsl.dsl_source_decode_surfaces_get(name, 
+        DSL_UINT_P(num_decode_surfaces), DSL_UINT_P(num_extra_surfaces))
+    return int(result), num_decode_surfaces.value, num_extra_surfaces.value 
+
+##
+## dsl_source_decode_surfaces_set()
+##
+_dsl.dsl_source_decode_surfaces_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_source_decode_surfaces_set.restype = c_uint
+def dsl_source_decode_surfaces_set(name, num_decode_surfaces, num_extra_surfaces):
+    global _dsl
+    result = _dsl.dsl_source_decode_surfaces_set(name, num_decode_surfaces, num_extra_surfaces)
+    return int(result)
+
+##
+## dsl_source_decode_rtsp_config_get()
+##
+_dsl.dsl_source_decode_rtsp_config_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_bool), 
+    POINTER(c_bool), POINTER(c_uint), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_decode_rtsp_config_get.restype = c_uint
+def dsl_source_decode_rtsp_config_get(name):
+    global _dsl
+    latency = c_uint(0)
+    drop_on_latency = c_bool(False)
+    do_retransmission = c_bool(False)
+    protocols = c_uint(0)
+    buffer_mode = c_uint(0)
+    timeout = c_uint(0)
+    result = _dsl.dsl_source_decode_rtsp_config_get(name, DSL_UINT_P(latency), 
+        DSL_BOOL_P(drop_on_latency), DSL_BOOL_P(do_retransmission), DSL_UINT_P(protocols), 
+        DSL_UINT_P(buffer_mode), DSL_UINT_P(timeout))
+    return int(result), latency.value, drop_on_latency.value, do_retransmission.value, \
+        protocols.value, buffer_mode.value, timeout.value
+
+##
+## dsl_source_decode_rtsp_config_set()
+##
+_dsl.dsl_source_decode_rtsp_config_set.argtypes = [c_wchar_p, c_uint, c_bool, c_bool, c_uint, c_uint, c_uint]
+_dsl.dsl_source_decode_rtsp_config_set.restype = c_uint
+def dsl_source_decode_rtsp_config_set(name, latency, drop_on_latency, do_retransmission, 
+    protocols, buffer_mode, timeout):
+    global _dsl
+    result = _dsl.dsl_source_decode_rtsp_config_set(name, latency, drop_on_latency, 
+        do_retransmission, protocols, buffer_mode, timeout)
+    return int(result)
+
+##
+## dsl_source_decode_rtsp_preset_set()
+##
+_dsl.dsl_source_decode_rtsp_preset_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_source_decode_rtsp_preset_set.restype = c_uint
+def dsl_source_decode_rtsp_preset_set(name, preset):
+    global _dsl
+    result = _dsl.dsl_source_decode_rtsp_preset_set(name, preset)
+    return int(result)
+
+##
+## dsl_source_decode_rtsp_stats_get()
+##
+_dsl.dsl_source_decode_rtsp_stats_get.argtypes = [c_wchar_p, POINTER(c_double), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_decode_rtsp_stats_get.restype = c_uint
+def dsl_source_decode_rtsp_stats_get(name):
+    global _dsl
+    jitter = c_double(0)
+    packets_received = c_uint(0)
+    packets_lost = c_uint(0)
+    result = _dsl.dsl_source_decode_rtsp_stats_get(name, DSL_DOUBLE_P(jitter), 
+        DSL_UINT_P(packets_received), DSL_UINT_P(packets_lost))
+    return int(result), jitter.value, packets_received.value, packets_lost.value
+
+##
+## dsl_source_uri_switch()
+##
+_dsl.dsl_source_uri_switch.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_source_uri_switch.restype = c_uint
+def dsl_source_uri_switch(name, uri):
+    global _dsl
+    result = _dsl.dsl_source_uri_switch(name, uri)
+    return int(result)
+
+##
+## dsl_source_uri_switch_latency_get()
+##
+_dsl.dsl_source_uri_switch_latency_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_source_uri_switch_latency_get.restype = c_uint
+def dsl_source_uri_switch_latency_get(name):
+    global _dsl
+    latency = c_uint(0)
+    result = _dsl.dsl_source_uri_switch_latency_get(name, DSL_UINT_P(latency))
+    return int(result), latency.value 
+
 ##
 ## dsl_source_dimensions_get()
 ##
@@ -119,6 +329,30 @@ def dsl_source_frame_rate_get(name):
     result = _dsl.dsl_source_frame_rate_get(name, DSL_UINT_P(fps_n), DSL_UINT_P(fps_d))
     return int(result), fps_n.value, fps_d.value 
 
+##
+## dsl_source_dimensions_get_by_handle()
+##
+_dsl.dsl_source_dimensions_get_by_handle.argtypes = [c_uint, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_dimensions_get_by_handle.restype = c_uint
+def dsl_source_dimensions_get_by_handle(handle):
+    global _dsl
+    width = c_uint(0)
+    height = c_uint(0)
+    result = _dsl.dsl_source_dimensions_get_by_handle(handle, DSL_UINT_P(width), DSL_UINT_P(height))
+    return int(result), width.value, height.value 
+
+##
+## dsl_source_frame_rate_get_by_handle()
+##
+_dsl.dsl_source_frame_rate_get_by_handle.argtypes = [c_uint, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_source_frame_rate_get_by_handle.restype = c_uint
+def dsl_source_frame_rate_get_by_handle(handle):
+    global _dsl
+    fps_n = c_uint(0)
+    fps_d = c_uint(0)
+    result = _dsl.dsl_source_frame_rate_get_by_handle(handle, DSL_UINT_P(fps_n), DSL_UINT_P(fps_d))
+    return int(result), fps_n.value, fps_d.value 
+
 ##
 ## dsl_source_decode_uri_get()
 ##
@@ -1056,6 +1290,44 @@ def dsl_component_gpuid_set(name):
     result =_dsl.dsl_component_gpuid_set(gpuid)
     return int(result)
 
+##
+## dsl_component_queue_policy_get()
+##
+_dsl.dsl_component_queue_policy_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_uint), POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_component_queue_policy_get.restype = c_uint
+def dsl_component_queue_policy_get(name):
+    global _dsl
+    max_size_buffers = c_uint(0)
+    max_size_time = c_uint(0)
+    leaky = c_uint(0)
+    latency_budget = c_uint(0)
+    result = _dsl.dsl_component_queue_policy_get(name, DSL_UINT_P(max_size_buffers), 
+        DSL_UINT_P(max_size_time), DSL_UINT_P(leaky), DSL_UINT_P(latency_budget))
+    return int(result), max_size_buffers.value, max_size_time.value, leaky.value, latency_budget.value
+
+##
+## dsl_component_queue_policy_set()
+##
+_dsl.dsl_component_queue_policy_set.argtypes = [c_wchar_p, c_uint, c_uint, c_uint, c_uint]
+_dsl.dsl_component_queue_policy_set.restype = c_uint
+def dsl_component_queue_policy_set(name, max_size_buffers, max_size_time, leaky, latency_budget):
+    global _dsl
+    result = _dsl.dsl_component_queue_policy_set(name, 
+        max_size_buffers, max_size_time, leaky, latency_budget)
+    return int(result)
+
+##
+## dsl_component_queue_dropped_get()
+##
+_dsl.dsl_component_queue_dropped_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_component_queue_dropped_get.restype = c_uint
+def dsl_component_queue_dropped_get(name):
+    global _dsl
+    dropped = c_uint(0)
+    result = _dsl.dsl_component_queue_dropped_get(name, DSL_UINT_P(dropped))
+    return int(result), dropped.value
+
 ##
 ## dsl_component_gpuid_set_many()
 ##
@@ -1068,6 +1340,38 @@ def dsl_component_gpuid_set_many(components, gpuid):
     result =_dsl.dsl_component_gpuid_set_many(arr, gpuid)
     return int(result)
 
+##
+## dsl_component_handle_get()
+##
+_dsl.dsl_component_handle_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_component_handle_get.restype = c_uint
+def dsl_component_handle_get(name):
+    global _dsl
+    handle = c_uint(0)
+    result = _dsl.dsl_component_handle_get(name, DSL_UINT_P(handle))
+    return int(result), handle.value
+
+##
+## dsl_component_gpuid_get_by_handle()
+##
+_dsl.dsl_component_gpuid_get_by_handle.argtypes = [c_uint, POINTER(c_uint)]
+_dsl.dsl_component_gpuid_get_by_handle.restype = c_uint
+def dsl_component_gpuid_get_by_handle(handle):
+    global _dsl
+    gpuid = c_uint(0)
+    result = _dsl.dsl_component_gpuid_get_by_handle(handle, DSL_UINT_P(gpuid))
+    return int(result), gpuid.value
+
+##
+## dsl_component_gpuid_set_by_handle()
+##
+_dsl.dsl_component_gpuid_set_by_handle.argtypes = [c_uint, c_uint]
+_dsl.dsl_component_gpuid_set_by_handle.restype = c_uint
+def dsl_component_gpuid_set_by_handle(handle, gpuid):
+    global _dsl
+    result = _dsl.dsl_component_gpuid_set_by_handle(handle, gpuid)
+    return int(result)
+
 ##
 ## dsl_branch_new()
 ##
@@ -1145,6 +1449,33 @@ def dsl_branch_component_remove_many(branch, components):
     result =_dsl.dsl_branch_component_remove_many(branch, arr)
     return int(result)
 
+##
+## dsl_transaction_begin()
+##
+_dsl.dsl_transaction_begin.restype = c_uint
+def dsl_transaction_begin():
+    global _dsl
+    result = _dsl.dsl_transaction_begin()
+    return int(result)
+
+##
+## dsl_transaction_commit()
+##
+_dsl.dsl_transaction_commit.restype = c_uint
+def dsl_transaction_commit():
+    global _dsl
+    result = _dsl.dsl_transaction_commit()
+    return int(result)
+
+##
+## dsl_transaction_abort()
+##
+_dsl.dsl_transaction_abort.restype = c_uint
+def dsl_transaction_abort():
+    global _dsl
+    result = _dsl.dsl_transaction_abort()
+    return int(result)
+
 ##
 ## dsl_pipeline_new()
 ##
@@ -1263,6 +1594,29 @@ def dsl_pipeline_component_remove_many(pipeline, components):
     result =_dsl.dsl_pipeline_component_remove_many(pipeline, arr)
     return int(result)
 
+##
+## dsl_pipeline_load_definition()
+##
+_dsl.dsl_pipeline_load_definition.argtypes = [c_wchar_p, POINTER(c_wchar_p)]
+_dsl.dsl_pipeline_load_definition.restype = c_uint
+def dsl_pipeline_load_definition(definition):
+    global _dsl
+    report = c_wchar_p(0)
+    result = _dsl.dsl_pipeline_load_definition(definition, DSL_WCHAR_PP(report))
+    if report.value:
+        return int(result), report.value.split(';')
+    return int(result), []
+
+##
+## dsl_pipeline_save_definition()
+##
+_dsl.dsl_pipeline_save_definition.argtypes = [c_wchar_p, c_wchar_p]
+_dsl.dsl_pipeline_save_definition.restype = c_uint
+def dsl_pipeline_save_definition(pipeline, path):
+    global _dsl
+    result = _dsl.dsl_pipeline_save_definition(pipeline, path)
+    return int(result)
+
 ##
 ## dsl_pipeline_streammux_batch_properties_get()
 ##
@@ -1328,6 +1682,324 @@ def dsl_pipeline_streammux_padding_set(name, enabled):
     result = _dsl.dsl_pipeline_streammux_padding_set(name, enabled)
     return int(result)
 
+##
+## dsl_pipeline_surface_budget_get()
+##
+_dsl.dsl_pipeline_surface_budget_get.argtypes = [c_wchar_p, POINTER(c_uint), POINTER(c_uint)]
+_dsl.dsl_pipeline_surface_budget_get.restype = c_uint
+def dsl_pipeline_surface_budget_get(name):
+    global _dsl
+    budget = c_uint(0)
+    policy = c_uint(0)
+    result = _dsl.dsl_pipeline_surface_budget_get(name, DSL_UINT_P(budget), DSL_UINT_P(policy))
+    return int(result), budget.value, policy.value 
+
+##
+## dsl_pipeline_surface_budget_set()
+##
+_dsl.dsl_pipeline_surface_budget_set.argtypes = [c_wchar_p, c_uint, c_uint]
+_dsl.dsl_pipeline_surface_budget_set.restype = c_uint
+def dsl_pipeline_surface_budget_set(name, budget, policy):
+    global _dsl
+    result = _dsl.dsl_pipeline_surface_budget_set(name, budget, policy)
+    return int(result)
+
+##
+## dsl_pipeline_surface_memory_get()
+##
+_dsl.dsl_pipeline_surface_memory_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pipeline_surface_memory_get.restype = c_uint
+def dsl_pipeline_surface_memory_get(name):
+    global _dsl
+    size = c_uint(0)
+    result = _dsl.dsl_pipeline_surface_memory_get(name, DSL_UINT_P(size))
+    return int(result), size.value 
+
+##
+## dsl_pipeline_latency_tracing_enabled_get()
+##
+_dsl.dsl_pipeline_latency_tracing_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_latency_tracing_enabled_get.restype = c_uint
+def dsl_pipeline_latency_tracing_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_latency_tracing_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value 
+
+##
+## dsl_pipeline_latency_tracing_enabled_set()
+##
+_dsl.dsl_pipeline_latency_tracing_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_latency_tracing_enabled_set.restype = c_uint
+def dsl_pipeline_latency_tracing_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_latency_tracing_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_link_optimization_enabled_get()
+##
+_dsl.dsl_pipeline_link_optimization_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_link_optimization_enabled_get.restype = c_uint
+def dsl_pipeline_link_optimization_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_link_optimization_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value 
+
+##
+## dsl_pipeline_link_optimization_enabled_set()
+##
+_dsl.dsl_pipeline_link_optimization_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_link_optimization_enabled_set.restype = c_uint
+def dsl_pipeline_link_optimization_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_link_optimization_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_link_optimization_report_get()
+##
+_dsl.dsl_pipeline_link_optimization_report_get.argtypes = [c_wchar_p, POINTER(c_wchar_p)]
+_dsl.dsl_pipeline_link_optimization_report_get.restype = c_uint
+def dsl_pipeline_link_optimization_report_get(name):
+    global _dsl
+    report = c_wchar_p(0)
+    result = _dsl.dsl_pipeline_link_optimization_report_get(name, DSL_WCHAR_PP(report))
+    return int(result), report.value 
+
+##
+## dsl_pipeline_thread_role_affinity_get()
+##
+_dsl.dsl_pipeline_thread_role_affinity_get.argtypes = [c_wchar_p, c_uint, 
+    POINTER(c_wchar_p), POINTER(c_int)]
+_dsl.dsl_pipeline_thread_role_affinity_get.restype = c_uint
+def dsl_pipeline_thread_role_affinity_get(name, role):
+    global _dsl
+    cpus = c_wchar_p(0)
+    priority = c_int(0)
+    result = _dsl.dsl_pipeline_thread_role_affinity_get(name, role, 
+        DSL_WCHAR_PP(cpus), DSL_INT_P(priority))
+    return int(result), cpus.value, priority.value 
+
+##
+## dsl_pipeline_thread_role_affinity_set()
+##
+_dsl.dsl_pipeline_thread_role_affinity_set.argtypes = [c_wchar_p, c_uint, c_wchar_p, c_int]
+_dsl.dsl_pipeline_thread_role_affinity_set.restype = c_uint
+def dsl_pipeline_thread_role_affinity_set(name, role, cpus, priority):
+    global _dsl
+    result = _dsl.dsl_pipeline_thread_role_affinity_set(name, role, cpus, priority)
+    return int(result)
+
+##
+## dsl_pipeline_thread_report_get()
+##
+_dsl.dsl_pipeline_thread_report_get.argtypes = [c_wchar_p, POINTER(c_wchar_p)]
+_dsl.dsl_pipeline_thread_report_get.restype = c_uint
+def dsl_pipeline_thread_report_get(name):
+    global _dsl
+    report = c_wchar_p(0)
+    result = _dsl.dsl_pipeline_thread_report_get(name, DSL_WCHAR_PP(report))
+    return int(result), report.value 
+
+##
+## dsl_pipeline_latency_report_get()
+##
+_dsl.dsl_pipeline_latency_report_get.argtypes = [c_wchar_p, POINTER(c_wchar_p)]
+_dsl.dsl_pipeline_latency_report_get.restype = c_uint
+def dsl_pipeline_latency_report_get(name):
+    global _dsl
+    report = c_wchar_p(0)
+    result = _dsl.dsl_pipeline_latency_report_get(name, DSL_WCHAR_PP(report))
+    return int(result), report.value 
+
+##
+## dsl_pipeline_perf_enabled_get()
+##
+_dsl.dsl_pipeline_perf_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_perf_enabled_get.restype = c_uint
+def dsl_pipeline_perf_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_perf_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value 
+
+##
+## dsl_pipeline_perf_enabled_set()
+##
+_dsl.dsl_pipeline_perf_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_perf_enabled_set.restype = c_uint
+def dsl_pipeline_perf_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_perf_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_perf_interval_get()
+##
+_dsl.dsl_pipeline_perf_interval_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pipeline_perf_interval_get.restype = c_uint
+def dsl_pipeline_perf_interval_get(name):
+    global _dsl
+    interval = c_uint(0)
+    result = _dsl.dsl_pipeline_perf_interval_get(name, DSL_UINT_P(interval))
+    return int(result), interval.value 
+
+##
+## dsl_pipeline_perf_interval_set()
+##
+_dsl.dsl_pipeline_perf_interval_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_pipeline_perf_interval_set.restype = c_uint
+def dsl_pipeline_perf_interval_set(name, interval):
+    global _dsl
+    result = _dsl.dsl_pipeline_perf_interval_set(name, interval)
+    return int(result)
+
+##
+## dsl_pipeline_perf_get()
+##
+_dsl.dsl_pipeline_perf_get.argtypes = [c_wchar_p, c_uint, POINTER(c_double), 
+    POINTER(c_double), POINTER(c_double), POINTER(c_double), POINTER(c_uint)]
+_dsl.dsl_pipeline_perf_get.restype = c_uint
+def dsl_pipeline_perf_get(name, source_id):
+    global _dsl
+    fps = c_double(0)
+    latency_p50 = c_double(0)
+    latency_p95 = c_double(0)
+    latency_p99 = c_double(0)
+    drops = c_uint(0)
+    result = _dsl.dsl_pipeline_perf_get(name, source_id, DSL_DOUBLE_P(fps), 
+        DSL_DOUBLE_P(latency_p50), DSL_DOUBLE_P(latency_p95), DSL_DOUBLE_P(latency_p99), 
+        DSL_UINT_P(drops))
+    return int(result), fps.value, latency_p50.value, latency_p95.value, latency_p99.value, drops.value 
+
+##
+## dsl_pipeline_perf_listener_add()
+##
+_dsl.dsl_pipeline_perf_listener_add.argtypes = [c_wchar_p, DSL_PERF_LISTENER, c_void_p]
+_dsl.dsl_pipeline_perf_listener_add.restype = c_uint
+def dsl_pipeline_perf_listener_add(name, listener, user_data):
+    global _dsl
+    client_listener = DSL_PERF_LISTENER(listener)
+    callbacks.append(client_listener)
+    result = _dsl.dsl_pipeline_perf_listener_add(name, client_listener, user_data)
+    return int(result)
+    
+##
+## dsl_pipeline_perf_listener_remove()
+##
+_dsl.dsl_pipeline_perf_listener_remove.argtypes = [c_wchar_p, DSL_PERF_LISTENER]
+_dsl.dsl_pipeline_perf_listener_remove.restype = c_uint
+def dsl_pipeline_perf_listener_remove(name, listener):
+    global _dsl
+    client_listener = DSL_PERF_LISTENER(listener)
+    result = _dsl.dsl_pipeline_perf_listener_remove(name, client_listener)
+    return int(result)
+
+##
+## dsl_pipeline_sgie_link_mode_get()
+##
+_dsl.dsl_pipeline_sgie_link_mode_get.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pipeline_sgie_link_mode_get.restype = c_uint
+def dsl_pipeline_sgie_link_mode_get(name):
+    global _dsl
+    mode = c_uint(0)
+    result = _dsl.dsl_pipeline_sgie_link_mode_get(name, DSL_UINT_P(mode))
+    return int(result), mode.value 
+
+##
+## dsl_pipeline_sgie_link_mode_set()
+##
+_dsl.dsl_pipeline_sgie_link_mode_set.argtypes = [c_wchar_p, c_uint]
+_dsl.dsl_pipeline_sgie_link_mode_set.restype = c_uint
+def dsl_pipeline_sgie_link_mode_set(name, mode):
+    global _dsl
+    result = _dsl.dsl_pipeline_sgie_link_mode_set(name, mode)
+    return int(result)
+
+##
+## dsl_pipeline_classification_cache_enabled_get()
+##
+_dsl.dsl_pipeline_classification_cache_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_classification_cache_enabled_get.restype = c_uint
+def dsl_pipeline_classification_cache_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_classification_cache_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value 
+
+##
+## dsl_pipeline_classification_cache_enabled_set()
+##
+_dsl.dsl_pipeline_classification_cache_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_classification_cache_enabled_set.restype = c_uint
+def dsl_pipeline_classification_cache_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_classification_cache_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_classification_cache_settings_get()
+##
+_dsl.dsl_pipeline_classification_cache_settings_get.argtypes = [c_wchar_p, 
+    POINTER(c_uint), POINTER(c_double), POINTER(c_uint)]
+_dsl.dsl_pipeline_classification_cache_settings_get.restype = c_uint
+def dsl_pipeline_classification_cache_settings_get(name):
+    global _dsl
+    min_count = c_uint(0)
+    min_confidence = c_double(0)
+    ttl = c_uint(0)
+    result = _dsl.dsl_pipeline_classification_cache_settings_get(name, 
+        DSL_UINT_P(min_count), DSL_DOUBLE_P(min_confidence), DSL_UINT_P(ttl))
+    return int(result), min_count.value, min_confidence.value, ttl.value 
+
+##
+## dsl_pipeline_classification_cache_settings_set()
+##
+_dsl.dsl_pipeline_classification_cache_settings_set.argtypes = [c_wchar_p, 
+    c_uint, c_double, c_uint]
+_dsl.dsl_pipeline_classification_cache_settings_set.restype = c_uint
+def dsl_pipeline_classification_cache_settings_set(name, min_count, min_confidence, ttl):
+    global _dsl
+    result = _dsl.dsl_pipeline_classification_cache_settings_set(name, 
+        min_count, min_confidence, ttl)
+    return int(result)
+
+##
+## dsl_pipeline_classification_cache_stats_get()
+##
+_dsl.dsl_pipeline_classification_cache_stats_get.argtypes = [c_wchar_p, 
+    POINTER(c_double), POINTER(c_uint)]
+_dsl.dsl_pipeline_classification_cache_stats_get.restype = c_uint
+def dsl_pipeline_classification_cache_stats_get(name):
+    global _dsl
+    hit_rate = c_double(0)
+    entries = c_uint(0)
+    result = _dsl.dsl_pipeline_classification_cache_stats_get(name, 
+        DSL_DOUBLE_P(hit_rate), DSL_UINT_P(entries))
+    return int(result), hit_rate.value, entries.value 
+
+##
+## dsl_pipeline_trace_start()
+##
+_dsl.dsl_pipeline_trace_start.argtypes = [c_wchar_p, c_wchar_p, c_uint]
+_dsl.dsl_pipeline_trace_start.restype = c_uint
+def dsl_pipeline_trace_start(name, file_path, format):
+    global _dsl
+    result = _dsl.dsl_pipeline_trace_start(name, file_path, format)
+    return int(result)
+
+##
+## dsl_pipeline_trace_stop()
+##
+_dsl.dsl_pipeline_trace_stop.argtypes = [c_wchar_p]
+_dsl.dsl_pipeline_trace_stop.restype = c_uint
+def dsl_pipeline_trace_stop(name):
+    global _dsl
+    result = _dsl.dsl_pipeline_trace_stop(name)
+    return int(result)
+
 ##
 ## dsl_pipeline_xwindow_clear()
 ##
@@ -1370,6 +2042,29 @@ def dsl_pipeline_pause(name):
     result =_dsl.dsl_pipeline_pause(name)
     return int(result)
 
+##
+## dsl_pipeline_prepare()
+##
+_dsl.dsl_pipeline_prepare.argtypes = [c_wchar_p, DSL_PREPARE_COMPLETE_LISTENER, c_void_p]
+_dsl.dsl_pipeline_prepare.restype = c_uint
+def dsl_pipeline_prepare(name, listener, user_data):
+    global _dsl
+    client_listener = DSL_PREPARE_COMPLETE_LISTENER(listener)
+    callbacks.append(client_listener)
+    result = _dsl.dsl_pipeline_prepare(name, client_listener, user_data)
+    return int(result)
+
+##
+## dsl_pipeline_prepare_report_get()
+##
+_dsl.dsl_pipeline_prepare_report_get.argtypes = [c_wchar_p, POINTER(c_wchar_p)]
+_dsl.dsl_pipeline_prepare_report_get.restype = c_uint
+def dsl_pipeline_prepare_report_get(name):
+    global _dsl
+    report = c_wchar_p(0)
+    result = _dsl.dsl_pipeline_prepare_report_get(name, DSL_WCHAR_PP(report))
+    return int(result), report.value 
+
 ##
 ## dsl_pipeline_play()
 ##
@@ -1525,6 +2220,49 @@ def dsl_pipeline_xwindow_delete_event_handler_remove(name, handler):
     result = _dsl.dsl_pipeline_xwindow_delete_event_handler_remove(name, client_handler)
     return int(result)
 
+##
+## dsl_pipeline_main_context_enabled_get()
+##
+_dsl.dsl_pipeline_main_context_enabled_get.argtypes = [c_wchar_p, POINTER(c_bool)]
+_dsl.dsl_pipeline_main_context_enabled_get.restype = c_uint
+def dsl_pipeline_main_context_enabled_get(name):
+    global _dsl
+    enabled = c_bool(0)
+    result = _dsl.dsl_pipeline_main_context_enabled_get(name, DSL_BOOL_P(enabled))
+    return int(result), enabled.value 
+
+##
+## dsl_pipeline_main_context_enabled_set()
+##
+_dsl.dsl_pipeline_main_context_enabled_set.argtypes = [c_wchar_p, c_bool]
+_dsl.dsl_pipeline_main_context_enabled_set.restype = c_uint
+def dsl_pipeline_main_context_enabled_set(name, enabled):
+    global _dsl
+    result = _dsl.dsl_pipeline_main_context_enabled_set(name, enabled)
+    return int(result)
+
+##
+## dsl_pipeline_event_fd_get()
+##
+_dsl.dsl_pipeline_event_fd_get.argtypes = [c_wchar_p, POINTER(c_int)]
+_dsl.dsl_pipeline_event_fd_get.restype = c_uint
+def dsl_pipeline_event_fd_get(name):
+    global _dsl
+    fd = c_int(-1)
+    result = _dsl.dsl_pipeline_event_fd_get(name, DSL_INT_P(fd))
+    return int(result), fd.value 
+
+##
+## dsl_pipeline_events_dispatch()
+##
+_dsl.dsl_pipeline_events_dispatch.argtypes = [c_wchar_p, POINTER(c_uint)]
+_dsl.dsl_pipeline_events_dispatch.restype = c_uint
+def dsl_pipeline_events_dispatch(name):
+    global _dsl
+    count = c_uint(0)
+    result = _dsl.dsl_pipeline_events_dispatch(name, DSL_UINT_P(count))
+    return int(result), count.value 
+
 ##
 ## dsl_main_loop_run()
 ##
@@ -35,17 +35,23 @@ THE SOFTWARE.
 
 #include <iostream> 
 #include <sstream>
+#include <iomanip>
 #include <vector>
+#include <deque>
 #include <map> 
+#include <set>
 #include <memory> 
 #include <fstream>
 #include <thread>
+#include <atomic>
 #include <chrono>
 #include <unordered_map>
 #include <typeinfo>
 #include <algorithm>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
 
 #include <deepstream_common.h>
 #include <deepstream_config.h>
@@ -55,5 +61,6 @@ THE SOFTWARE.
 
 #include "DslMutex.h"
 #include "DslLog.h"
+#include "DslTraceRecorder.h"
 
 #endif // _DSL_H
\ No newline at end of file
@@ -51,6 +51,9 @@ THE SOFTWARE.
 #define DSL_RESULT_COMPONENT_NOT_USED_BY_BRANCH                     0x00010006
 #define DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE                   0x00010007
 #define DSL_RESULT_COMPONENT_SET_GPUID_FAILED                       0x00010008
+#define DSL_RESULT_COMPONENT_HANDLE_NOT_FOUND                       0x00010009
+#define DSL_RESULT_COMPONENT_HANDLE_GET_FAILED                      0x0001000A
+#define DSL_RESULT_COMPONENT_QUEUE_POLICY_SET_FAILED                0x0001000B
 
 /**
  * Source API Return Values
@@ -69,6 +72,10 @@ THE SOFTWARE.
 #define DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED                       0x0002000B
 #define DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED                    0x0002000C
 #define DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE                   0x0002000D
+#define DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED                       0x0002000E
+#define DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED                    0x0002000F
+#define DSL_RESULT_SOURCE_SWITCH_FAILED                             0x00020010
+#define DSL_RESULT_SOURCE_SET_FAILED                                0x00020011
 
 /**
  * Dewarper API Return Values
@@ -219,6 +226,22 @@ THE SOFTWARE.
 #define DSL_RESULT_PIPELINE_FAILED_TO_STOP                          0x00080011
 #define DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED               0x00080012
 #define DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED                 0x00080013
+#define DSL_RESULT_PIPELINE_SURFACE_BUDGET_SET_FAILED               0x00080014
+#define DSL_RESULT_PIPELINE_PERF_GET_FAILED                         0x00080015
+#define DSL_RESULT_PIPELINE_PERF_SET_FAILED                         0x00080016
+#define DSL_RESULT_PIPELINE_TRACE_FAILED                            0x00080017
+#define DSL_RESULT_PIPELINE_CACHE_GET_FAILED                        0x00080018
+#define DSL_RESULT_PIPELINE_CACHE_SET_FAILED                        0x00080019
+#define DSL_RESULT_PIPELINE_SGIE_LINK_MODE_SET_FAILED               0x0008001A
+#define DSL_RESULT_PIPELINE_MAIN_CONTEXT_SET_FAILED                 0x0008001B
+#define DSL_RESULT_PIPELINE_EVENT_FD_FAILED                         0x0008001C
+#define DSL_RESULT_PIPELINE_DEFINITION_LOAD_FAILED                  0x0008001D
+#define DSL_RESULT_PIPELINE_DEFINITION_SAVE_FAILED                  0x0008001E
+#define DSL_RESULT_PIPELINE_FAILED_TO_PREPARE                       0x0008001F
+#define DSL_RESULT_PIPELINE_LINK_OPTIMIZATION_SET_FAILED            0x00080020
+#define DSL_RESULT_PIPELINE_DEFINITION_INVALID                      0x00080021
+#define DSL_RESULT_PIPELINE_THREAD_AFFINITY_GET_FAILED              0x00080022
+#define DSL_RESULT_PIPELINE_THREAD_AFFINITY_SET_FAILED              0x00080023
 
 #define DSL_RESULT_BRANCH_RESULT                                    0x000B0000
 #define DSL_RESULT_BRANCH_NAME_NOT_UNIQUE                           0x000B0001
@@ -230,6 +253,14 @@ THE SOFTWARE.
 #define DSL_RESULT_BRANCH_SOURCE_NOT_ALLOWED                        0x000B0007
 #define DSL_RESULT_BRANCH_SINK_MAX_IN_USE_REACHED                   0x000B0008
 
+/**
+ * Transaction API Return Values
+ */
+#define DSL_RESULT_TRANSACTION_RESULT                               0x000D0000
+#define DSL_RESULT_TRANSACTION_IN_PROGRESS                          0x000D0001
+#define DSL_RESULT_TRANSACTION_NOT_IN_PROGRESS                      0x000D0002
+#define DSL_RESULT_TRANSACTION_VALIDATION_FAILED                    0x000D0003
+
 #define DSL_CUDADEC_MEMTYPE_DEVICE                                  0
 #define DSL_CUDADEC_MEMTYPE_PINNED                                  1
 #define DSL_CUDADEC_MEMTYPE_UNIFIED                                 2
@@ -256,6 +287,36 @@ THE SOFTWARE.
 #define DSL_RTP_TCP                                                 0x04
 #define DSL_RTP_ALL                                                 0x07
 
+#define DSL_RTSP_BUFFER_MODE_NONE                                   0
+#define DSL_RTSP_BUFFER_MODE_SLAVE                                  1
+#define DSL_RTSP_BUFFER_MODE_BUFFER                                 2
+#define DSL_RTSP_BUFFER_MODE_AUTO                                   3
+#define DSL_RTSP_BUFFER_MODE_SYNCED                                 4
+
+#define DSL_RTSP_PRESET_ULTRA_LOW_LATENCY                           0
+#define DSL_RTSP_PRESET_ROBUST                                      1
+
+#define DSL_SURFACE_BUDGET_POLICY_REFUSE                            0
+#define DSL_SURFACE_BUDGET_POLICY_SHRINK                            1
+
+#define DSL_PLAYLIST_FILE_STARTED                                   0
+#define DSL_PLAYLIST_FILE_ENDED                                     1
+
+#define DSL_TRACE_FORMAT_CHROME_JSON                                0
+#define DSL_TRACE_FORMAT_PERFETTO                                   1
+
+#define DSL_SGIE_LINK_MODE_PARALLEL                                 0
+#define DSL_SGIE_LINK_MODE_SERIAL                                   1
+
+#define DSL_THREAD_ROLE_DECODE                                      0
+#define DSL_THREAD_ROLE_INFERENCE                                   1
+#define DSL_THREAD_ROLE_SINK                                        2
+#define DSL_THREAD_ROLE_OTHER                                       3
+
+#define DSL_QUEUE_LEAKY_NO                                          0
+#define DSL_QUEUE_LEAKY_UPSTREAM                                    1
+#define DSL_QUEUE_LEAKY_DOWNSTREAM                                  2
+
 /**
  * @brief DSL_DEFAULT values initialized on first call to DSL
  */
@@ -266,12 +327,26 @@ THE SOFTWARE.
 #define DSL_DEFAULT_STREAMMUX_WIDTH                                 1920
 #define DSL_DEFAULT_STREAMMUX_HEIGHT                                1080
 #define DSL_DEFAULT_STATE_CHANGE_TIMEOUT_IN_SEC                     10
+#define DSL_DEFAULT_MULTI_IMAGE_READAHEAD                           8
+#define DSL_DEFAULT_RTSP_TIMEOUT                                    5000
+#define DSL_DEFAULT_PERF_INTERVAL                                   1000
+#define DSL_DEFAULT_CLASSIFICATION_CACHE_MIN_COUNT                  3
+#define DSL_DEFAULT_CLASSIFICATION_CACHE_MIN_CONFIDENCE             0.8
+#define DSL_DEFAULT_CLASSIFICATION_CACHE_TTL                        2000
+#define DSL_DEFAULT_QUEUE_MAX_SIZE_BUFFERS                          200
+#define DSL_DEFAULT_QUEUE_MAX_SIZE_TIME                             1000
 
 EXTERN_C_BEGIN
 
 typedef uint DslReturnType;
 typedef uint boolean;
 
+/**
+ * @brief opaque handle to a Component, resolved once by name with 
+ * dsl_component_handle_get. Handles become invalid when the Component is deleted.
+ */
+typedef uint DslHandle;
+
 /**
  * @brief callback typedef for a client batch meta handler function. Once added to a Component, 
  * the function will be called when the component receives a batch meta buffer.
@@ -296,6 +371,29 @@ typedef void (*dsl_state_change_listener_cb)(uint prev_state, uint curr_state, v
  */
 typedef void (*dsl_eos_listener_cb)(void* user_data);
 
+/**
+ * @brief callback typedef for a client listener function. Once a Pipeline has
+ * been prepared, the function will be called with the result of the preroll.
+ * @param[in] result DSL_RESULT_SUCCESS if the Pipeline reached PAUSED, 
+ * DSL_RESULT_PIPELINE_FAILED_TO_PREPARE otherwise
+ * @param[in] user_data opaque pointer to client's data
+ */
+typedef void (*dsl_prepare_complete_cb)(uint result, void* user_data);
+
+/**
+ * @brief callback typedef for a client perf listener function. Once added to a Pipeline, 
+ * the function will be called for each Source at the end of every perf reporting interval
+ * @param[in] source_id unique id of the Source reported
+ * @param[in] fps rolling frames per second over the last interval
+ * @param[in] latency_p50 50th percentile capture-to-sink latency over the last interval in ms
+ * @param[in] latency_p95 95th percentile capture-to-sink latency over the last interval in ms
+ * @param[in] latency_p99 99th percentile capture-to-sink latency over the last interval in ms
+ * @param[in] drops total number of frames dropped
+ * @param[in] user_data opaque pointer to client's data
+ */
+typedef void (*dsl_perf_listener_cb)(uint source_id, double fps, double latency_p50, 
+    double latency_p95, double latency_p99, uint drops, void* user_data);
+
 /**
  * @brief callback typedef for a client XWindow KeyRelease event handler function. Once added to a Pipeline, 
  * the function will be called when the Pipeline receives XWindow KeyRelease events.
@@ -320,6 +418,19 @@ typedef void (*dsl_xwindow_button_event_handler_cb)(uint xpos, uint ypos, void*
  */
 typedef void (*dsl_xwindow_delete_event_handler_cb)(void* user_data);
 
+/**
+ * @brief callback typedef for a client playlist file listener function. Once added to a 
+ * URI Source, the function will be called when each file in the Source's playlist
+ * starts and ends.
+ * @param[in] event one of DSL_PLAYLIST_FILE_STARTED or DSL_PLAYLIST_FILE_ENDED
+ * @param[in] uri URI of the file that started or ended
+ * @param[in] frames number of frames output for the file, 0 on DSL_PLAYLIST_FILE_STARTED
+ * @param[in] fps average frames per second for the file, 0 on DSL_PLAYLIST_FILE_STARTED
+ * @param[in] user_data opaque pointer to client's user data
+ */
+typedef void (*dsl_playlist_file_listener_cb)(uint event, 
+    const wchar_t* uri, uint frames, double fps, void* user_data);
+
 /**
  * @brief creates a new, uniquely named CSI Camera Source component
  * @param[in] name unique name for the new Source
@@ -366,6 +477,29 @@ DslReturnType dsl_source_uri_new(const wchar_t* name, const wchar_t* uri, boolea
 DslReturnType dsl_source_rtsp_new(const wchar_t* name, const wchar_t* uri, uint protocol,
     uint cudadec_mem_type, uint intra_decode, uint drop_frame_interval);
 
+/**
+ * @brief creates a new, uniquely named Multi Image Source component. The Source
+ * reads a folder or glob of JPEG/PNG files, or a multipart M-JPEG file, and 
+ * outputs decoded frames as fast as downstream allows, without clock sync.
+ * @param[in] name unique name for the new Source
+ * @param[in] location folder, glob pattern (e.g. "./images/*.jpg"), or M-JPEG file
+ * @param[in] readahead maximum number of files to read ahead of the decoder,
+ * use DSL_DEFAULT_MULTI_IMAGE_READAHEAD
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_image_multi_new(const wchar_t* name, 
+    const wchar_t* location, uint readahead);
+
+/**
+ * @brief returns the current file processing statistics for a named Multi Image Source
+ * @param[in] name unique name of the Multi Image Source to query
+ * @param[out] files_read number of files (or M-JPEG frames) output since play
+ * @param[out] files_per_second average output rate since the first frame
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_image_multi_stats_get(const wchar_t* name, 
+    uint* files_read, double* files_per_second);
+
 /**
  * @brief returns the frame rate of the name source as a fraction
  * Camera sources will return the value used on source creation
@@ -388,6 +522,30 @@ DslReturnType dsl_source_dimensions_get(const wchar_t* name, uint* width, uint*
  */
 DslReturnType dsl_source_frame_rate_get(const wchar_t* name, uint* fps_n, uint* fps_d);
 
+/**
+ * @brief dsl_source_dimensions_get for a Source handle
+ * @param[in] source handle of the Source to query
+ */
+DslReturnType dsl_source_dimensions_get_by_handle(DslHandle source, uint* width, uint* height);
+
+/**
+ * @brief dsl_source_dimensions_get for a UTF-8 Source name
+ * @param[in] name UTF-8 name of the Source to query
+ */
+DslReturnType dsl_source_dimensions_get_utf8(const char* name, uint* width, uint* height);
+
+/**
+ * @brief dsl_source_frame_rate_get for a Source handle
+ * @param[in] source handle of the Source to query
+ */
+DslReturnType dsl_source_frame_rate_get_by_handle(DslHandle source, uint* fps_n, uint* fps_d);
+
+/**
+ * @brief dsl_source_frame_rate_get for a UTF-8 Source name
+ * @param[in] name UTF-8 name of the Source to query
+ */
+DslReturnType dsl_source_frame_rate_get_utf8(const char* name, uint* fps_n, uint* fps_d);
+
 /**
  * @brief Gets the current URI in use by the named Decode Source
  * @param[in] name name of the Source to query
@@ -404,6 +562,148 @@ DslReturnType dsl_source_decode_uri_get(const wchar_t* name, const wchar_t** uri
  */
 DslReturnType dsl_source_decode_uri_set(const wchar_t* name, const wchar_t* uri);
 
+/**
+ * @brief Appends a file URI to the playlist of a named URI Source. On EOS of its 
+ * current file, the Source swaps in a new decoder for the next file while all
+ * downstream components remain linked and playing. The next file is read ahead
+ * into the page cache, but its demuxer and decoder are only created on swap.
+ * The Pipeline receives EOS after the last file in the playlist ends.
+ * @param[in] name name of the URI Source to update
+ * @param[in] uri file URI to append to the playlist
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_playlist_add(const wchar_t* name, const wchar_t* uri);
+
+/**
+ * @brief Clears all file URIs from the playlist of a named URI Source.
+ * Files currently playing or read ahead as the next file are not affected.
+ * @param[in] name name of the URI Source to update
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_playlist_clear(const wchar_t* name);
+
+/**
+ * @brief Gets the number of file URIs in the playlist of a named URI Source
+ * @param[in] name name of the URI Source to query
+ * @param[out] size number of file URIs in the playlist
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_playlist_size_get(const wchar_t* name, uint* size);
+
+/**
+ * @brief adds a callback to be notified as each file in a URI Source's playlist 
+ * starts and ends. The initial URI of the Source is reported as the first file.
+ * @param[in] name name of the URI Source to update
+ * @param[in] listener pointer to the client's function to call on file start and end
+ * @param[in] user_data opaque pointer to client data passed into the listener function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_playlist_file_listener_add(const wchar_t* name, 
+    dsl_playlist_file_listener_cb listener, void* user_data);
+
+/**
+ * @brief removes a callback previously added with dsl_source_uri_playlist_file_listener_add
+ * @param[in] name name of the URI Source to update
+ * @param[in] listener pointer to the client's function to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_playlist_file_listener_remove(const wchar_t* name, 
+    dsl_playlist_file_listener_cb listener);
+
+/**
+ * @brief Gets the decoder surface counts for a named Decode Source (URI, RTSP)
+ * @param[in] name name of the Source to query
+ * @param[out] num_decode_surfaces number of decoder output surfaces
+ * @param[out] num_extra_surfaces number of extra surfaces for downstream components
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_decode_surfaces_get(const wchar_t* name, 
+    uint* num_decode_surfaces, uint* num_extra_surfaces);
+
+/**
+ * @brief Sets the decoder surface counts for a named Decode Source (URI, RTSP)
+ * The Source must not be linked, i.e. its Pipeline must be stopped.
+ * @param[in] name name of the Source to update
+ * @param[in] num_decode_surfaces number of decoder output surfaces, > 0
+ * @param[in] num_extra_surfaces number of extra surfaces for downstream components
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_decode_surfaces_set(const wchar_t* name, 
+    uint num_decode_surfaces, uint num_extra_surfaces);
+
+/**
+ * @brief Gets the RTSP ingest settings for a named Decode Source (URI, RTSP)
+ * @param[in] name name of the Source to query
+ * @param[out] latency jitterbuffer latency in milliseconds
+ * @param[out] drop_on_latency if true, packets later than latency are dropped
+ * @param[out] do_retransmission if true, lost packets are requested again
+ * @param[out] protocols allowed RTP protocols [ DSL_RTP_TCP | DSL_RTP_ALL ]
+ * @param[out] buffer_mode one of the DSL_RTSP_BUFFER_MODE constant values
+ * @param[out] timeout UDP and TCP receive timeout in milliseconds
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_decode_rtsp_config_get(const wchar_t* name, uint* latency,
+    boolean* drop_on_latency, boolean* do_retransmission, uint* protocols, 
+    uint* buffer_mode, uint* timeout);
+
+/**
+ * @brief Sets the RTSP ingest settings for a named Decode Source (URI, RTSP).
+ * A URI Source applies the settings when its URI is an rtsp URI.
+ * @param[in] name name of the Source to update
+ * @param[in] latency jitterbuffer latency in milliseconds
+ * @param[in] drop_on_latency if true, packets later than latency are dropped
+ * @param[in] do_retransmission if true, lost packets are requested again
+ * @param[in] protocols allowed RTP protocols [ DSL_RTP_TCP | DSL_RTP_ALL ].
+ * With DSL_RTP_ALL, UDP is tried first with fallback to TCP on timeout.
+ * @param[in] buffer_mode one of the DSL_RTSP_BUFFER_MODE constant values
+ * @param[in] timeout UDP and TCP receive timeout in milliseconds
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_decode_rtsp_config_set(const wchar_t* name, uint latency,
+    boolean drop_on_latency, boolean do_retransmission, uint protocols, 
+    uint buffer_mode, uint timeout);
+
+/**
+ * @brief Sets the RTSP ingest settings for a named Decode Source to a preset
+ * @param[in] name name of the Source to update
+ * @param[in] preset one of the DSL_RTSP_PRESET constant values
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_decode_rtsp_preset_set(const wchar_t* name, uint preset);
+
+/**
+ * @brief Gets the network statistics for a named Decode Source's RTSP stream.
+ * All values are 0 until the RTSP session is established, and once the Source
+ * is unlinked. Each new session restarts the statistics.
+ * @param[in] name name of the Source to query
+ * @param[out] jitter current interarrival jitter in milliseconds
+ * @param[out] packets_received total RTP packets received
+ * @param[out] packets_lost total RTP packets lost
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_decode_rtsp_stats_get(const wchar_t* name, double* jitter,
+    uint* packets_received, uint* packets_lost);
+
+/**
+ * @brief Switches a named URI Source to a new URI while playing. The new URI is
+ * prerolled in a standby decoder and swapped in on its first decoded frame, keeping
+ * the Source's StreamMux pad and source-id. The current URI plays until the swap.
+ * The URI is set directly if the Source is not playing.
+ * @param[in] name name of the URI Source to update
+ * @param[in] uri new URI to switch to
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_switch(const wchar_t* name, const wchar_t* uri);
+
+/**
+ * @brief Gets the latency of the last completed switch for a named URI Source,
+ * measured from the call to dsl_source_uri_switch to the first frame of the new URI.
+ * @param[in] name name of the URI Source to query
+ * @param[out] latency switch latency in milliseconds, 0 if no switch has completed
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_SOURCE_RESULT otherwise.
+ */
+DslReturnType dsl_source_uri_switch_latency_get(const wchar_t* name, uint* latency);
+
 /**
  * @brief Adds a named dewarper to a named decode source (URI, RTSP)
  * @param[in] name name of the source object to update
@@ -988,6 +1288,54 @@ DslReturnType dsl_tiler_tiles_get(const wchar_t* name, uint* cols, uint* rows);
  */
 DslReturnType dsl_tiler_tiles_set(const wchar_t* name, uint cols, uint rows);
 
+/**
+ * @brief dsl_tiler_dimensions_get for a Tiler handle
+ * @param[in] tiler handle of the Tiler to query
+ */
+DslReturnType dsl_tiler_dimensions_get_by_handle(DslHandle tiler, uint* width, uint* height);
+
+/**
+ * @brief dsl_tiler_dimensions_get for a UTF-8 Tiler name
+ * @param[in] name UTF-8 name of the Tiler to query
+ */
+DslReturnType dsl_tiler_dimensions_get_utf8(const char* name, uint* width, uint* height);
+
+/**
+ * @brief dsl_tiler_dimensions_set for a Tiler handle
+ * @param[in] tiler handle of the Tiler to update
+ */
+DslReturnType dsl_tiler_dimensions_set_by_handle(DslHandle tiler, uint width, uint height);
+
+/**
+ * @brief dsl_tiler_dimensions_set for a UTF-8 Tiler name
+ * @param[in] name UTF-8 name of the Tiler to update
+ */
+DslReturnType dsl_tiler_dimensions_set_utf8(const char* name, uint width, uint height);
+
+/**
+ * @brief dsl_tiler_tiles_get for a Tiler handle
+ * @param[in] tiler handle of the Tiler to query
+ */
+DslReturnType dsl_tiler_tiles_get_by_handle(DslHandle tiler, uint* cols, uint* rows);
+
+/**
+ * @brief dsl_tiler_tiles_get for a UTF-8 Tiler name
+ * @param[in] name UTF-8 name of the Tiler to query
+ */
+DslReturnType dsl_tiler_tiles_get_utf8(const char* name, uint* cols, uint* rows);
+
+/**
+ * @brief dsl_tiler_tiles_set for a Tiler handle
+ * @param[in] tiler handle of the Tiler to update
+ */
+DslReturnType dsl_tiler_tiles_set_by_handle(DslHandle tiler, uint cols, uint rows);
+
+/**
+ * @brief dsl_tiler_tiles_set for a UTF-8 Tiler name
+ * @param[in] name UTF-8 name of the Tiler to update
+ */
+DslReturnType dsl_tiler_tiles_set_utf8(const char* name, uint cols, uint rows);
+
 /**
  * @brief Adds a batch meta handler callback function to be called to process each frame buffer.
  * A Tiled Display can have multiple Sink and Source batch meta handlers
@@ -1300,6 +1648,83 @@ DslReturnType dsl_component_gpuid_set(const wchar_t* component, uint gpuid);
  */
 DslReturnType dsl_component_gpuid_set_many(const wchar_t** components, uint gpuid);
 
+/**
+ * @brief Gets the Queue policy for the named component. Sinks, Branches and the
+ * Sinks and Demuxer Tees support Queue policies.
+ * @param[in] component name of the component to query
+ * @param[out] max_size_buffers maximum number of buffers queued, 0 for no limit
+ * @param[out] max_size_time maximum time queued in milliseconds, 0 for no limit
+ * @param[out] leaky one of the DSL_QUEUE_LEAKY constant values
+ * @param[out] latency_budget maximum age of a frame leaving the Queue in 
+ * milliseconds, 0 if disabled
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_COMPONENT_RESULT on failure
+ */
+DslReturnType dsl_component_queue_policy_get(const wchar_t* component, 
+    uint* max_size_buffers, uint* max_size_time, uint* leaky, uint* latency_budget);
+
+/**
+ * @brief Sets the Queue policy for the named component, applied immediately if 
+ * the component's Queue exists. The component's dropped frame count is reset.
+ * @param[in] component name of the component to update
+ * @param[in] max_size_buffers maximum number of buffers queued, 0 for no limit
+ * @param[in] max_size_time maximum time queued in milliseconds, 0 for no limit
+ * @param[in] leaky one of the DSL_QUEUE_LEAKY constant values
+ * @param[in] latency_budget maximum age of a frame leaving the Queue in 
+ * milliseconds, 0 to disable. Frames over budget are dropped.
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_COMPONENT_RESULT on failure
+ */
+DslReturnType dsl_component_queue_policy_set(const wchar_t* component, 
+    uint max_size_buffers, uint max_size_time, uint leaky, uint latency_budget);
+
+/**
+ * @brief Gets the number of frames dropped by the named component's Queue policy
+ * since the policy was last set, or for a Branch, since the Branch was last linked
+ * @param[in] component name of the component to query
+ * @param[out] dropped frames leaked by the Queue plus frames over the latency budget
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_COMPONENT_RESULT on failure
+ */
+DslReturnType dsl_component_queue_dropped_get(const wchar_t* component, uint* dropped);
+
+/**
+ * @brief Resolves a component name to a handle for use with the *_by_handle services,
+ * avoiding the name conversion and lookup on each call. Getting the handle of the 
+ * same component again returns the same value.
+ * @param[in] component name of the component to resolve
+ * @param[out] handle handle for the component, valid until the component is deleted
+ * @return DSL_RESULT_SUCCESS on success, one of DSL_RESULT_COMPONENT_RESULT on failure
+ */
+DslReturnType dsl_component_handle_get(const wchar_t* component, DslHandle* handle);
+
+/**
+ * @brief dsl_component_handle_get for a UTF-8 component name
+ * @param[in] component UTF-8 name of the component to resolve
+ */
+DslReturnType dsl_component_handle_get_utf8(const char* component, DslHandle* handle);
+
+/**
+ * @brief dsl_component_gpuid_get for a component handle
+ * @param[in] component handle of the component to query
+ */
+DslReturnType dsl_component_gpuid_get_by_handle(DslHandle component, uint* gpuid);
+
+/**
+ * @brief dsl_component_gpuid_get for a UTF-8 component name
+ * @param[in] component UTF-8 name of the component to query
+ */
+DslReturnType dsl_component_gpuid_get_utf8(const char* component, uint* gpuid);
+
+/**
+ * @brief dsl_component_gpuid_set for a component handle
+ * @param[in] component handle of the component to update
+ */
+DslReturnType dsl_component_gpuid_set_by_handle(DslHandle component, uint gpuid);
+
+/**
+ * @brief dsl_component_gpuid_set for a UTF-8 component name
+ * @param[in] component UTF-8 name of the component to update
+ */
+DslReturnType dsl_component_gpuid_set_utf8(const char* component, uint gpuid);
+
 /**
  * @brief creates a new, uniquely named Branch
  * @param[in] name unique name for the new Branch
@@ -1359,6 +1784,33 @@ DslReturnType dsl_branch_component_remove(const wchar_t* branch,
 DslReturnType dsl_branch_component_remove_many(const wchar_t* branch, 
     const wchar_t** components);
 
+/**
+ * @brief begins a transaction for the calling thread. All Pipeline and Component
+ * creation and deletion, and all Pipeline, Branch, and Tee add and remove edits, 
+ * are recorded until the transaction is committed or aborted. The Services lock is
+ * held for the whole transaction, all calls from other threads block until it ends.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TRANSACTION_RESULT otherwise
+ */
+DslReturnType dsl_transaction_begin();
+
+/**
+ * @brief commits the calling thread's transaction, keeping all changes made,
+ * once the graph of each Pipeline, Branch, Demuxer and Splitter created or edited
+ * within the transaction is validated.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TRANSACTION_VALIDATION_FAILED
+ * if validation fails and all changes are undone, DSL_RESULT_TRANSACTION_RESULT otherwise
+ */
+DslReturnType dsl_transaction_commit();
+
+/**
+ * @brief aborts the calling thread's transaction. All Components and Pipelines
+ * created within the transaction are deleted, the original Components deleted are restored
+ * with their handles, and all Pipeline, Branch, and Tee add and remove edits are undone 
+ * in reverse order.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_TRANSACTION_RESULT otherwise
+ */
+DslReturnType dsl_transaction_abort();
+
 /**
  * @brief creates a new, uniquely named Pipeline
  * @param[in] pipeline unique name for the new Pipeline
@@ -1451,6 +1903,31 @@ DslReturnType dsl_pipeline_component_remove(const wchar_t* pipeline,
 DslReturnType dsl_pipeline_component_remove_many(const wchar_t* pipeline, 
     const wchar_t** components);
 
+/**
+ * @brief creates all Pipelines, Branches, Tees, and Components described by a Pipeline
+ * definition, and adds each to its parent, in a single call. The definition is loaded 
+ * atomically, as a transaction, if any service fails all are undone.
+ * @param[in] definition path to a definition file, or the definition itself, as
+ * groups of "key=value" pairs, one group per component. See the API Reference.
+ * @param[out] report semicolon separated names of all Pipelines and Components created
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_DEFINITION_LOAD_FAILED if 
+ * the definition cannot be parsed or has a group of unknown type, 
+ * DSL_RESULT_PIPELINE_DEFINITION_INVALID if a key's value is malformed or out of range,
+ * or the result of the first service to fail otherwise. 
+ */
+DslReturnType dsl_pipeline_load_definition(const wchar_t* definition, 
+    const wchar_t** report);
+
+/**
+ * @brief saves the definition of a Pipeline, and all of its Branches, Tees,
+ * and Components, so that it can be re-created with dsl_pipeline_load_definition
+ * @param[in] pipeline name of the Pipeline to save
+ * @param[in] path path of the definition file to create or overwrite
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure
+ */
+DslReturnType dsl_pipeline_save_definition(const wchar_t* pipeline, 
+    const wchar_t* path);
+
 /**
  * @brief 
  * @param[in] pipeline name of the pipeline to query
@@ -1529,6 +2006,292 @@ DslReturnType dsl_pipeline_streammux_padding_get(const wchar_t* name, boolean* e
  */
 DslReturnType dsl_pipeline_streammux_padding_set(const wchar_t* name, boolean enabled);
 
+/**
+ * @brief gets the current surface memory budget settings for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] budget surface memory budget in MB, 0 if disabled
+ * @param[out] policy one of the DSL_SURFACE_BUDGET_POLICY constant values
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_surface_budget_get(const wchar_t* name, uint* budget, uint* policy);
+
+/**
+ * @brief sets the surface memory budget for the named Pipeline. On link, the projected
+ * surface memory for all decoders, the Stream Muxer and all Sinks is checked against
+ * the budget. The Pipeline either fails to play, or shrinks its decoders' surface 
+ * counts to fit for that play, according to the policy. The counts set by the client
+ * are left unchanged. Sources not yet played are planned at the Stream Muxer dimensions.
+ * Only the counts honoured by each Source's decoder are shrunk: nvv4l2decoder, assumed
+ * until first played, honours the extra count only, nvcuvid the decode count only.
+ * @param[in] name name of the Pipeline to update
+ * @param[in] budget surface memory budget in MB, 0 to disable
+ * @param[in] policy one of the DSL_SURFACE_BUDGET_POLICY constant values
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_surface_budget_set(const wchar_t* name, uint budget, uint policy);
+
+/**
+ * @brief gets the surface memory projected for the named Pipeline's decoders,
+ * Stream Muxer and Sinks with their current settings
+ * @param[in] name name of the Pipeline to query
+ * @param[out] size projected surface memory in MB
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_surface_memory_get(const wchar_t* name, uint* size);
+
+/**
+ * @brief gets the current latency tracing enabled setting for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] enabled true if latency tracing is enabled, false otherwise
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_latency_tracing_enabled_get(const wchar_t* name, boolean* enabled);
+
+/**
+ * @brief enables/disables latency tracing for the named Pipeline. When enabled, 
+ * timestamping probes are installed on the sink and src ghost pads of every Bintr
+ * in the Pipeline when linked, or immediately if already linked.
+ * @param[in] name name of the Pipeline to update
+ * @param[in] enabled set to true to enable latency tracing, false to disable
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_latency_tracing_enabled_set(const wchar_t* name, boolean enabled);
+
+/**
+ * @brief gets the current link optimization enabled setting for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] enabled true if link optimization is enabled, false otherwise
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_link_optimization_enabled_get(const wchar_t* name, boolean* enabled);
+
+/**
+ * @brief enables/disables link optimization for the named Pipeline. When enabled,
+ * elements made redundant by the Pipeline's topology are elided on link.
+ * The Pipeline must be stopped, i.e. unlinked, to change the setting.
+ * @param[in] name name of the Pipeline to update
+ * @param[in] enabled set to true to enable link optimization, false to disable
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_link_optimization_enabled_set(const wchar_t* name, boolean enabled);
+
+/**
+ * @brief gets a report of the elements elided by link optimization when the
+ * named Pipeline was last linked, with one line per elision.
+ * @param[in] name name of the Pipeline to query
+ * @param[out] report link optimization report, valid until the next call
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_link_optimization_report_get(const wchar_t* name, 
+    const wchar_t** report);
+
+/**
+ * @brief gets the CPU affinity and priority for a role of streaming thread
+ * @param[in] name name of the Pipeline to query
+ * @param[in] role one of the DSL_THREAD_ROLE constant values
+ * @param[out] cpus CPU list, e.g. L"0-3,6", empty string if not pinned
+ * @param[out] priority nice value applied to each thread of the role
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_thread_role_affinity_get(const wchar_t* name, 
+    uint role, const wchar_t** cpus, int* priority);
+
+/**
+ * @brief sets the CPU affinity and priority for a role of streaming thread, 
+ * applied to each thread of the role as it starts.
+ * @param[in] name name of the Pipeline to update
+ * @param[in] role one of the DSL_THREAD_ROLE constant values
+ * @param[in] cpus CPU list, e.g. L"0-3,6", empty string to not pin
+ * @param[in] priority nice value in the range -20 to 19
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_thread_role_affinity_set(const wchar_t* name, 
+    uint role, const wchar_t* cpus, int priority);
+
+/**
+ * @brief gets a report of the CPU usage of each streaming thread started since
+ * the named Pipeline was last linked, with one line per thread.
+ * @param[in] name name of the Pipeline to query
+ * @param[out] report thread report, valid until the next call
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_thread_report_get(const wchar_t* name, 
+    const wchar_t** report);
+
+/**
+ * @brief gets a latency report for the named Pipeline, with one line per traced Bintr
+ * giving the number of buffers measured and the p50, p95 and p99 latencies in ms.
+ * @param[in] name name of the Pipeline to query
+ * @param[out] report latency report, valid until the next call
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_latency_report_get(const wchar_t* name, const wchar_t** report);
+
+/**
+ * @brief gets the current performance metering enabled setting for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] enabled true if performance metering is enabled, false otherwise
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_perf_enabled_get(const wchar_t* name, boolean* enabled);
+
+/**
+ * @brief enables/disables performance metering for the named Pipeline. When enabled,
+ * each frame is stamped as it leaves its Source and measured as it arrives at each Sink.
+ * @param[in] name name of the Pipeline to update
+ * @param[in] enabled set to true to enable performance metering, false to disable
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_perf_enabled_set(const wchar_t* name, boolean enabled);
+
+/**
+ * @brief gets the current performance reporting interval for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] interval reporting interval in milliseconds
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_perf_interval_get(const wchar_t* name, uint* interval);
+
+/**
+ * @brief sets the performance reporting interval for the named Pipeline, 
+ * over which the rolling FPS is calculated and perf listeners are called.
+ * @param[in] name name of the Pipeline to update
+ * @param[in] interval reporting interval in milliseconds, must be greater than 0
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_perf_interval_set(const wchar_t* name, uint interval);
+
+/**
+ * @brief gets the performance measured for a Source in the named Pipeline
+ * over the last reporting interval
+ * @param[in] name name of the Pipeline to query
+ * @param[in] source_id unique id of the Source to query
+ * @param[out] fps rolling frames per second
+ * @param[out] latency_p50 50th percentile capture-to-sink latency in ms
+ * @param[out] latency_p95 95th percentile capture-to-sink latency in ms
+ * @param[out] latency_p99 99th percentile capture-to-sink latency in ms
+ * @param[out] drops total number of frames dropped
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_perf_get(const wchar_t* name, uint source_id, double* fps, 
+    double* latency_p50, double* latency_p95, double* latency_p99, uint* drops);
+
+/**
+ * @brief adds a callback to be notified with the performance of each Source
+ * at the end of every reporting interval
+ * @param[in] name name of the pipeline to update
+ * @param[in] listener pointer to the client's function to call
+ * @param[in] userdata opaque pointer to client data passed into the listener function.
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_perf_listener_add(const wchar_t* name, 
+    dsl_perf_listener_cb listener, void* userdata);
+
+/**
+ * @brief removes a callback previously added with dsl_pipeline_perf_listener_add
+ * @param[in] name name of the pipeline to update
+ * @param[in] listener pointer to the client's function to remove
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_perf_listener_remove(const wchar_t* name, 
+    dsl_perf_listener_cb listener);
+
+/**
+ * @brief gets the current Secondary GIE link mode for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] mode one of the DSL_SGIE_LINK_MODE constant values
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_sgie_link_mode_get(const wchar_t* name, uint* mode);
+
+/**
+ * @brief sets the Secondary GIE link mode for the named Pipeline, applied on link.
+ * In parallel mode, all Secondary GIEs infer on the same buffer from a Tee and the 
+ * stream waits for all to complete. In serial mode, the Secondary GIEs are linked 
+ * back-to-back, avoiding the per-SGIE Tee branch, Fake Sink, and fan-in wait.
+ * @param[in] name name of the Pipeline to update
+ * @param[in] mode one of the DSL_SGIE_LINK_MODE constant values
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_sgie_link_mode_set(const wchar_t* name, uint mode);
+
+/**
+ * @brief gets the current classification cache enabled setting for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] enabled true if the classification cache is enabled, false otherwise
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_classification_cache_enabled_get(const wchar_t* name, 
+    boolean* enabled);
+
+/**
+ * @brief sets the classification cache enabled setting for the named Pipeline.
+ * When enabled, the Secondary GIE classifications of each tracked object are
+ * cached, and once frozen, the object is skipped by all Secondary GIEs with 
+ * the cached classifier meta re-attached downstream. Requires a Tracker.
+ * @param[in] name name of the Pipeline to update
+ * @param[in] enabled set to true to enable the classification cache
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_classification_cache_enabled_set(const wchar_t* name, 
+    boolean enabled);
+
+/**
+ * @brief gets the current classification cache settings for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] min_count number of confident classifications required to freeze an object
+ * @param[out] min_confidence minimum probability for a confident classification
+ * @param[out] ttl time-to-live in milliseconds for objects no longer tracked
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_classification_cache_settings_get(const wchar_t* name, 
+    uint* min_count, double* min_confidence, uint* ttl);
+
+/**
+ * @brief sets the classification cache settings for the named Pipeline
+ * @param[in] name name of the Pipeline to update
+ * @param[in] min_count number of confident classifications required to freeze an object
+ * @param[in] min_confidence minimum probability for a confident classification [0..1]
+ * @param[in] ttl time-to-live in milliseconds for objects no longer tracked
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_classification_cache_settings_set(const wchar_t* name, 
+    uint min_count, double min_confidence, uint ttl);
+
+/**
+ * @brief gets the classification cache statistics for the named Pipeline
+ * @param[in] name name of the Pipeline to query
+ * @param[out] hit_rate ratio of object lookups skipping secondary inference [0..1]
+ * @param[out] entries current number of tracked objects in the cache
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_classification_cache_stats_get(const wchar_t* name, 
+    double* hit_rate, uint* entries);
+
+/**
+ * @brief starts a timeline trace for the named Pipeline. API calls, bus messages,
+ * pad probe handlers and buffer arrivals at each component are recorded into 
+ * per-thread ring buffers until the trace is stopped. The trace session is 
+ * process-wide, so only one trace can be active at a time across all Pipelines.
+ * Starting a trace for a second Pipeline while one is active fails with
+ * DSL_RESULT_PIPELINE_TRACE_FAILED. Events from other Pipelines that occur 
+ * during the session are also recorded.
+ * @param[in] name name of the Pipeline to trace
+ * @param[in] file_path path to the trace file to write when the trace is stopped
+ * @param[in] format one of the DSL_TRACE_FORMAT constant values
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_trace_start(const wchar_t* name, 
+    const wchar_t* file_path, uint format);
+
+/**
+ * @brief stops the timeline trace for the named Pipeline, and writes all 
+ * recorded events to the file provided on start.
+ * @param[in] name name of the Pipeline to stop tracing
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_trace_stop(const wchar_t* name);
+
 /**
  * @brief pauses a Pipeline if in a state of playing
  * @param[in] pipeline unique name of the Pipeline to pause.
@@ -1536,6 +2299,27 @@ DslReturnType dsl_pipeline_streammux_padding_set(const wchar_t* name, boolean en
  */
 DslReturnType dsl_pipeline_pause(const wchar_t* pipeline);
 
+/**
+ * @brief links all components of a Pipeline in a state of NULL and starts an
+ * asynchronous transition to PAUSED, loading all models and prerolling non-live
+ * sources, so that a later call to dsl_pipeline_play is a near-instant state change.
+ * @param[in] pipeline unique name of the Pipeline to prepare.
+ * @param[in] listener client function to call on completion, may be NULL.
+ * @param[in] user_data opaque pointer to client data passed into the listener.
+ * @return DSL_RESULT_SUCCESS if the prepare was started, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_prepare(const wchar_t* pipeline, 
+    dsl_prepare_complete_cb listener, void* user_data);
+
+/**
+ * @brief gets a report of the time each element of the named Pipeline spent 
+ * reaching PAUSED on the last prepare, one line per element in descending order
+ * @param[in] pipeline name of the Pipeline to query
+ * @param[out] report prepare report, valid until the next call
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT otherwise.
+ */
+DslReturnType dsl_pipeline_prepare_report_get(const wchar_t* pipeline, const wchar_t** report);
+
 /**
  * @brief plays a Pipeline if in a state of paused
  * @param[in] pipeline unique name of the Pipeline to play.
@@ -1675,6 +2459,48 @@ DslReturnType dsl_pipeline_xwindow_delete_event_handler_add(const wchar_t* pipel
 DslReturnType dsl_pipeline_xwindow_delete_event_handler_remove(const wchar_t* pipeline, 
     dsl_xwindow_delete_event_handler_cb handler);
 
+/**
+ * @brief gets the current main context setting for the named Pipeline
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] enabled true if the Pipeline runs on a dedicated main context and thread
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_main_context_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled);
+
+/**
+ * @brief enables or disables a dedicated main context and thread for the named Pipeline.
+ * When enabled, the Pipeline's bus messages, client listeners, and performance reports
+ * are handled on its own thread, independent of all other Pipelines and of the 
+ * default main loop run with dsl_main_loop_run. The Pipeline must be stopped.
+ * @param[in] pipeline name of the pipeline to update
+ * @param[in] enabled set to true to enable, false to use the default main loop
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_main_context_enabled_set(const wchar_t* pipeline, 
+    boolean enabled);
+
+/**
+ * @brief gets a pollable event file descriptor for the named Pipeline, creating it
+ * on first call. Once created, the Pipeline's bus messages are no longer handled by 
+ * a main loop. The descriptor becomes readable when messages are pending, and the 
+ * client must call dsl_pipeline_events_dispatch to call all state-change, EOS, 
+ * and error handling on the client's own thread. 
+ * @param[in] pipeline name of the pipeline to query
+ * @param[out] fd non-blocking eventfd owned by the Pipeline, closed on delete
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_event_fd_get(const wchar_t* pipeline, int* fd);
+
+/**
+ * @brief dispatches all pending bus messages for the named Pipeline on the 
+ * calling thread, and clears the Pipeline's event file descriptor.
+ * @param[in] pipeline name of the pipeline to dispatch
+ * @param[out] count number of messages dispatched
+ * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_RESULT on failure.
+ */
+DslReturnType dsl_pipeline_events_dispatch(const wchar_t* pipeline, uint* count);
+
 /**
  * @brief entry point to the GST Main Loop
  * Note: This is a blocking call - executes an endless loop
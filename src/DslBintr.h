@@ -29,6 +29,7 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslNodetr.h"
 #include "DslPadProbetr.h"
+#include "DslQueuePolicy.h"
 
 namespace DSL
 {
@@ -68,6 +69,7 @@ namespace DSL
                 LOG_ERROR("Failed to create a new GST bin for Bintr '" << name << "'");
                 throw;  
             }
+            g_mutex_init(&m_apiMutex);
         }
         
         /**
@@ -76,6 +78,18 @@ namespace DSL
         ~Bintr()
         {
             LOG_FUNC();
+            
+            g_mutex_clear(&m_apiMutex);
+        }
+        
+        /**
+         * @brief returns the mutex used to serialize client API access
+         * to the properties of this Bintr
+         * @return pointer to this Bintr's API mutex
+         */
+        GMutex* GetApiMutex()
+        {
+            return &m_apiMutex;
         }
 
         /**
@@ -350,6 +364,17 @@ namespace DSL
             m_gpuId = gpuId;
             return true;
         }
+        
+        /**
+         * @brief Gets the policy for the Queue that buffers this Bintr's input
+         * @return shared pointer to the QueuePolicy, nullptr if not supported
+         */
+        DSL_QUEUE_POLICY_PTR GetQueuePolicy()
+        {
+            LOG_FUNC();
+            
+            return m_pQueuePolicy;
+        }
 
     public:
 
@@ -408,6 +433,16 @@ namespace DSL
          * @brief Source PadProbetr for this Bintr
          */
         DSL_PAD_PROBE_PTR m_pSrcPadProbe;
+        
+        /**
+         * @brief Queue policy for this Bintr, nullptr if not supported
+         */
+        DSL_QUEUE_POLICY_PTR m_pQueuePolicy;
+        
+        /**
+         * @brief mutex to serialize client API access to this Bintr's properties
+         */
+        GMutex m_apiMutex;
     };
 
 } // DSL
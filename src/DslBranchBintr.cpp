@@ -33,8 +33,27 @@ namespace DSL
     BranchBintr::BranchBintr(const char* name)
         : Bintr(name)
         , m_batchTimeout(DSL_DEFAULT_STREAMMUX_BATCH_TIMEOUT)
+        , m_sgieLinkMode(DSL_SGIE_LINK_MODE_PARALLEL)
+        , m_numHeadComponents(0)
+        , m_relinkPending(false)
+        , m_relinkSwapping(false)
+        , m_relinkResult(false)
     {
         LOG_FUNC();
+        
+        g_mutex_init(&m_relinkMutex);
+        g_cond_init(&m_relinkCond);
+        
+        // Attached to the Queue of the first component when linked to a Tee
+        m_pQueuePolicy = DSL_QUEUE_POLICY_NEW(name);
+    }
+
+    BranchBintr::~BranchBintr()
+    {
+        LOG_FUNC();
+        
+        g_mutex_clear(&m_relinkMutex);
+        g_cond_clear(&m_relinkCond);
     }
 
     bool BranchBintr::AddOsdBintr(DSL_NODETR_PTR pOsdBintr)
@@ -90,6 +109,14 @@ namespace DSL
     {
         LOG_FUNC();
         
+        // The Secondary GIEs are linked as one component, which can't be
+        // relinked in place, only added or removed as a whole.
+        if (m_isLinked and m_pSecondaryGiesBintr)
+        {
+            LOG_ERROR("Unable to add Secondary GIE '" << pSecondaryGieBintr->GetName() 
+                << "' to Branch '" << GetName() << "' as its Secondary GIEs are linked");
+            return false;
+        }
         // Create the optional Secondary GIEs bintr 
         if (!m_pSecondaryGiesBintr)
         {
@@ -224,17 +251,38 @@ namespace DSL
         return m_pMultiSinksBintr->RemoveChild(std::dynamic_pointer_cast<Bintr>(pSinkBintr));
     }
     
-    bool BranchBintr::LinkAll()
+    uint BranchBintr::GetSecondaryGieLinkMode()
+    {
+        LOG_FUNC();
+        
+        return m_sgieLinkMode;
+    }
+    
+    bool BranchBintr::SetSecondaryGieLinkMode(uint mode)
     {
         LOG_FUNC();
         
         if (m_isLinked)
         {
-            LOG_INFO("Components for Branch '" << GetName() << "' are already assembled");
+            LOG_ERROR("Unable to set Secondary GIE link mode for Branch '" << GetName() 
+                << "' as it's currently linked");
             return false;
         }
+        if (mode > DSL_SGIE_LINK_MODE_SERIAL)
+        {
+            LOG_ERROR("Invalid Secondary GIE link mode '" << mode << "' for Branch '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_sgieLinkMode = mode;
+        return true;
+    }
+    
+    bool BranchBintr::ValidateComponents()
+    {
+        LOG_FUNC();
+        
         if (!m_pDemuxerBintr and !m_pSplitterBintr and !m_pMultiSinksBintr)
-//        if (!m_pDemuxerBintr and !m_pTilerBintr)
         {
             LOG_ERROR("Pipline '" << GetName() << "' has no Demuxer, Splitter or Sink - and is unable to link");
             return false;
@@ -249,140 +297,102 @@ namespace DSL
             LOG_ERROR("Pipline '" << GetName() << "' has a Seconday GIE and no Primary GIE - and is unable to link");
             return false;
         }
+        return true;
+    }
+    
+    std::vector<DSL_BINTR_PTR> BranchBintr::GetComponentChain()
+    {
+        LOG_FUNC();
+        
+        std::vector<DSL_BINTR_PTR> chain;
         
         if (m_pPrimaryGieBintr)
         {
-            // Set the GIE's batch size to the current stream muxer batch size, 
-            // then LinkAll PrimaryGie Elementrs and add as the next component in the Branch
-            m_pPrimaryGieBintr->SetBatchSize(m_batchSize);
-            if (!m_pPrimaryGieBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pPrimaryGieBintr)))
-            {
-                return false;
-            }
-            m_linkedComponents.push_back(m_pPrimaryGieBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up Primary GIE '" << 
-                m_pPrimaryGieBintr->GetName() << "' successfully");
+            chain.push_back(m_pPrimaryGieBintr);
         }
-        
         if (m_pTrackerBintr)
         {
-            // LinkAll Tracker Elementrs and add as the next component in the Branch
-            m_pTrackerBintr->SetBatchSize(m_batchSize);
-            if (!m_pTrackerBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pTrackerBintr)))
-            {
-                return false;
-            }
-            m_linkedComponents.push_back(m_pTrackerBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up Tracker '" << 
-                m_pTrackerBintr->GetName() << "' successfully");
+            chain.push_back(m_pTrackerBintr);
         }
-        
         if (m_pSecondaryGiesBintr)
         {
-            // Set the Secondary GIEs' Primary GIE Name, and set batch sizes
-            m_pSecondaryGiesBintr->SetInferOnGieId(m_pPrimaryGieBintr->GetUniqueId());
-            m_pSecondaryGiesBintr->SetBatchSize(m_batchSize);
-            
-            // LinkAll SecondaryGie Elementrs and add the Bintr as next component in the Branch
-            if (!m_pSecondaryGiesBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pSecondaryGiesBintr)))
-            {
-                return false;
-            }
-            m_linkedComponents.push_back(m_pSecondaryGiesBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up all Secondary GIEs '" << 
-                m_pSecondaryGiesBintr->GetName() << "' successfully");
+            chain.push_back(m_pSecondaryGiesBintr);
         }
-
         if (m_pOfvBintr)
         {
-            // LinkAll Optical Flow Elementrs and add as the next component in the Branch
-            m_pOfvBintr->SetBatchSize(m_batchSize);
-            if (!m_pOfvBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pOfvBintr)))
-            {
-                return false;
-            }
-            m_linkedComponents.push_back(m_pOfvBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up Optical Flow Detector '" << 
-                m_pOfvBintr->GetName() << "' successfully");
+            chain.push_back(m_pOfvBintr);
         }
-
         // mutually exclusive with Demuxer
         if (m_pTilerBintr)
         {
-            // Link All Tiler Elementrs and add as the next component in the Branch
-            m_pTilerBintr->SetBatchSize(m_batchSize);
-            if (!m_pTilerBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pTilerBintr)))
-            {
-                return false;
-            }
-            m_linkedComponents.push_back(m_pTilerBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up Tiler '" << 
-                m_pTilerBintr->GetName() << "' successfully");
+            chain.push_back(m_pTilerBintr);
         }
-
         // mutually exclusive with Demuxer
         if (m_pOsdBintr)
         {
-            // LinkAll Osd Elementrs and add as next component in the Branch
-            m_pOsdBintr->SetBatchSize(m_batchSize);
-            if (!m_pOsdBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pOsdBintr)))
-            {
-                return false;
-            }
-            m_linkedComponents.push_back(m_pOsdBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up OSD '" << 
-                m_pOsdBintr->GetName() << "' successfully");
+            chain.push_back(m_pOsdBintr);
         }
-
         // mutually exclusive with TilerBintr, Pipeline-OsdBintr, and Pieline-MultiSinksBintr
+        // the Demuxer and Splitter are the ** LAST ** component in the Branch
         if (m_pDemuxerBintr)
         {
-            // Link All Demuxer Elementrs and add as the next ** AND LAST ** component in the Pipeline
-            m_pDemuxerBintr->SetBatchSize(m_batchSize);
-            if (!m_pDemuxerBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pDemuxerBintr)))
-            {
-                return false;
-            }
-            m_linkedComponents.push_back(m_pDemuxerBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up Stream Demuxer '" << 
-                m_pDemuxerBintr->GetName() << "' successfully");
+            chain.push_back(m_pDemuxerBintr);
         }
-
-        // mutually exclusive with TilerBintr, Pipeline-OsdBintr, and Pieline-MultiSinksBintr
         if (m_pSplitterBintr)
         {
-            // Link All Demuxer Elementrs and add as the next ** AND LAST ** component in the Pipeline
-            m_pSplitterBintr->SetBatchSize(m_batchSize);
-            if (!m_pSplitterBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pSplitterBintr)))
-            {
-                return false;
-            }
-            m_linkedComponents.push_back(m_pSplitterBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up Stream Splitter'" << 
-                m_pSplitterBintr->GetName() << "' successfully");
+            chain.push_back(m_pSplitterBintr);
         }
-
-        // mutually exclusive with Demuxer
+        // all Sinks are added as the final (tail) component in the Branch
         if (m_pMultiSinksBintr)
         {
-            // Link all Sinks and their elementrs and add as finale (tail) components in the Branch
-            m_pMultiSinksBintr->SetBatchSize(m_batchSize);
-            if (!m_pMultiSinksBintr->LinkAll() or
-                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(m_pMultiSinksBintr)))
+            chain.push_back(m_pMultiSinksBintr);
+        }
+        return chain;
+    }
+    
+    void BranchBintr::PrepareComponent(DSL_BINTR_PTR pComponent)
+    {
+        LOG_FUNC();
+        
+        // Set the component's batch size to the current stream muxer batch size
+        pComponent->SetBatchSize(m_batchSize);
+        
+        // Set the Secondary GIEs' Primary GIE Id and link mode
+        if (pComponent == m_pSecondaryGiesBintr)
+        {
+            m_pSecondaryGiesBintr->SetInferOnGieId(m_pPrimaryGieBintr->GetUniqueId());
+            m_pSecondaryGiesBintr->SetLinkMode(m_sgieLinkMode);
+        }
+    }
+    
+    bool BranchBintr::LinkAll()
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_INFO("Components for Branch '" << GetName() << "' are already assembled");
+            return false;
+        }
+        if (!ValidateComponents())
+        {
+            return false;
+        }
+        // Any components already linked, e.g. a Pipeline's Sources, remain the head
+        m_numHeadComponents = m_linkedComponents.size();
+        
+        // LinkAll Elementrs for each component and add as the next component in the Branch
+        for (auto const& ivec: GetComponentChain())
+        {
+            PrepareComponent(ivec);
+            if (!ivec->LinkAll() or
+                (m_linkedComponents.size() and !m_linkedComponents.back()->LinkToSink(ivec)))
             {
                 return false;
             }
-            m_linkedComponents.push_back(m_pMultiSinksBintr);
-            LOG_INFO("Branch '" << GetName() << "' Linked up all Sinks '" << 
-                m_pMultiSinksBintr->GetName() << "' successfully");
+            m_linkedComponents.push_back(ivec);
+            LOG_INFO("Branch '" << GetName() << "' Linked up component '" << 
+                ivec->GetName() << "' successfully");
         }
         
         m_isLinked = true;
@@ -411,6 +421,290 @@ namespace DSL
 
         m_isLinked = false;
     }
+
+    bool BranchBintr::RemoveChild(DSL_NODETR_PTR pChild)
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked and std::dynamic_pointer_cast<SecondaryGieBintr>(pChild))
+        {
+            LOG_ERROR("Unable to remove Secondary GIE '" << pChild->GetName() 
+                << "' from Branch '" << GetName() << "' as its Secondary GIEs are linked");
+            return false;
+        }
+        // Clear the Branch's reference so the component is excluded from the chain
+        DSL_BINTR_PTR pComponent = std::dynamic_pointer_cast<Bintr>(pChild);
+        DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = m_pPrimaryGieBintr;
+        DSL_TRACKER_PTR pTrackerBintr = m_pTrackerBintr;
+        DSL_OFV_PTR pOfvBintr = m_pOfvBintr;
+        DSL_OSD_PTR pOsdBintr = m_pOsdBintr;
+        DSL_TILER_PTR pTilerBintr = m_pTilerBintr;
+        DSL_DEMUXER_PTR pDemuxerBintr = m_pDemuxerBintr;
+        DSL_SPLITTER_PTR pSplitterBintr = m_pSplitterBintr;
+        
+        if (pComponent == m_pPrimaryGieBintr)
+        {
+            m_pPrimaryGieBintr = nullptr;
+        }
+        if (pComponent == m_pTrackerBintr)
+        {
+            m_pTrackerBintr = nullptr;
+        }
+        if (pComponent == m_pOfvBintr)
+        {
+            m_pOfvBintr = nullptr;
+        }
+        if (pComponent == m_pOsdBintr)
+        {
+            m_pOsdBintr = nullptr;
+        }
+        if (pComponent == m_pTilerBintr)
+        {
+            m_pTilerBintr = nullptr;
+        }
+        if (pComponent == m_pDemuxerBintr)
+        {
+            m_pDemuxerBintr = nullptr;
+        }
+        if (pComponent == m_pSplitterBintr)
+        {
+            m_pSplitterBintr = nullptr;
+        }
+
+        if (!Relink())
+        {
+            LOG_ERROR("Unable to relink Branch '" << GetName() 
+                << "' without component '" << pChild->GetName() << "'");
+            m_pPrimaryGieBintr = pPrimaryGieBintr;
+            m_pTrackerBintr = pTrackerBintr;
+            m_pOfvBintr = pOfvBintr;
+            m_pOsdBintr = pOsdBintr;
+            m_pTilerBintr = pTilerBintr;
+            m_pDemuxerBintr = pDemuxerBintr;
+            m_pSplitterBintr = pSplitterBintr;
+            return false;
+        }
+        return Bintr::RemoveChild(pChild);
+    }
+    
+    bool BranchBintr::IsRelinkRequired()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            return false;
+        }
+        std::vector<DSL_BINTR_PTR> linkedChain(
+            m_linkedComponents.begin() + m_numHeadComponents, m_linkedComponents.end());
+        
+        return GetComponentChain() != linkedChain;
+    }
+    
+    bool BranchBintr::Relink()
+    {
+        LOG_FUNC();
+        
+        if (!m_isLinked)
+        {
+            LOG_INFO("Branch '" << GetName() << "' is not linked - components will be linked on Play");
+            return true;
+        }
+        if (!ValidateComponents())
+        {
+            return false;
+        }
+        // The desired chain is the head components, unchanged, and the Branch's current chain
+        std::vector<DSL_BINTR_PTR> chain(m_linkedComponents.begin(), 
+            m_linkedComponents.begin() + m_numHeadComponents);
+        std::vector<DSL_BINTR_PTR> branchChain = GetComponentChain();
+        chain.insert(chain.end(), branchChain.begin(), branchChain.end());
+        
+        // Find the number of components in common at the head and tail of both chains
+        uint head(0);
+        while (head < chain.size() and head < m_linkedComponents.size() and 
+            chain[head] == m_linkedComponents[head])
+        {
+            head++;
+        }
+        if (head == chain.size() and head == m_linkedComponents.size())
+        {
+            // Sources and Sinks are linked in place by their parent Bintr, any
+            // other change to a linked component is refused before reaching here.
+            LOG_INFO("Components for Branch '" << GetName() << "' are unchanged");
+            return true;
+        }
+        uint tail(0);
+        while (tail < chain.size() - head and tail < m_linkedComponents.size() - head and
+            chain[chain.size() - 1 - tail] == m_linkedComponents[m_linkedComponents.size() - 1 - tail])
+        {
+            tail++;
+        }
+        if (!head or !tail)
+        {
+            LOG_ERROR("The first or last component of Branch '" << GetName() 
+                << "' has changed - the Branch must be stopped to relink");
+            return false;
+        }
+        m_pRelinkUpstream = m_linkedComponents[head - 1];
+        m_pRelinkDownstream = m_linkedComponents[m_linkedComponents.size() - tail];
+        m_relinkOldSegment.assign(m_linkedComponents.begin() + head, 
+            m_linkedComponents.end() - tail);
+        m_relinkNewSegment.assign(chain.begin() + head, chain.end() - tail);
+        
+        LOG_INFO("Relinking " << m_relinkNewSegment.size() << " component(s) in place of "
+            << m_relinkOldSegment.size() << " between '" << m_pRelinkUpstream->GetName()
+            << "' and '" << m_pRelinkDownstream->GetName() << "' for Branch '" << GetName() << "'");
+        
+        // Link the new segment and bring it to the Branch's state ahead of the swap,
+        // so that any model loading is done while the upstream pad is still flowing.
+        bool linked(true);
+        for (uint i = 0; linked and i < m_relinkNewSegment.size(); i++)
+        {
+            PrepareComponent(m_relinkNewSegment[i]);
+            linked = m_relinkNewSegment[i]->LinkAll() and 
+                (!i or m_relinkNewSegment[i - 1]->LinkToSink(m_relinkNewSegment[i]));
+        }
+        for (auto ivec = m_relinkNewSegment.rbegin(); linked and ivec != m_relinkNewSegment.rend(); ivec++)
+        {
+            linked = gst_element_sync_state_with_parent((*ivec)->GetGstElement());
+        }
+        
+        if (linked)
+        {
+            if (GetState() != GST_STATE_PLAYING)
+            {
+                linked = SwapRelinkSegment();
+            }
+            else
+            {
+                GstPad* pUpstreamSrcPad = 
+                    gst_element_get_static_pad(m_pRelinkUpstream->GetGstElement(), "src");
+                if (!pUpstreamSrcPad)
+                {
+                    LOG_ERROR("Failed to get Src Pad for component '" 
+                        << m_pRelinkUpstream->GetName() << "'");
+                    linked = false;
+                }
+                else
+                {
+                    {
+                        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_relinkMutex);
+                        m_relinkPending = true;
+                        m_relinkSwapping = false;
+                    }
+                    // The IDLE probe is called immediately if the pad is idle, otherwise
+                    // on the streaming thread once the current buffer has been pushed
+                    gulong probeId = gst_pad_add_probe(pUpstreamSrcPad, 
+                        GST_PAD_PROBE_TYPE_IDLE, BranchRelinkProbeCB, this, NULL);
+                    
+                    bool timedOut(false);
+                    {
+                        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_relinkMutex);
+                        
+                        // The upstream pad may never go idle, e.g. if blocked downstream,
+                        // so the wait is bounded unless the swap has already started.
+                        gint64 endTime = g_get_monotonic_time() + DSL_BRANCH_RELINK_TIMEOUT_US;
+                        while (m_relinkPending)
+                        {
+                            if (!g_cond_wait_until(&m_relinkCond, &m_relinkMutex, endTime) and
+                                !m_relinkSwapping)
+                            {
+                                m_relinkPending = false;
+                                timedOut = true;
+                            }
+                            else if (m_relinkSwapping)
+                            {
+                                endTime = G_MAXINT64;
+                            }
+                        }
+                        linked = !timedOut and m_relinkResult;
+                    }
+                    if (timedOut)
+                    {
+                        LOG_ERROR("Timed out waiting on component '" 
+                            << m_pRelinkUpstream->GetName() << "' to go idle for relink");
+                        if (probeId)
+                        {
+                            gst_pad_remove_probe(pUpstreamSrcPad, probeId);
+                        }
+                    }
+                    gst_object_unref(pUpstreamSrcPad);
+                }
+            }
+        }
+        
+        // Stop and unlink the segment that is no longer linked in the Branch, 
+        // which is the new segment on failure
+        std::vector<DSL_BINTR_PTR>& segment = (linked) ? m_relinkOldSegment : m_relinkNewSegment;
+        for (auto const& ivec: segment)
+        {
+            gst_element_set_state(ivec->GetGstElement(), GST_STATE_NULL);
+            if (ivec->IsLinkedToSink())
+            {
+                ivec->UnlinkFromSink();
+            }
+            ivec->UnlinkAll();
+        }
+        if (linked)
+        {
+            m_linkedComponents = chain;
+        }
+        else
+        {
+            LOG_ERROR("Failed to relink Branch '" << GetName() << "'");
+        }
+        m_pRelinkUpstream = nullptr;
+        m_pRelinkDownstream = nullptr;
+        m_relinkOldSegment.clear();
+        m_relinkNewSegment.clear();
+        
+        return linked;
+    }
+    
+    bool BranchBintr::SwapRelinkSegment()
+    {
+        LOG_FUNC();
+        
+        DSL_BINTR_PTR pNewFirst = (m_relinkNewSegment.size()) 
+            ? m_relinkNewSegment.front() : m_pRelinkDownstream;
+        
+        m_pRelinkUpstream->UnlinkFromSink();
+        if (m_relinkOldSegment.size())
+        {
+            m_relinkOldSegment.back()->UnlinkFromSink();
+        }
+        if (m_relinkNewSegment.size() and 
+            !m_relinkNewSegment.back()->LinkToSink(m_pRelinkDownstream))
+        {
+            return false;
+        }
+        return m_pRelinkUpstream->LinkToSink(pNewFirst);
+    }
+    
+    GstPadProbeReturn BranchBintr::HandleRelinkProbe(GstPad* pPad, GstPadProbeInfo* pInfo)
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_relinkMutex);
+            
+            // Relink has timed out and cancelled the swap
+            if (!m_relinkPending)
+            {
+                return GST_PAD_PROBE_REMOVE;
+            }
+            m_relinkSwapping = true;
+        }
+        bool result = SwapRelinkSegment();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_relinkMutex);
+        m_relinkResult = result;
+        m_relinkPending = false;
+        g_cond_signal(&m_relinkCond);
+        
+        return GST_PAD_PROBE_REMOVE;
+    }
     
     bool BranchBintr::LinkToSource(DSL_NODETR_PTR pTee)
     {
@@ -471,6 +765,8 @@ namespace DSL
             return false;
         }
         m_pGstRequestedSourcePads[srcPadName] = pRequestedSourcePad;
+        
+        AttachQueuePolicy();
 
         return Bintr::LinkToSource(pTee);
         
@@ -503,7 +799,48 @@ namespace DSL
                 
         m_pGstRequestedSourcePads.erase(srcPadName);
         
+        m_pQueuePolicy->Detach();
+        
         return Nodetr::UnlinkFromSource();
     }
+    
+    void BranchBintr::AttachQueuePolicy()
+    {
+        LOG_FUNC();
+        
+        // A first component with a Queue policy of its own takes precedence
+        DSL_QUEUE_POLICY_PTR pHeadQueuePolicy = 
+            m_linkedComponents.front()->GetQueuePolicy();
+        if (pHeadQueuePolicy and pHeadQueuePolicy->IsSet())
+        {
+            if (m_pQueuePolicy->IsSet())
+            {
+                LOG_WARN("Queue policy for Branch '" << GetName() 
+                    << "' is overridden by the policy of its first component '"
+                    << m_linkedComponents.front()->GetName() << "'");
+            }
+            return;
+        }
+        GstElement* pQueue = QueuePolicy::FindQueue(
+            m_linkedComponents.front()->GetGstElement());
+        if (!pQueue)
+        {
+            if (m_pQueuePolicy->IsSet())
+            {
+                LOG_WARN("Unable to apply the Queue policy for Branch '" << GetName() 
+                    << "' as its first component '" 
+                    << m_linkedComponents.front()->GetName() << "' has no input Queue");
+            }
+            return;
+        }
+        m_pQueuePolicy->Attach(pQueue);
+        gst_object_unref(pQueue);
+    }
+    
+    static GstPadProbeReturn BranchRelinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pBranch)
+    {
+        return static_cast<BranchBintr*>(pBranch)->HandleRelinkProbe(pPad, pInfo);
+    }
 
 } // DSL
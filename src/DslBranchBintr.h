@@ -45,6 +45,11 @@ namespace DSL
     #define DSL_BRANCH_NEW(name) \
         std::shared_ptr<BranchBintr>(new BranchBintr(name))
 
+    /**
+     * @brief maximum time to wait on the upstream pad to go idle for a relink
+     */
+    #define DSL_BRANCH_RELINK_TIMEOUT_US    (2 * G_USEC_PER_SEC)
+
     /**
      * @class BranchBintr
      * @brief 
@@ -57,6 +62,8 @@ namespace DSL
          * 
          */
         BranchBintr(const char* name);
+        
+        ~BranchBintr();
 
         /**
          * @brief adds a single GIE Bintr to this Branch 
@@ -145,10 +152,54 @@ namespace DSL
         } 
 
         
+        /**
+         * @brief Gets the current link mode for this Branch's Secondary GIEs
+         * @return one of the DSL_SGIE_LINK_MODE constant values
+         */
+        uint GetSecondaryGieLinkMode();
+        
+        /**
+         * @brief Sets the link mode for this Branch's Secondary GIEs, applied on link
+         * @param[in] mode one of the DSL_SGIE_LINK_MODE constant values
+         * @return false if the Branch is linked or the mode is invalid
+         */
+        bool SetSecondaryGieLinkMode(uint mode);
+        
         bool LinkAll();
         
         void UnlinkAll();
         
+        /**
+         * @brief overrides the base method to clear the Branch's reference to
+         * the child and, if linked, to relink the Branch without it first.
+         * @param[in] pChild shared pointer to the child to remove
+         * @return false if the child could not be unlinked or removed
+         */
+        bool RemoveChild(DSL_NODETR_PTR pChild);
+        
+        /**
+         * @brief relinks a linked Branch incrementally, after components have been 
+         * added or removed. The current component chain is compared with the linked 
+         * chain, and only the segment that differs is unlinked and replaced while
+         * the upstream component's src pad is blocked. All other components remain 
+         * linked and in their current state.
+         * Sources and Sinks added to, or removed from, a linked Branch are linked
+         * in place by the Sources and Sinks Bintrs, leaving the chain unchanged.
+         * @return true if the Branch is unlinked, unchanged, or relinked successfully.
+         * false if the first or last component has changed, the segment fails to 
+         * link, or the upstream pad fails to go idle within DSL_BRANCH_RELINK_TIMEOUT_US.
+         */
+        virtual bool Relink();
+        
+        /**
+         * @brief handles the IDLE pad probe installed on the upstream component's
+         * src pad by Relink, swapping the old segment for the new while blocked.
+         * @param[in] pPad the upstream component's src pad
+         * @param[in] pInfo pad probe info
+         * @return GST_PAD_PROBE_REMOVE always
+         */
+        GstPadProbeReturn HandleRelinkProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
+        
         /**
          * @brief Links this BranchBintr, becoming a sink, to a Tee Elementr
          * The Tee can be either a demuxer of tee 
@@ -161,12 +212,99 @@ namespace DSL
          */
         bool UnlinkFromSource();
 
+        /**
+         * @brief checks that the Branch's current set of components can be linked
+         * @return true if linkable, false otherwise
+         */
+        bool ValidateComponents();
+        
+        /**
+         * @brief checks whether the Branch's current chain of components differs
+         * from the chain it is linked with, i.e. whether Relink has work to do
+         * @return true if linked and the chain has changed, false otherwise
+         */
+        bool IsRelinkRequired();
+        
     protected:
+    
+        /**
+         * @brief gets the Branch's current components in link order, excluding
+         * any head components linked by a derived class
+         * @return ordered list of components to link
+         */
+        std::vector<DSL_BINTR_PTR> GetComponentChain();
         
+        /**
+         * @brief applies the Branch's batch size, and any dependent settings, 
+         * to a component prior to linking
+         * @param[in] pComponent component to prepare
+         */
+        void PrepareComponent(DSL_BINTR_PTR pComponent);
+        
+        /**
+         * @brief unlinks the old segment from, and links the new segment to, the
+         * upstream and downstream components set up by Relink
+         * @return true if the new segment was linked successfully
+         */
+        bool SwapRelinkSegment();
+
+        /**
+         * @brief attaches the Branch's Queue policy to the input Queue of its
+         * first component, unless the component has a Queue policy of its own
+         */
+        void AttachQueuePolicy();
+
         uint m_batchTimeout;
+        
+        /**
+         * @brief one of the DSL_SGIE_LINK_MODE constant values, applied to the
+         * Secondary GIEs on link
+         */
+        uint m_sgieLinkMode;
 
         std::vector<DSL_BINTR_PTR> m_linkedComponents;
         
+        /**
+         * @brief number of head components, e.g. the Pipeline's Sources, at the 
+         * front of m_linkedComponents that are linked by a derived class
+         */
+        uint m_numHeadComponents;
+        
+        /**
+         * @brief mutex and condition to synchronize Relink with the pad probe
+         */
+        GMutex m_relinkMutex;
+        GCond m_relinkCond;
+        
+        /**
+         * @brief true while Relink is waiting on the pad probe, cleared by 
+         * Relink on timeout to cancel the swap
+         */
+        bool m_relinkPending;
+        
+        /**
+         * @brief true once the pad probe has started the swap, which can 
+         * no longer be cancelled
+         */
+        bool m_relinkSwapping;
+        
+        /**
+         * @brief result of the segment swap performed by the pad probe
+         */
+        bool m_relinkResult;
+        
+        /**
+         * @brief unchanged components on either side of the segment being relinked
+         */
+        DSL_BINTR_PTR m_pRelinkUpstream;
+        DSL_BINTR_PTR m_pRelinkDownstream;
+        
+        /**
+         * @brief currently linked and new segments, either of which may be empty
+         */
+        std::vector<DSL_BINTR_PTR> m_relinkOldSegment;
+        std::vector<DSL_BINTR_PTR> m_relinkNewSegment;
+        
         /**
          * @brief optional, one at most Primary GIE for this Branch
          */
@@ -215,6 +353,16 @@ namespace DSL
         
     }; // Branch
     
+    /**
+     * @brief IDLE Pad Probe callback function to swap a segment of a Branch
+     * @param[in] pPad the upstream component's src pad
+     * @param[in] pInfo pad probe info
+     * @param[in] pBranch pointer to the BranchBintr being relinked
+     * @return GST_PAD_PROBE_REMOVE always
+     */
+    static GstPadProbeReturn BranchRelinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pBranch);
+    
 } // Namespace
 
 #endif // _DSL_BRANCH_H
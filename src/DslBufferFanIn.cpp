@@ -0,0 +1,146 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslBufferFanIn.h"
+
+namespace DSL
+{
+    BufferFanIn::BufferFanIn(const char* name)
+        : m_name(name)
+        , m_stopped(false)
+        , m_flushing(false)
+    {
+        LOG_FUNC();
+        
+        std::string quarkName = "dsl-fan-in-" + m_name;
+        m_quark = g_quark_from_string(quarkName.c_str());
+        
+        g_mutex_init(&m_waitMutex);
+        g_cond_init(&m_waitCond);
+    }
+    
+    BufferFanIn::~BufferFanIn()
+    {
+        LOG_FUNC();
+        
+        g_cond_clear(&m_waitCond);
+        g_mutex_clear(&m_waitMutex);
+    }
+    
+    void BufferFanIn::Reset()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+        
+        m_stopped = false;
+        m_flushing = false;
+    }
+    
+    void BufferFanIn::Expect(GstBuffer* pBuffer, uint numBranches)
+    {
+        // Any counter left from an abandoned wait is destroyed on replacement.
+        // The buffer can only be reused once all branches have released it.
+        gst_mini_object_set_qdata(GST_MINI_OBJECT(pBuffer), m_quark, 
+            new std::atomic<int>(numBranches), BufferFanInCounterDestroyCB);
+    }
+    
+    void BufferFanIn::Complete(GstBuffer* pBuffer)
+    {
+        std::atomic<int>* pCounter = static_cast<std::atomic<int>*>(
+            gst_mini_object_get_qdata(GST_MINI_OBJECT(pBuffer), m_quark));
+            
+        // Only the last branch to complete takes the mutex to signal
+        if (pCounter and pCounter->fetch_sub(1) == 1)
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+            g_cond_signal(&m_waitCond);
+        }
+    }
+    
+    bool BufferFanIn::Wait(GstBuffer* pBuffer)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+
+        std::atomic<int>* pCounter = static_cast<std::atomic<int>*>(
+            gst_mini_object_get_qdata(GST_MINI_OBJECT(pBuffer), m_quark));
+        if (!pCounter)
+        {
+            return true;
+        }
+        gint64 endTime(g_get_monotonic_time() + DSL_FAN_IN_MAX_WAIT_MS * G_TIME_SPAN_MILLISECOND);
+        
+        while (pCounter->load() > 0)
+        {
+            if (m_stopped or m_flushing)
+            {
+                return false;
+            }
+            // The buffer is never released while a branch can still write 
+            // to it. Log each interval without completion and keep waiting.
+            if (!g_cond_wait_until(&m_waitCond, &m_waitMutex, endTime))
+            {
+                LOG_WARN("BufferFanIn '" << m_name << "' still waiting on " 
+                    << pCounter->load() << " branches after " 
+                    << DSL_FAN_IN_MAX_WAIT_MS << " ms");
+                endTime = g_get_monotonic_time() + 
+                    DSL_FAN_IN_MAX_WAIT_MS * G_TIME_SPAN_MILLISECOND;
+            }
+        }
+        // All branches are done with the counter, safe to remove and destroy
+        gst_mini_object_set_qdata(GST_MINI_OBJECT(pBuffer), m_quark, NULL, NULL);
+        return true;
+    }
+    
+    void BufferFanIn::SetStopped()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+        
+        m_stopped = true;
+        g_cond_broadcast(&m_waitCond);
+    }
+    
+    void BufferFanIn::SetFlushing(bool flushing)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_waitMutex);
+        
+        m_flushing = flushing;
+        if (flushing)
+        {
+            g_cond_broadcast(&m_waitCond);
+        }
+        else
+        {
+            // a flush-stop also follows a seek after EOS
+            m_stopped = false;
+        }
+    }
+    
+    static void BufferFanInCounterDestroyCB(gpointer pCounter)
+    {
+        delete static_cast<std::atomic<int>*>(pCounter);
+    }
+}
@@ -0,0 +1,140 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_BUFFER_FAN_IN_H
+#define _DSL_BUFFER_FAN_IN_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief interval, in milliseconds, between warnings logged while 
+     * waiting on all branches to complete a shared buffer. The buffer is 
+     * held until completion, EOS, or Flush.
+     */
+    #define DSL_FAN_IN_MAX_WAIT_MS                  1000
+
+    /**
+     * @class BufferFanIn
+     * @brief Synchronizes the completion of a buffer that is shared by 
+     * multiple Tee branches. A per-buffer atomic counter is attached to the 
+     * buffer as qdata on fan-out, each branch decrements the counter on 
+     * completion, and the last branch signals the single waiting thread.
+     * Waiters are unblocked on EOS and Flush without polling.
+     */
+    class BufferFanIn
+    {
+    public:
+    
+        /**
+         * @brief ctor for the BufferFanIn class
+         * @param[in] name name of the owning component for logging
+         */
+        BufferFanIn(const char* name);
+        
+        ~BufferFanIn();
+        
+        /**
+         * @brief clears the stopped and flushing states, called on link
+         */
+        void Reset();
+        
+        /**
+         * @brief attaches a new pending counter to a buffer on fan-out
+         * @param[in] pBuffer buffer shared by all branches
+         * @param[in] numBranches number of branches that will complete the buffer
+         */
+        void Expect(GstBuffer* pBuffer, uint numBranches);
+        
+        /**
+         * @brief called by each branch on completion of a shared buffer. 
+         * The last branch to complete signals the waiting thread.
+         * @param[in] pBuffer buffer completed by the calling branch
+         */
+        void Complete(GstBuffer* pBuffer);
+        
+        /**
+         * @brief blocks the calling thread until all branches have completed
+         * the buffer, or until the BufferFanIn is stopped or flushing. A 
+         * warning is logged every DSL_FAN_IN_MAX_WAIT_MS without completion.
+         * @param[in] pBuffer buffer to wait on
+         * @return true if all branches completed, false if stopped or flushing
+         * with branches still pending.
+         */
+        bool Wait(GstBuffer* pBuffer);
+        
+        /**
+         * @brief sets the stopped state, on EOS, and unblocks all waiters
+         */
+        void SetStopped();
+        
+        /**
+         * @brief sets the flushing state and unblocks all waiters on start
+         * @param[in] flushing true on flush-start, false on flush-stop
+         */
+        void SetFlushing(bool flushing);
+        
+    private:
+    
+        /**
+         * @brief name of the owning component for logging
+         */
+        std::string m_name;
+        
+        /**
+         * @brief qdata key for the pending counter attached to each buffer
+         */
+        GQuark m_quark;
+        
+        /**
+         * @brief mutex protecting the wait condition and states
+         */
+        GMutex m_waitMutex;
+        
+        /**
+         * @brief signaled by the last branch to complete, and on EOS or Flush
+         */
+        GCond m_waitCond;
+        
+        /**
+         * @brief set on EOS, cleared on Reset and flush-stop
+         */
+        bool m_stopped;
+        
+        /**
+         * @brief set between flush-start and flush-stop
+         */
+        bool m_flushing;
+    };
+    
+    /**
+     * @brief destroy notify for the pending counter attached to a buffer
+     * @param[in] pCounter pointer to the std::atomic<int> counter to delete
+     */
+    static void BufferFanInCounterDestroyCB(gpointer pCounter);
+}
+
+#endif // _DSL_BUFFER_FAN_IN_H
@@ -0,0 +1,229 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslClassificationCache.h"
+
+namespace DSL
+{
+    ClassificationCache::ClassificationCache(const char* name)
+        : m_name(name)
+        , m_minCount(DSL_DEFAULT_CLASSIFICATION_CACHE_MIN_COUNT)
+        , m_minConfidence(DSL_DEFAULT_CLASSIFICATION_CACHE_MIN_CONFIDENCE)
+        , m_ttl(DSL_DEFAULT_CLASSIFICATION_CACHE_TTL)
+        , m_numClassifiers(1)
+        , m_hits(0)
+        , m_misses(0)
+        , m_nextEviction(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_cacheMutex);
+    }
+    
+    ClassificationCache::~ClassificationCache()
+    {
+        LOG_FUNC();
+        
+        g_mutex_clear(&m_cacheMutex);
+    }
+
+    void ClassificationCache::GetSettings(uint* minCount, double* minConfidence, uint* ttl)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        *minCount = m_minCount;
+        *minConfidence = m_minConfidence;
+        *ttl = m_ttl;
+    }
+    
+    bool ClassificationCache::SetSettings(uint minCount, double minConfidence, uint ttl)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        if (!minCount or !ttl or minConfidence < 0 or minConfidence > 1)
+        {
+            LOG_ERROR("Invalid classification cache settings for Pipeline '" << m_name << "'");
+            return false;
+        }
+        m_minCount = minCount;
+        m_minConfidence = minConfidence;
+        m_ttl = ttl;
+        return true;
+    }
+    
+    void ClassificationCache::SetNumClassifiers(uint numClassifiers)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        // Frozen objects may be missing labels from any new classifiers
+        if (numClassifiers != m_numClassifiers)
+        {
+            m_entries.clear();
+        }
+        m_numClassifiers = numClassifiers;
+    }
+    
+    bool ClassificationCache::Lookup(uint sourceId, guint64 objectId, gint64 now)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        auto entry = m_entries.find(GetKey(sourceId, objectId));
+        if (entry == m_entries.end() or !entry->second.frozen)
+        {
+            m_misses++;
+            return false;
+        }
+        entry->second.lastSeen = now;
+        m_hits++;
+        return true;
+    }
+    
+    bool ClassificationCache::GetLabels(uint sourceId, guint64 objectId, 
+        std::vector<CachedLabel>& labels)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        auto entry = m_entries.find(GetKey(sourceId, objectId));
+        if (entry == m_entries.end() or !entry->second.frozen)
+        {
+            return false;
+        }
+        labels.clear();
+        for (auto const& imap: entry->second.labels)
+        {
+            labels.push_back(imap.second.first);
+        }
+        return true;
+    }
+    
+    void ClassificationCache::Observe(uint sourceId, guint64 objectId, 
+        const std::vector<CachedLabel>& labels, gint64 now)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        guint64 key = GetKey(sourceId, objectId);
+        
+        if (m_entries.find(key) == m_entries.end())
+        {
+            if (m_entries.size() >= DSL_CLASSIFICATION_CACHE_MAX_ENTRIES)
+            {
+                EvictOldest();
+            }
+            m_entries[key].frozen = false;
+        }
+        CacheEntry& entry = m_entries[key];
+        entry.lastSeen = now;
+        
+        if (entry.frozen)
+        {
+            return;
+        }
+        for (auto const& label: labels)
+        {
+            auto& cached = entry.labels[std::make_pair(label.componentId, label.labelId)];
+            
+            if (label.probability < m_minConfidence)
+            {
+                cached.second = 0;
+            }
+            else if (cached.second and cached.first.classId == label.classId)
+            {
+                cached.second++;
+            }
+            else
+            {
+                cached.first = label;
+                cached.second = 1;
+            }
+        }
+        
+        // Freeze once every classifier has labeled the object consistently
+        std::set<gint> confidentClassifiers;
+        for (auto const& imap: entry.labels)
+        {
+            if (imap.second.second < m_minCount)
+            {
+                return;
+            }
+            confidentClassifiers.insert(imap.first.first);
+        }
+        entry.frozen = (confidentClassifiers.size() >= m_numClassifiers);
+    }
+
+    void ClassificationCache::Evict(gint64 now)
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        // Scan at most four times per time-to-live, not on every batch
+        if (now < m_nextEviction)
+        {
+            return;
+        }
+        m_nextEviction = now + (gint64)m_ttl * G_TIME_SPAN_MILLISECOND / 4;
+        
+        gint64 expired = now - (gint64)m_ttl * G_TIME_SPAN_MILLISECOND;
+        
+        for (auto entry = m_entries.begin(); entry != m_entries.end();)
+        {
+            if (entry->second.lastSeen < expired)
+            {
+                entry = m_entries.erase(entry);
+            }
+            else
+            {
+                entry++;
+            }
+        }
+    }
+    
+    void ClassificationCache::EvictOldest()
+    {
+        auto oldest = m_entries.begin();
+        for (auto entry = m_entries.begin(); entry != m_entries.end(); entry++)
+        {
+            if (entry->second.lastSeen < oldest->second.lastSeen)
+            {
+                oldest = entry;
+            }
+        }
+        if (oldest != m_entries.end())
+        {
+            m_entries.erase(oldest);
+        }
+    }
+    
+    void ClassificationCache::GetStats(uint64_t* hits, uint64_t* misses, uint* entries)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_cacheMutex);
+        
+        *hits = m_hits;
+        *misses = m_misses;
+        *entries = m_entries.size();
+    }
+}
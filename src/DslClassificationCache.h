@@ -0,0 +1,250 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_CLASSIFICATION_CACHE_H
+#define _DSL_CLASSIFICATION_CACHE_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_CLASSIFICATION_CACHE_PTR std::shared_ptr<ClassificationCache>
+    #define DSL_CLASSIFICATION_CACHE_NEW(name) \
+        std::shared_ptr<ClassificationCache>(new ClassificationCache(name))    
+
+    /**
+     * @brief maximum number of tracked objects held by the cache at one time.
+     * The least recently seen object is evicted when full.
+     */
+    #define DSL_CLASSIFICATION_CACHE_MAX_ENTRIES    4096
+    
+    /**
+     * @brief unique component id set on cached objects to skip the Secondary
+     * GIEs. Never assigned to a GIE, or by DeepStream, and restored downstream.
+     */
+    #define DSL_CLASSIFICATION_CACHE_SKIP_ID        -2
+
+    /**
+     * @brief a single classification result from a Secondary GIE
+     */
+    struct CachedLabel
+    {
+        /**
+         * @brief unique id of the Secondary GIE that produced the label
+         */
+        gint componentId;
+        
+        /**
+         * @brief index of the label for multi-label classifiers
+         */
+        guint labelId;
+        
+        /**
+         * @brief number of classes of the classifier
+         */
+        guint numClasses;
+        
+        guint classId;
+        
+        gfloat probability;
+        
+        std::string label;
+    };
+    
+    /**
+     * @class ClassificationCache
+     * @brief Caches the Secondary GIE classifications of tracked objects keyed
+     * by source-id and object-id. Once every classifier has labeled an object with
+     * the same class and sufficient confidence a minimum number of times, the 
+     * labels are frozen and the object no longer needs secondary inference. 
+     * Objects not seen within the time-to-live are evicted as lost tracks.
+     */
+    class ClassificationCache
+    {
+    public:
+        
+        /**
+         * @brief ctor for the ClassificationCache class
+         * @param[in] name name of the Pipeline using the cache
+         */
+        ClassificationCache(const char* name);
+        
+        ~ClassificationCache();
+        
+        /**
+         * @brief Gets the current cache settings
+         * @param[out] minCount number of confident classifications required to freeze
+         * @param[out] minConfidence minimum probability for a confident classification
+         * @param[out] ttl time-to-live in milliseconds for objects not seen
+         */
+        void GetSettings(uint* minCount, double* minConfidence, uint* ttl);
+        
+        /**
+         * @brief Sets the cache settings, applied to all new classifications
+         * @param[in] minCount number of confident classifications required to freeze
+         * @param[in] minConfidence minimum probability for a confident classification
+         * @param[in] ttl time-to-live in milliseconds for objects not seen
+         * @return false if any of the settings are invalid
+         */
+        bool SetSettings(uint minCount, double minConfidence, uint ttl);
+        
+        /**
+         * @brief Sets the number of classifiers that must label an object 
+         * before it can be frozen, set on link to the number of Secondary GIEs
+         * @param[in] numClassifiers number of linked Secondary GIEs
+         */
+        void SetNumClassifiers(uint numClassifiers);
+        
+        /**
+         * @brief Looks up an object, refreshing its last-seen time and counting
+         * a cache hit if frozen, or a miss otherwise.
+         * @param[in] sourceId source-id of the frame containing the object
+         * @param[in] objectId tracker assigned object-id
+         * @param[in] now current monotonic time in microseconds
+         * @return true if the object's labels are frozen
+         */
+        bool Lookup(uint sourceId, guint64 objectId, gint64 now);
+        
+        /**
+         * @brief Gets the frozen labels for an object
+         * @param[in] sourceId source-id of the frame containing the object
+         * @param[in] objectId tracker assigned object-id
+         * @param[out] labels frozen labels for the object
+         * @return false if the object is not frozen
+         */
+        bool GetLabels(uint sourceId, guint64 objectId, std::vector<CachedLabel>& labels);
+        
+        /**
+         * @brief Observes the classifications of an object on a single frame
+         * @param[in] sourceId source-id of the frame containing the object
+         * @param[in] objectId tracker assigned object-id
+         * @param[in] labels classifications produced for the object, may be empty
+         * @param[in] now current monotonic time in microseconds
+         */
+        void Observe(uint sourceId, guint64 objectId, 
+            const std::vector<CachedLabel>& labels, gint64 now);
+        
+        /**
+         * @brief Evicts all objects not seen within the time-to-live
+         * @param[in] now current monotonic time in microseconds
+         */
+        void Evict(gint64 now);
+        
+        /**
+         * @brief Gets the cache statistics since creation
+         * @param[out] hits number of object lookups found frozen
+         * @param[out] misses number of object lookups not frozen
+         * @param[out] entries current number of objects in the cache
+         */
+        void GetStats(uint64_t* hits, uint64_t* misses, uint* entries);
+        
+    private:
+    
+        /**
+         * @brief cached state for a single tracked object
+         */
+        struct CacheEntry
+        {
+            /**
+             * @brief last label seen from each classifier, keyed by component 
+             * and label id, with the number of consecutive confident matches
+             */
+            std::map<std::pair<gint, guint>, std::pair<CachedLabel, uint>> labels;
+            
+            /**
+             * @brief true once every classifier has reached the minimum count
+             */
+            bool frozen;
+            
+            /**
+             * @brief monotonic time in microseconds the object was last seen
+             */
+            gint64 lastSeen;
+        };
+        
+        /**
+         * @brief Gets the compact cache key for an object
+         */
+        guint64 GetKey(uint sourceId, guint64 objectId)
+        {
+            return (objectId & 0x00FFFFFFFFFFFFFF) | ((guint64)sourceId << 56);
+        }
+        
+        /**
+         * @brief Evicts the least recently seen object, called when full
+         */
+        void EvictOldest();
+        
+        /**
+         * @brief name of the Pipeline using the cache, for logging
+         */
+        std::string m_name;
+        
+        /**
+         * @brief number of confident classifications required to freeze
+         */
+        uint m_minCount;
+        
+        /**
+         * @brief minimum probability for a confident classification
+         */
+        double m_minConfidence;
+        
+        /**
+         * @brief time-to-live in milliseconds for objects not seen
+         */
+        uint m_ttl;
+        
+        /**
+         * @brief number of classifiers that must label an object to freeze
+         */
+        uint m_numClassifiers;
+        
+        /**
+         * @brief all cached objects keyed by source-id and object-id
+         */
+        std::unordered_map<guint64, CacheEntry> m_entries;
+        
+        uint64_t m_hits;
+        
+        uint64_t m_misses;
+        
+        /**
+         * @brief monotonic time in microseconds of the next eviction scan
+         */
+        gint64 m_nextEviction;
+        
+        /**
+         * @brief mutex shared by the lookup and observe pad probes
+         */
+        GMutex m_cacheMutex;
+    };
+}
+
+#endif // _DSL_CLASSIFICATION_CACHE_H
@@ -74,6 +74,26 @@ namespace DSL
             LOG_FUNC();
         };
 
+        /**
+         * @brief checks that a GST Element factory is registered, without
+         * creating an Element. Used by Bintrs that create their Elementrs on link.
+         * @param[in] factoryName GST factory name to find
+         * @return true if the factory is registered, false otherwise
+         */
+        static bool FactoryExists(const char* factoryName)
+        {
+            LOG_FUNC();
+
+            GstElementFactory* pFactory = gst_element_factory_find(factoryName);
+            if (!pFactory)
+            {
+                LOG_ERROR("Element factory '" << factoryName << "' is not registered");
+                return false;
+            }
+            gst_object_unref(pFactory);
+            return true;
+        }
+
         /**
          * @brief Gets a GST Element's attribute of type int, owned by this Elementr
          * @param[in] name name of the attribute to set
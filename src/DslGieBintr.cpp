@@ -438,6 +438,32 @@ namespace DSL
         return true;
     }
     
+    bool SecondaryGieBintr::LinkAllInSeries()
+    {
+        LOG_FUNC();
+
+        if (!m_batchSize)
+        {
+            LOG_ERROR("SecondaryGieBintr '" << GetName() << "' can not be linked: batch size = 0");
+            return false;
+        }
+        if (m_isLinked)
+        {
+            LOG_ERROR("SecondaryGieBintr '" << GetName() << "' is already linked");
+            return false;
+        }
+        // The Fake Sink is left unlinked, the parent links the Infer Engine onward
+        if (!m_pQueue->LinkToSink(m_pInferEngine))
+        {
+            LOG_ERROR("SecondaryGieBintr '" << GetName() << "' failed to link in series");
+            return false;
+        }
+        
+        m_isLinked = true;
+        
+        return true;
+    }
+    
     void SecondaryGieBintr::UnlinkAll()
     {
         LOG_FUNC();
@@ -447,7 +473,10 @@ namespace DSL
             LOG_ERROR("SecondaryGieBintr '" << GetName() << "' is not linked");
             return;
         }
-        m_pInferEngine->UnlinkFromSink();
+        if (m_pInferEngine->IsLinkedToSink())
+        {
+            m_pInferEngine->UnlinkFromSink();
+        }
         m_pQueue->UnlinkFromSink();
 
         m_isLinked = false;
@@ -311,6 +311,13 @@ namespace DSL
          */
         void UnlinkAll();
         
+        /**
+         * @brief Links the Queue and Infer Engine Elementrs only, leaving the
+         * Infer Engine to be linked to the next SGIE in a serial chain.
+         * @return true if all links were succesful, false otherwise
+         */
+        bool LinkAllInSeries();
+        
         /**
          * @brief Links this SGIE's Queue Elementr as sink back to the provided source pTee
          * @param[in] pTee that is source for this Secondary GIE
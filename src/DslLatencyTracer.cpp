@@ -0,0 +1,196 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslLatencyTracer.h"
+
+namespace DSL
+{
+    LatencyTracer::LatencyTracer(const char* name)
+        : m_name(name)
+        , m_histogram(DSL_LATENCY_NUM_BUCKETS, 0)
+        , m_count(0)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_mutex);
+    }
+    
+    LatencyTracer::~LatencyTracer()
+    {
+        LOG_FUNC();
+        
+        g_mutex_clear(&m_mutex);
+    }
+    
+    void LatencyTracer::RemoveProbes()
+    {
+        LOG_FUNC();
+        
+        // A callback already in progress keeps its reference to this tracer 
+        // until complete, the reference is then released by the destroy notify
+        for (auto const& ivec: m_probes)
+        {
+            gst_pad_remove_probe(ivec.first, ivec.second);
+            gst_object_unref(ivec.first);
+        }
+        m_probes.clear();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_mutex);
+        m_entryTimes.clear();
+    }
+    
+    void LatencyTracer::AddEntryPad(GstPad* pPad, int sourceId)
+    {
+        LOG_FUNC();
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_mutex);
+            m_entryPads[pPad] = sourceId;
+        }
+        gulong probeId = gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER, 
+            LatencyTracerEntryProbeCB, new DSL_LATENCY_TRACER_PTR(shared_from_this()), 
+            LatencyTracerProbeDestroyCB);
+        m_probes.push_back(std::make_pair(GST_PAD(gst_object_ref(pPad)), probeId));
+    }
+    
+    void LatencyTracer::AddExitPad(GstPad* pPad)
+    {
+        LOG_FUNC();
+        
+        gulong probeId = gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER, 
+            LatencyTracerExitProbeCB, new DSL_LATENCY_TRACER_PTR(shared_from_this()), 
+            LatencyTracerProbeDestroyCB);
+        m_probes.push_back(std::make_pair(GST_PAD(gst_object_ref(pPad)), probeId));
+    }
+
+    void LatencyTracer::HandleEntry(GstPad* pPad, GstBuffer* pBuffer)
+    {
+        gint64 now = g_get_monotonic_time();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_mutex);
+        
+        // Buffers dropped inside the component never exit, so bound the pending
+        // entries by discarding the oldest, i.e. lowest PTS, first
+        if (m_entryTimes.size() >= DSL_LATENCY_MAX_PENDING)
+        {
+            m_entryTimes.erase(m_entryTimes.begin());
+        }
+        m_entryTimes[std::make_pair(GST_BUFFER_PTS(pBuffer), m_entryPads[pPad])] = now;
+    }
+    
+    void LatencyTracer::HandleExit(GstBuffer* pBuffer)
+    {
+        gint64 now = g_get_monotonic_time();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_mutex);
+        
+        auto entry = m_entryTimes.find(std::make_pair(GST_BUFFER_PTS(pBuffer), DSL_LATENCY_BATCHED));
+        if (entry != m_entryTimes.end())
+        {
+            AddLatency(now - entry->second);
+            m_entryTimes.erase(entry);
+            return;
+        }
+        
+        // Unbatched entry, i.e. across the StreamMux - correlate each frame in 
+        // the batch by its original PTS and source-id
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (!pBatchMeta)
+        {
+            return;
+        }
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            
+            entry = m_entryTimes.find(std::make_pair(pFrameMeta->buf_pts, (int)pFrameMeta->source_id));
+            if (entry != m_entryTimes.end())
+            {
+                AddLatency(now - entry->second);
+                m_entryTimes.erase(entry);
+            }
+        }
+    }
+    
+    void LatencyTracer::AddLatency(gint64 latency)
+    {
+        uint bucket = std::min((uint)(std::max(latency, (gint64)0) / DSL_LATENCY_BUCKET_WIDTH_US), 
+            (uint)DSL_LATENCY_NUM_BUCKETS-1);
+        m_histogram[bucket]++;
+        m_count++;
+    }
+    
+    double LatencyTracer::GetPercentile(uint percentile)
+    {
+        if (!m_count)
+        {
+            return 0;
+        }
+        uint64_t target = ((uint64_t)m_count*percentile + 99) / 100;
+        uint64_t cumulative(0);
+        uint bucket(0);
+        for (; bucket < DSL_LATENCY_NUM_BUCKETS-1; bucket++)
+        {
+            cumulative += m_histogram[bucket];
+            if (cumulative >= target)
+            {
+                break;
+            }
+        }
+        return (double)((bucket+1) * DSL_LATENCY_BUCKET_WIDTH_US) / 1000;
+    }
+    
+    void LatencyTracer::GetPercentiles(double* p50, double* p95, double* p99, uint* count)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_mutex);
+        
+        *p50 = GetPercentile(50);
+        *p95 = GetPercentile(95);
+        *p99 = GetPercentile(99);
+        *count = m_count;
+    }
+    
+    static GstPadProbeReturn LatencyTracerEntryProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTracer)
+    {
+        (*static_cast<DSL_LATENCY_TRACER_PTR*>(pTracer))->HandleEntry(pPad, 
+            GST_PAD_PROBE_INFO_BUFFER(pInfo));
+        return GST_PAD_PROBE_OK;
+    }
+
+    static GstPadProbeReturn LatencyTracerExitProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTracer)
+    {
+        (*static_cast<DSL_LATENCY_TRACER_PTR*>(pTracer))->HandleExit(
+            GST_PAD_PROBE_INFO_BUFFER(pInfo));
+        return GST_PAD_PROBE_OK;
+    }
+    
+    static void LatencyTracerProbeDestroyCB(gpointer pTracer)
+    {
+        delete static_cast<DSL_LATENCY_TRACER_PTR*>(pTracer);
+    }
+}
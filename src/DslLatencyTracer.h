@@ -0,0 +1,200 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_LATENCY_TRACER_H
+#define _DSL_LATENCY_TRACER_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_LATENCY_TRACER_PTR std::shared_ptr<LatencyTracer>
+    #define DSL_LATENCY_TRACER_NEW(name) \
+        std::shared_ptr<LatencyTracer>(new LatencyTracer(name))    
+
+    /**
+     * @brief width of each latency histogram bucket in microseconds
+     */
+    #define DSL_LATENCY_BUCKET_WIDTH_US             100
+    
+    /**
+     * @brief number of latency histogram buckets, the last bucket 
+     * counts all samples beyond the range of the histogram
+     */
+    #define DSL_LATENCY_NUM_BUCKETS                 5000
+    
+    /**
+     * @brief maximum number of unmatched entry timestamps held at one time
+     */
+    #define DSL_LATENCY_MAX_PENDING                 256
+
+    /**
+     * @brief source-id for entry pads with batched buffers
+     */
+    #define DSL_LATENCY_BATCHED                     -1
+
+    /**
+     * @class LatencyTracer
+     * @brief Measures the latency across a Bintr by timestamping buffers on 
+     * entry and exit pad probes. Buffers are correlated by PTS and source-id,
+     * and latencies are accumulated into a fixed histogram for percentiles.
+     * Each pad probe holds a reference to the tracer, released by GStreamer 
+     * once the probe is removed and any callback in progress has completed.
+     */
+    class LatencyTracer : public std::enable_shared_from_this<LatencyTracer>
+    {
+    public:
+        
+        /**
+         * @brief ctor for the LatencyTracer class
+         * @param[in] name name of the traced component to report
+         */
+        LatencyTracer(const char* name);
+        
+        /**
+         * @brief dtor for the LatencyTracer class, only called once all pad
+         * probes have been removed and released
+         */
+        ~LatencyTracer();
+
+        /**
+         * @brief returns the name of the traced component
+         */
+        const std::string& GetName()
+        {
+            return m_name;
+        }
+
+        /**
+         * @brief Adds a buffer probe to timestamp buffers entering the traced component
+         * @param[in] pPad pad to add the entry probe to
+         * @param[in] sourceId source-id of the unbatched stream on the pad,
+         * or DSL_LATENCY_BATCHED for batched buffers
+         */
+        void AddEntryPad(GstPad* pPad, int sourceId);
+
+        /**
+         * @brief Adds a buffer probe to measure buffers leaving the traced component
+         * @param[in] pPad pad to add the exit probe to
+         */
+        void AddExitPad(GstPad* pPad);
+
+        /**
+         * @brief Removes all pad probes, keeping the latencies measured so far.
+         * Must be called before the tracer is released by its owner, as each 
+         * probe holds a reference to the tracer.
+         */
+        void RemoveProbes();
+
+        /**
+         * @brief Gets the latency percentiles for all buffers measured 
+         * @param[out] p50 50th percentile latency in milliseconds
+         * @param[out] p95 95th percentile latency in milliseconds
+         * @param[out] p99 99th percentile latency in milliseconds
+         * @param[out] count number of latencies measured
+         */
+        void GetPercentiles(double* p50, double* p95, double* p99, uint* count);
+
+        /**
+         * @brief Handles a buffer on one of the entry pads
+         * @param[in] pPad entry pad the buffer was received on
+         * @param[in] pBuffer buffer to timestamp
+         */
+        void HandleEntry(GstPad* pPad, GstBuffer* pBuffer);
+
+        /**
+         * @brief Handles a buffer on one of the exit pads
+         * @param[in] pBuffer buffer to measure
+         */
+        void HandleExit(GstBuffer* pBuffer);
+
+    private:
+    
+        /**
+         * @brief Adds a single latency to the histogram, m_mutex must be held
+         * @param[in] latency latency in microseconds
+         */
+        void AddLatency(gint64 latency);
+        
+        /**
+         * @brief Gets a single percentile from the histogram, m_mutex must be held
+         * @param[in] percentile [0..100]
+         * @return upper edge of the percentile's bucket in milliseconds
+         */
+        double GetPercentile(uint percentile);
+
+        /**
+         * @brief name of the traced component
+         */
+        std::string m_name;
+        
+        /**
+         * @brief mutex to protect the entry timestamps and histogram
+         */
+        GMutex m_mutex;
+        
+        /**
+         * @brief source-id for each entry pad, mapped by pad
+         */
+        std::map<GstPad*, int> m_entryPads;
+        
+        /**
+         * @brief all pads with a probe id installed by this tracer
+         */
+        std::vector<std::pair<GstPad*, gulong>> m_probes;
+
+        /**
+         * @brief monotonic entry time in microseconds, mapped by PTS and source-id
+         */
+        std::map<std::pair<GstClockTime, int>, gint64> m_entryTimes;
+        
+        /**
+         * @brief latency histogram with DSL_LATENCY_NUM_BUCKETS buckets
+         */
+        std::vector<uint> m_histogram;
+        
+        /**
+         * @brief number of latencies added to the histogram
+         */
+        uint m_count;
+    };
+    
+    static GstPadProbeReturn LatencyTracerEntryProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTracer);
+
+    static GstPadProbeReturn LatencyTracerExitProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pTracer);
+
+    /**
+     * @brief Pad probe destroy notify, releases the probe's reference to the tracer
+     * @param pTracer pointer to the DSL_LATENCY_TRACER_PTR held by the probe
+     */
+    static void LatencyTracerProbeDestroyCB(gpointer pTracer);
+}
+
+#endif // _DSL_LATENCY_TRACER_H
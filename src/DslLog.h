@@ -25,15 +25,44 @@ THE SOFTWARE.
 #ifndef _DSL_LOG_H
 #define _DSL_LOG_H
 
-inline std::string methodName(const std::string& prettyFunction)
+/**
+ * @struct MethodName
+ * @brief Slice of __PRETTY_FUNCTION__ holding the qualified method name,
+ * i.e. "DSL::Nodetr::GetName", with the return type and parameters removed.
+ */
+struct MethodName
 {
-    size_t colons = prettyFunction.find("::");
-    size_t begin = prettyFunction.substr(0,colons).rfind(" ") + 1;
-    size_t end = prettyFunction.rfind("(") - begin;
-
-    return prettyFunction.substr(begin,end) + "()";
+    const char* str;
+    int length;
+};
+
+/**
+ * @brief Slices the qualified method name out of a pretty function string. 
+ * Evaluated at compile time when used to initialize a constexpr variable, 
+ * as done by LOG_FUNC.
+ * @param[in] prettyFunction value of __PRETTY_FUNCTION__ for the calling method
+ * @return slice of prettyFunction from the end of the return type to the first "("
+ */
+constexpr MethodName methodName(const char* prettyFunction)
+{
+    size_t end(0);
+    while (prettyFunction[end] and prettyFunction[end] != '(')
+    {
+        end++;
+    }
+    size_t begin(end);
+    while (begin > 0 and prettyFunction[begin-1] != ' ')
+    {
+        begin--;
+    }
+    return MethodName{prettyFunction+begin, (int)(end-begin)};
 }
 
+/**
+ * Expression for the current method name. A constant expression, but only 
+ * guaranteed to be evaluated at compile time when it initializes a constexpr
+ * variable. Otherwise the slice may be computed on each call.
+ */
 #define __METHOD_NAME__ methodName(__PRETTY_FUNCTION__)
 
 #if defined(DSL_LOGGER_IMP)
@@ -32,19 +32,39 @@ GST_DEBUG_CATEGORY_EXTERN(GST_CAT_DSL);
 namespace DSL
 {
 
+/**
+ * @brief returns true if messages at the given level will be logged by the DSL 
+ * debug category. Checked before any formatting so that disabled logging only
+ * costs a comparison against the global minimum level.
+ */
+#ifndef GST_DISABLE_GST_DEBUG
+#define LOG_LEVEL_ENABLED(level) \
+    (G_UNLIKELY((level) <= _gst_debug_min) and GST_CAT_DSL and \
+        (level) <= gst_debug_category_get_threshold(GST_CAT_DSL))
+#else
+#define LOG_LEVEL_ENABLED(level) false
+#endif
+
 /**
  * Logs the Entry and Exit of a Function with the DEBUG level.
  * Add macro as the first statement to each function of interest.
- * Consider the intrussion/penalty of this call when adding.
+ * The method name is held in a static constexpr, forcing it to be sliced at 
+ * compile time, and nothing is formatted unless the DSL category is enabled 
+ * at the DEBUG level.
  */
-#define LOG_FUNC() LogFunc lf(__METHOD_NAME__)
+#define LOG_FUNC() \
+    static constexpr MethodName dslMethodName = __METHOD_NAME__; \
+    LogFunc lf(dslMethodName)
 
 #define LOG(message, level) \
     do \
     { \
-        std::stringstream logMessage; \
-        logMessage  << " : " << message; \
-        GST_CAT_LEVEL_LOG(GST_CAT_DSL, level, NULL, logMessage.str().c_str(), NULL); \
+        if (LOG_LEVEL_ENABLED(level)) \
+        { \
+            std::stringstream logMessage; \
+            logMessage  << " : " << message; \
+            GST_CAT_LEVEL_LOG(GST_CAT_DSL, level, NULL, "%s", logMessage.str().c_str()); \
+        } \
     } while (0)
 
 #define LOG_DEBUG(message) LOG(message, GST_LEVEL_DEBUG)
@@ -62,21 +82,33 @@ namespace DSL
     class LogFunc
     {
     public:
-        LogFunc(const std::string& method) 
+        LogFunc(MethodName method) 
+            : m_method(method)
+            , m_enabled(LOG_LEVEL_ENABLED(GST_LEVEL_DEBUG))
         {
-            m_logMessage  << method;
-            GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
-                m_logMessage.str().c_str(), "");
+            if (m_enabled)
+            {
+                GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
+                    "%.*s()", m_method.length, m_method.str);
+            }
         };
         
         ~LogFunc()
         {
-            GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
-                m_logMessage.str().c_str(), "");
+            if (m_enabled)
+            {
+                GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
+                    "%.*s()", m_method.length, m_method.str);
+            }
         };
         
     private:
-        std::stringstream m_logMessage; 
+        MethodName m_method;
+        
+        /**
+         * @brief true if the entry was logged, so the exit is logged as well
+         */
+        bool m_enabled;
     };
 
 } // namespace 
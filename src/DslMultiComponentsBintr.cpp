@@ -31,9 +31,17 @@ namespace DSL
 
     MultiComponentsBintr::MultiComponentsBintr(const char* name, const char* teeType)
         : Bintr(name)
+        , m_teeElisionEnabled(false)
+        , m_isTeeElided(false)
+        , m_restoreTeePending(false)
+        , m_restoreTeeSwapping(false)
+        , m_restoreTeeResult(false)
     {
         LOG_FUNC();
         
+        g_mutex_init(&m_restoreTeeMutex);
+        g_cond_init(&m_restoreTeeCond);
+        
         // Single Queue and Tee element for all Components
         m_pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "sink_bin_queue");
         m_pTee = DSL_ELEMENT_NEW(teeType, "sink_bin_tee");
@@ -45,6 +53,9 @@ namespace DSL
         m_pQueue->AddGhostPadToParent("sink");
         
         m_pSinkPadProbe = DSL_PAD_PROBE_NEW("multi-comp-sink-pad-probe", "sink", m_pQueue);
+        
+        m_pQueuePolicy = DSL_QUEUE_POLICY_NEW(name);
+        m_pQueuePolicy->Attach(m_pQueue->GetGstElement());
     }
     
     MultiComponentsBintr::~MultiComponentsBintr()
@@ -55,6 +66,8 @@ namespace DSL
         {
             UnlinkAll();
         }
+        g_mutex_clear(&m_restoreTeeMutex);
+        g_cond_clear(&m_restoreTeeCond);
     }
     
 
@@ -75,6 +88,12 @@ namespace DSL
             LOG_ERROR("'" << pChildComponent->GetName() << "' is already a child of '" << GetName() << "'");
             return false;
         }
+        if (IsLinked() and m_isTeeElided and !RestoreTee())
+        {
+            LOG_ERROR("Unable to add Component '" << pChildComponent->GetName() 
+                << "' to '" << GetName() << "' as its elided Tee could not be restored");
+            return false;
+        }
 
         // Add the Component to the Components collection and as a child of this Bintr
         m_pChildComponents[pChildComponent->GetName()] = pChildComponent;
@@ -124,6 +143,12 @@ namespace DSL
             LOG_ERROR("' " << pChildComponent->GetName() << "' is NOT a child of '" << GetName() << "'");
             return false;
         }
+        if (IsLinked() and m_isTeeElided and !RestoreTee())
+        {
+            LOG_ERROR("Unable to remove Component '" << pChildComponent->GetName() 
+                << "' from '" << GetName() << "' as its elided Tee could not be restored");
+            return false;
+        }
         if (pChildComponent->IsLinkedToSource())
         {
             // unlink the sink from the Tee
@@ -148,6 +173,26 @@ namespace DSL
             LOG_ERROR("MultiComponentsBintr '" << GetName() << "' is already linked");
             return false;
         }
+        // A single child has its own Queue, so the Queue and Tee can be elided, 
+        // linking the child directly to this Bintr's sink ghost pad
+        if (m_teeElisionEnabled and m_pChildComponents.size() == 1)
+        {
+            DSL_BINTR_PTR pChildComponent = m_pChildComponents.begin()->second;
+            
+            pChildComponent->SetId(0);
+            if (!pChildComponent->LinkAll() or 
+                !SetSinkGhostPadTarget(pChildComponent->GetGstElement()))
+            {
+                LOG_ERROR("MultiComponentsBintr '" << GetName() 
+                    << "' failed to Link Child Component '" << pChildComponent->GetName() << "'");
+                return false;
+            }
+            LOG_INFO("MultiComponentsBintr '" << GetName() << "' elided its Queue and Tee for '"
+                << pChildComponent->GetName() << "'");
+            m_isTeeElided = true;
+            m_isLinked = true;
+            return true;
+        }
         m_pQueue->LinkToSink(m_pTee);
 
         uint id(0);
@@ -177,6 +222,18 @@ namespace DSL
             LOG_ERROR("MultiComponentsBintr '" << GetName() << "' is not linked");
             return;
         }
+        if (m_isTeeElided)
+        {
+            for (auto const& imap: m_pChildComponents)
+            {
+                imap.second->UnlinkAll();
+                imap.second->SetId(-1);
+            }
+            SetSinkGhostPadTarget(m_pQueue->GetGstElement());
+            m_isTeeElided = false;
+            m_isLinked = false;
+            return;
+        }
         for (auto const& imap: m_pChildComponents)
         {
             // unlink from the Tee Element
@@ -269,6 +326,178 @@ namespace DSL
         }
         return Bintr::SetBatchSize(batchSize);
     }
+    
+    void MultiComponentsBintr::SetTeeElisionEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        m_teeElisionEnabled = enabled;
+    }
+    
+    bool MultiComponentsBintr::IsTeeElided()
+    {
+        LOG_FUNC();
+        
+        return m_isTeeElided;
+    }
+    
+    bool MultiComponentsBintr::SetSinkGhostPadTarget(GstElement* pElement)
+    {
+        LOG_FUNC();
+        
+        GstPad* pGhostPad = gst_element_get_static_pad(GetGstElement(), "sink");
+        GstPad* pTargetPad = gst_element_get_static_pad(pElement, "sink");
+        if (!pGhostPad or !pTargetPad)
+        {
+            LOG_ERROR("Failed to get Sink Pads to retarget for MultiComponentsBintr '" 
+                << GetName() << "'");
+            if (pGhostPad)
+            {
+                gst_object_unref(pGhostPad);
+            }
+            if (pTargetPad)
+            {
+                gst_object_unref(pTargetPad);
+            }
+            return false;
+        }
+        bool result = gst_ghost_pad_set_target(GST_GHOST_PAD(pGhostPad), pTargetPad);
+        gst_object_unref(pGhostPad);
+        gst_object_unref(pTargetPad);
+        
+        return result;
+    }
+    
+    bool MultiComponentsBintr::RestoreTee()
+    {
+        LOG_FUNC();
+        
+        DSL_BINTR_PTR pChildComponent = m_pChildComponents.begin()->second;
+        
+        // Link the Queue and Tee and bring them to this Bintr's state ahead of 
+        // the swap, while the child is still fed directly through the ghost pad.
+        if (!m_pQueue->LinkToSink(m_pTee))
+        {
+            LOG_ERROR("MultiComponentsBintr '" << GetName() 
+                << "' failed to link its Queue and Tee for restore");
+            return false;
+        }
+        gst_element_sync_state_with_parent(m_pTee->GetGstElement());
+        gst_element_sync_state_with_parent(m_pQueue->GetGstElement());
+        
+        bool restored(true);
+        GstPad* pUpstreamSrcPad(NULL);
+        if (GetState() == GST_STATE_PLAYING)
+        {
+            GstPad* pGhostPad = gst_element_get_static_pad(GetGstElement(), "sink");
+            if (pGhostPad)
+            {
+                pUpstreamSrcPad = gst_pad_get_peer(pGhostPad);
+                gst_object_unref(pGhostPad);
+            }
+        }
+        if (!pUpstreamSrcPad)
+        {
+            restored = SwapInTee();
+        }
+        else
+        {
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_restoreTeeMutex);
+                m_restoreTeePending = true;
+                m_restoreTeeSwapping = false;
+            }
+            // The IDLE probe is called immediately if the pad is idle, otherwise
+            // on the streaming thread once the current buffer has been pushed
+            gulong probeId = gst_pad_add_probe(pUpstreamSrcPad, 
+                GST_PAD_PROBE_TYPE_IDLE, MultiComponentsRestoreTeeProbeCB, this, NULL);
+            
+            bool timedOut(false);
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_restoreTeeMutex);
+                
+                // The upstream pad may never go idle, e.g. if blocked downstream,
+                // so the wait is bounded unless the swap has already started.
+                gint64 endTime = g_get_monotonic_time() + DSL_TEE_RESTORE_TIMEOUT_US;
+                while (m_restoreTeePending)
+                {
+                    if (!g_cond_wait_until(&m_restoreTeeCond, &m_restoreTeeMutex, endTime) and
+                        !m_restoreTeeSwapping)
+                    {
+                        m_restoreTeePending = false;
+                        timedOut = true;
+                    }
+                    else if (m_restoreTeeSwapping)
+                    {
+                        endTime = G_MAXINT64;
+                    }
+                }
+                restored = !timedOut and m_restoreTeeResult;
+            }
+            if (timedOut)
+            {
+                LOG_ERROR("Timed out waiting on the upstream pad of MultiComponentsBintr '" 
+                    << GetName() << "' to go idle to restore its Tee");
+                if (probeId)
+                {
+                    gst_pad_remove_probe(pUpstreamSrcPad, probeId);
+                }
+                // The swap never started, so the child is still fed directly
+                gst_element_set_state(m_pQueue->GetGstElement(), GST_STATE_NULL);
+                gst_element_set_state(m_pTee->GetGstElement(), GST_STATE_NULL);
+                m_pQueue->UnlinkFromSink();
+            }
+            gst_object_unref(pUpstreamSrcPad);
+        }
+        if (!restored)
+        {
+            LOG_ERROR("MultiComponentsBintr '" << GetName() 
+                << "' failed to restore its Queue and Tee for '" 
+                << pChildComponent->GetName() << "'");
+            return false;
+        }
+        LOG_INFO("MultiComponentsBintr '" << GetName() << "' restored its Queue and Tee for '"
+            << pChildComponent->GetName() << "'");
+        m_isTeeElided = false;
+        return true;
+    }
+    
+    bool MultiComponentsBintr::SwapInTee()
+    {
+        LOG_FUNC();
+        
+        DSL_BINTR_PTR pChildComponent = m_pChildComponents.begin()->second;
+        
+        // Retargeting the ghost pad unlinks the child's sink pad, which can 
+        // then be linked back to the Tee behind the restored Queue
+        return SetSinkGhostPadTarget(m_pQueue->GetGstElement()) and
+            pChildComponent->LinkToSource(m_pTee);
+    }
+    
+    GstPadProbeReturn MultiComponentsBintr::HandleRestoreTeeProbe(GstPad* pPad, 
+        GstPadProbeInfo* pInfo)
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_restoreTeeMutex);
+            
+            // RestoreTee has timed out and cancelled the swap
+            if (!m_restoreTeePending)
+            {
+                return GST_PAD_PROBE_REMOVE;
+            }
+            m_restoreTeeSwapping = true;
+        }
+        bool result = SwapInTee();
+        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_restoreTeeMutex);
+        m_restoreTeeResult = result;
+        m_restoreTeePending = false;
+        g_cond_signal(&m_restoreTeeCond);
+        
+        return GST_PAD_PROBE_REMOVE;
+    }
  
     MultiSinksBintr::MultiSinksBintr(const char* name)
         : MultiComponentsBintr(name, "tee")
@@ -305,5 +534,11 @@ namespace DSL
         return std::dynamic_pointer_cast<BranchBintr>(pParentBintr)->
             AddSplitterBintr(shared_from_this());
     }
-   
-}
\ No newline at end of file
+
+    static GstPadProbeReturn MultiComponentsRestoreTeeProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMultiComponents)
+    {
+        return static_cast<MultiComponentsBintr*>(pMultiComponents)->
+            HandleRestoreTeeProbe(pPad, pInfo);
+    }
+}
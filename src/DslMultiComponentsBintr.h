@@ -49,6 +49,12 @@ namespace DSL
     #define DSL_SPLITTER_NEW(name) \
         std::shared_ptr<SplitterBintr>(new SplitterBintr(name))
 
+    /**
+     * @brief maximum time to wait on the upstream pad to go idle to restore
+     * an elided Queue and Tee
+     */
+    #define DSL_TEE_RESTORE_TIMEOUT_US      (2 * G_USEC_PER_SEC)
+
     /**
      * @class ProcessBintr
      * @brief 
@@ -129,11 +135,91 @@ namespace DSL
          */
         bool SetBatchSize(uint batchSize);
         
+        /**
+         * @brief enables/disables the elision of the Queue and Tee on link when 
+         * there is a single child component. Set before linking.
+         * @param[in] enabled set to true to enable elision
+         */
+        void SetTeeElisionEnabled(bool enabled);
+        
+        /**
+         * @brief checks whether the Queue and Tee were elided on the last link
+         * @return true if the single child is linked directly to the sink pad
+         */
+        bool IsTeeElided();
+        
+        /**
+         * @brief handles the IDLE pad probe installed on the upstream src pad
+         * by RestoreTee, swapping in the Queue and Tee while blocked.
+         * @param[in] pPad the upstream src pad
+         * @param[in] pInfo pad probe info
+         * @return GST_PAD_PROBE_REMOVE always
+         */
+        GstPadProbeReturn HandleRestoreTeeProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
+        
     private:
     
+        /**
+         * @brief sets the target of this Bintr's sink ghost pad 
+         * @param[in] pElement element whose static sink pad becomes the target
+         * @return true if the target was set successfully
+         */
+        bool SetSinkGhostPadTarget(GstElement* pElement);
+        
+        /**
+         * @brief restores the elided Queue and Tee while linked, relinking the 
+         * single child to the Tee so that children can be added and removed.
+         * While playing, the swap is done in an IDLE probe on the upstream src pad.
+         * @return true if the Queue and Tee were restored successfully, false if 
+         * the swap fails or the upstream pad fails to go idle within 
+         * DSL_TEE_RESTORE_TIMEOUT_US.
+         */
+        bool RestoreTee();
+        
+        /**
+         * @brief retargets the sink ghost pad to the linked Queue and Tee, and
+         * links the single child to the Tee
+         * @return true if the child was relinked successfully
+         */
+        bool SwapInTee();
+        
+        /**
+         * @brief mutex and condition to synchronize RestoreTee with the pad probe
+         */
+        GMutex m_restoreTeeMutex;
+        GCond m_restoreTeeCond;
+        
+        /**
+         * @brief true while RestoreTee is waiting on the pad probe, cleared by 
+         * RestoreTee on timeout to cancel the swap
+         */
+        bool m_restoreTeePending;
+        
+        /**
+         * @brief true once the pad probe has started the swap, which can 
+         * no longer be cancelled
+         */
+        bool m_restoreTeeSwapping;
+        
+        /**
+         * @brief result of the swap performed by the pad probe
+         */
+        bool m_restoreTeeResult;
+    
         DSL_ELEMENT_PTR m_pQueue;
         DSL_ELEMENT_PTR m_pTee;
         
+        /**
+         * @brief true if the Queue and Tee are to be elided for a single child
+         */
+        bool m_teeElisionEnabled;
+        
+        /**
+         * @brief true if the Queue and Tee were elided on link, with the single 
+         * child's sink pad the target of this Bintr's sink ghost pad
+         */
+        bool m_isTeeElided;
+        
         /**
          * @brief Unique streamId of Parent SourceBintr if added to Source vs. Pipeline
          * The id is used when getting a request Pad for Src Demuxer
@@ -209,6 +295,16 @@ namespace DSL
         bool AddToParent(DSL_NODETR_PTR pParentBintr);
     };
 
+    /**
+     * @brief IDLE Pad Probe callback function to restore an elided Queue and Tee
+     * @param[in] pPad the upstream src pad
+     * @param[in] pInfo pad probe info
+     * @param[in] pMultiComponents pointer to the MultiComponentsBintr to restore
+     * @return GST_PAD_PROBE_REMOVE always
+     */
+    static GstPadProbeReturn MultiComponentsRestoreTeeProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMultiComponents);
+
 }
 
 #endif // _DSL_PROCESS_BINTR_H
\ No newline at end of file
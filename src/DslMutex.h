@@ -56,6 +56,66 @@ namespace DSL
         GMutex* m_pMutex; 
     };
 
+    #define LOCK_READER_FOR_CURRENT_SCOPE(rwlock) LockReaderForCurrentScope lock(rwlock)
+
+    /**
+     * @class LockReaderForCurrentScope
+     * @brief Locks a GRWLock for shared read access for the current scope {}.
+     * A NULL lock is skipped, i.e. when already held by the calling thread.
+     */
+    class LockReaderForCurrentScope
+    {
+    public:
+        LockReaderForCurrentScope(GRWLock* rwlock) : m_pRWLock(rwlock) 
+        {
+            if (m_pRWLock)
+            {
+                g_rw_lock_reader_lock(m_pRWLock);
+            }
+        };
+        
+        ~LockReaderForCurrentScope()
+        {
+            if (m_pRWLock)
+            {
+                g_rw_lock_reader_unlock(m_pRWLock);
+            }
+        };
+        
+    private:
+        GRWLock* m_pRWLock; 
+    };
+
+    #define LOCK_WRITER_FOR_CURRENT_SCOPE(rwlock) LockWriterForCurrentScope lock(rwlock)
+
+    /**
+     * @class LockWriterForCurrentScope
+     * @brief Locks a GRWLock for exclusive write access for the current scope {}.
+     * A NULL lock is skipped, i.e. when already held by the calling thread.
+     */
+    class LockWriterForCurrentScope
+    {
+    public:
+        LockWriterForCurrentScope(GRWLock* rwlock) : m_pRWLock(rwlock) 
+        {
+            if (m_pRWLock)
+            {
+                g_rw_lock_writer_lock(m_pRWLock);
+            }
+        };
+        
+        ~LockWriterForCurrentScope()
+        {
+            if (m_pRWLock)
+            {
+                g_rw_lock_writer_unlock(m_pRWLock);
+            }
+        };
+        
+    private:
+        GRWLock* m_pRWLock; 
+    };
+
     #define UNREF_MESSAGE_ON_RETURN(message) UnrefMessageOnReturn ref(message)
 
     /**
@@ -309,6 +309,17 @@ namespace DSL
             return m_pChildren.size();
         }
 
+        /**
+         * @brief returns the map of all child Nodetrs for this Nodetr
+         * @return const reference to the map of children, mapped by name
+         */
+        const std::map<std::string, DSL_NODETR_PTR>& GetChildren()
+        {
+            LOG_FUNC();
+
+            return m_pChildren;
+        }
+
         GstObject* GetGstObject()
         {
             LOG_FUNC();
@@ -126,6 +126,7 @@ namespace DSL
 
     GstPadProbeReturn PadProbetr::HandlePadProbe(GstPad* pPad, GstPadProbeInfo* pInfo)
     {
+        TRACE_SCOPE("probe", m_name.c_str());
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_padProbeMutex);
         
         if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
@@ -0,0 +1,274 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslPerfMeter.h"
+
+namespace DSL
+{
+    SourcePerfCounters::SourcePerfCounters()
+        : m_frameCount(0)
+        , m_dropCount(0)
+        , m_lastFrameNum(-1)
+        , m_latencyCount(0)
+    {
+        for (uint i = 0; i < DSL_LATENCY_NUM_BUCKETS; i++)
+        {
+            m_histogram[i].store(0);
+        }
+        for (uint i = 0; i < DSL_PERF_NUM_STAMPS; i++)
+        {
+            m_stampPts[i].store(GST_CLOCK_TIME_NONE);
+            m_stampTime[i].store(0);
+        }
+    }
+    
+    void SourcePerfCounters::Stamp(GstClockTime pts)
+    {
+        uint slot = (pts / GST_MSECOND) % DSL_PERF_NUM_STAMPS;
+        
+        // Invalidate the slot while the time is written so that a concurrent
+        // Measure never pairs the new time with the old PTS or vice versa
+        m_stampPts[slot].store(GST_CLOCK_TIME_NONE, std::memory_order_relaxed);
+        m_stampTime[slot].store(g_get_monotonic_time(), std::memory_order_release);
+        m_stampPts[slot].store(pts, std::memory_order_release);
+    }
+    
+    void SourcePerfCounters::Measure(GstClockTime pts, gint frameNum)
+    {
+        gint64 now = g_get_monotonic_time();
+        
+        // Count each frame once, on first arrival at any sink
+        gint64 lastFrameNum = m_lastFrameNum.load(std::memory_order_relaxed);
+        while (frameNum > lastFrameNum)
+        {
+            if (m_lastFrameNum.compare_exchange_weak(lastFrameNum, frameNum))
+            {
+                m_frameCount.fetch_add(1, std::memory_order_relaxed);
+                if (lastFrameNum >= 0)
+                {
+                    m_dropCount.fetch_add(frameNum - lastFrameNum - 1, 
+                        std::memory_order_relaxed);
+                }
+                break;
+            }
+        }
+        
+        uint slot = (pts / GST_MSECOND) % DSL_PERF_NUM_STAMPS;
+        
+        if (m_stampPts[slot].load(std::memory_order_acquire) != pts)
+        {
+            return;
+        }
+        gint64 stampTime = m_stampTime[slot].load(std::memory_order_acquire);
+        if (m_stampPts[slot].load(std::memory_order_acquire) != pts)
+        {
+            return;
+        }
+        uint bucket = std::min((uint)(std::max(now - stampTime, (gint64)0) / 
+            DSL_LATENCY_BUCKET_WIDTH_US), (uint)DSL_LATENCY_NUM_BUCKETS-1);
+        m_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+        m_latencyCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    
+    uint SourcePerfCounters::TakeHistogram(uint* histogram)
+    {
+        // Each bucket is swapped out on its own. A latency added concurrently
+        // lands in either this interval or the next, never in both.
+        uint count(0);
+        for (uint i = 0; i < DSL_LATENCY_NUM_BUCKETS; i++)
+        {
+            histogram[i] = m_histogram[i].exchange(0, std::memory_order_relaxed);
+            count += histogram[i];
+        }
+        return count;
+    }
+    
+    PerfMeter::PerfMeter(const char* name)
+        : m_name(name)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_reportMutex);
+    }
+    
+    PerfMeter::~PerfMeter()
+    {
+        LOG_FUNC();
+        
+        RemoveProbes();
+        g_mutex_clear(&m_reportMutex);
+    }
+    
+    void PerfMeter::RemoveProbes()
+    {
+        LOG_FUNC();
+        
+        for (auto const& ivec: m_probes)
+        {
+            gst_pad_remove_probe(ivec.first, ivec.second);
+            gst_object_unref(ivec.first);
+        }
+        m_probes.clear();
+    }
+    
+    void PerfMeter::AddSourcePad(GstPad* pPad, uint sourceId)
+    {
+        LOG_FUNC();
+        
+        DSL_SOURCE_PERF_COUNTERS_PTR pCounters = DSL_SOURCE_PERF_COUNTERS_NEW();
+        m_counters[sourceId] = pCounters;
+        m_reports[sourceId] = {0, g_get_monotonic_time(), 0, 0, 0, 0, 0};
+        
+        gulong probeId = gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER, 
+            PerfMeterSourceProbeCB, pCounters.get(), NULL);
+        m_probes.push_back(std::make_pair(GST_PAD(gst_object_ref(pPad)), probeId));
+    }
+    
+    void PerfMeter::AddSinkPad(GstPad* pPad)
+    {
+        LOG_FUNC();
+        
+        gulong probeId = gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER, 
+            PerfMeterSinkProbeCB, this, NULL);
+        m_probes.push_back(std::make_pair(GST_PAD(gst_object_ref(pPad)), probeId));
+    }
+    
+    void PerfMeter::HandleSinkBuffer(GstBuffer* pBuffer)
+    {
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (!pBatchMeta)
+        {
+            return;
+        }
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            
+            auto counters = m_counters.find(pFrameMeta->source_id);
+            if (counters != m_counters.end())
+            {
+                counters->second->Measure(pFrameMeta->buf_pts, pFrameMeta->frame_num);
+            }
+        }
+    }
+    
+    void PerfMeter::Update()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reportMutex);
+        
+        gint64 now = g_get_monotonic_time();
+        
+        for (auto const& imap: m_counters)
+        {
+            SourcePerfReport& report = m_reports[imap.first];
+            
+            uint64_t frameCount = imap.second->m_frameCount.load(std::memory_order_relaxed);
+            gint64 elapsed = now - report.updateTime;
+            
+            report.fps = (elapsed > 0)
+                ? (double)(frameCount - report.frameCount) * G_USEC_PER_SEC / elapsed
+                : 0;
+            report.frameCount = frameCount;
+            report.updateTime = now;
+            
+            uint histogram[DSL_LATENCY_NUM_BUCKETS];
+            uint count = imap.second->TakeHistogram(histogram);
+            report.p50 = GetPercentile(histogram, count, 50);
+            report.p95 = GetPercentile(histogram, count, 95);
+            report.p99 = GetPercentile(histogram, count, 99);
+            report.drops = imap.second->m_dropCount.load(std::memory_order_relaxed);
+        }
+    }
+    
+    double PerfMeter::GetPercentile(const uint* histogram, uint count, uint percentile)
+    {
+        if (!count)
+        {
+            return 0;
+        }
+        uint64_t target = ((uint64_t)count*percentile + 99) / 100;
+        uint64_t cumulative(0);
+        uint bucket(0);
+        for (; bucket < DSL_LATENCY_NUM_BUCKETS-1; bucket++)
+        {
+            cumulative += histogram[bucket];
+            if (cumulative >= target)
+            {
+                break;
+            }
+        }
+        return (double)((bucket+1) * DSL_LATENCY_BUCKET_WIDTH_US) / 1000;
+    }
+    
+    std::vector<uint> PerfMeter::GetSourceIds()
+    {
+        LOG_FUNC();
+        
+        std::vector<uint> sourceIds;
+        for (auto const& imap: m_counters)
+        {
+            sourceIds.push_back(imap.first);
+        }
+        return sourceIds;
+    }
+    
+    bool PerfMeter::GetReport(uint sourceId, double* fps, 
+        double* p50, double* p95, double* p99, uint* drops)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_reportMutex);
+        
+        auto report = m_reports.find(sourceId);
+        if (report == m_reports.end())
+        {
+            LOG_ERROR("Source-id '" << sourceId << "' is not metered for Pipeline '" 
+                << m_name << "'");
+            return false;
+        }
+        *fps = report->second.fps;
+        *p50 = report->second.p50;
+        *p95 = report->second.p95;
+        *p99 = report->second.p99;
+        *drops = report->second.drops;
+        return true;
+    }
+    
+    static GstPadProbeReturn PerfMeterSourceProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pCounters)
+    {
+        static_cast<SourcePerfCounters*>(pCounters)->Stamp(
+            GST_BUFFER_PTS(GST_PAD_PROBE_INFO_BUFFER(pInfo)));
+        return GST_PAD_PROBE_OK;
+    }
+
+    static GstPadProbeReturn PerfMeterSinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMeter)
+    {
+        static_cast<PerfMeter*>(pMeter)->HandleSinkBuffer(GST_PAD_PROBE_INFO_BUFFER(pInfo));
+        return GST_PAD_PROBE_OK;
+    }
+}
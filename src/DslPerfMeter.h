@@ -0,0 +1,252 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_PERF_METER_H
+#define _DSL_PERF_METER_H
+
+#include "Dsl.h"
+#include "DslLatencyTracer.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_PERF_METER_PTR std::shared_ptr<PerfMeter>
+    #define DSL_PERF_METER_NEW(name) \
+        std::shared_ptr<PerfMeter>(new PerfMeter(name))    
+
+    #define DSL_SOURCE_PERF_COUNTERS_PTR std::shared_ptr<SourcePerfCounters>
+    #define DSL_SOURCE_PERF_COUNTERS_NEW() \
+        std::shared_ptr<SourcePerfCounters>(new SourcePerfCounters())    
+
+    /**
+     * @brief number of source timestamp slots kept per source, indexed by PTS in ms
+     */
+    #define DSL_PERF_NUM_STAMPS                     1024
+
+    /**
+     * @class SourcePerfCounters
+     * @brief Lock-free counters for a single source, written from the 
+     * streaming threads and read by the PerfMeter on each update
+     */
+    class SourcePerfCounters
+    {
+    public:
+    
+        SourcePerfCounters();
+
+        /**
+         * @brief Stamps a frame leaving the source with the current time
+         * @param[in] pts presentation timestamp of the frame
+         */
+        void Stamp(GstClockTime pts);
+        
+        /**
+         * @brief Measures a frame arriving at a sink. Frames are counted once,
+         * on first arrival, while latency is measured at every sink
+         * @param[in] pts original presentation timestamp of the frame
+         * @param[in] frameNum frame number of the frame, per source
+         */
+        void Measure(GstClockTime pts, gint frameNum);
+
+        /**
+         * @brief Takes the latencies measured since the previous take, resetting
+         * each bucket of the histogram so that every report covers one interval
+         * @param[out] histogram DSL_LATENCY_NUM_BUCKETS bucket counts for the interval
+         * @return number of latencies measured in the interval
+         */
+        uint TakeHistogram(uint* histogram);
+
+        /**
+         * @brief number of unique frames measured at the sinks
+         */
+        std::atomic<uint64_t> m_frameCount;
+
+        /**
+         * @brief number of frames missing from the sequence measured at the sinks
+         */
+        std::atomic<uint64_t> m_dropCount;
+
+        /**
+         * @brief frame number of the last unique frame measured, -1 if none
+         */
+        std::atomic<gint64> m_lastFrameNum;
+        
+        /**
+         * @brief total number of latencies measured
+         */
+        std::atomic<uint> m_latencyCount;
+
+        /**
+         * @brief latency histogram with DSL_LATENCY_NUM_BUCKETS buckets for the
+         * current interval, reset on each TakeHistogram
+         */
+        std::atomic<uint> m_histogram[DSL_LATENCY_NUM_BUCKETS];
+        
+    private:
+    
+        /**
+         * @brief PTS of the frame last stamped in each slot
+         */
+        std::atomic<GstClockTime> m_stampPts[DSL_PERF_NUM_STAMPS];
+
+        /**
+         * @brief monotonic time in microseconds of the frame last stamped in each slot
+         */
+        std::atomic<gint64> m_stampTime[DSL_PERF_NUM_STAMPS];
+    };
+    
+    /**
+     * @class PerfMeter
+     * @brief Measures the rolling FPS, capture-to-sink latency percentiles 
+     * and frame drops for each source in a Pipeline. FPS and percentiles 
+     * cover the interval since the previous update.
+     */
+    class PerfMeter
+    {
+    public:
+        
+        /**
+         * @brief ctor for the PerfMeter class
+         * @param[in] name name of the Pipeline to meter
+         */
+        PerfMeter(const char* name);
+        
+        /**
+         * @brief dtor for the PerfMeter class, removes all pad probes
+         */
+        ~PerfMeter();
+
+        /**
+         * @brief Removes all pad probes installed by this meter. The counters
+         * are kept so that the last report remains available.
+         */
+        void RemoveProbes();
+
+        /**
+         * @brief Adds a buffer probe to stamp each frame leaving a source
+         * @param[in] pPad src pad of the source to meter
+         * @param[in] sourceId unique source-id for the source
+         */
+        void AddSourcePad(GstPad* pPad, uint sourceId);
+
+        /**
+         * @brief Adds a buffer probe to measure each batched frame arriving at a sink
+         * @param[in] pPad sink pad of the sink to meter
+         */
+        void AddSinkPad(GstPad* pPad);
+        
+        /**
+         * @brief Updates the rolling FPS and percentiles for all sources
+         * from the frames and latencies measured since the previous update
+         */
+        void Update();
+
+        /**
+         * @brief Gets the source-ids for all metered sources
+         * @return vector of source-ids in ascending order
+         */
+        std::vector<uint> GetSourceIds();
+
+        /**
+         * @brief Gets the performance measured for a single source on the last update
+         * @param[in] sourceId source-id of the source to query
+         * @param[out] fps rolling frames per second over the last update interval
+         * @param[out] p50 50th percentile latency over the last update interval in ms
+         * @param[out] p95 95th percentile latency over the last update interval in ms
+         * @param[out] p99 99th percentile latency over the last update interval in ms
+         * @param[out] drops total number of frames dropped
+         * @return false if the source is not metered
+         */
+        bool GetReport(uint sourceId, double* fps, 
+            double* p50, double* p95, double* p99, uint* drops);
+
+        /**
+         * @brief Handles a batched buffer on one of the sink pads
+         * @param[in] pBuffer buffer to measure
+         */
+        void HandleSinkBuffer(GstBuffer* pBuffer);
+
+    private:
+    
+        /**
+         * @brief performance snapshot for a single source, taken on update
+         */
+        struct SourcePerfReport
+        {
+            uint64_t frameCount;
+            gint64 updateTime;
+            double fps;
+            double p50;
+            double p95;
+            double p99;
+            uint drops;
+        };
+        
+        /**
+         * @brief Gets a single percentile from a latency histogram
+         * @param[in] histogram DSL_LATENCY_NUM_BUCKETS bucket counts
+         * @param[in] count number of latencies in the histogram
+         * @param[in] percentile [0..100]
+         * @return upper edge of the percentile's bucket in milliseconds, 0 if empty
+         */
+        double GetPercentile(const uint* histogram, uint count, uint percentile);
+
+        /**
+         * @brief name of the metered Pipeline
+         */
+        std::string m_name;
+        
+        /**
+         * @brief mutex to protect the reports
+         */
+        GMutex m_reportMutex;
+
+        /**
+         * @brief counters for each source, mapped by source-id. The map is
+         * only modified before the probes are installed
+         */
+        std::map<uint, DSL_SOURCE_PERF_COUNTERS_PTR> m_counters;
+        
+        /**
+         * @brief last report for each source, mapped by source-id
+         */
+        std::map<uint, SourcePerfReport> m_reports;
+        
+        /**
+         * @brief all pads with a probe id installed by this meter
+         */
+        std::vector<std::pair<GstPad*, gulong>> m_probes;
+    };
+    
+    static GstPadProbeReturn PerfMeterSourceProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pCounters);
+
+    static GstPadProbeReturn PerfMeterSinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pMeter);
+}
+
+#endif // _DSL_PERF_METER_H
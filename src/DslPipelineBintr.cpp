@@ -34,11 +34,28 @@ namespace DSL
         : BranchBintr(name)
         , m_pGstBus(NULL)
         , m_gstBusWatch(0)
-        , m_pXWindowEventThread(NULL)
+        , m_pMainContext(NULL)
+        , m_pMainLoop(NULL)
+        , m_pMainContextThread(NULL)
+        , m_pBusWatchSource(NULL)
+        , m_eventFd(-1)
         , m_pXDisplay(0)
         , m_pXWindow(0)
         , m_xWindowWidth(0)
         , m_xWindowHeight(0)
+        , m_surfaceBudget(0)
+        , m_surfaceBudgetPolicy(DSL_SURFACE_BUDGET_POLICY_REFUSE)
+        , m_latencyTracingEnabled(false)
+        , m_prepareInProgress(false)
+        , m_prepareListener(NULL)
+        , m_prepareUserData(NULL)
+        , m_linkOptimizationEnabled(false)
+        , m_perfEnabled(false)
+        , m_perfInterval(DSL_DEFAULT_PERF_INTERVAL)
+        , m_perfTimerId(0)
+        , m_perfTimerCount(0)
+        , m_classificationCacheEnabled(false)
+        , m_isTracing(false)
 {
         LOG_FUNC();
 
@@ -52,9 +69,18 @@ namespace DSL
         // Initialize "constant-to-string" maps
         _initMaps();
         
+        m_pClassificationCache = DSL_CLASSIFICATION_CACHE_NEW(name);
+        m_pThreadManager = DSL_THREAD_MANAGER_NEW(name);
+        
         g_mutex_init(&m_busSyncMutex);
         g_mutex_init(&m_busWatchMutex);
         g_mutex_init(&m_displayMutex);
+        g_mutex_init(&m_perfMutex);
+        g_mutex_init(&m_perfTimerMutex);
+        g_cond_init(&m_perfTimerCond);
+        g_mutex_init(&m_eventQueueMutex);
+        g_mutex_init(&m_prepareMutex);
+        g_cond_init(&m_prepareCond);
 
         // get the GST message bus - one per GST pipeline
         m_pGstBus = gst_pipeline_get_bus(GST_PIPELINE(m_pGstObj));
@@ -69,11 +95,43 @@ namespace DSL
     PipelineBintr::~PipelineBintr()
     {
         LOG_FUNC();
+        
+        // The prepare thread may need the display mutex to create the XWindow
+        WaitForPrepare();
+        
+        // Must be removed before taking the display mutex, as the event 
+        // dispatcher waits for any current call to HandleXWindowEvents
+        if (m_pXWindow)
+        {
+            XWindowEventDispatcher::GetDispatcher()->RemoveDisplay(m_pXDisplay);
+        }
         {
             LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
             
             Stop();
             
+            // Remove the timer source, then wait on its destroy notify, which 
+            // GLib calls once any callback already dispatched has returned.
+            StopPerfMeter();
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfTimerMutex);
+                
+                while (m_perfTimerCount)
+                {
+                    g_cond_wait(&m_perfTimerCond, &m_perfTimerMutex);
+                }
+            }
+            
+            // Each probe holds a reference to its tracer
+            for (auto const& ivec: m_latencyTracers)
+            {
+                ivec->RemoveProbes();
+            }
+            if (m_isTracing)
+            {
+                StopTrace();
+            }
+            
             if (m_pXWindow)
             {
                 XDestroyWindow(m_pXDisplay, m_pXWindow);
@@ -81,17 +139,43 @@ namespace DSL
             if (m_pXDisplay)
             {
                 XCloseDisplay(m_pXDisplay);
-                // Setting the display handle to NULL will terminate the XWindow Event Thread.
                 m_pXDisplay = NULL;
             }
             // cleanup all resources
-            gst_bus_remove_watch(m_pGstBus);
+            if (m_pMainContext)
+            {
+                StopMainContext(false);
+            }
+            else
+            {
+                gst_bus_remove_watch(m_pGstBus);
+            }
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busSyncMutex);
+                
+                if (m_eventFd >= 0)
+                {
+                    close(m_eventFd);
+                    m_eventFd = -1;
+                }
+                for (auto const& pMessage: m_eventQueue)
+                {
+                    gst_message_unref(pMessage);
+                }
+                m_eventQueue.clear();
+            }
             gst_object_unref(m_pGstBus);
 
             g_mutex_clear(&m_busSyncMutex);
             g_mutex_clear(&m_busWatchMutex);
         }
         g_mutex_clear(&m_displayMutex);
+        g_mutex_clear(&m_perfMutex);
+        g_mutex_clear(&m_perfTimerMutex);
+        g_cond_clear(&m_perfTimerCond);
+        g_mutex_clear(&m_eventQueueMutex);
+        g_mutex_clear(&m_prepareMutex);
+        g_cond_clear(&m_prepareCond);
     }
     
     bool PipelineBintr::AddSourceBintr(DSL_NODETR_PTR pSourceBintr)
@@ -111,178 +195,1365 @@ namespace DSL
         }
         return true;
     }
-
-    bool PipelineBintr::IsSourceBintrChild(DSL_NODETR_PTR pSourceBintr)
+
+    bool PipelineBintr::IsSourceBintrChild(DSL_NODETR_PTR pSourceBintr)
+    {
+        LOG_FUNC();
+
+        if (!m_pPipelineSourcesBintr)
+        {
+            LOG_INFO("Pipeline '" << GetName() << "' has no Sources");
+            return false;
+        }
+        return (m_pPipelineSourcesBintr->IsChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr)));
+    }
+
+    bool PipelineBintr::RemoveSourceBintr(DSL_NODETR_PTR pSourceBintr)
+    {
+        LOG_FUNC();
+
+        // Must cast to SourceBintr first so that correct Instance of RemoveChild is called
+        return m_pPipelineSourcesBintr->RemoveChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr));
+    }
+
+
+    void PipelineBintr::GetStreamMuxBatchProperties(guint* batchSize, uint* batchTimeout)
+    {
+        LOG_FUNC();
+
+        *batchSize = m_batchSize;
+        *batchTimeout = m_batchTimeout;
+    }
+
+    bool PipelineBintr::SetStreamMuxBatchProperties(uint batchSize, uint batchTimeout)
+    {
+        LOG_FUNC();
+
+        m_batchSize = batchSize;
+        m_batchTimeout = batchTimeout;
+
+        if (IsLinked())
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' is currently Linked - batch properties can not be updated");
+            return false;
+            
+        }
+        if (m_pPipelineSourcesBintr)
+        {
+            m_pPipelineSourcesBintr->SetStreamMuxBatchProperties(m_batchSize, m_batchTimeout);
+        }
+        
+        return true;
+    }
+
+    bool PipelineBintr::GetStreamMuxDimensions(uint* width, uint* height)
+    {
+        LOG_FUNC();
+
+        if (!m_pPipelineSourcesBintr)
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' has no Sources or Stream Muxer");
+            return false;
+        }
+        m_pPipelineSourcesBintr->GetStreamMuxDimensions(width, height);
+        return true;
+    }
+
+    bool PipelineBintr::SetStreamMuxDimensions(uint width, uint height)
+    {
+        LOG_FUNC();
+
+        if (!m_pPipelineSourcesBintr)
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' has no Sources or Stream Muxer");
+            return false;
+        }
+        m_pPipelineSourcesBintr->SetStreamMuxDimensions(width, height);
+        return true;
+    }
+    
+    bool PipelineBintr::GetStreamMuxPadding(bool* enabled)
+    {
+        LOG_FUNC();
+
+        if (!m_pPipelineSourcesBintr)
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' has no Sources or Stream Muxer");
+            return false;
+        }
+        m_pPipelineSourcesBintr->GetStreamMuxPadding(enabled);
+        return true;
+    }
+    
+    bool PipelineBintr::SetStreamMuxPadding(bool enabled)
+    {
+        LOG_FUNC();
+
+        if (!m_pPipelineSourcesBintr)
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' has no Sources or Stream Muxer");
+            return false;
+        }
+        m_pPipelineSourcesBintr->SetStreamMuxPadding(enabled);
+        return true;
+    }
+    
+    void PipelineBintr::GetXWindowDimensions(uint* width, uint* height)
+    {
+        LOG_FUNC();
+        
+        *width = m_xWindowWidth;
+        *height = m_xWindowHeight;
+    }
+
+    bool PipelineBintr::SetXWindowDimensions(uint width, uint height)
+    {
+        LOG_FUNC();
+
+        // TODO verify dimensions before setting.
+        if (m_pXWindow)
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' has an existing XWindow.");
+            return false;
+        }
+        m_xWindowWidth = width;
+        m_xWindowHeight = height;
+        return true;
+    }
+    
+    bool PipelineBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_INFO("Components for Pipeline '" << GetName() << "' are already assembled");
+            return false;
+        }
+        if (!m_pPipelineSourcesBintr)
+        {
+            LOG_ERROR("Pipline '" << GetName() << "' has no required Source component - and is unable to link");
+            return false;
+        }
+
+        // If the batch size has not been explicitely set, use the number of sources.
+        if (m_batchSize < m_pPipelineSourcesBintr->GetNumChildren())
+        {
+            SetStreamMuxBatchProperties(m_pPipelineSourcesBintr->GetNumChildren(), m_batchTimeout);
+        }
+        
+        if (!ApplySurfaceBudget())
+        {
+            return false;
+        }
+        
+        // Start with an empty list of linked components
+        m_linkedComponents.clear();
+
+        // Link all Source Elementrs (required component), and all Sources to the StreamMuxer
+        // then add the PipelineSourcesBintr as the Source (head) component for this Pipeline
+        if (!m_pPipelineSourcesBintr->LinkAll())
+        {
+            return false;
+        }
+        m_linkedComponents.push_back(m_pPipelineSourcesBintr);
+        
+        LOG_INFO("Pipeline '" << GetName() << "' Linked up all Source '" << 
+            m_pPipelineSourcesBintr->GetName() << "' successfully");
+
+        if (m_pSecondaryGiesBintr)
+        {
+            if (m_classificationCacheEnabled and !m_pTrackerBintr)
+            {
+                LOG_WARN("Pipeline '" << GetName() 
+                    << "' has no Tracker - no objects will be classification cached");
+            }
+            m_pSecondaryGiesBintr->SetClassificationCache(
+                (m_classificationCacheEnabled) ? m_pClassificationCache : nullptr);
+        }
+
+        // The Sinks' Queue and Tee are redundant with a single Sink, which has its own Queue
+        if (m_pMultiSinksBintr)
+        {
+            m_pMultiSinksBintr->SetTeeElisionEnabled(m_linkOptimizationEnabled);
+        }
+
+        // call the base class to Link all remaining components.
+        if (!BranchBintr::LinkAll())
+        {
+            return false;
+        }
+        
+        std::ostringstream report;
+        if (m_pMultiSinksBintr and m_pMultiSinksBintr->IsTeeElided())
+        {
+            report << m_pMultiSinksBintr->GetName() 
+                << " elided queue and tee for single sink\n";
+        }
+        m_linkOptimizationReport = report.str();
+        
+        m_pThreadManager->ClearComponents();
+        for (auto const& ivec: m_linkedComponents)
+        {
+            AddThreadComponents(ivec, DSL_THREAD_ROLE_OTHER);
+        }
+        
+        if (m_latencyTracingEnabled)
+        {
+            InstallLatencyTracers();
+        }
+        if (m_perfEnabled)
+        {
+            InstallPerfMeter();
+        }
+        if (m_isTracing)
+        {
+            InstallTraceProbes();
+        }
+        return true;
+    }
+
+    bool PipelineBintr::Relink()
+    {
+        LOG_FUNC();
+        
+        if (!BranchBintr::Relink())
+        {
+            return false;
+        }
+        if (!m_isLinked)
+        {
+            return true;
+        }
+        if (m_latencyTracingEnabled)
+        {
+            InstallLatencyTracers();
+        }
+        if (m_isTracing)
+        {
+            InstallTraceProbes();
+        }
+        return true;
+    }
+
+    bool PipelineBintr::GetLinkOptimizationEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_linkOptimizationEnabled;
+    }
+    
+    bool PipelineBintr::SetLinkOptimizationEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("Unable to set link optimization for Pipeline '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_linkOptimizationEnabled = enabled;
+        return true;
+    }
+    
+    const char* PipelineBintr::GetLinkOptimizationReport()
+    {
+        LOG_FUNC();
+        
+        return m_linkOptimizationReport.c_str();
+    }
+
+    bool PipelineBintr::GetThreadRoleAffinity(uint role, const char** cpus, int* priority)
+    {
+        LOG_FUNC();
+        
+        return m_pThreadManager->GetRoleAffinity(role, cpus, priority);
+    }
+    
+    bool PipelineBintr::SetThreadRoleAffinity(uint role, const char* cpus, int priority)
+    {
+        LOG_FUNC();
+        
+        return m_pThreadManager->SetRoleAffinity(role, cpus, priority);
+    }
+    
+    const char* PipelineBintr::GetThreadReport()
+    {
+        LOG_FUNC();
+        
+        return m_pThreadManager->GetReport();
+    }
+    
+    void PipelineBintr::AddThreadComponents(DSL_NODETR_PTR pNodetr, uint role)
+    {
+        LOG_FUNC();
+        
+        DSL_BINTR_PTR pBintr = std::dynamic_pointer_cast<Bintr>(pNodetr);
+        if (!pBintr)
+        {
+            return;
+        }
+        if (std::dynamic_pointer_cast<SourceBintr>(pBintr))
+        {
+            role = DSL_THREAD_ROLE_DECODE;
+        }
+        else if (std::dynamic_pointer_cast<GieBintr>(pBintr) or
+            std::dynamic_pointer_cast<PipelineSecondaryGiesBintr>(pBintr))
+        {
+            role = DSL_THREAD_ROLE_INFERENCE;
+        }
+        else if (std::dynamic_pointer_cast<SinkBintr>(pBintr) or
+            std::dynamic_pointer_cast<MultiSinksBintr>(pBintr))
+        {
+            role = DSL_THREAD_ROLE_SINK;
+        }
+        m_pThreadManager->AddComponent(pBintr->GetGstObject(), 
+            pBintr->GetCStrName(), role);
+            
+        for (auto const& imap: pBintr->GetChildren())
+        {
+            AddThreadComponents(imap.second, role);
+        }
+    }
+
+    bool PipelineBintr::GetLatencyTracingEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_latencyTracingEnabled;
+    }
+    
+    void PipelineBintr::SetLatencyTracingEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        m_latencyTracingEnabled = enabled;
+        
+        if (!m_isLinked)
+        {
+            return;
+        }
+        if (enabled)
+        {
+            InstallLatencyTracers();
+        }
+        else
+        {
+            // Only the probes are removed, the tracers are kept so that
+            // the last report can still be read.
+            for (auto const& ivec: m_latencyTracers)
+            {
+                ivec->RemoveProbes();
+            }
+        }
+    }
+    
+    const char* PipelineBintr::GetLatencyReport()
+    {
+        LOG_FUNC();
+        
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(1);
+        
+        for (auto const& ivec: m_latencyTracers)
+        {
+            double p50(0), p95(0), p99(0);
+            uint count(0);
+            ivec->GetPercentiles(&p50, &p95, &p99, &count);
+            
+            report << ivec->GetName() << " count=" << count << " p50=" << p50 
+                << "ms p95=" << p95 << "ms p99=" << p99 << "ms\n";
+        }
+        m_latencyReport = report.str();
+        return m_latencyReport.c_str();
+    }
+    
+    void PipelineBintr::InstallLatencyTracers()
+    {
+        LOG_FUNC();
+        
+        // Tracers remain after unlink so the last report can still be read.
+        // Each is released once its probes are removed, and any probe 
+        // callback still in progress has completed
+        for (auto const& ivec: m_latencyTracers)
+        {
+            ivec->RemoveProbes();
+        }
+        m_latencyTracers.clear();
+        
+        // The Sources bin is traced from each Source's src pad to the StreamMux's
+        // src pad to include the time each frame waits to be batched
+        DSL_LATENCY_TRACER_PTR pSourcesTracer = 
+            DSL_LATENCY_TRACER_NEW(m_pPipelineSourcesBintr->GetCStrName());
+        
+        for (auto const& imap: m_pPipelineSourcesBintr->GetChildren())
+        {
+            DSL_SOURCE_PTR pSourceBintr = std::dynamic_pointer_cast<SourceBintr>(imap.second);
+            
+            GstPad* pSrcPad = gst_element_get_static_pad(
+                GST_ELEMENT(pSourceBintr->GetGstObject()), "src");
+            if (pSrcPad)
+            {
+                pSourcesTracer->AddEntryPad(pSrcPad, pSourceBintr->GetSourceId());
+                gst_object_unref(pSrcPad);
+            }
+        }
+        GstPad* pSrcPad = gst_element_get_static_pad(
+            GST_ELEMENT(m_pPipelineSourcesBintr->GetGstObject()), "src");
+        if (pSrcPad)
+        {
+            pSourcesTracer->AddExitPad(pSrcPad);
+            gst_object_unref(pSrcPad);
+        }
+        m_latencyTracers.push_back(pSourcesTracer);
+        
+        for (auto const& ivec: m_linkedComponents)
+        {
+            if (ivec != m_pPipelineSourcesBintr)
+            {
+                InstallLatencyTracers(ivec);
+            }
+        }
+        LOG_INFO("Pipeline '" << GetName() << "' installed " 
+            << m_latencyTracers.size() << " latency tracers");
+    }
+
+    void PipelineBintr::InstallLatencyTracers(DSL_NODETR_PTR pNodetr)
+    {
+        LOG_FUNC();
+        
+        DSL_BINTR_PTR pBintr = std::dynamic_pointer_cast<Bintr>(pNodetr);
+        if (!pBintr)
+        {
+            return;
+        }
+        
+        // Only Bintrs with both sink and src ghost pads can be bracketed
+        GstPad* pSinkPad = gst_element_get_static_pad(
+            GST_ELEMENT(pBintr->GetGstObject()), "sink");
+        GstPad* pSrcPad = gst_element_get_static_pad(
+            GST_ELEMENT(pBintr->GetGstObject()), "src");
+            
+        if (pSinkPad and pSrcPad)
+        {
+            DSL_LATENCY_TRACER_PTR pTracer = DSL_LATENCY_TRACER_NEW(pBintr->GetCStrName());
+            pTracer->AddEntryPad(pSinkPad, DSL_LATENCY_BATCHED);
+            pTracer->AddExitPad(pSrcPad);
+            m_latencyTracers.push_back(pTracer);
+        }
+        if (pSinkPad)
+        {
+            gst_object_unref(pSinkPad);
+        }
+        if (pSrcPad)
+        {
+            gst_object_unref(pSrcPad);
+        }
+        
+        // Trace all children of Branches and Multi-Component Bintrs as well
+        for (auto const& imap: pBintr->GetChildren())
+        {
+            InstallLatencyTracers(imap.second);
+        }
+    }
+
+    bool PipelineBintr::GetPerfEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_perfEnabled;
+    }
+    
+    void PipelineBintr::SetPerfEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        m_perfEnabled = enabled;
+        
+        if (!m_isLinked)
+        {
+            return;
+        }
+        if (enabled)
+        {
+            if (!m_perfTimerId)
+            {
+                InstallPerfMeter();
+            }
+        }
+        else
+        {
+            StopPerfMeter();
+        }
+    }
+    
+    uint PipelineBintr::GetPerfInterval()
+    {
+        LOG_FUNC();
+        
+        return m_perfInterval;
+    }
+    
+    bool PipelineBintr::SetPerfInterval(uint interval)
+    {
+        LOG_FUNC();
+        
+        if (m_perfTimerId)
+        {
+            LOG_ERROR("Unable to set perf interval for Pipeline '" << GetName() 
+                << "' as it's currently metering");
+            return false;
+        }
+        if (!interval)
+        {
+            LOG_ERROR("Invalid perf interval of 0 for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        m_perfInterval = interval;
+        return true;
+    }
+    
+    bool PipelineBintr::GetPerf(uint sourceId, double* fps, 
+        double* p50, double* p95, double* p99, uint* drops)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfMutex);
+        
+        if (!m_pPerfMeter)
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' has not been metered");
+            return false;
+        }
+        return m_pPerfMeter->GetReport(sourceId, fps, p50, p95, p99, drops);
+    }
+    
+    bool PipelineBintr::AddPerfListener(dsl_perf_listener_cb listener, void* userdata)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfMutex);
+        
+        if (m_perfListeners.find(listener) != m_perfListeners.end())
+        {   
+            LOG_ERROR("Pipeline listener is not unique");
+            return false;
+        }
+        m_perfListeners[listener] = userdata;
+        
+        return true;
+    }
+
+    bool PipelineBintr::RemovePerfListener(dsl_perf_listener_cb listener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfMutex);
+        
+        if (m_perfListeners.find(listener) == m_perfListeners.end())
+        {   
+            LOG_ERROR("Pipeline listener was not found");
+            return false;
+        }
+        m_perfListeners.erase(listener);
+        
+        return true;
+    }
+    
+    void PipelineBintr::InstallPerfMeter()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfMutex);
+        
+        m_pPerfMeter = DSL_PERF_METER_NEW(GetCStrName());
+        
+        // Each frame is stamped as it leaves its Source, before the StreamMux
+        for (auto const& imap: m_pPipelineSourcesBintr->GetChildren())
+        {
+            DSL_SOURCE_PTR pSourceBintr = std::dynamic_pointer_cast<SourceBintr>(imap.second);
+            
+            GstPad* pSrcPad = gst_element_get_static_pad(
+                GST_ELEMENT(pSourceBintr->GetGstObject()), "src");
+            if (pSrcPad)
+            {
+                m_pPerfMeter->AddSourcePad(pSrcPad, pSourceBintr->GetSourceId());
+                gst_object_unref(pSrcPad);
+            }
+        }
+        for (auto const& ivec: m_linkedComponents)
+        {
+            if (ivec != m_pPipelineSourcesBintr)
+            {
+                InstallPerfMeter(ivec);
+            }
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfTimerMutex);
+            m_perfTimerCount++;
+        }
+        if (m_pMainContext)
+        {
+            GSource* pPerfTimer = g_timeout_source_new(m_perfInterval);
+            g_source_set_callback(pPerfTimer, PipelinePerfTimerCB, this, 
+                PipelinePerfTimerDestroyCB);
+            m_perfTimerId = g_source_attach(pPerfTimer, m_pMainContext);
+            g_source_unref(pPerfTimer);
+        }
+        else
+        {
+            m_perfTimerId = g_timeout_add_full(G_PRIORITY_DEFAULT, m_perfInterval, 
+                PipelinePerfTimerCB, this, PipelinePerfTimerDestroyCB);
+        }
+    }
+    
+    void PipelineBintr::InstallPerfMeter(DSL_NODETR_PTR pNodetr)
+    {
+        LOG_FUNC();
+        
+        DSL_SINK_PTR pSinkBintr = std::dynamic_pointer_cast<SinkBintr>(pNodetr);
+        if (pSinkBintr)
+        {
+            GstPad* pSinkPad = gst_element_get_static_pad(
+                GST_ELEMENT(pSinkBintr->GetGstObject()), "sink");
+            if (pSinkPad)
+            {
+                m_pPerfMeter->AddSinkPad(pSinkPad);
+                gst_object_unref(pSinkPad);
+            }
+            return;
+        }
+        if (std::dynamic_pointer_cast<Bintr>(pNodetr))
+        {
+            for (auto const& imap: pNodetr->GetChildren())
+            {
+                InstallPerfMeter(imap.second);
+            }
+        }
+    }
+    
+    void PipelineBintr::StopPerfMeter()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfMutex);
+        
+        if (m_perfTimerId)
+        {
+            if (m_pMainContext)
+            {
+                GSource* pPerfTimer = g_main_context_find_source_by_id(
+                    m_pMainContext, m_perfTimerId);
+                if (pPerfTimer)
+                {
+                    g_source_destroy(pPerfTimer);
+                }
+            }
+            else
+            {
+                g_source_remove(m_perfTimerId);
+            }
+            m_perfTimerId = 0;
+        }
+        if (m_pPerfMeter)
+        {
+            m_pPerfMeter->RemoveProbes();
+        }
+    }
+    
+    int PipelineBintr::HandlePerfTimer()
+    {
+        LOG_FUNC();
+        
+        struct PerfReport
+        {
+            uint sourceId;
+            double fps, p50, p95, p99;
+            uint drops;
+        };
+        std::vector<PerfReport> reports;
+        std::map<dsl_perf_listener_cb, void*> perfListeners;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfMutex);
+            
+            // Dispatched before the timer was removed by StopPerfMeter
+            if (!m_perfTimerId)
+            {
+                return false;
+            }
+            m_pPerfMeter->Update();
+            
+            for (auto sourceId: m_pPerfMeter->GetSourceIds())
+            {
+                PerfReport report = {sourceId, 0, 0, 0, 0, 0};
+                m_pPerfMeter->GetReport(sourceId, &report.fps, 
+                    &report.p50, &report.p95, &report.p99, &report.drops);
+                reports.push_back(report);
+            }
+            perfListeners = m_perfListeners;
+        }
+        
+        // Listeners are called without the mutex held so that they may query
+        // or update the Pipeline's performance settings
+        for (auto const& ivec: reports)
+        {
+            for (auto const& imap: perfListeners)
+            {
+                imap.first(ivec.sourceId, ivec.fps, ivec.p50, ivec.p95, ivec.p99, 
+                    ivec.drops, imap.second);
+            }
+        }
+        return true;
+    }
+
+    void PipelineBintr::HandlePerfTimerDestroyed()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_perfTimerMutex);
+        
+        m_perfTimerCount--;
+        g_cond_broadcast(&m_perfTimerCond);
+    }
+
+    bool PipelineBintr::StartTrace(const char* filePath, uint format)
+    {
+        LOG_FUNC();
+        
+        if (!TraceRecorder::GetRecorder()->Start(GetCStrName(), filePath, format))
+        {
+            return false;
+        }
+        m_isTracing = true;
+        if (m_isLinked)
+        {
+            InstallTraceProbes();
+        }
+        return true;
+    }
+    
+    bool PipelineBintr::StopTrace()
+    {
+        LOG_FUNC();
+        
+        if (!m_isTracing)
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' is not tracing");
+            return false;
+        }
+        RemoveTraceProbes();
+        m_isTracing = false;
+        
+        return TraceRecorder::GetRecorder()->Stop(GetCStrName());
+    }
+    
+    void PipelineBintr::InstallTraceProbes()
+    {
+        LOG_FUNC();
+        
+        RemoveTraceProbes();
+        
+        for (auto const& ivec: m_linkedComponents)
+        {
+            InstallTraceProbes(ivec);
+        }
+    }
+    
+    void PipelineBintr::InstallTraceProbes(DSL_NODETR_PTR pNodetr)
+    {
+        LOG_FUNC();
+        
+        DSL_BINTR_PTR pBintr = std::dynamic_pointer_cast<Bintr>(pNodetr);
+        if (!pBintr)
+        {
+            return;
+        }
+        
+        // Buffers arrive at a Bintr on its sink pad, or leave its src pad for Sources
+        GstPad* pPad = gst_element_get_static_pad(
+            GST_ELEMENT(pBintr->GetGstObject()), "sink");
+        if (!pPad)
+        {
+            pPad = gst_element_get_static_pad(GST_ELEMENT(pBintr->GetGstObject()), "src");
+        }
+        if (pPad)
+        {
+            gulong probeId = gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER, 
+                PipelineTraceBufferProbeCB, (gpointer)pBintr->GetCStrName(), NULL);
+            m_traceProbes.push_back(std::make_pair(pPad, probeId));
+        }
+        for (auto const& imap: pBintr->GetChildren())
+        {
+            InstallTraceProbes(imap.second);
+        }
+    }
+    
+    void PipelineBintr::RemoveTraceProbes()
+    {
+        LOG_FUNC();
+        
+        for (auto const& ivec: m_traceProbes)
+        {
+            gst_pad_remove_probe(ivec.first, ivec.second);
+            gst_object_unref(ivec.first);
+        }
+        m_traceProbes.clear();
+    }
+
+    bool PipelineBintr::GetClassificationCacheEnabled()
+    {
+        LOG_FUNC();
+        
+        return m_classificationCacheEnabled;
+    }
+    
+    bool PipelineBintr::SetClassificationCacheEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("Unable to set classification cache enabled for Pipeline '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        m_classificationCacheEnabled = enabled;
+        return true;
+    }
+    
+    void PipelineBintr::GetClassificationCacheSettings(uint* minCount, 
+        double* minConfidence, uint* ttl)
+    {
+        LOG_FUNC();
+        
+        m_pClassificationCache->GetSettings(minCount, minConfidence, ttl);
+    }
+    
+    bool PipelineBintr::SetClassificationCacheSettings(uint minCount, 
+        double minConfidence, uint ttl)
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("Unable to set classification cache settings for Pipeline '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        return m_pClassificationCache->SetSettings(minCount, minConfidence, ttl);
+    }
+    
+    bool PipelineBintr::GetClassificationCacheStats(double* hitRate, uint* entries)
+    {
+        LOG_FUNC();
+        
+        if (!m_classificationCacheEnabled)
+        {
+            LOG_ERROR("Classification cache is not enabled for Pipeline '" << GetName() << "'");
+            return false;
+        }
+        uint64_t hits(0), misses(0);
+        m_pClassificationCache->GetStats(&hits, &misses, entries);
+        
+        *hitRate = (hits + misses) ? (double)hits / (hits + misses) : 0;
+        return true;
+    }
+    
+    bool PipelineBintr::GetMainContextEnabled()
+    {
+        LOG_FUNC();
+        
+        return (m_pMainContext != NULL);
+    }
+    
+    bool PipelineBintr::SetMainContextEnabled(bool enabled)
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("Unable to set main context for Pipeline '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        bool eventFdCreated(false);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busSyncMutex);
+            eventFdCreated = (m_eventFd >= 0);
+        }
+        if (enabled and eventFdCreated)
+        {
+            LOG_ERROR("Unable to enable main context for Pipeline '" << GetName() 
+                << "' as its events are dispatched by the client");
+            return false;
+        }
+        if (enabled == GetMainContextEnabled())
+        {
+            LOG_ERROR("Main context for Pipeline '" << GetName() 
+                << "' is already " << (enabled ? "enabled" : "disabled"));
+            return false;
+        }
+        if (enabled)
+        {
+            StartMainContext();
+        }
+        else
+        {
+            StopMainContext(true);
+        }
+        return true;
+    }
+    
+    void PipelineBintr::StartMainContext()
+    {
+        LOG_FUNC();
+        
+        // A Bus can have only one watch installed with gst_bus_add_watch
+        gst_bus_remove_watch(m_pGstBus);
+        
+        m_pMainContext = g_main_context_new();
+        m_pMainLoop = g_main_loop_new(m_pMainContext, FALSE);
+        
+        m_pBusWatchSource = gst_bus_create_watch(m_pGstBus);
+        g_source_set_callback(m_pBusWatchSource, (GSourceFunc)bus_watch, this, NULL);
+        m_gstBusWatch = g_source_attach(m_pBusWatchSource, m_pMainContext);
+        
+        m_pMainContextThread = g_thread_new(GetCStrName(), 
+            PipelineMainContextThread, this);
+            
+        LOG_INFO("Main context thread started for Pipeline '" << GetName() << "'");
+    }
+    
+    void PipelineBintr::StopMainContext(bool restoreBusWatch)
+    {
+        LOG_FUNC();
+        
+        // Quit from within the loop so that a quit can't be lost if the 
+        // thread has yet to enter g_main_loop_run
+        GSource* pQuitSource = g_idle_source_new();
+        g_source_set_callback(pQuitSource, PipelineMainLoopQuitCB, m_pMainLoop, NULL);
+        g_source_attach(pQuitSource, m_pMainContext);
+        g_source_unref(pQuitSource);
+        
+        if (g_thread_self() == m_pMainContextThread)
+        {
+            // Called from a client listener - the thread holds its own 
+            // reference to the main loop and will exit on return.
+            LOG_WARN("Main context for Pipeline '" << GetName() 
+                << "' stopped from its own thread");
+            g_thread_unref(m_pMainContextThread);
+        }
+        else
+        {
+            g_thread_join(m_pMainContextThread);
+        }
+        m_pMainContextThread = NULL;
+        
+        g_source_destroy(m_pBusWatchSource);
+        g_source_unref(m_pBusWatchSource);
+        m_pBusWatchSource = NULL;
+        
+        g_main_loop_unref(m_pMainLoop);
+        m_pMainLoop = NULL;
+        g_main_context_unref(m_pMainContext);
+        m_pMainContext = NULL;
+        
+        m_gstBusWatch = (restoreBusWatch)
+            ? gst_bus_add_watch(m_pGstBus, bus_watch, this)
+            : 0;
+    }
+    
+    bool PipelineBintr::GetEventFd(int* fd)
+    {
+        LOG_FUNC();
+        
+        if (m_pMainContext)
+        {
+            LOG_ERROR("Unable to get event fd for Pipeline '" << GetName() 
+                << "' as its main context is enabled");
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busSyncMutex);
+        
+        if (m_eventFd < 0)
+        {
+            m_eventFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            if (m_eventFd < 0)
+            {
+                LOG_ERROR("Failed to create event fd for Pipeline '" << GetName() 
+                    << "' with errno = " << errno);
+                return false;
+            }
+            LOG_INFO("Event fd = " << m_eventFd << " created for Pipeline '" 
+                << GetName() << "'");
+        }
+        *fd = m_eventFd;
+        return true;
+    }
+    
+    uint PipelineBintr::DispatchEvents()
     {
         LOG_FUNC();
-
-        if (!m_pPipelineSourcesBintr)
+        
+        // The fd is created by the client thread and read by the bus sync 
+        // handler, both under the bus sync mutex
         {
-            LOG_INFO("Pipeline '" << GetName() << "' has no Sources");
-            return false;
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busSyncMutex);
+            
+            if (m_eventFd < 0)
+            {
+                return 0;
+            }
+            
+            // Clear the eventfd before taking the queue so that any message 
+            // queued after the swap leaves the fd readable.
+            eventfd_t count;
+            eventfd_read(m_eventFd, &count);
         }
-        return (m_pPipelineSourcesBintr->IsChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr)));
+        std::deque<GstMessage*> messages;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_eventQueueMutex);
+            messages.swap(m_eventQueue);
+        }
+        for (auto const& pMessage: messages)
+        {
+            HandleBusWatchMessage(pMessage);
+            gst_message_unref(pMessage);
+        }
+        return messages.size();
     }
-
-    bool PipelineBintr::RemoveSourceBintr(DSL_NODETR_PTR pSourceBintr)
+    
+    void PipelineBintr::RunMainLoop()
     {
         LOG_FUNC();
-
-        // Must cast to SourceBintr first so that correct Instance of RemoveChild is called
-        return m_pPipelineSourcesBintr->RemoveChild(std::dynamic_pointer_cast<SourceBintr>(pSourceBintr));
+        
+        GMainLoop* pMainLoop = g_main_loop_ref(m_pMainLoop);
+        GMainContext* pMainContext = g_main_loop_get_context(pMainLoop);
+        
+        g_main_context_push_thread_default(pMainContext);
+        g_main_loop_run(pMainLoop);
+        g_main_context_pop_thread_default(pMainContext);
+        
+        g_main_loop_unref(pMainLoop);
     }
-
-
-    void PipelineBintr::GetStreamMuxBatchProperties(guint* batchSize, uint* batchTimeout)
+    
+    void PipelineBintr::GetSurfaceBudget(uint* budget, uint* policy)
     {
         LOG_FUNC();
-
-        *batchSize = m_batchSize;
-        *batchTimeout = m_batchTimeout;
+        
+        *budget = m_surfaceBudget;
+        *policy = m_surfaceBudgetPolicy;
     }
 
-    bool PipelineBintr::SetStreamMuxBatchProperties(uint batchSize, uint batchTimeout)
+    bool PipelineBintr::SetSurfaceBudget(uint budget, uint policy)
     {
         LOG_FUNC();
-
-        m_batchSize = batchSize;
-        m_batchTimeout = batchTimeout;
-
-        if (IsLinked())
+        
+        if (m_isLinked)
         {
-            LOG_ERROR("Pipeline '" << GetName() << "' is currently Linked - batch properties can not be updated");
+            LOG_ERROR("Unable to set surface budget for Pipeline '" << GetName() 
+                << "' as it's currently linked");
             return false;
-            
         }
-        if (m_pPipelineSourcesBintr)
+        if (policy > DSL_SURFACE_BUDGET_POLICY_SHRINK)
         {
-            m_pPipelineSourcesBintr->SetStreamMuxBatchProperties(m_batchSize, m_batchTimeout);
+            LOG_ERROR("Invalid surface budget policy '" << policy << "' for Pipeline '" 
+                << GetName() << "'");
+            return false;
         }
-        
+        m_surfaceBudget = budget;
+        m_surfaceBudgetPolicy = policy;
         return true;
     }
-
-    bool PipelineBintr::GetStreamMuxDimensions(uint* width, uint* height)
+    
+    uint PipelineBintr::GetProjectedSurfaceMemory()
     {
         LOG_FUNC();
-
-        if (!m_pPipelineSourcesBintr)
-        {
-            LOG_ERROR("Pipeline '" << GetName() << "' has no Sources or Stream Muxer");
-            return false;
-        }
-        m_pPipelineSourcesBintr->GetStreamMuxDimensions(width, height);
-        return true;
+        
+        SurfaceMemoryPlanner planner;
+        BuildSurfacePlan(planner);
+        
+        return (planner.GetProjectedSize() + (1<<20) - 1) >> 20;
     }
-
-    bool PipelineBintr::SetStreamMuxDimensions(uint width, uint height)
+    
+    void PipelineBintr::BuildSurfacePlan(SurfaceMemoryPlanner& planner)
     {
         LOG_FUNC();
-
+        
         if (!m_pPipelineSourcesBintr)
         {
-            LOG_ERROR("Pipeline '" << GetName() << "' has no Sources or Stream Muxer");
-            return false;
+            return;
+        }
+        uint muxWidth(0), muxHeight(0);
+        m_pPipelineSourcesBintr->GetStreamMuxDimensions(&muxWidth, &muxHeight);
+        if (!muxWidth or !muxHeight)
+        {
+            muxWidth = DSL_DEFAULT_STREAMMUX_WIDTH;
+            muxHeight = DSL_DEFAULT_STREAMMUX_HEIGHT;
+        }
+        
+        for (auto const& imap: m_pPipelineSourcesBintr->m_pChildSources)
+        {
+            DSL_DECODE_SOURCE_PTR pDecodeSource = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(imap.second);
+            if (!pDecodeSource)
+            {
+                continue;
+            }
+            // Decoded dimensions are unknown until first played, so
+            // plan for the StreamMux dimensions until then.
+            uint width(0), height(0);
+            pDecodeSource->GetDimensions(&width, &height);
+            if (!width or !height)
+            {
+                width = muxWidth;
+                height = muxHeight;
+            }
+            // Only the counts honoured by the Source's decoder can be shrunk.
+            // nvv4l2decoder allocates its own decode surfaces, nvcuvid no extras.
+            uint numDecodeSurfaces(0), numExtraSurfaces(0);
+            pDecodeSource->GetNumSurfaces(&numDecodeSurfaces, &numExtraSurfaces);
+            bool decodeSurfacesHonoured(false), extraSurfacesHonoured(false);
+            pDecodeSource->GetHonouredSurfaces(&decodeSurfacesHonoured, 
+                &extraSurfacesHonoured);
+            planner.AddDecoder(imap.first, width, height, numDecodeSurfaces, 
+                (extraSurfacesHonoured) ? numExtraSurfaces : 0, !decodeSurfacesHonoured);
+        }
+        planner.AddStreamMux(muxWidth, muxHeight, 
+            std::max(m_batchSize, m_pPipelineSourcesBintr->GetNumChildren()));
+        
+        for (uint i = 0; i < GetNumSinksInUse(); i++)
+        {
+            planner.AddSink(muxWidth, muxHeight);
         }
-        m_pPipelineSourcesBintr->SetStreamMuxDimensions(width, height);
-        return true;
     }
     
-    bool PipelineBintr::GetStreamMuxPadding(bool* enabled)
+    bool PipelineBintr::ApplySurfaceBudget()
     {
         LOG_FUNC();
+        
+        // Start from the surface counts set by the client on each link, 
+        // so that a previous shrink does not outlive a raised or disabled budget
+        for (auto const& imap: m_pPipelineSourcesBintr->m_pChildSources)
+        {
+            DSL_DECODE_SOURCE_PTR pDecodeSource = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(imap.second);
+            if (pDecodeSource)
+            {
+                uint numDecodeSurfaces(0), numExtraSurfaces(0);
+                pDecodeSource->GetNumSurfaces(&numDecodeSurfaces, &numExtraSurfaces);
+                pDecodeSource->SetEffectiveNumSurfaces(numDecodeSurfaces, numExtraSurfaces);
+            }
+        }
+        if (!m_surfaceBudget)
+        {
+            return true;
+        }
+        SurfaceMemoryPlanner planner;
+        BuildSurfacePlan(planner);
+        
+        uint64_t budget = (uint64_t)m_surfaceBudget << 20;
+        uint64_t projectedSize = planner.GetProjectedSize();
+        
+        LOG_INFO("Pipeline '" << GetName() << "' projected surface memory = " 
+            << (projectedSize >> 20) << "MB with budget = " << m_surfaceBudget << "MB");
 
-        if (!m_pPipelineSourcesBintr)
+        if (projectedSize <= budget)
         {
-            LOG_ERROR("Pipeline '" << GetName() << "' has no Sources or Stream Muxer");
+            return true;
+        }
+        if (m_surfaceBudgetPolicy == DSL_SURFACE_BUDGET_POLICY_REFUSE or 
+            !planner.FitToBudget(budget))
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' projected surface memory of " 
+                << (projectedSize >> 20) << "MB exceeds budget of " << m_surfaceBudget << "MB");
             return false;
         }
-        m_pPipelineSourcesBintr->GetStreamMuxPadding(enabled);
+        for (auto const& imap: m_pPipelineSourcesBintr->m_pChildSources)
+        {
+            DSL_DECODE_SOURCE_PTR pDecodeSource = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(imap.second);
+            uint numDecodeSurfaces(0), numExtraSurfaces(0);
+            if (!pDecodeSource or !planner.GetDecoderSurfaces(imap.first, 
+                &numDecodeSurfaces, &numExtraSurfaces))
+            {
+                continue;
+            }
+            uint requestedDecodeSurfaces(0), requestedExtraSurfaces(0);
+            pDecodeSource->GetNumSurfaces(&requestedDecodeSurfaces, &requestedExtraSurfaces);
+            bool decodeSurfacesHonoured(false), extraSurfacesHonoured(false);
+            pDecodeSource->GetHonouredSurfaces(&decodeSurfacesHonoured, 
+                &extraSurfacesHonoured);
+            if (!extraSurfacesHonoured)
+            {
+                numExtraSurfaces = requestedExtraSurfaces;
+            }
+            if (numDecodeSurfaces == requestedDecodeSurfaces and 
+                numExtraSurfaces == requestedExtraSurfaces)
+            {
+                continue;
+            }
+            LOG_INFO("Source '" << imap.first << "' shrunk to " << numDecodeSurfaces 
+                << " decode and " << numExtraSurfaces << " extra surfaces for this play");
+            pDecodeSource->SetEffectiveNumSurfaces(numDecodeSurfaces, numExtraSurfaces);
+        }
         return true;
     }
-    
-    bool PipelineBintr::SetStreamMuxPadding(bool enabled)
+
+    bool PipelineBintr::Prepare(dsl_prepare_complete_cb listener, void* userData)
     {
         LOG_FUNC();
-
-        if (!m_pPipelineSourcesBintr)
+        
         {
-            LOG_ERROR("Pipeline '" << GetName() << "' has no Sources or Stream Muxer");
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_prepareMutex);
+            
+            if (m_prepareInProgress)
+            {
+                LOG_ERROR("Prepare is already in progress for Pipeline '" << GetName() << "'");
+                return false;
+            }
+        }
+        if (GetState() != GST_STATE_NULL)
+        {
+            LOG_ERROR("Pipeline '" << GetName() << "' must be in a NULL state to prepare");
             return false;
         }
-        m_pPipelineSourcesBintr->SetStreamMuxPadding(enabled);
+        // A failed prepare leaves the Pipeline linked until stopped or prepared again
+        if (!IsLinked() and !LinkAll())
+        {
+            LOG_ERROR("Unable to link Pipeline '" << GetName() << "' for Prepare");
+            return false;
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_prepareMutex);
+            
+            m_prepareInProgress = true;
+            m_prepareListener = listener;
+            m_prepareUserData = userData;
+            m_prepareTimes.clear();
+            m_prepareLastChange = std::chrono::steady_clock::now();
+        }
+        // The state change, including all engine loads and the preroll, 
+        // is performed on a thread from the GStreamer thread pool.
+        gst_element_call_async(GetGstElement(), PipelinePrepareCB, this, NULL);
         return true;
     }
     
-    void PipelineBintr::GetXWindowDimensions(uint* width, uint* height)
+    void PipelineBintr::HandlePrepare()
     {
         LOG_FUNC();
         
-        *width = m_xWindowWidth;
-        *height = m_xWindowHeight;
-    }
-
-    bool PipelineBintr::SetXWindowDimensions(uint width, uint height)
-    {
-        LOG_FUNC();
-
-        // TODO verify dimensions before setting.
-        if (m_pXWindow)
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        
+        GstStateChangeReturn changeReturn = 
+            gst_element_set_state(GetGstElement(), GST_STATE_PAUSED);
+        if (changeReturn == GST_STATE_CHANGE_ASYNC)
         {
-            LOG_ERROR("Pipeline '" << GetName() << "' has an existing XWindow.");
-            return false;
+            changeReturn = gst_element_get_state(GetGstElement(), NULL, NULL, 
+                DSL_DEFAULT_STATE_CHANGE_TIMEOUT_IN_SEC * GST_SECOND);
+        }
+        // Live sources do not preroll, NO_PREROLL is the expected result
+        bool prepared(changeReturn != GST_STATE_CHANGE_FAILURE);
+        if (!prepared)
+        {
+            LOG_ERROR("FAILURE occured preparing Pipeline '" << GetName() << "'");
+            gst_element_set_state(GetGstElement(), GST_STATE_NULL);
+        }
+        else
+        {
+            LOG_INFO("Pipeline '" << GetName() << "' prepared in " << 
+                std::chrono::duration<double, std::milli>(
+                    std::chrono::steady_clock::now() - start).count() << "ms");
+        }
+        
+        dsl_prepare_complete_cb listener(NULL);
+        void* userData(NULL);
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_prepareMutex);
+            
+            listener = m_prepareListener;
+            userData = m_prepareUserData;
+            m_prepareInProgress = false;
+            g_cond_broadcast(&m_prepareCond);
+        }
+        // Pipeline may be deleted once signaled, the listener is free to call Play
+        if (listener)
+        {
+            try
+            {
+                listener(prepared ? DSL_RESULT_SUCCESS 
+                    : DSL_RESULT_PIPELINE_FAILED_TO_PREPARE, userData);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Client Listener for Prepare complete threw an exception");
+            }
         }
-        m_xWindowWidth = width;
-        m_xWindowHeight = height;
-        return true;
     }
     
-    bool PipelineBintr::LinkAll()
+    const char* PipelineBintr::GetPrepareReport()
     {
         LOG_FUNC();
-
-        if (m_isLinked)
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_prepareMutex);
+        
+        std::vector<std::pair<std::string, double>> times(
+            m_prepareTimes.begin(), m_prepareTimes.end());
+        std::sort(times.begin(), times.end(), 
+            [](const std::pair<std::string, double>& a, 
+                const std::pair<std::string, double>& b)
+            {
+                return a.second > b.second;
+            });
+        
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(1);
+        
+        for (auto const& ivec: times)
         {
-            LOG_INFO("Components for Pipeline '" << GetName() << "' are already assembled");
-            return false;
+            report << ivec.first << " " << ivec.second << "ms\n";
         }
-        if (!m_pPipelineSourcesBintr)
+        m_prepareReport = report.str();
+        return m_prepareReport.c_str();
+    }
+    
+    void PipelineBintr::RecordPrepareStateChange(GstMessage* pMessage)
+    {
+        GstState oldState, newState;
+        gst_message_parse_state_changed(pMessage, &oldState, &newState, NULL);
+        
+        // Only the upward transitions, NULL->READY->PAUSED, are timed
+        if (newState <= oldState or newState > GST_STATE_PAUSED)
         {
-            LOG_ERROR("Pipline '" << GetName() << "' has no required Source component - and is unable to link");
-            return false;
+            return;
         }
-
-        // If the batch size has not been explicitely set, use the number of sources.
-        if (m_batchSize < m_pPipelineSourcesBintr->GetNumChildren())
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_prepareMutex);
+        
+        if (!m_prepareInProgress)
         {
-            SetStreamMuxBatchProperties(m_pPipelineSourcesBintr->GetNumChildren(), m_batchTimeout);
+            return;
         }
+        // Elements change state in sequence, sinks first, so the time since 
+        // the previous state change is the time taken by this element.
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        m_prepareTimes[GST_MESSAGE_SRC_NAME(pMessage)] += 
+            std::chrono::duration<double, std::milli>(now - m_prepareLastChange).count();
+        m_prepareLastChange = now;
+    }
+    
+    void PipelineBintr::WaitForPrepare()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_prepareMutex);
         
-        // Start with an empty list of linked components
-        m_linkedComponents.clear();
-
-        // Link all Source Elementrs (required component), and all Sources to the StreamMuxer
-        // then add the PipelineSourcesBintr as the Source (head) component for this Pipeline
-        if (!m_pPipelineSourcesBintr->LinkAll())
+        while (m_prepareInProgress)
         {
-            return false;
+            g_cond_wait(&m_prepareCond, &m_prepareMutex);
         }
-        m_linkedComponents.push_back(m_pPipelineSourcesBintr);
-        
-        LOG_INFO("Pipeline '" << GetName() << "' Linked up all Source '" << 
-            m_pPipelineSourcesBintr->GetName() << "' successfully");
-
-        // call the base class to Link all remaining components.
-        return BranchBintr::LinkAll();
     }
 
     bool PipelineBintr::Play()
     {
         LOG_FUNC();
         
+        WaitForPrepare();
+        
         if (GetState() == GST_STATE_NULL)
         {
-            if (!LinkAll())
+            if (!IsLinked() and !LinkAll())
             {
                 LOG_ERROR("Unable to prepare Pipeline '" << GetName() << "' for Play");
                 return false;
@@ -306,6 +1577,8 @@ namespace DSL
     {
         LOG_FUNC();
         
+        WaitForPrepare();
+        
         if (GetState() != GST_STATE_PLAYING)
         {
             LOG_WARN("Pipeline '" << GetName() << "' is not in a state of Playing");
@@ -324,18 +1597,26 @@ namespace DSL
     {
         LOG_FUNC();
         
+        WaitForPrepare();
+        
         uint state = GetState();
-        if ((state != GST_STATE_PLAYING) and (state != GST_STATE_PAUSED))
+        if ((state == GST_STATE_PLAYING) or (state == GST_STATE_PAUSED))
         {
-            LOG_DEBUG("Pipeline '" << GetName() << "' is not in a state of Playing or Paused");
-            return true;
+            if (!SetState(GST_STATE_READY))
+            {
+                LOG_ERROR("Failed to Stop Pipeline '" << GetName() << "'");
+                return false;
+            }
         }
-
-        if (!SetState(GST_STATE_READY))
+        // A Pipeline left linked by a failed prepare is unlinked as well
+        else if (!IsLinked())
         {
-            LOG_ERROR("Failed to Stop Pipeline '" << GetName() << "'");
-            return false;
+            LOG_DEBUG("Pipeline '" << GetName() << "' is not in a state of Playing or Paused");
+            return true;
         }
+        StopPerfMeter();
+        RemoveTraceProbes();
+        
         if (IsLinked())
         {
             UnlinkAll();
@@ -500,6 +1781,7 @@ namespace DSL
     }
     bool PipelineBintr::HandleBusWatchMessage(GstMessage* pMessage)
     {
+        TRACE_SCOPE("bus", GST_MESSAGE_TYPE_NAME(pMessage));
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_busWatchMutex);
         
         switch (GST_MESSAGE_TYPE(pMessage))
@@ -526,6 +1808,10 @@ namespace DSL
         case GST_MESSAGE_STATE_CHANGED:
             HandleStateChanged(pMessage);
             return true;
+        case GST_MESSAGE_APPLICATION:
+            // tasks posted by Sources to run outside of their streaming threads
+            UriSourceBintr::HandleTaskMessage(pMessage);
+            return true;
         default:
             LOG_INFO("Unhandled message type:: " << GST_MESSAGE_TYPE(pMessage));
         }
@@ -538,6 +1824,12 @@ namespace DSL
 
         switch (GST_MESSAGE_TYPE(pMessage))
         {
+        case GST_MESSAGE_STATE_CHANGED:
+            RecordPrepareStateChange(pMessage);
+            break;
+        case GST_MESSAGE_STREAM_STATUS:
+            m_pThreadManager->HandleStreamStatus(pMessage);
+            break;
         case GST_MESSAGE_ELEMENT:
         
             if (gst_is_video_overlay_prepare_window_handle_message(pMessage))
@@ -566,6 +1858,18 @@ namespace DSL
         default:
             break;
         }
+        
+        // Queue the message for client dispatch, signaling after the
+        // message is queued so that the client can never miss it.
+        if (m_eventFd >= 0)
+        {
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_eventQueueMutex);
+                m_eventQueue.push_back(gst_message_ref(pMessage));
+            }
+            eventfd_write(m_eventFd, 1);
+            return GST_BUS_DROP;
+        }
         return GST_BUS_PASS;
     }
     
@@ -580,6 +1884,13 @@ namespace DSL
         gst_message_parse_state_changed(pMessage, &oldstate, &newstate, NULL);
 
         LOG_INFO(m_mapPipelineStates[oldstate] << " => " << m_mapPipelineStates[newstate]);
+        
+        if (TraceRecorder::IsActive())
+        {
+            std::string stateChange = std::string(gst_element_state_get_name(oldstate)) 
+                + " => " + gst_element_state_get_name(newstate);
+            TRACE_INSTANT("state", stateChange.c_str());
+        }
 
         // iterate through the map of state-change-listeners calling each
         for(auto const& imap: m_stateChangeListeners)
@@ -602,65 +1913,59 @@ namespace DSL
     
     void PipelineBintr::HandleXWindowEvents()
     {
-        while (m_pXDisplay)
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
+        while (m_pXDisplay and XPending(m_pXDisplay)) 
         {
+            XEvent xEvent;
+            XNextEvent(m_pXDisplay, &xEvent);
+            switch (xEvent.type) 
             {
-                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_displayMutex);
-                while (m_pXDisplay and XPending(m_pXDisplay)) 
+            case ButtonPress:
+                LOG_INFO("Button pressed: xpos = " << xEvent.xbutton.x << ": ypos = " << xEvent.xbutton.y);
+                
+                // iterate through the map of XWindow Button Event handlers calling each
+                for(auto const& imap: m_xWindowButtonEventHandlers)
+                {
+                    imap.first((uint)xEvent.xbutton.x, (uint)xEvent.xbutton.y, imap.second);
+                }
+                break;
+                
+            case KeyRelease:
+                KeySym key;
+                char keyString[255];
+                if (XLookupString(&xEvent.xkey, keyString, 255, &key,0))
+                {   
+                    keyString[1] = 0;
+                    std::string cstrKeyString(keyString);
+                    std::wstring wstrKeyString(cstrKeyString.begin(), cstrKeyString.end());
+                    LOG_INFO("Key released = '" << cstrKeyString << "'"); 
+                    
+                    // iterate through the map of XWindow Key Event handlers calling each
+                    for(auto const& imap: m_xWindowKeyEventHandlers)
+                    {
+                        imap.first(wstrKeyString.c_str(), imap.second);
+                    }
+                }
+                break;
+                
+            case ClientMessage:
+                LOG_INFO("Client message");
+
+                if (XInternAtom(m_pXDisplay, "WM_DELETE_WINDOW", True) != None)
                 {
-                    XEvent xEvent;
-                    XNextEvent(m_pXDisplay, &xEvent);
-                    switch (xEvent.type) 
+                    LOG_INFO("WM_DELETE_WINDOW message received");
+                    Stop();
+                    // iterate through the map of XWindow Delete Event handlers calling each
+                    for(auto const& imap: m_xWindowDeleteEventHandlers)
                     {
-                    case ButtonPress:
-                        LOG_INFO("Button pressed: xpos = " << xEvent.xbutton.x << ": ypos = " << xEvent.xbutton.y);
-                        
-                        // iterate through the map of XWindow Button Event handlers calling each
-                        for(auto const& imap: m_xWindowButtonEventHandlers)
-                        {
-                            imap.first((uint)xEvent.xbutton.x, (uint)xEvent.xbutton.y, imap.second);
-                        }
-                        break;
-                        
-                    case KeyRelease:
-                        KeySym key;
-                        char keyString[255];
-                        if (XLookupString(&xEvent.xkey, keyString, 255, &key,0))
-                        {   
-                            keyString[1] = 0;
-                            std::string cstrKeyString(keyString);
-                            std::wstring wstrKeyString(cstrKeyString.begin(), cstrKeyString.end());
-                            LOG_INFO("Key released = '" << cstrKeyString << "'"); 
-                            
-                            // iterate through the map of XWindow Key Event handlers calling each
-                            for(auto const& imap: m_xWindowKeyEventHandlers)
-                            {
-                                imap.first(wstrKeyString.c_str(), imap.second);
-                            }
-                        }
-                        break;
-                        
-                    case ClientMessage:
-                        LOG_INFO("Client message");
-
-                        if (XInternAtom(m_pXDisplay, "WM_DELETE_WINDOW", True) != None)
-                        {
-                            LOG_INFO("WM_DELETE_WINDOW message received");
-                            Stop();
-                            // iterate through the map of XWindow Delete Event handlers calling each
-                            for(auto const& imap: m_xWindowDeleteEventHandlers)
-                            {
-                                imap.first(imap.second);
-                            }
-                        }
-                        break;
-                        
-                    default:
-                        break;
+                        imap.first(imap.second);
                     }
                 }
+                break;
+                
+            default:
+                break;
             }
-            g_usleep(G_USEC_PER_SEC / 20);
         }
     }
 
@@ -707,11 +2012,9 @@ namespace DSL
         // received and processed by the X server. TRUE = Discard all queued events
         XSync(m_pXDisplay, TRUE);
 
-        // Start the X window event thread
-        std::string threadName = GetName() + std::string("-x-window-event-thread");
-        m_pXWindowEventThread = g_thread_new(threadName.c_str(), XWindowEventThread, this);
-        
-        return true;
+        // Poll for XWindow events on the thread shared by all Pipelines
+        return XWindowEventDispatcher::GetDispatcher()->AddDisplay(m_pXDisplay, 
+            PipelineXWindowEventsCB, this);
     }
     
     bool PipelineBintr::ClearXWindow()
@@ -781,12 +2084,46 @@ namespace DSL
         return static_cast<PipelineBintr*>(pData)->HandleBusSyncMessage(pMessage);
     }
 
-    static gpointer XWindowEventThread(gpointer pData)
+    static void PipelineXWindowEventsCB(gpointer pPipeline)
+    {
+        static_cast<PipelineBintr*>(pPipeline)->HandleXWindowEvents();
+    }
+    
+    static gpointer PipelineMainContextThread(gpointer pPipeline)
     {
-        static_cast<PipelineBintr*>(pData)->HandleXWindowEvents();
+        static_cast<PipelineBintr*>(pPipeline)->RunMainLoop();
        
         return NULL;
     }
     
+    static gboolean PipelineMainLoopQuitCB(gpointer pMainLoop)
+    {
+        g_main_loop_quit(static_cast<GMainLoop*>(pMainLoop));
+        
+        return FALSE;
+    }
+    
+    static int PipelinePerfTimerCB(gpointer pPipeline)
+    {
+        return static_cast<PipelineBintr*>(pPipeline)->HandlePerfTimer();
+    }
+    
+    static void PipelinePerfTimerDestroyCB(gpointer pPipeline)
+    {
+        static_cast<PipelineBintr*>(pPipeline)->HandlePerfTimerDestroyed();
+    }
+    
+    static void PipelinePrepareCB(GstElement* pElement, gpointer pPipeline)
+    {
+        static_cast<PipelineBintr*>(pPipeline)->HandlePrepare();
+    }
+    
+    static GstPadProbeReturn PipelineTraceBufferProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pName)
+    {
+        TRACE_INSTANT("buffer", (const char*)pName);
+        return GST_PAD_PROBE_OK;
+    }
+    
 
 } // DSL
@@ -31,6 +31,12 @@ THE SOFTWARE.
 #include "DslSourceBintr.h"
 #include "DslDewarperBintr.h"
 #include "DslPipelineSourcesBintr.h"
+#include "DslSurfacePlanner.h"
+#include "DslLatencyTracer.h"
+#include "DslPerfMeter.h"
+#include "DslClassificationCache.h"
+#include "DslThreadManager.h"
+#include "DslXWindowEventDispatcher.h"
     
 namespace DSL 
 {
@@ -55,6 +61,29 @@ namespace DSL
         PipelineBintr(const char* pipeline);
         ~PipelineBintr();
 
+        /**
+         * @brief links all components and starts an asynchronous transition to
+         * PAUSED, prerolling non-live sources, so that a later Play is a state flip.
+         * @param[in] listener client callback to notify on completion, may be NULL
+         * @param[in] userData opaque pointer to client data passed to the listener
+         * @return false if the Pipeline is not in a NULL state, a prepare is
+         * already in progress, or the Pipeline fails to link
+         */
+        bool Prepare(dsl_prepare_complete_cb listener, void* userData);
+        
+        /**
+         * @brief handles the transition to PAUSED started by Prepare, called
+         * on a GStreamer thread-pool thread.
+         */
+        void HandlePrepare();
+        
+        /**
+         * @brief Gets a report of the time each element spent reaching PAUSED
+         * on the last call to Prepare, in descending order of time
+         * @return report with one line per element, valid until the next call
+         */
+        const char* GetPrepareReport();
+
         bool Play();
         
         bool Pause();
@@ -135,6 +164,255 @@ namespace DSL
          */
         bool SetStreamMuxPadding(bool enabled);
         
+        /**
+         * @brief Gets the current surface memory budget settings for this Pipeline
+         * @param[out] budget surface memory budget in MB, 0 if disabled
+         * @param[out] policy one of the DSL_SURFACE_BUDGET_POLICY constant values
+         */
+        void GetSurfaceBudget(uint* budget, uint* policy);
+
+        /**
+         * @brief Sets the surface memory budget for this Pipeline, applied on link.
+         * @param[in] budget surface memory budget in MB, 0 to disable
+         * @param[in] policy one of the DSL_SURFACE_BUDGET_POLICY constant values
+         * @return false if the Pipeline is linked or the policy is invalid
+         */
+        bool SetSurfaceBudget(uint budget, uint policy);
+
+        /**
+         * @brief Gets the surface memory projected for this Pipeline's
+         * decoders, StreamMux and Sinks with their current settings
+         * @return projected surface memory in MB, rounded up
+         */
+        uint GetProjectedSurfaceMemory();
+        
+        /**
+         * @brief Gets the current latency tracing enabled setting for this Pipeline
+         * @return true if latency tracing is enabled, false otherwise
+         */
+        bool GetLatencyTracingEnabled();
+
+        /**
+         * @brief Sets the latency tracing enabled setting for this Pipeline. 
+         * If linked, tracing is installed or its probes removed immediately, otherwise
+         * on link. The last report remains readable once disabled.
+         * @param[in] enabled set to true to enable latency tracing
+         */
+        void SetLatencyTracingEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the current link optimization enabled setting for this Pipeline
+         * @return true if link optimization is enabled, false otherwise
+         */
+        bool GetLinkOptimizationEnabled();
+        
+        /**
+         * @brief Sets the link optimization enabled setting for this Pipeline,
+         * applied on link. Redundant elements are elided from the linked Pipeline.
+         * @param[in] enabled set to true to enable link optimization
+         * @return false if the Pipeline is currently linked
+         */
+        bool SetLinkOptimizationEnabled(bool enabled);
+        
+        /**
+         * @brief Gets a report of the elements elided on the last link
+         * @return report with one line per elision, valid until the next call
+         */
+        const char* GetLinkOptimizationReport();
+        
+        /**
+         * @brief Gets the CPU affinity and priority for a thread role
+         * @param[in] role one of the DSL_THREAD_ROLE constant values
+         * @param[out] cpus CPU list, empty string if not pinned
+         * @param[out] priority nice value applied to each thread
+         * @return false if the role is invalid
+         */
+        bool GetThreadRoleAffinity(uint role, const char** cpus, int* priority);
+        
+        /**
+         * @brief Sets the CPU affinity and priority for a thread role, applied
+         * to each streaming thread of the role as it starts
+         * @param[in] role one of the DSL_THREAD_ROLE constant values
+         * @param[in] cpus CPU list, e.g. "0-3,6", empty string to not pin
+         * @param[in] priority nice value in the range -20 to 19
+         * @return false if the role, CPU list or priority is invalid
+         */
+        bool SetThreadRoleAffinity(uint role, const char* cpus, int priority);
+        
+        /**
+         * @brief Gets a report of the CPU usage of each streaming thread since link
+         * @return report with one line per thread, valid until the next call
+         */
+        const char* GetThreadReport();
+        
+        /**
+         * @brief Gets a report of the latency percentiles for each traced Bintr
+         * @return report with one line per traced Bintr, valid until the next call
+         */
+        const char* GetLatencyReport();
+        
+        /**
+         * @brief Gets the current performance metering enabled setting for this Pipeline
+         * @return true if performance metering is enabled, false otherwise
+         */
+        bool GetPerfEnabled();
+
+        /**
+         * @brief Sets the performance metering enabled setting for this Pipeline. 
+         * If linked, metering is started or stopped immediately, otherwise on link
+         * @param[in] enabled set to true to enable performance metering
+         */
+        void SetPerfEnabled(bool enabled);
+
+        /**
+         * @brief Gets the current performance reporting interval for this Pipeline
+         * @return reporting interval in milliseconds
+         */
+        uint GetPerfInterval();
+
+        /**
+         * @brief Sets the performance reporting interval for this Pipeline
+         * @param[in] interval reporting interval in milliseconds, must be > 0
+         * @return false if the Pipeline is metering or the interval is 0
+         */
+        bool SetPerfInterval(uint interval);
+
+        /**
+         * @brief Gets the performance measured for a single source over the 
+         * last reporting interval
+         * @param[in] sourceId source-id of the source to query
+         * @param[out] fps rolling frames per second 
+         * @param[out] p50 50th percentile capture-to-sink latency in milliseconds
+         * @param[out] p95 95th percentile capture-to-sink latency in milliseconds
+         * @param[out] p99 99th percentile capture-to-sink latency in milliseconds
+         * @param[out] drops total number of frames dropped
+         * @return false if the Pipeline has not been metered or the source is not found
+         */
+        bool GetPerf(uint sourceId, double* fps, 
+            double* p50, double* p95, double* p99, uint* drops);
+            
+        /**
+         * @brief adds a callback to be notified with the performance of each source
+         * at the end of every reporting interval
+         * @param[in] listener pointer to the client's function to call 
+         * @param[in] userdata opaque pointer to client data passed into the listener function.
+         * @return false if the listener is not unique
+         */
+        bool AddPerfListener(dsl_perf_listener_cb listener, void* userdata);
+
+        /**
+         * @brief removes a previously added callback
+         * @param[in] listener pointer to the client's function to remove
+         * @return false if the listener was not found
+         */
+        bool RemovePerfListener(dsl_perf_listener_cb listener);
+        
+        /**
+         * @brief handles the performance reporting timer by updating the PerfMeter
+         * and calling all client listeners with the report for each source
+         * @return true to continue the timer, false to stop
+         */
+        int HandlePerfTimer();
+        
+        /**
+         * @brief handles the destroy notify of a performance reporting timer,
+         * called by GLib once the timer is removed and any dispatched callback
+         * has returned
+         */
+        void HandlePerfTimerDestroyed();
+        
+        /**
+         * @brief Gets the current classification cache enabled setting for this Pipeline
+         * @return true if the classification cache is enabled, false otherwise
+         */
+        bool GetClassificationCacheEnabled();
+
+        /**
+         * @brief Sets the classification cache enabled setting for this Pipeline,
+         * applied to the Secondary GIEs on link
+         * @param[in] enabled set to true to enable the classification cache
+         * @return false if the Pipeline is linked
+         */
+        bool SetClassificationCacheEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the current classification cache settings for this Pipeline
+         * @param[out] minCount number of confident classifications required to freeze
+         * @param[out] minConfidence minimum probability for a confident classification
+         * @param[out] ttl time-to-live in milliseconds for objects not seen
+         */
+        void GetClassificationCacheSettings(uint* minCount, double* minConfidence, uint* ttl);
+        
+        /**
+         * @brief Sets the classification cache settings for this Pipeline
+         * @param[in] minCount number of confident classifications required to freeze
+         * @param[in] minConfidence minimum probability for a confident classification
+         * @param[in] ttl time-to-live in milliseconds for objects not seen
+         * @return false if the Pipeline is linked or any of the settings are invalid
+         */
+        bool SetClassificationCacheSettings(uint minCount, double minConfidence, uint ttl);
+        
+        /**
+         * @brief Gets the classification cache statistics for this Pipeline
+         * @param[out] hitRate ratio of object lookups that skipped secondary inference
+         * @param[out] entries current number of tracked objects in the cache
+         * @return false if the classification cache is not enabled
+         */
+        bool GetClassificationCacheStats(double* hitRate, uint* entries);
+        
+        /**
+         * @brief Starts a timeline trace for this Pipeline, recording API calls, bus
+         * messages, pad probe handlers and buffer arrivals at each Bintr
+         * @param[in] filePath path to the trace file to write on stop
+         * @param[in] format one of the DSL_TRACE_FORMAT constant values
+         * @return false if a trace is already active or the format is invalid
+         */
+        bool StartTrace(const char* filePath, uint format);
+
+        /**
+         * @brief Stops the current timeline trace and writes it to file
+         * @return false if this Pipeline is not tracing or the file could not be written
+         */
+        bool StopTrace();
+        
+        /**
+         * @brief Gets the current main context setting for this Pipeline
+         * @return true if the Pipeline's bus watch and timers run on a dedicated 
+         * main context and thread, false if run on the default main loop
+         */
+        bool GetMainContextEnabled();
+        
+        /**
+         * @brief Enables or disables a dedicated main context and thread for this 
+         * Pipeline. When enabled, bus messages and client listeners are handled 
+         * independently of all other Pipelines and of dsl_main_loop_run.
+         * @param[in] enabled set to true to enable, false to use the default main loop
+         * @return false if the Pipeline is linked or the setting is unchanged
+         */
+        bool SetMainContextEnabled(bool enabled);
+        
+        /**
+         * @brief Gets the event file descriptor for this Pipeline, creating it on
+         * first call. Once created, all bus messages are queued and signaled on the
+         * descriptor, and must be dispatched by calling DispatchEvents.
+         * @param[out] fd readable eventfd signaled when events are pending
+         * @return false if the main context is enabled or the eventfd could not be created
+         */
+        bool GetEventFd(int* fd);
+        
+        /**
+         * @brief Dispatches all pending bus messages to the client listeners on 
+         * the calling thread, and clears the event file descriptor.
+         * @return the number of messages dispatched
+         */
+        uint DispatchEvents();
+        
+        /**
+         * @brief runs the dedicated main loop, called by the main context thread 
+         * function with the Pipeline's main context as the thread default
+         */
+        void RunMainLoop();
+        
         /**
          * @brief Gets the current dimensions for the Pipeline's XWindow
          * @param[out] width width in pixels for the current setting
@@ -268,6 +546,14 @@ namespace DSL
         
         bool LinkAll();
         
+        /**
+         * @brief relinks the Pipeline's changed segment, then reinstalls the
+         * latency tracers and trace probes, as installed by LinkAll, so that 
+         * components linked in place are traced.
+         * @return true if the Pipeline is unlinked, unchanged, or relinked successfully.
+         */
+        bool Relink();
+        
         /**
          * @brief returns a handle to this PipelineBintr's XWindow
          * @return XWindow handle, NULL untill created
@@ -285,10 +571,235 @@ namespace DSL
 
         bool HandleStateChanged(GstMessage* pMessage);
         
+        /**
+         * @brief records the time since the previous state change against the
+         * element that posted the message, while a prepare is in progress
+         * @param[in] pMessage state changed message from any element
+         */
+        void RecordPrepareStateChange(GstMessage* pMessage);
+        
+        /**
+         * @brief blocks the calling thread until any prepare in progress completes
+         */
+        void WaitForPrepare();
+        
         void HandleEosMessage(GstMessage* pMessage);
         
         void HandleErrorMessage(GstMessage* pMessage);
         
+        /**
+         * @brief Adds all decoders, the StreamMux and all Sinks to a surface plan
+         * @param[in] planner surface memory planner to add to
+         */
+        void BuildSurfacePlan(SurfaceMemoryPlanner& planner);
+        
+        /**
+         * @brief Checks the projected surface memory against the budget, if set, 
+         * shrinking the decoder surface counts under DSL_SURFACE_BUDGET_POLICY_SHRINK
+         * @return false if the projected surface memory can't fit the budget
+         */
+        bool ApplySurfaceBudget();
+        
+        /**
+         * @brief Installs a new LatencyTracer for each Bintr in this Pipeline
+         * replacing any previously installed.
+         */
+        void InstallLatencyTracers();
+        
+        /**
+         * @brief Installs a LatencyTracer for a Nodetr, if a Bintr, and recursively
+         * for all of its children
+         * @param[in] pNodetr Nodetr to trace
+         */
+        void InstallLatencyTracers(DSL_NODETR_PTR pNodetr);
+        
+        /**
+         * @brief Installs a new PerfMeter on all Sources and Sinks in this Pipeline
+         * and starts the reporting timer
+         */
+        void InstallPerfMeter();
+        
+        /**
+         * @brief Adds the sink pad of a Nodetr to the PerfMeter, if a SinkBintr, 
+         * and recursively for all of its children
+         * @param[in] pNodetr Nodetr to meter
+         */
+        void InstallPerfMeter(DSL_NODETR_PTR pNodetr);
+
+        /**
+         * @brief Adds a Nodetr, if a Bintr, to the ThreadManager with its 
+         * thread role, and recursively for all of its children
+         * @param[in] pNodetr Nodetr to add
+         * @param[in] role thread role inherited from the parent of the Nodetr
+         */
+        void AddThreadComponents(DSL_NODETR_PTR pNodetr, uint role);
+
+        /**
+         * @brief Stops the reporting timer and removes the PerfMeter's probes.
+         * The PerfMeter is kept so that the last report remains available
+         */
+        void StopPerfMeter();
+        
+        /**
+         * @brief Installs buffer probes to trace buffer arrivals at every Bintr
+         */
+        void InstallTraceProbes();
+
+        /**
+         * @brief Installs a buffer probe for a Nodetr, if a Bintr, and recursively
+         * for all of its children
+         * @param[in] pNodetr Nodetr to trace
+         */
+        void InstallTraceProbes(DSL_NODETR_PTR pNodetr);
+        
+        /**
+         * @brief Removes all buffer probes installed by InstallTraceProbes
+         */
+        void RemoveTraceProbes();
+        
+        /**
+         * @brief surface memory budget in MB, 0 if disabled
+         */
+        uint m_surfaceBudget;
+        
+        /**
+         * @brief one of the DSL_SURFACE_BUDGET_POLICY constant values
+         */
+        uint m_surfaceBudgetPolicy;
+        
+        /**
+         * @brief true if latency tracing is enabled for this Pipeline
+         */
+        bool m_latencyTracingEnabled;
+        
+        /**
+         * @brief list of LatencyTracers currently installed, in link order
+         */
+        std::vector<DSL_LATENCY_TRACER_PTR> m_latencyTracers;
+        
+        /**
+         * @brief latency report built on the last call to GetLatencyReport
+         */
+        std::string m_latencyReport;
+        
+        /**
+         * @brief mutex to protect the prepare state and per-element times
+         */
+        GMutex m_prepareMutex;
+        
+        /**
+         * @brief signaled when an asynchronous prepare completes
+         */
+        GCond m_prepareCond;
+        
+        /**
+         * @brief true while an asynchronous prepare is in progress
+         */
+        bool m_prepareInProgress;
+        
+        /**
+         * @brief client listener to notify on prepare complete, may be NULL
+         */
+        dsl_prepare_complete_cb m_prepareListener;
+        
+        /**
+         * @brief opaque client data to pass to the prepare listener
+         */
+        void* m_prepareUserData;
+        
+        /**
+         * @brief time of the last state change while preparing
+         */
+        std::chrono::steady_clock::time_point m_prepareLastChange;
+        
+        /**
+         * @brief time in ms each element spent reaching PAUSED, keyed by name
+         */
+        std::map<std::string, double> m_prepareTimes;
+        
+        /**
+         * @brief prepare report built on the last call to GetPrepareReport
+         */
+        std::string m_prepareReport;
+        
+        /**
+         * @brief true if redundant elements are to be elided on link
+         */
+        bool m_linkOptimizationEnabled;
+        
+        /**
+         * @brief report of the elements elided on the last link
+         */
+        std::string m_linkOptimizationReport;
+        
+        /**
+         * @brief manages the affinity and reporting of streaming threads
+         */
+        DSL_THREAD_MANAGER_PTR m_pThreadManager;
+        
+        /**
+         * @brief true if performance metering is enabled for this Pipeline
+         */
+        bool m_perfEnabled;
+        
+        /**
+         * @brief performance reporting interval in milliseconds
+         */
+        uint m_perfInterval;
+        
+        /**
+         * @brief PerfMeter for this Pipeline, created on link if enabled
+         */
+        DSL_PERF_METER_PTR m_pPerfMeter;
+        
+        /**
+         * @brief gnome timer Id for the performance reporting timer, 0 if not running
+         */
+        uint m_perfTimerId;
+
+        /**
+         * @brief mutex to protect the performance listeners and meter 
+         * from the reporting timer callback
+         */
+        GMutex m_perfMutex;
+
+        /**
+         * @brief number of performance reporting timers not yet destroyed, with
+         * the mutex and condition used to wait on their destroy notify. Kept 
+         * apart from m_perfMutex as removing a timer calls its destroy notify
+         * immediately if the timer is not being dispatched.
+         */
+        uint m_perfTimerCount;
+        GMutex m_perfTimerMutex;
+        GCond m_perfTimerCond;
+
+        /**
+         * @brief map of all currently registered perf-listeners
+         * callback functions mapped with the user provided data
+         */
+        std::map<dsl_perf_listener_cb, void*>m_perfListeners;
+        
+        /**
+         * @brief true if the classification cache is enabled for this Pipeline
+         */
+        bool m_classificationCacheEnabled;
+        
+        /**
+         * @brief classification cache for this Pipeline's Secondary GIEs,
+         * holds the cache settings and statistics whether enabled or not
+         */
+        DSL_CLASSIFICATION_CACHE_PTR m_pClassificationCache;
+        
+        /**
+         * @brief true if this Pipeline owns the active timeline trace
+         */
+        bool m_isTracing;
+        
+        /**
+         * @brief all pads with a buffer trace probe installed, with probe id
+         */
+        std::vector<std::pair<GstPad*, gulong>> m_traceProbes;
+        
         /**
          * @brief parent bin for all Source bins in this Pipeline
          */
@@ -354,6 +865,55 @@ namespace DSL
          */
         guint m_gstBusWatch;
         
+        /**
+         * @brief dedicated main context for this Pipeline, NULL if using the default
+         */
+        GMainContext* m_pMainContext;
+        
+        /**
+         * @brief main loop run on the dedicated main context thread
+         */
+        GMainLoop* m_pMainLoop;
+        
+        /**
+         * @brief handle to the dedicated main context thread
+         */
+        GThread* m_pMainContextThread;
+        
+        /**
+         * @brief Bus Watch source attached to the dedicated main context
+         */
+        GSource* m_pBusWatchSource;
+        
+        /**
+         * @brief event file descriptor for client dispatch, -1 if not created.
+         * Protected by the bus sync mutex
+         */
+        int m_eventFd;
+        
+        /**
+         * @brief bus messages queued by the sync handler for client dispatch
+         */
+        std::deque<GstMessage*> m_eventQueue;
+        
+        /**
+         * @brief mutex to protect the event queue
+         */
+        GMutex m_eventQueueMutex;
+        
+        /**
+         * @brief creates the dedicated main context and thread, and moves the
+         * Bus Watch from the default main context to it
+         */
+        void StartMainContext();
+        
+        /**
+         * @brief stops and joins the dedicated main context thread, and restores
+         * the Bus Watch to the default main context
+         * @param[in] restoreBusWatch set to false if the Bus is being destroyed
+         */
+        void StopMainContext(bool restoreBusWatch);
+        
         /**
          * @brief maps a GstState constant value to a string for logging
          */
@@ -373,11 +933,6 @@ namespace DSL
          * @brief handle to X Window
          */
         Window m_pXWindow;
-        /**
-         * @brief handle to the X Window event thread, 
-         * active for the life of the Pipeline
-        */
-        GThread* m_pXWindowEventThread;        
         
         /**
          * @brief maps a GstMessage constant value to a string for logging
@@ -412,7 +967,57 @@ namespace DSL
     static GstBusSyncReply bus_sync_handler(
         GstBus* bus, GstMessage* pMessage, gpointer pData);
 
-    static gpointer XWindowEventThread(gpointer pData);
+    /**
+     * @brief callback function to handle all pending events for a Pipeline's 
+     * XWindow, called by the shared XWindowEventDispatcher thread
+     * @param[in] pPipeline pointer to the PipelineBintr that owns the XWindow
+     */
+    static void PipelineXWindowEventsCB(gpointer pPipeline);
+
+    /**
+     * @brief Thread function to run a Pipeline's dedicated main loop
+     * @param[in] pPipeline pointer to the PipelineBintr that started the thread
+     * @return NULL always
+     */
+    static gpointer PipelineMainContextThread(gpointer pPipeline);
+
+    /**
+     * @brief Idle callback function to quit a Pipeline's dedicated main loop
+     * @param[in] pMainLoop pointer to the GMainLoop to quit
+     * @return false to remove the idle source
+     */
+    static gboolean PipelineMainLoopQuitCB(gpointer pMainLoop);
+
+    /**
+     * @brief Timer callback function to report the performance of a Pipeline
+     * @param[in] pPipeline pointer to the PipelineBintr that started the timer
+     * @return true to continue the timer, false to stop
+     */
+    static int PipelinePerfTimerCB(gpointer pPipeline);
+
+    /**
+     * @brief Destroy notify function for a Pipeline's performance reporting timer
+     * @param[in] pPipeline pointer to the PipelineBintr that started the timer
+     */
+    static void PipelinePerfTimerDestroyCB(gpointer pPipeline);
+
+    /**
+     * @brief Async callback function to prepare a Pipeline, called by the 
+     * GStreamer thread pool
+     * @param[in] pElement the Pipeline's GST Element
+     * @param[in] pPipeline pointer to the PipelineBintr to prepare
+     */
+    static void PipelinePrepareCB(GstElement* pElement, gpointer pPipeline);
+
+    /**
+     * @brief Pad Probe callback function to trace buffer arrivals at a Bintr
+     * @param[in] pPad pad the buffer arrived on
+     * @param[in] pInfo pad probe info for the buffer
+     * @param[in] pName name of the Bintr the pad belongs to
+     * @return GST_PAD_PROBE_OK always
+     */
+    static GstPadProbeReturn PipelineTraceBufferProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pName);
 
     
 } // Namespace
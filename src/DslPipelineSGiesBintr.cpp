@@ -30,10 +30,11 @@ namespace DSL
 
     PipelineSecondaryGiesBintr::PipelineSecondaryGiesBintr(const char* name)
         : Bintr(name)
-        , m_stop(false)
-        , m_flush(false)
         , m_primaryGieUniqueId(0)
         , m_interval(0)
+        , m_numLinkedSecondaryGies(0)
+        , m_linkMode(DSL_SGIE_LINK_MODE_PARALLEL)
+        , m_fanIn(name)
     {
         LOG_FUNC();
 
@@ -58,10 +59,11 @@ namespace DSL
             throw;
         }
         
-        // Sink Pad Probe -- added to the Tee -- is used to wait on Stream events, and to 
-        // unblock the waiting Src Pad Probe on Flush or EOS
+        // Sink Pad Probe -- added to the Tee -- is used to mark each buffer as pending on 
+        // all SGIEs, and to unblock the waiting Src Pad Probe on Flush or EOS
         m_sinkPadProbeId = gst_pad_add_probe(m_pGstStaticSinkPad, 
-            GST_PAD_PROBE_TYPE_EVENT_BOTH, SecondaryGiesSinkProbeCB, this, NULL);
+            (GstPadProbeType)(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_BOTH | 
+                GST_PAD_PROBE_TYPE_EVENT_FLUSH), SecondaryGiesSinkProbeCB, this, NULL);
 
         // Src Pad Probe -- added to the Queue -- used to block the stream and wait for
         // all SGIEs to finish processing the shared buffer.
@@ -165,6 +167,15 @@ namespace DSL
             // unlink the sink from the Tee
             pChildSecondaryGie->UnlinkFromSource();
         }
+        if (m_fakeSinkProbeIds.find(pChildSecondaryGie->GetName()) != m_fakeSinkProbeIds.end())
+        {
+            GstPad* pFakeSinkPad = gst_element_get_static_pad(
+                pChildSecondaryGie->GetFakeSinkElementr()->GetGstElement(), "sink");
+            gst_pad_remove_probe(pFakeSinkPad, m_fakeSinkProbeIds[pChildSecondaryGie->GetName()]);
+            gst_object_unref(pFakeSinkPad);
+            m_fakeSinkProbeIds.erase(pChildSecondaryGie->GetName());
+            m_numLinkedSecondaryGies--;
+        }
         // remove the SecondaryGie's Elements as children of this Bintr
         // remove the SecondaryGie's Elements as children of this Bintr
         if (!Bintr::RemoveChild(pChildSecondaryGie->GetQueueElementr()) or
@@ -216,12 +227,18 @@ namespace DSL
             LOG_ERROR("Failed to get Static Sink Pad for SecondaryGiesBintr '" << GetName() << "'");
             return false;
         }
+        // In parallel mode, the shared-buffer-Queue is linked to the Tee alongside the SGIEs.
         // Always Link from "sink" pad back to "src" pad when linking Tees - link state is managed
         // by each individual "sink" in the one-to-many relationship 
-        if (!m_pQueue->LinkToSource(m_pTee))
+        if (m_linkMode == DSL_SGIE_LINK_MODE_PARALLEL and !m_pQueue->LinkToSource(m_pTee))
         {
             return false;
         }
+        m_numLinkedSecondaryGies = 0;
+        
+        // In serial mode, the last Infer Engine linked in the chain
+        DSL_NODETR_PTR pLastInferEngine;
+        
         // TODO - recursively handle multiple levels of Secondary Inference
         for (auto const& imap: m_pChildSecondaryGies)
         {
@@ -232,6 +249,25 @@ namespace DSL
                 {
                     return false;
                 }
+                m_numLinkedSecondaryGies++;
+                
+                if (m_linkMode == DSL_SGIE_LINK_MODE_SERIAL)
+                {
+                    LOG_INFO("Linking " << imap.second->GetName() << " in series");
+                    
+                    // Link the SGIE's Queue and Infer Engine, and then link back with the
+                    // Tee if first, or with the previous SGIE's Infer Engine otherwise
+                    if (!imap.second->LinkAllInSeries() or 
+                        (!pLastInferEngine and !imap.second->LinkToSource(m_pTee)) or
+                        (pLastInferEngine and !pLastInferEngine->LinkToSink(imap.second->GetQueueElementr())))
+                    {
+                        LOG_ERROR("PipelineSecondaryGiesBintr '" << GetName() 
+                            << "' failed to Link Child SecondaryGie '" << imap.second->GetName() << "' in series");
+                        return false;
+                    }
+                    pLastInferEngine = imap.second->GetInferEngineElementr();
+                    continue;
+                }
                 
                 LOG_INFO("Linking " << m_pTee->GetName() << " from " << imap.second->GetName());
                 
@@ -242,8 +278,31 @@ namespace DSL
                         << "' failed to Link Child SecondaryGie '" << imap.second->GetName() << "'");
                     return false;
                 }
+                
+                // Each SGIE's FakeSink signals the completion of the shared buffer
+                GstPad* pFakeSinkPad = gst_element_get_static_pad(
+                    imap.second->GetFakeSinkElementr()->GetGstElement(), "sink");
+                m_fakeSinkProbeIds[imap.first] = gst_pad_add_probe(pFakeSinkPad, 
+                    GST_PAD_PROBE_TYPE_BUFFER, SecondaryGieFakeSinkProbeCB, this, NULL);
+                gst_object_unref(pFakeSinkPad);
             }
         }
+        if (m_linkMode == DSL_SGIE_LINK_MODE_SERIAL)
+        {
+            // Complete the chain with the output Queue, or link it directly to the Tee if no SGIEs
+            if ((pLastInferEngine and !pLastInferEngine->LinkToSink(m_pQueue)) or
+                (!pLastInferEngine and !m_pQueue->LinkToSource(m_pTee)))
+            {
+                LOG_ERROR("PipelineSecondaryGiesBintr '" << GetName() 
+                    << "' failed to Link the output Queue in series");
+                return false;
+            }
+        }
+        if (m_pClassificationCache)
+        {
+            m_pClassificationCache->SetNumClassifiers(m_numLinkedSecondaryGies);
+        }
+        m_fanIn.Reset();
         m_isLinked = true;
         return true;
     }
@@ -257,19 +316,42 @@ namespace DSL
             LOG_ERROR("OsdBintr '" << GetName() << "' is not linked");
             return;
         }
+        for (auto const& imap: m_fakeSinkProbeIds)
+        {
+            if (m_pChildSecondaryGies.find(imap.first) == m_pChildSecondaryGies.end())
+            {
+                continue;
+            }
+            GstPad* pFakeSinkPad = gst_element_get_static_pad(
+                m_pChildSecondaryGies[imap.first]->GetFakeSinkElementr()->GetGstElement(), "sink");
+            gst_pad_remove_probe(pFakeSinkPad, imap.second);
+            gst_object_unref(pFakeSinkPad);
+        }
+        m_fakeSinkProbeIds.clear();
+        m_numLinkedSecondaryGies = 0;
+        
         for (auto const& imap: m_pChildSecondaryGies)
         {
-            // unlink from the Tee Element
-            LOG_INFO("Unlinking " << m_pTee->GetName() << " from " << imap.second->GetName());
-            if (!imap.second->UnlinkFromSource())
+            // unlink from the Tee Element, in serial mode only the first SGIE is linked to the Tee
+            if (imap.second->GetQueueElementr()->IsLinkedToSource())
             {
-                LOG_ERROR("PipelineSecondaryGiesBintr '" << GetName() 
-                    << "' failed to Unlink Child SecondaryGie '" << imap.second->GetName() << "'");
+                LOG_INFO("Unlinking " << m_pTee->GetName() << " from " << imap.second->GetName());
+                if (!imap.second->UnlinkFromSource())
+                {
+                    LOG_ERROR("PipelineSecondaryGiesBintr '" << GetName() 
+                        << "' failed to Unlink Child SecondaryGie '" << imap.second->GetName() << "'");
+                }
+            }
+            // unink all of the ChildSecondaryGie's Elementrs, including the serial link onward
+            if (imap.second->IsLinked())
+            {
+                imap.second->UnlinkAll();
             }
-            // unink all of the ChildSecondaryGie's Elementrs
-            imap.second->UnlinkAll();
         }
-        m_pQueue->UnlinkFromSource();
+        if (m_pQueue->IsLinkedToSource())
+        {
+            m_pQueue->UnlinkFromSource();
+        }
         m_isLinked = false;
     }
 
@@ -294,18 +376,214 @@ namespace DSL
         m_interval = interval;
     }
     
+    uint PipelineSecondaryGiesBintr::GetLinkMode()
+    {
+        LOG_FUNC();
+        
+        return m_linkMode;
+    }
+    
+    bool PipelineSecondaryGiesBintr::SetLinkMode(uint mode)
+    {
+        LOG_FUNC();
+        
+        if (m_isLinked)
+        {
+            LOG_ERROR("Unable to set link mode for PipelineSecondaryGiesBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        if (mode > DSL_SGIE_LINK_MODE_SERIAL)
+        {
+            LOG_ERROR("Invalid link mode '" << mode << "' for PipelineSecondaryGiesBintr '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_linkMode = mode;
+        return true;
+    }
+    
+    void PipelineSecondaryGiesBintr::SetClassificationCache(
+        DSL_CLASSIFICATION_CACHE_PTR pClassificationCache)
+    {
+        LOG_FUNC();
+        
+        m_pClassificationCache = pClassificationCache;
+    }
+    
+    DSL_CLASSIFICATION_CACHE_PTR PipelineSecondaryGiesBintr::GetClassificationCache()
+    {
+        LOG_FUNC();
+        
+        return m_pClassificationCache;
+    }
+    
+    void PipelineSecondaryGiesBintr::SkipCachedObjects(GstBuffer* pBuffer)
+    {
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (!pBatchMeta)
+        {
+            return;
+        }
+        gint64 now = g_get_monotonic_time();
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            
+            for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+                
+                if (pObjectMeta->object_id == UNTRACKED_OBJECT_ID or
+                    pObjectMeta->unique_component_id != m_primaryGieUniqueId)
+                {
+                    continue;
+                }
+                // The SGIEs only infer on objects with the Primary GIE's unique id
+                if (m_pClassificationCache->Lookup(pFrameMeta->source_id, 
+                    pObjectMeta->object_id, now))
+                {
+                    pObjectMeta->unique_component_id = DSL_CLASSIFICATION_CACHE_SKIP_ID;
+                }
+            }
+        }
+    }
+    
+    void PipelineSecondaryGiesBintr::UpdateCachedObjects(GstBuffer* pBuffer)
+    {
+        NvDsBatchMeta* pBatchMeta = gst_buffer_get_nvds_batch_meta(pBuffer);
+        if (!pBatchMeta)
+        {
+            return;
+        }
+        gint64 now = g_get_monotonic_time();
+        std::vector<CachedLabel> labels;
+        
+        for (NvDsMetaList* pFrameMetaList = pBatchMeta->frame_meta_list; 
+            pFrameMetaList; pFrameMetaList = pFrameMetaList->next)
+        {
+            NvDsFrameMeta* pFrameMeta = (NvDsFrameMeta*)(pFrameMetaList->data);
+            
+            for (NvDsMetaList* pObjectMetaList = pFrameMeta->obj_meta_list; 
+                pObjectMetaList; pObjectMetaList = pObjectMetaList->next)
+            {
+                NvDsObjectMeta* pObjectMeta = (NvDsObjectMeta*)(pObjectMetaList->data);
+                
+                if (pObjectMeta->unique_component_id == DSL_CLASSIFICATION_CACHE_SKIP_ID)
+                {
+                    pObjectMeta->unique_component_id = m_primaryGieUniqueId;
+                    
+                    if (!m_pClassificationCache->GetLabels(pFrameMeta->source_id, 
+                        pObjectMeta->object_id, labels))
+                    {
+                        continue;
+                    }
+                    // Re-attach one classifier meta per SGIE, labels are ordered by SGIE
+                    NvDsClassifierMeta* pClassifierMeta(NULL);
+                    for (auto const& label: labels)
+                    {
+                        if (!pClassifierMeta or pClassifierMeta->unique_component_id != label.componentId)
+                        {
+                            pClassifierMeta = nvds_acquire_classifier_meta_from_pool(pBatchMeta);
+                            pClassifierMeta->unique_component_id = label.componentId;
+                            pClassifierMeta->num_labels = 0;
+                            nvds_add_classifier_meta_to_object(pObjectMeta, pClassifierMeta);
+                        }
+                        NvDsLabelInfo* pLabelInfo = nvds_acquire_label_info_meta_from_pool(pBatchMeta);
+                        pLabelInfo->label_id = label.labelId;
+                        pLabelInfo->num_classes = label.numClasses;
+                        pLabelInfo->result_class_id = label.classId;
+                        pLabelInfo->result_prob = label.probability;
+                        pLabelInfo->pResult_label = NULL;
+                        g_strlcpy(pLabelInfo->result_label, label.label.c_str(), MAX_LABEL_SIZE);
+                        nvds_add_label_info_meta_to_classifier(pClassifierMeta, pLabelInfo);
+                        pClassifierMeta->num_labels++;
+                        
+                        // Append the label to the display text as the SGIE would have
+                        if (pObjectMeta->text_params.display_text)
+                        {
+                            gchar* pDisplayText = pObjectMeta->text_params.display_text;
+                            pObjectMeta->text_params.display_text = 
+                                g_strconcat(pDisplayText, " ", label.label.c_str(), NULL);
+                            g_free(pDisplayText);
+                        }
+                    }
+                    continue;
+                }
+                if (pObjectMeta->object_id == UNTRACKED_OBJECT_ID or
+                    pObjectMeta->unique_component_id != m_primaryGieUniqueId)
+                {
+                    continue;
+                }
+                labels.clear();
+                for (NvDsMetaList* pClassifierMetaList = pObjectMeta->classifier_meta_list; 
+                    pClassifierMetaList; pClassifierMetaList = pClassifierMetaList->next)
+                {
+                    NvDsClassifierMeta* pClassifierMeta = 
+                        (NvDsClassifierMeta*)(pClassifierMetaList->data);
+                        
+                    for (NvDsMetaList* pLabelInfoList = pClassifierMeta->label_info_list; 
+                        pLabelInfoList; pLabelInfoList = pLabelInfoList->next)
+                    {
+                        NvDsLabelInfo* pLabelInfo = (NvDsLabelInfo*)(pLabelInfoList->data);
+                        
+                        CachedLabel label;
+                        label.componentId = pClassifierMeta->unique_component_id;
+                        label.labelId = pLabelInfo->label_id;
+                        label.numClasses = pLabelInfo->num_classes;
+                        label.classId = pLabelInfo->result_class_id;
+                        label.probability = pLabelInfo->result_prob;
+                        label.label = (pLabelInfo->pResult_label) ? 
+                            pLabelInfo->pResult_label : pLabelInfo->result_label;
+                        labels.push_back(label);
+                    }
+                }
+                m_pClassificationCache->Observe(pFrameMeta->source_id, 
+                    pObjectMeta->object_id, labels, now);
+            }
+        }
+        m_pClassificationCache->Evict(now);
+    }
+    
     GstPadProbeReturn PipelineSecondaryGiesBintr::HandleSecondaryGiesSinkProbe(
         GstPad* pPad, GstPadProbeInfo* pInfo)
     {
+        TRACE_SCOPE("probe", __func__);
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_sinkPadProbeMutex);
 
-        if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_BOTH)
+        if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
+        {
+            if (m_pClassificationCache)
+            {
+                SkipCachedObjects(GST_BUFFER(pInfo->data));
+            }
+            // In serial mode the buffer reaches the output Queue after the last SGIE
+            if (m_linkMode == DSL_SGIE_LINK_MODE_PARALLEL and m_numLinkedSecondaryGies)
+            {
+                m_fanIn.Expect(GST_BUFFER(pInfo->data), m_numLinkedSecondaryGies);
+            }
+            return GST_PAD_PROBE_OK;
+        }
+        if (pInfo->type & (GST_PAD_PROBE_TYPE_EVENT_BOTH | GST_PAD_PROBE_TYPE_EVENT_FLUSH))
         {
             GstEvent *event = (GstEvent*)pInfo->data;
             
-            if (event->type == GST_EVENT_EOS)
+            switch (event->type)
             {
-                m_stop = true;
+            case GST_EVENT_EOS:
+                m_fanIn.SetStopped();
+                break;
+            case GST_EVENT_FLUSH_START:
+                m_fanIn.SetFlushing(true);
+                break;
+            case GST_EVENT_FLUSH_STOP:
+                m_fanIn.SetFlushing(false);
+                break;
+            default:
+                break;
             }
         }
         return GST_PAD_PROBE_OK;
@@ -314,6 +592,7 @@ namespace DSL
     GstPadProbeReturn PipelineSecondaryGiesBintr::HandleSecondaryGiesSrcProbe(
         GstPad* pPad, GstPadProbeInfo* pInfo)
     {
+        TRACE_SCOPE("probe", __func__);
         LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_srcPadProbeMutex);
 
         if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_BOTH)
@@ -327,15 +606,34 @@ namespace DSL
         }
         if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
         {
-            while (GST_OBJECT_REFCOUNT_VALUE(GST_BUFFER(pInfo->data)) > 1 && !m_stop && !m_flush)
+            // Stopped or flushing with branches still pending. The buffer 
+            // may still be written to, so it is not passed downstream.
+            if (!m_fanIn.Wait(GST_BUFFER(pInfo->data)))
+            {
+                LOG_WARN("Dropping buffer not completed by all Secondary GIEs for '" 
+                    << GetName() << "'");
+                return GST_PAD_PROBE_DROP;
+            }
+            if (m_pClassificationCache)
             {
-                gint64 endtime(g_get_monotonic_time() + G_TIME_SPAN_SECOND / 1000);
-                g_cond_wait_until(&m_padWaitLock, &m_srcPadProbeMutex, endtime);
+                UpdateCachedObjects(GST_BUFFER(pInfo->data));
             }
         }
         return GST_PAD_PROBE_OK;
     }
 
+    GstPadProbeReturn PipelineSecondaryGiesBintr::HandleSecondaryGieFakeSinkProbe(
+        GstPad* pPad, GstPadProbeInfo* pInfo)
+    {
+        TRACE_SCOPE("probe", __func__);
+
+        if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
+        {
+            m_fanIn.Complete(GST_BUFFER(pInfo->data));
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
     // ************************************************************************
     // Sink and Src Pad Probe Callback functions for all Pipelines...
     // Callback user-data points to the Instance of PipelineSecondaryGiesBintr
@@ -354,4 +652,11 @@ namespace DSL
             HandleSecondaryGiesSrcProbe(pPad, pInfo);
     }
     
+    static GstPadProbeReturn SecondaryGieFakeSinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pGiesBintr)
+    {
+        return static_cast<PipelineSecondaryGiesBintr*>(pGiesBintr)->
+            HandleSecondaryGieFakeSinkProbe(pPad, pInfo);
+    }
+    
 }
\ No newline at end of file
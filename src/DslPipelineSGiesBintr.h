@@ -29,6 +29,8 @@ THE SOFTWARE.
 #include "DslApi.h"
 #include "DslBintr.h"
 #include "DslGieBintr.h"
+#include "DslBufferFanIn.h"
+#include "DslClassificationCache.h"
     
    
 namespace DSL 
@@ -114,7 +116,36 @@ namespace DSL
         void SetInterval(uint interval);
         
         /**
-         * @brief 
+         * @brief Gets the current link mode for all child Secondary GIEs
+         * @return one of the DSL_SGIE_LINK_MODE constant values
+         */
+        uint GetLinkMode();
+        
+        /**
+         * @brief Sets the link mode for all child Secondary GIEs, parallel from
+         * the Tee with a fan-in wait, or serial with the SGIEs back-to-back
+         * @param[in] mode one of the DSL_SGIE_LINK_MODE constant values
+         * @return false if linked or the mode is invalid
+         */
+        bool SetLinkMode(uint mode);
+        
+        /**
+         * @brief Sets the classification cache used to skip secondary inference
+         * on tracked objects with frozen classifications. Set before linking.
+         * @param[in] pClassificationCache shared pointer to the cache, nullptr to disable
+         */
+        void SetClassificationCache(DSL_CLASSIFICATION_CACHE_PTR pClassificationCache);
+        
+        /**
+         * @brief Gets the classification cache currently in use
+         * @return shared pointer to the cache, nullptr if disabled
+         */
+        DSL_CLASSIFICATION_CACHE_PTR GetClassificationCache();
+
+        /**
+         * @brief handles buffers and events on the sink (Tee) pad. Each buffer
+         * is marked as pending on all linked SGIEs, EOS and Flush events
+         * unblock the waiting Src Pad Probe.
          * @param pPad
          * @param pInfo
          * @return 
@@ -122,13 +153,23 @@ namespace DSL
         GstPadProbeReturn HandleSecondaryGiesSinkProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
         
         /**
-         * @brief 
+         * @brief blocks the shared buffer on the src (Queue) pad until 
+         * it is signaled that all linked SGIEs have completed the buffer.
          * @param pPad
          * @param pInfo
          * @return 
          */
         GstPadProbeReturn HandleSecondaryGiesSrcProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
 
+        /**
+         * @brief handles buffers on the sink pad of each SGIE's FakeSink, 
+         * completing the shared buffer for that SGIE.
+         * @param pPad
+         * @param pInfo
+         * @return 
+         */
+        GstPadProbeReturn HandleSecondaryGieFakeSinkProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
+
     private:
         /**
          * @brief adds a child Elementr to this PipelineSourcesBintr
@@ -143,6 +184,20 @@ namespace DSL
          */
         bool RemoveChild(DSL_NODETR_PTR pChildElement);
 
+        /**
+         * @brief marks all tracked objects with frozen classifications 
+         * to be skipped by the Secondary GIEs
+         * @param[in] pBuffer batched buffer on entry, before the Tee
+         */
+        void SkipCachedObjects(GstBuffer* pBuffer);
+        
+        /**
+         * @brief restores all skipped objects, re-attaching their cached classifier
+         * meta, and observes the new classifications of all other tracked objects
+         * @param[in] pBuffer batched buffer on exit, after all SGIEs have completed
+         */
+        void UpdateCachedObjects(GstBuffer* pBuffer);
+
         /**
          * @brief Tee's the output from the Primary GIE as input for all 
          * 2nd-level SGIEs. 2nd-level SGIEs create their own Tees for all
@@ -182,15 +237,34 @@ namespace DSL
          */
         uint m_srcPadProbeId;
         
+        /**
+         * @brief map of FakeSink pad probe handles keyed by SGIE name
+         */
+        std::map<std::string, gulong> m_fakeSinkProbeIds;
+        
         int m_primaryGieUniqueId;
         
         uint m_interval;
 
-        bool m_stop;
-
-        bool m_flush;
+        /**
+         * @brief number of SGIEs linked to the Tee, set on LinkAll
+         */
+        uint m_numLinkedSecondaryGies;
+        
+        /**
+         * @brief one of the DSL_SGIE_LINK_MODE constant values
+         */
+        uint m_linkMode;
 
-        GCond m_padWaitLock;
+        /**
+         * @brief synchronizes the completion of each shared buffer by all SGIEs
+         */
+        BufferFanIn m_fanIn;
+        
+        /**
+         * @brief optional classification cache, nullptr if disabled
+         */
+        DSL_CLASSIFICATION_CACHE_PTR m_pClassificationCache;
     };
 
     /**
@@ -214,6 +288,17 @@ namespace DSL
     static GstPadProbeReturn SecondaryGiesSrcProbeCB(GstPad* pPad, 
         GstPadProbeInfo* pInfo, gpointer pGiesBintr);    
 
+    /**
+     * @brief Probe function to signal the completion of 
+     * a shared buffer by a single Secondary GIE
+     * @param pPad
+     * @param pInfo
+     * @param pointer to a specific PipelineSecondaryGiesBintr
+     * @return 
+     */
+    static GstPadProbeReturn SecondaryGieFakeSinkProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pGiesBintr);    
+
 }
 
 #endif // _DSL_SGIES_BINTR_H
\ No newline at end of file
@@ -0,0 +1,292 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslQueuePolicy.h"
+
+namespace DSL
+{
+    QueuePolicy::QueuePolicy(const char* name)
+        : m_name(name)
+        , m_pQueue(NULL)
+        , m_isSet(false)
+        , m_maxSizeBuffers(DSL_DEFAULT_QUEUE_MAX_SIZE_BUFFERS)
+        , m_maxSizeTime(DSL_DEFAULT_QUEUE_MAX_SIZE_TIME)
+        , m_leaky(DSL_QUEUE_LEAKY_NO)
+        , m_latencyBudget(0)
+        , m_overrunHandlerId(0)
+        , m_srcProbeId(0)
+        , m_leakedCount(0)
+        , m_lateCount(0)
+    {
+        LOG_FUNC();
+
+        g_mutex_init(&m_segmentMutex);
+        gst_segment_init(&m_segment, GST_FORMAT_UNDEFINED);
+    }
+
+    QueuePolicy::~QueuePolicy()
+    {
+        LOG_FUNC();
+
+        Detach();
+        g_mutex_clear(&m_segmentMutex);
+    }
+
+    void QueuePolicy::GetSettings(uint* maxSizeBuffers, uint* maxSizeTime,
+        uint* leaky, uint* latencyBudget)
+    {
+        LOG_FUNC();
+
+        *maxSizeBuffers = m_maxSizeBuffers;
+        *maxSizeTime = m_maxSizeTime;
+        *leaky = m_leaky;
+        *latencyBudget = m_latencyBudget / GST_MSECOND;
+    }
+
+    bool QueuePolicy::SetSettings(uint maxSizeBuffers, uint maxSizeTime,
+        uint leaky, uint latencyBudget)
+    {
+        LOG_FUNC();
+
+        if (leaky > DSL_QUEUE_LEAKY_DOWNSTREAM)
+        {
+            LOG_ERROR("Invalid leaky value = " << leaky << " for the Queue of '"
+                << m_name << "'");
+            return false;
+        }
+        RemoveHandlers();
+
+        m_maxSizeBuffers = maxSizeBuffers;
+        m_maxSizeTime = maxSizeTime;
+        m_leaky = leaky;
+        m_latencyBudget = (GstClockTime)latencyBudget * GST_MSECOND;
+        m_isSet = true;
+
+        m_leakedCount = 0;
+        m_lateCount = 0;
+
+        Apply();
+        return true;
+    }
+
+    bool QueuePolicy::IsSet()
+    {
+        LOG_FUNC();
+
+        return m_isSet;
+    }
+
+    void QueuePolicy::Attach(GstElement* pQueue)
+    {
+        LOG_FUNC();
+
+        Detach();
+
+        m_pQueue = GST_ELEMENT(gst_object_ref(pQueue));
+        m_leakedCount = 0;
+        m_lateCount = 0;
+
+        Apply();
+    }
+
+    void QueuePolicy::Detach()
+    {
+        LOG_FUNC();
+
+        if (!m_pQueue)
+        {
+            return;
+        }
+        RemoveHandlers();
+        gst_object_unref(m_pQueue);
+        m_pQueue = NULL;
+    }
+
+    uint QueuePolicy::GetDropped()
+    {
+        LOG_FUNC();
+
+        return m_leakedCount + m_lateCount;
+    }
+
+    GstElement* QueuePolicy::FindQueue(GstElement* pElement)
+    {
+        LOG_FUNC();
+
+        GstPad* pPad = gst_element_get_static_pad(pElement, "sink");
+        while (pPad and GST_IS_GHOST_PAD(pPad))
+        {
+            GstPad* pTargetPad = gst_ghost_pad_get_target(GST_GHOST_PAD(pPad));
+            gst_object_unref(pPad);
+            pPad = pTargetPad;
+        }
+        if (!pPad)
+        {
+            return NULL;
+        }
+        GstElement* pParent = gst_pad_get_parent_element(pPad);
+        gst_object_unref(pPad);
+
+        if (pParent and g_strcmp0(G_OBJECT_TYPE_NAME(pParent), "GstQueue"))
+        {
+            gst_object_unref(pParent);
+            return NULL;
+        }
+        return pParent;
+    }
+
+    void QueuePolicy::HandleOverrun()
+    {
+        // Called with the Queue full, once for each frame leaked
+        m_leakedCount++;
+    }
+
+    GstPadProbeReturn QueuePolicy::HandleSrcProbe(GstPad* pPad, GstPadProbeInfo* pInfo)
+    {
+        // Events and buffers are serialized on the src pad's streaming thread, 
+        // but the probe can still be in flight when removed by the client thread
+        if (pInfo->type & GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM)
+        {
+            GstEvent* pEvent = GST_PAD_PROBE_INFO_EVENT(pInfo);
+            if (GST_EVENT_TYPE(pEvent) == GST_EVENT_SEGMENT)
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_segmentMutex);
+                gst_event_copy_segment(pEvent, &m_segment);
+            }
+            return GST_PAD_PROBE_OK;
+        }
+        GstBuffer* pBuffer = GST_PAD_PROBE_INFO_BUFFER(pInfo);
+        if (!pBuffer or !GST_BUFFER_PTS_IS_VALID(pBuffer))
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        GstSegment segment;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_segmentMutex);
+            gst_segment_copy_into(&m_segment, &segment);
+        }
+        if (segment.format != GST_FORMAT_TIME)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        // The pad's parent is the Queue, valid for as long as it streams, 
+        // where m_pQueue can be released by the client thread
+        GstElement* pQueue = GST_ELEMENT_CAST(GST_PAD_PARENT(pPad));
+        GstClock* pClock = gst_element_get_clock(pQueue);
+        if (!pClock)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        GstClockTime now = gst_clock_get_time(pClock) - gst_element_get_base_time(pQueue);
+        gst_object_unref(pClock);
+
+        // The age of a frame is the time since its running time, i.e. since
+        // capture for a live source. Non-live frames are early and never dropped
+        GstClockTime runningTime = gst_segment_to_running_time(&segment,
+            GST_FORMAT_TIME, GST_BUFFER_PTS(pBuffer));
+        if (GST_CLOCK_TIME_IS_VALID(runningTime) and now > runningTime and
+            now - runningTime > m_latencyBudget)
+        {
+            m_lateCount++;
+            return GST_PAD_PROBE_DROP;
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    void QueuePolicy::Apply()
+    {
+        LOG_FUNC();
+
+        if (!m_pQueue or !m_isSet)
+        {
+            return;
+        }
+        g_object_set(m_pQueue, "max-size-buffers", m_maxSizeBuffers,
+            "max-size-time", (guint64)m_maxSizeTime * GST_MSECOND,
+            "leaky", m_leaky, NULL);
+
+        if (m_leaky != DSL_QUEUE_LEAKY_NO)
+        {
+            m_overrunHandlerId = g_signal_connect(m_pQueue, "overrun",
+                G_CALLBACK(QueueOverrunCB), this);
+        }
+        if (m_latencyBudget)
+        {
+            GstPad* pSrcPad = gst_element_get_static_pad(m_pQueue, "src");
+
+            // The Segment is sticky and not resent if already streaming
+            GstEvent* pSegmentEvent = gst_pad_get_sticky_event(pSrcPad, GST_EVENT_SEGMENT, 0);
+            if (pSegmentEvent)
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_segmentMutex);
+                gst_event_copy_segment(pSegmentEvent, &m_segment);
+                gst_event_unref(pSegmentEvent);
+            }
+            m_srcProbeId = gst_pad_add_probe(pSrcPad,
+                (GstPadProbeType)(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM),
+                QueueSrcProbeCB, this, NULL);
+            gst_object_unref(pSrcPad);
+        }
+        LOG_INFO("Queue policy for '" << m_name << "' applied with max-size-buffers = "
+            << m_maxSizeBuffers << ", max-size-time = " << m_maxSizeTime
+            << "ms, leaky = " << m_leaky << ", latency-budget = "
+            << m_latencyBudget / GST_MSECOND << "ms");
+    }
+
+    void QueuePolicy::RemoveHandlers()
+    {
+        LOG_FUNC();
+
+        if (!m_pQueue)
+        {
+            return;
+        }
+        if (m_overrunHandlerId)
+        {
+            g_signal_handler_disconnect(m_pQueue, m_overrunHandlerId);
+            m_overrunHandlerId = 0;
+        }
+        if (m_srcProbeId)
+        {
+            GstPad* pSrcPad = gst_element_get_static_pad(m_pQueue, "src");
+            gst_pad_remove_probe(pSrcPad, m_srcProbeId);
+            gst_object_unref(pSrcPad);
+            m_srcProbeId = 0;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_segmentMutex);
+        gst_segment_init(&m_segment, GST_FORMAT_UNDEFINED);
+    }
+
+    static void QueueOverrunCB(GstElement* pQueue, gpointer pPolicy)
+    {
+        static_cast<QueuePolicy*>(pPolicy)->HandleOverrun();
+    }
+
+    static GstPadProbeReturn QueueSrcProbeCB(GstPad* pPad,
+        GstPadProbeInfo* pInfo, gpointer pPolicy)
+    {
+        return static_cast<QueuePolicy*>(pPolicy)->HandleSrcProbe(pPad, pInfo);
+    }
+}
@@ -0,0 +1,222 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_QUEUE_POLICY_H
+#define _DSL_QUEUE_POLICY_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_QUEUE_POLICY_PTR std::shared_ptr<QueuePolicy>
+    #define DSL_QUEUE_POLICY_NEW(name) \
+        std::shared_ptr<QueuePolicy>(new QueuePolicy(name))
+
+    /**
+     * @class QueuePolicy
+     * @brief Applies a size limit, leaky mode and latency budget to a single
+     * Queue element, and counts the frames the Queue drops as a result.
+     * Nothing is applied to the Queue until the policy is first set.
+     */
+    class QueuePolicy
+    {
+    public:
+
+        /**
+         * @brief ctor for the QueuePolicy class
+         * @param[in] name name of the component that owns the policy
+         */
+        QueuePolicy(const char* name);
+
+        /**
+         * @brief dtor for the QueuePolicy class, detaches from the Queue
+         */
+        ~QueuePolicy();
+
+        /**
+         * @brief Gets the current policy settings
+         * @param[out] maxSizeBuffers maximum number of buffers queued, 0 for no limit
+         * @param[out] maxSizeTime maximum time queued in milliseconds, 0 for no limit
+         * @param[out] leaky one of the DSL_QUEUE_LEAKY constant values
+         * @param[out] latencyBudget maximum age of a frame on exit in milliseconds,
+         * 0 if disabled
+         */
+        void GetSettings(uint* maxSizeBuffers, uint* maxSizeTime,
+            uint* leaky, uint* latencyBudget);
+
+        /**
+         * @brief Sets the policy settings, applied immediately if attached.
+         * The dropped frame count is reset.
+         * @param[in] maxSizeBuffers maximum number of buffers queued, 0 for no limit
+         * @param[in] maxSizeTime maximum time queued in milliseconds, 0 for no limit
+         * @param[in] leaky one of the DSL_QUEUE_LEAKY constant values
+         * @param[in] latencyBudget maximum age of a frame on exit in milliseconds,
+         * 0 to disable
+         * @return false if the leaky value is invalid
+         */
+        bool SetSettings(uint maxSizeBuffers, uint maxSizeTime,
+            uint leaky, uint latencyBudget);
+
+        /**
+         * @brief Queries the policy for settings set by the client
+         * @return true if the settings have been set
+         */
+        bool IsSet();
+
+        /**
+         * @brief Attaches the policy to a Queue, detaching from any previous Queue.
+         * The settings, if set, are applied and the dropped frame count is reset.
+         * @param[in] pQueue Queue element to attach to, a new reference is taken
+         */
+        void Attach(GstElement* pQueue);
+
+        /**
+         * @brief Detaches the policy from its Queue, if attached. The Queue's
+         * settings are left as is, and the dropped frame count is kept.
+         */
+        void Detach();
+
+        /**
+         * @brief Gets the number of frames dropped since last attached or set
+         * @return frames leaked by the Queue plus frames over the latency budget
+         */
+        uint GetDropped();
+
+        /**
+         * @brief Finds the Queue element behind an element's sink pad,
+         * following any ghost pads
+         * @param[in] pElement element to search
+         * @return new reference to the Queue, NULL if the sink pad is not a Queue's
+         */
+        static GstElement* FindQueue(GstElement* pElement);
+
+        /**
+         * @brief Handles the Queue's overrun signal, counting one leaked frame
+         */
+        void HandleOverrun();
+
+        /**
+         * @brief Handles buffers and segment events on the Queue's src pad,
+         * dropping buffers that are older than the latency budget
+         * @param pPad
+         * @param pInfo
+         * @return GST_PAD_PROBE_DROP for buffers over budget
+         */
+        GstPadProbeReturn HandleSrcProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
+
+    private:
+
+        /**
+         * @brief Applies the settings to the attached Queue, connecting
+         * the overrun handler and the src pad probe as required
+         */
+        void Apply();
+
+        /**
+         * @brief Disconnects the overrun handler and removes the src pad probe
+         */
+        void RemoveHandlers();
+
+        /**
+         * @brief name of the component that owns the policy
+         */
+        std::string m_name;
+
+        /**
+         * @brief Queue element, NULL if not attached
+         */
+        GstElement* m_pQueue;
+
+        /**
+         * @brief true once the settings have been set by the client
+         */
+        bool m_isSet;
+
+        uint m_maxSizeBuffers;
+
+        uint m_maxSizeTime;
+
+        uint m_leaky;
+
+        /**
+         * @brief latency budget in nanoseconds, read from the streaming thread
+         */
+        std::atomic<GstClockTime> m_latencyBudget;
+
+        /**
+         * @brief handle for the overrun signal, 0 if not connected
+         */
+        gulong m_overrunHandlerId;
+
+        /**
+         * @brief handle for the src pad probe, 0 if not installed
+         */
+        gulong m_srcProbeId;
+
+        /**
+         * @brief last segment received on the src pad, used to
+         * convert buffer timestamps to running time
+         */
+        GstSegment m_segment;
+
+        /**
+         * @brief mutex to protect the segment, written by the streaming thread
+         * and reset by the client thread while a probe may still be in flight
+         */
+        GMutex m_segmentMutex;
+
+        /**
+         * @brief number of frames leaked by the Queue
+         */
+        std::atomic<uint> m_leakedCount;
+
+        /**
+         * @brief number of frames dropped over the latency budget
+         */
+        std::atomic<uint> m_lateCount;
+    };
+
+    /**
+     * @brief Queue overrun signal callback
+     * @param pQueue
+     * @param pPolicy pointer to the QueuePolicy that connected the signal
+     */
+    static void QueueOverrunCB(GstElement* pQueue, gpointer pPolicy);
+
+    /**
+     * @brief Queue src pad probe callback
+     * @param pPad
+     * @param pInfo
+     * @param pPolicy pointer to the QueuePolicy that installed the probe
+     * @return
+     */
+    static GstPadProbeReturn QueueSrcProbeCB(GstPad* pPad,
+        GstPadProbeInfo* pInfo, gpointer pPolicy);
+}
+
+#endif // _DSL_QUEUE_POLICY_H
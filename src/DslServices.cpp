@@ -35,6 +35,33 @@ THE SOFTWARE.
 // Single GST debug catagory initialization
 GST_DEBUG_CATEGORY(GST_CAT_DSL);
 
+/**
+ * @brief Runs a sequence of edits as a single transaction, unless the calling
+ * thread already has one in progress, so that a failure part way through 
+ * leaves no partial changes.
+ * @param[in] edits function performing the edits, returning on first failure
+ * @return result of the edits
+ */
+template<typename Edits>
+static DslReturnType RunAsTransaction(Edits edits)
+{
+    DSL::Services* pServices = DSL::Services::GetServices();
+    
+    if (pServices->TransactionInProgress())
+    {
+        return edits();
+    }
+    pServices->TransactionBegin();
+    
+    DslReturnType retval = edits();
+    if (retval != DSL_RESULT_SUCCESS)
+    {
+        pServices->TransactionAbort();
+        return retval;
+    }
+    return pServices->TransactionCommit(false);
+}
+
 DslReturnType dsl_source_csi_new(const wchar_t* name, 
     uint width, uint height, uint fps_n, uint fps_d)
 {
@@ -79,6 +106,28 @@ DslReturnType dsl_source_rtsp_new(const wchar_t* name, const wchar_t* uri,
         protocol, cudadec_mem_type, intra_decode, dropFrameInterval);
 }
 
+DslReturnType dsl_source_image_multi_new(const wchar_t* name, 
+    const wchar_t* location, uint readahead)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrLocation(location);
+    std::string cstrLocation(wstrLocation.begin(), wstrLocation.end());
+
+    return DSL::Services::GetServices()->SourceImageMultiNew(cstrName.c_str(), 
+        cstrLocation.c_str(), readahead);
+}
+
+DslReturnType dsl_source_image_multi_stats_get(const wchar_t* name, 
+    uint* files_read, double* files_per_second)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceImageMultiStatsGet(cstrName.c_str(), 
+        files_read, files_per_second);
+}
+
 DslReturnType dsl_source_dimensions_get(const wchar_t* name, uint* width, uint* height)
 {
     std::wstring wstrName(name);
@@ -95,6 +144,26 @@ DslReturnType dsl_source_frame_rate_get(const wchar_t* name, uint* fps_n, uint*
     return DSL::Services::GetServices()->SourceFrameRateGet(cstrName.c_str(), fps_n, fps_d);
 }
 
+DslReturnType dsl_source_dimensions_get_by_handle(DslHandle source, uint* width, uint* height)
+{
+    return DSL::Services::GetServices()->SourceDimensionsGet(source, width, height);
+}
+
+DslReturnType dsl_source_dimensions_get_utf8(const char* name, uint* width, uint* height)
+{
+    return DSL::Services::GetServices()->SourceDimensionsGet(name, width, height);
+}
+
+DslReturnType dsl_source_frame_rate_get_by_handle(DslHandle source, uint* fps_n, uint* fps_d)
+{
+    return DSL::Services::GetServices()->SourceFrameRateGet(source, fps_n, fps_d);
+}
+
+DslReturnType dsl_source_frame_rate_get_utf8(const char* name, uint* fps_n, uint* fps_d)
+{
+    return DSL::Services::GetServices()->SourceFrameRateGet(name, fps_n, fps_d);
+}
+
 DslReturnType dsl_source_decode_uri_get(const wchar_t* name, const wchar_t** uri)
 {
     std::wstring wstrName(name);
@@ -124,6 +193,130 @@ DslReturnType dsl_source_decode_uri_set(const wchar_t* name, const wchar_t* uri)
     return DSL::Services::GetServices()->SourceDecodeUriSet(cstrName.c_str(), cstrUri.c_str());
 }
 
+DslReturnType dsl_source_uri_playlist_add(const wchar_t* name, const wchar_t* uri)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrUri(uri);
+    std::string cstrUri(wstrUri.begin(), wstrUri.end());
+
+    return DSL::Services::GetServices()->SourceUriPlaylistAdd(cstrName.c_str(), cstrUri.c_str());
+}
+
+DslReturnType dsl_source_uri_playlist_clear(const wchar_t* name)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceUriPlaylistClear(cstrName.c_str());
+}
+
+DslReturnType dsl_source_uri_playlist_size_get(const wchar_t* name, uint* size)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceUriPlaylistSizeGet(cstrName.c_str(), size);
+}
+
+DslReturnType dsl_source_uri_playlist_file_listener_add(const wchar_t* name, 
+    dsl_playlist_file_listener_cb listener, void* user_data)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceUriPlaylistFileListenerAdd(cstrName.c_str(), 
+        listener, user_data);
+}
+
+DslReturnType dsl_source_uri_playlist_file_listener_remove(const wchar_t* name, 
+    dsl_playlist_file_listener_cb listener)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceUriPlaylistFileListenerRemove(cstrName.c_str(), 
+        listener);
+}
+
+DslReturnType dsl_source_decode_surfaces_get(const wchar_t* name, 
+    uint* num_decode_surfaces, uint* num_extra_surfaces)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceDecodeSurfacesGet(cstrName.c_str(), 
+        num_decode_surfaces, num_extra_surfaces);
+}
+
+DslReturnType dsl_source_decode_surfaces_set(const wchar_t* name, 
+    uint num_decode_surfaces, uint num_extra_surfaces)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceDecodeSurfacesSet(cstrName.c_str(), 
+        num_decode_surfaces, num_extra_surfaces);
+}
+
+DslReturnType dsl_source_decode_rtsp_config_get(const wchar_t* name, uint* latency,
+    boolean* drop_on_latency, boolean* do_retransmission, uint* protocols, 
+    uint* buffer_mode, uint* timeout)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceDecodeRtspConfigGet(cstrName.c_str(), 
+        latency, drop_on_latency, do_retransmission, protocols, buffer_mode, timeout);
+}
+
+DslReturnType dsl_source_decode_rtsp_config_set(const wchar_t* name, uint latency,
+    boolean drop_on_latency, boolean do_retransmission, uint protocols, 
+    uint buffer_mode, uint timeout)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceDecodeRtspConfigSet(cstrName.c_str(), 
+        latency, drop_on_latency, do_retransmission, protocols, buffer_mode, timeout);
+}
+
+DslReturnType dsl_source_decode_rtsp_preset_set(const wchar_t* name, uint preset)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceDecodeRtspPresetSet(cstrName.c_str(), preset);
+}
+
+DslReturnType dsl_source_decode_rtsp_stats_get(const wchar_t* name, double* jitter,
+    uint* packets_received, uint* packets_lost)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceDecodeRtspStatsGet(cstrName.c_str(), 
+        jitter, packets_received, packets_lost);
+}
+
+DslReturnType dsl_source_uri_switch(const wchar_t* name, const wchar_t* uri)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+    std::wstring wstrUri(uri);
+    std::string cstrUri(wstrUri.begin(), wstrUri.end());
+
+    return DSL::Services::GetServices()->SourceUriSwitch(cstrName.c_str(), cstrUri.c_str());
+}
+
+DslReturnType dsl_source_uri_switch_latency_get(const wchar_t* name, uint* latency)
+{
+    std::wstring wstrName(name);
+    std::string cstrName(wstrName.begin(), wstrName.end());
+
+    return DSL::Services::GetServices()->SourceUriSwitchLatencyGet(cstrName.c_str(), latency);
+}
+
 DslReturnType dsl_source_decode_dewarper_add(const wchar_t* name, const wchar_t* dewarper)
 {
     std::wstring wstrName(name);
@@ -582,23 +775,26 @@ DslReturnType dsl_tee_demuxer_new_branch_add_many(const wchar_t* tee, const wcha
     std::wstring wstrTee(tee);
     std::string cstrTee(wstrTee.begin(), wstrTee.end());
 
-    DslReturnType retval = DSL::Services::GetServices()->TeeDemuxerNew(cstrTee.c_str());
-    if (retval != DSL_RESULT_SUCCESS)
-    {
-        return retval;
-    }
-
-    for (const wchar_t** branch = branches; *branch; branch++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrBranch(*branch);
-        std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
-        retval = DSL::Services::GetServices()->TeeBranchAdd(cstrTee.c_str(), cstrBranch.c_str());
+        DslReturnType retval = DSL::Services::GetServices()->TeeDemuxerNew(cstrTee.c_str());
         if (retval != DSL_RESULT_SUCCESS)
         {
             return retval;
         }
-    }
-    return DSL_RESULT_SUCCESS;
+
+        for (const wchar_t** branch = branches; *branch; branch++)
+        {
+            std::wstring wstrBranch(*branch);
+            std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
+            retval = DSL::Services::GetServices()->TeeBranchAdd(cstrTee.c_str(), cstrBranch.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
+        }
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_tee_splitter_new(const wchar_t* name)
@@ -614,23 +810,26 @@ DslReturnType dsl_tee_splitter_new_branch_add_many(const wchar_t* tee, const wch
     std::wstring wstrTee(tee);
     std::string cstrTee(wstrTee.begin(), wstrTee.end());
 
-    DslReturnType retval = DSL::Services::GetServices()->TeeSplitterNew(cstrTee.c_str());
-    if (retval != DSL_RESULT_SUCCESS)
-    {
-        return retval;
-    }
-
-    for (const wchar_t** branch = branches; *branch; branch++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrBranch(*branch);
-        std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
-        retval = DSL::Services::GetServices()->TeeBranchAdd(cstrTee.c_str(), cstrBranch.c_str());
+        DslReturnType retval = DSL::Services::GetServices()->TeeSplitterNew(cstrTee.c_str());
         if (retval != DSL_RESULT_SUCCESS)
         {
             return retval;
         }
-    }
-    return DSL_RESULT_SUCCESS;
+
+        for (const wchar_t** branch = branches; *branch; branch++)
+        {
+            std::wstring wstrBranch(*branch);
+            std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
+            retval = DSL::Services::GetServices()->TeeBranchAdd(cstrTee.c_str(), cstrBranch.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
+        }
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_tee_branch_add(const wchar_t* tee, const wchar_t* branch)
@@ -647,18 +846,21 @@ DslReturnType dsl_tee_branch_add_many(const wchar_t* tee, const wchar_t** branch
 {
     std::wstring wstrTee(tee);
     std::string cstrTee(wstrTee.begin(), wstrTee.end());
-    
-    for (const wchar_t** branch = branches; *branch; branch++)
+
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrBranch(*branch);
-        std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
-        DslReturnType retval = DSL::Services::GetServices()->TeeBranchAdd(cstrTee.c_str(), cstrBranch.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** branch = branches; *branch; branch++)
         {
-            return retval;
+            std::wstring wstrBranch(*branch);
+            std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
+            DslReturnType retval = DSL::Services::GetServices()->TeeBranchAdd(cstrTee.c_str(), cstrBranch.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_tee_branch_remove(const wchar_t* tee, const wchar_t* branch)
@@ -676,17 +878,20 @@ DslReturnType dsl_tee_branch_remove_many(const wchar_t* tee, const wchar_t** bra
     std::wstring wstrTee(tee);
     std::string cstrTee(wstrTee.begin(), wstrTee.end());
     
-    for (const wchar_t** branch = branches; *branch; branch++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrBranch(*branch);
-        std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
-        DslReturnType retval = DSL::Services::GetServices()->TeeBranchRemove(cstrTee.c_str(), cstrBranch.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** branch = branches; *branch; branch++)
         {
-            return retval;
+            std::wstring wstrBranch(*branch);
+            std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
+            DslReturnType retval = DSL::Services::GetServices()->TeeBranchRemove(cstrTee.c_str(), cstrBranch.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_tee_branch_remove_all(const wchar_t* tee)
@@ -764,6 +969,46 @@ DslReturnType dsl_tiler_tiles_set(const wchar_t* name, uint cols, uint rows)
     return DSL::Services::GetServices()->TilerTilesSet(cstrName.c_str(), cols, rows);
 }
 
+DslReturnType dsl_tiler_dimensions_get_by_handle(DslHandle tiler, uint* width, uint* height)
+{
+    return DSL::Services::GetServices()->TilerDimensionsGet(tiler, width, height);
+}
+
+DslReturnType dsl_tiler_dimensions_get_utf8(const char* name, uint* width, uint* height)
+{
+    return DSL::Services::GetServices()->TilerDimensionsGet(name, width, height);
+}
+
+DslReturnType dsl_tiler_dimensions_set_by_handle(DslHandle tiler, uint width, uint height)
+{
+    return DSL::Services::GetServices()->TilerDimensionsSet(tiler, width, height);
+}
+
+DslReturnType dsl_tiler_dimensions_set_utf8(const char* name, uint width, uint height)
+{
+    return DSL::Services::GetServices()->TilerDimensionsSet(name, width, height);
+}
+
+DslReturnType dsl_tiler_tiles_get_by_handle(DslHandle tiler, uint* cols, uint* rows)
+{
+    return DSL::Services::GetServices()->TilerTilesGet(tiler, cols, rows);
+}
+
+DslReturnType dsl_tiler_tiles_get_utf8(const char* name, uint* cols, uint* rows)
+{
+    return DSL::Services::GetServices()->TilerTilesGet(name, cols, rows);
+}
+
+DslReturnType dsl_tiler_tiles_set_by_handle(DslHandle tiler, uint cols, uint rows)
+{
+    return DSL::Services::GetServices()->TilerTilesSet(tiler, cols, rows);
+}
+
+DslReturnType dsl_tiler_tiles_set_utf8(const char* name, uint cols, uint rows)
+{
+    return DSL::Services::GetServices()->TilerTilesSet(name, cols, rows);
+}
+
 DslReturnType dsl_tiler_batch_meta_handler_add(const wchar_t* name, uint pad, 
     dsl_batch_meta_handler_cb handler, void* user_data)
 {
@@ -1024,17 +1269,20 @@ DslReturnType dsl_component_delete(const wchar_t* component)
 
 DslReturnType dsl_component_delete_many(const wchar_t** components)
 {
-    for (const wchar_t** component = components; *component; component++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrComponent(*component);
-        std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
-        DslReturnType retval = DSL::Services::GetServices()->ComponentDelete(cstrComponent.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** component = components; *component; component++)
         {
-            return retval;
+            std::wstring wstrComponent(*component);
+            std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+            DslReturnType retval = DSL::Services::GetServices()->ComponentDelete(cstrComponent.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_component_delete_all()
@@ -1063,6 +1311,34 @@ DslReturnType dsl_component_gpuid_set(const wchar_t* component, uint gpuid)
     return DSL::Services::GetServices()->ComponentGpuIdSet(cstrComponent.c_str(), gpuid);
 }
 
+DslReturnType dsl_component_queue_policy_get(const wchar_t* component, 
+    uint* max_size_buffers, uint* max_size_time, uint* leaky, uint* latency_budget)
+{
+    std::wstring wstrComponent(component);
+    std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+
+    return DSL::Services::GetServices()->ComponentQueuePolicyGet(cstrComponent.c_str(), 
+        max_size_buffers, max_size_time, leaky, latency_budget);
+}
+
+DslReturnType dsl_component_queue_policy_set(const wchar_t* component, 
+    uint max_size_buffers, uint max_size_time, uint leaky, uint latency_budget)
+{
+    std::wstring wstrComponent(component);
+    std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+
+    return DSL::Services::GetServices()->ComponentQueuePolicySet(cstrComponent.c_str(), 
+        max_size_buffers, max_size_time, leaky, latency_budget);
+}
+
+DslReturnType dsl_component_queue_dropped_get(const wchar_t* component, uint* dropped)
+{
+    std::wstring wstrComponent(component);
+    std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+
+    return DSL::Services::GetServices()->ComponentQueueDroppedGet(cstrComponent.c_str(), dropped);
+}
+
 DslReturnType dsl_component_gpuid_set_many(const wchar_t** components, uint gpuid)
 {
     for (const wchar_t** component = components; *component; component++)
@@ -1078,6 +1354,39 @@ DslReturnType dsl_component_gpuid_set_many(const wchar_t** components, uint gpui
     return DSL_RESULT_SUCCESS;
 }
 
+DslReturnType dsl_component_handle_get(const wchar_t* component, DslHandle* handle)
+{
+    std::wstring wstrComponent(component);
+    std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+
+    return DSL::Services::GetServices()->ComponentHandleGet(cstrComponent.c_str(), handle);
+}
+
+DslReturnType dsl_component_handle_get_utf8(const char* component, DslHandle* handle)
+{
+    return DSL::Services::GetServices()->ComponentHandleGet(component, handle);
+}
+
+DslReturnType dsl_component_gpuid_get_by_handle(DslHandle component, uint* gpuid)
+{
+    return DSL::Services::GetServices()->ComponentGpuIdGet(component, gpuid);
+}
+
+DslReturnType dsl_component_gpuid_get_utf8(const char* component, uint* gpuid)
+{
+    return DSL::Services::GetServices()->ComponentGpuIdGet(component, gpuid);
+}
+
+DslReturnType dsl_component_gpuid_set_by_handle(DslHandle component, uint gpuid)
+{
+    return DSL::Services::GetServices()->ComponentGpuIdSet(component, gpuid);
+}
+
+DslReturnType dsl_component_gpuid_set_utf8(const char* component, uint gpuid)
+{
+    return DSL::Services::GetServices()->ComponentGpuIdSet(component, gpuid);
+}
+
 DslReturnType dsl_branch_new(const wchar_t* branch)
 {
     std::wstring wstrName(branch);
@@ -1092,38 +1401,44 @@ DslReturnType dsl_branch_new_component_add_many(const wchar_t* branch,
     std::wstring wstrBranch(branch);
     std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
 
-    DslReturnType retval = DSL::Services::GetServices()->BranchNew(cstrBranch.c_str());
-    if (retval != DSL_RESULT_SUCCESS)
-    {
-        return retval;
-    }
-
-    for (const wchar_t** component = components; *component; component++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrComponent(*component);
-        std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
-        retval = DSL::Services::GetServices()->BranchComponentAdd(cstrBranch.c_str(), cstrComponent.c_str());
+        DslReturnType retval = DSL::Services::GetServices()->BranchNew(cstrBranch.c_str());
         if (retval != DSL_RESULT_SUCCESS)
         {
             return retval;
         }
-    }
-    return DSL_RESULT_SUCCESS;
+
+        for (const wchar_t** component = components; *component; component++)
+        {
+            std::wstring wstrComponent(*component);
+            std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+            retval = DSL::Services::GetServices()->BranchComponentAdd(cstrBranch.c_str(), cstrComponent.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
+        }
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_branch_new_many(const wchar_t** names)
 {
-    for (const wchar_t** name = names; *name; name++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrName(*name);
-        std::string cstrName(wstrName.begin(), wstrName.end());
-        DslReturnType retval = DSL::Services::GetServices()->BranchNew(cstrName.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** name = names; *name; name++)
         {
-            return retval;
+            std::wstring wstrName(*name);
+            std::string cstrName(wstrName.begin(), wstrName.end());
+            DslReturnType retval = DSL::Services::GetServices()->BranchNew(cstrName.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 
@@ -1143,18 +1458,21 @@ DslReturnType dsl_branch_component_add_many(const wchar_t* branch,
 {
     std::wstring wstrBranch(branch);
     std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
-    
-    for (const wchar_t** component = components; *component; component++)
+
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrComponent(*component);
-        std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
-        DslReturnType retval = DSL::Services::GetServices()->BranchComponentAdd(cstrBranch.c_str(), cstrComponent.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** component = components; *component; component++)
         {
-            return retval;
+            std::wstring wstrComponent(*component);
+            std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+            DslReturnType retval = DSL::Services::GetServices()->BranchComponentAdd(cstrBranch.c_str(), cstrComponent.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_branch_component_remove(const wchar_t* branch, 
@@ -1174,17 +1492,35 @@ DslReturnType dsl_branch_component_remove_many(const wchar_t* branch,
     std::wstring wstrBranch(branch);
     std::string cstrBranch(wstrBranch.begin(), wstrBranch.end());
     
-    for (const wchar_t** component = components; *component; component++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrComponent(*component);
-        std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
-        DslReturnType retval = DSL::Services::GetServices()->BranchComponentRemove(cstrBranch.c_str(), cstrComponent.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** component = components; *component; component++)
         {
-            return retval;
+            std::wstring wstrComponent(*component);
+            std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+            DslReturnType retval = DSL::Services::GetServices()->BranchComponentRemove(cstrBranch.c_str(), cstrComponent.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        return DSL_RESULT_SUCCESS;
+    });
+}
+
+DslReturnType dsl_transaction_begin()
+{
+    return DSL::Services::GetServices()->TransactionBegin();
+}
+
+DslReturnType dsl_transaction_commit()
+{
+    return DSL::Services::GetServices()->TransactionCommit();
+}
+
+DslReturnType dsl_transaction_abort()
+{
+    return DSL::Services::GetServices()->TransactionAbort();
 }
 
 DslReturnType dsl_pipeline_new(const wchar_t* pipeline)
@@ -1200,38 +1536,44 @@ DslReturnType dsl_pipeline_new_component_add_many(const wchar_t* pipeline,
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
-    
-    DslReturnType retval = DSL::Services::GetServices()->PipelineNew(cstrPipeline.c_str());
-    if (retval != DSL_RESULT_SUCCESS)
-    {
-        return retval;
-    }
-    for (const wchar_t** component = components; *component; component++)
+
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrComponent(*component);
-        std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
-        DslReturnType retval = DSL::Services::GetServices()->PipelineComponentAdd(cstrPipeline.c_str(), cstrComponent.c_str());
+        DslReturnType retval = DSL::Services::GetServices()->PipelineNew(cstrPipeline.c_str());
         if (retval != DSL_RESULT_SUCCESS)
         {
             return retval;
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        for (const wchar_t** component = components; *component; component++)
+        {
+            std::wstring wstrComponent(*component);
+            std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+            DslReturnType retval = DSL::Services::GetServices()->PipelineComponentAdd(cstrPipeline.c_str(), cstrComponent.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
+        }
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_pipeline_new_many(const wchar_t** pipelines)
 {
-    for (const wchar_t** pipeline = pipelines; *pipeline; pipeline++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrPipeline(*pipeline);
-        std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
-        DslReturnType retval = DSL::Services::GetServices()->PipelineNew(cstrPipeline.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** pipeline = pipelines; *pipeline; pipeline++)
         {
-            return retval;
+            std::wstring wstrPipeline(*pipeline);
+            std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+            DslReturnType retval = DSL::Services::GetServices()->PipelineNew(cstrPipeline.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_pipeline_delete(const wchar_t* pipeline)
@@ -1283,18 +1625,21 @@ DslReturnType dsl_pipeline_component_add_many(const wchar_t* pipeline,
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
-    
-    for (const wchar_t** component = components; *component; component++)
+
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrComponent(*component);
-        std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
-        DslReturnType retval = DSL::Services::GetServices()->PipelineComponentAdd(cstrPipeline.c_str(), cstrComponent.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** component = components; *component; component++)
         {
-            return retval;
+            std::wstring wstrComponent(*component);
+            std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+            DslReturnType retval = DSL::Services::GetServices()->PipelineComponentAdd(cstrPipeline.c_str(), cstrComponent.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-    }
-    return DSL_RESULT_SUCCESS;
+        return DSL_RESULT_SUCCESS;
+    });
 }
 
 DslReturnType dsl_pipeline_component_remove(const wchar_t* pipeline, 
@@ -1314,17 +1659,56 @@ DslReturnType dsl_pipeline_component_remove_many(const wchar_t* pipeline,
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
     
-    for (const wchar_t** component = components; *component; component++)
+    return RunAsTransaction([&]() -> DslReturnType
     {
-        std::wstring wstrComponent(*component);
-        std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
-        DslReturnType retval = DSL::Services::GetServices()->PipelineComponentRemove(cstrPipeline.c_str(), cstrComponent.c_str());
-        if (retval != DSL_RESULT_SUCCESS)
+        for (const wchar_t** component = components; *component; component++)
         {
-            return retval;
+            std::wstring wstrComponent(*component);
+            std::string cstrComponent(wstrComponent.begin(), wstrComponent.end());
+            DslReturnType retval = DSL::Services::GetServices()->PipelineComponentRemove(cstrPipeline.c_str(), cstrComponent.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
+        return DSL_RESULT_SUCCESS;
+    });
+}
+
+DslReturnType dsl_pipeline_load_definition(const wchar_t* definition, 
+    const wchar_t** report)
+{
+    std::wstring wstrDefinition(definition);
+    std::string cstrDefinition(wstrDefinition.begin(), wstrDefinition.end());
+    
+    const char* cReport;
+    static std::string cstrReport;
+    static std::wstring wcstrReport;
+    
+    uint retval = RunAsTransaction([&]() -> DslReturnType
+    {
+        return DSL::Services::GetServices()->PipelineDefinitionLoad(
+            cstrDefinition.c_str(), &cReport);
+    });
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        cstrReport.assign(cReport);
+        wcstrReport.assign(cstrReport.begin(), cstrReport.end());
+        *report = wcstrReport.c_str();
     }
-    return DSL_RESULT_SUCCESS;
+    return retval;
+}
+
+DslReturnType dsl_pipeline_save_definition(const wchar_t* pipeline, 
+    const wchar_t* path)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrPath(path);
+    std::string cstrPath(wstrPath.begin(), wstrPath.end());
+
+    return DSL::Services::GetServices()->PipelineDefinitionSave(cstrPipeline.c_str(), 
+        cstrPath.c_str());
 }
 
 DslReturnType dsl_pipeline_streammux_batch_properties_get(const wchar_t* pipeline, 
@@ -1383,3565 +1767,6798 @@ DslReturnType dsl_pipeline_streammux_padding_set(const wchar_t* pipeline, boolea
     return DSL::Services::GetServices()->PipelineStreamMuxPaddingSet(cstrPipeline.c_str(), enabled);
 }
 
-DslReturnType dsl_pipeline_xwindow_clear(const wchar_t* pipeline)
+DslReturnType dsl_pipeline_surface_budget_get(const wchar_t* pipeline, uint* budget, uint* policy)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->PipelineXWindowClear(cstrPipeline.c_str());
+    return DSL::Services::GetServices()->PipelineSurfaceBudgetGet(cstrPipeline.c_str(), 
+        budget, policy);
 }
- 
-DslReturnType dsl_pipeline_xwindow_dimensions_get(const wchar_t* pipeline, 
-    uint* width, uint* height)
+
+DslReturnType dsl_pipeline_surface_budget_set(const wchar_t* pipeline, uint budget, uint policy)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->PipelineXWindowDimensionsGet(cstrPipeline.c_str(),
-        width, height);
+    return DSL::Services::GetServices()->PipelineSurfaceBudgetSet(cstrPipeline.c_str(), 
+        budget, policy);
 }
 
-DslReturnType dsl_pipeline_xwindow_dimensions_set(const wchar_t* pipeline, 
-    uint width, uint height)
+DslReturnType dsl_pipeline_surface_memory_get(const wchar_t* pipeline, uint* size)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->PipelineXWindowDimensionsSet(cstrPipeline.c_str(),
-        width, height);
-}    
+    return DSL::Services::GetServices()->PipelineSurfaceMemoryGet(cstrPipeline.c_str(), size);
+}
 
-DslReturnType dsl_pipeline_pause(const wchar_t* pipeline)
+DslReturnType dsl_pipeline_latency_tracing_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->PipelinePause(cstrPipeline.c_str());
+    return DSL::Services::GetServices()->PipelineLatencyTracingEnabledGet(
+        cstrPipeline.c_str(), enabled);
 }
 
-DslReturnType dsl_pipeline_play(const wchar_t* pipeline)
+DslReturnType dsl_pipeline_latency_tracing_enabled_set(const wchar_t* pipeline, 
+    boolean enabled)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->PipelinePlay(cstrPipeline.c_str());
+    return DSL::Services::GetServices()->PipelineLatencyTracingEnabledSet(
+        cstrPipeline.c_str(), enabled);
 }
 
-DslReturnType dsl_pipeline_stop(const wchar_t* pipeline)
+DslReturnType dsl_pipeline_link_optimization_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->PipelineStop(cstrPipeline.c_str());
+    return DSL::Services::GetServices()->PipelineLinkOptimizationEnabledGet(
+        cstrPipeline.c_str(), enabled);
 }
 
-DslReturnType dsl_pipeline_get_state(const wchar_t* pipeline)
+DslReturnType dsl_pipeline_link_optimization_enabled_set(const wchar_t* pipeline, 
+    boolean enabled)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->PipelineGetState(cstrPipeline.c_str());
+    return DSL::Services::GetServices()->PipelineLinkOptimizationEnabledSet(
+        cstrPipeline.c_str(), enabled);
 }
 
-DslReturnType dsl_pipeline_dump_to_dot(const wchar_t* pipeline, wchar_t* filename)
+DslReturnType dsl_pipeline_link_optimization_report_get(const wchar_t* pipeline, 
+    const wchar_t** report)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
-    std::wstring wstrFilename(filename);
-    std::string cstrFilename(wstrFilename.begin(), wstrFilename.end());
+    
+    const char* cReport;
+    static std::string cstrReport;
+    static std::wstring wcstrReport;
+    
+    uint retval = DSL::Services::GetServices()->PipelineLinkOptimizationReportGet(
+        cstrPipeline.c_str(), &cReport);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        cstrReport.assign(cReport);
+        wcstrReport.assign(cstrReport.begin(), cstrReport.end());
+        *report = wcstrReport.c_str();
+    }
+    return retval;
+}
 
-    return DSL::Services::GetServices()->PipelineDumpToDot(cstrPipeline.c_str(), 
-        const_cast<char*>(cstrFilename.c_str()));
+DslReturnType dsl_pipeline_thread_role_affinity_get(const wchar_t* pipeline, 
+    uint role, const wchar_t** cpus, int* priority)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    
+    const char* cCpus;
+    static std::string cstrCpus;
+    static std::wstring wcstrCpus;
+    
+    uint retval = DSL::Services::GetServices()->PipelineThreadRoleAffinityGet(
+        cstrPipeline.c_str(), role, &cCpus, priority);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        cstrCpus.assign(cCpus);
+        wcstrCpus.assign(cstrCpus.begin(), cstrCpus.end());
+        *cpus = wcstrCpus.c_str();
+    }
+    return retval;
 }
 
-DslReturnType dsl_pipeline_dump_to_dot_with_ts(const wchar_t* pipeline, wchar_t* filename)
+DslReturnType dsl_pipeline_thread_role_affinity_set(const wchar_t* pipeline, 
+    uint role, const wchar_t* cpus, int priority)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
-    std::wstring wstrFilename(filename);
-    std::string cstrFilename(wstrFilename.begin(), wstrFilename.end());
+    std::wstring wstrCpus(cpus);
+    std::string cstrCpus(wstrCpus.begin(), wstrCpus.end());
 
-    return DSL::Services::GetServices()->PipelineDumpToDotWithTs(cstrPipeline.c_str(), 
-        const_cast<char*>(cstrFilename.c_str()));
+    return DSL::Services::GetServices()->PipelineThreadRoleAffinitySet(
+        cstrPipeline.c_str(), role, cstrCpus.c_str(), priority);
 }
 
-DslReturnType dsl_pipeline_state_change_listener_add(const wchar_t* pipeline, 
-    dsl_state_change_listener_cb listener, void* userdata)
+DslReturnType dsl_pipeline_thread_report_get(const wchar_t* pipeline, 
+    const wchar_t** report)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    
+    const char* cReport;
+    static std::string cstrReport;
+    static std::wstring wcstrReport;
+    
+    uint retval = DSL::Services::GetServices()->PipelineThreadReportGet(
+        cstrPipeline.c_str(), &cReport);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        cstrReport.assign(cReport);
+        wcstrReport.assign(cstrReport.begin(), cstrReport.end());
+        *report = wcstrReport.c_str();
+    }
+    return retval;
+}
 
-    return DSL::Services::GetServices()->
-        PipelineStateChangeListenerAdd(cstrPipeline.c_str(), listener, userdata);
+DslReturnType dsl_pipeline_latency_report_get(const wchar_t* pipeline, 
+    const wchar_t** report)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    
+    const char* cReport;
+    static std::string cstrReport;
+    static std::wstring wcstrReport;
+    
+    uint retval = DSL::Services::GetServices()->PipelineLatencyReportGet(
+        cstrPipeline.c_str(), &cReport);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        cstrReport.assign(cReport);
+        wcstrReport.assign(cstrReport.begin(), cstrReport.end());
+        *report = wcstrReport.c_str();
+    }
+    return retval;
 }
 
-DslReturnType dsl_pipeline_state_change_listener_remove(const wchar_t* pipeline, 
-    dsl_state_change_listener_cb listener)
+DslReturnType dsl_pipeline_perf_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->
-        PipelineStateChangeListenerRemove(cstrPipeline.c_str(), listener);
+    return DSL::Services::GetServices()->PipelinePerfEnabledGet(
+        cstrPipeline.c_str(), enabled);
 }
 
-DslReturnType dsl_pipeline_eos_listener_add(const wchar_t* pipeline, 
-    dsl_eos_listener_cb listener, void* userdata)
+DslReturnType dsl_pipeline_perf_enabled_set(const wchar_t* pipeline, 
+    boolean enabled)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->
-        PipelineEosListenerAdd(cstrPipeline.c_str(), listener, userdata);
+    return DSL::Services::GetServices()->PipelinePerfEnabledSet(
+        cstrPipeline.c_str(), enabled);
 }
 
-DslReturnType dsl_pipeline_eos_listener_remove(const wchar_t* pipeline, 
-    dsl_eos_listener_cb listener)
+DslReturnType dsl_pipeline_perf_interval_get(const wchar_t* pipeline, 
+    uint* interval)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->
-        PipelineEosListenerRemove(cstrPipeline.c_str(), listener);
+    return DSL::Services::GetServices()->PipelinePerfIntervalGet(
+        cstrPipeline.c_str(), interval);
 }
 
-DslReturnType dsl_pipeline_xwindow_key_event_handler_add(const wchar_t* pipeline, 
-    dsl_xwindow_key_event_handler_cb handler, void* user_data)
+DslReturnType dsl_pipeline_perf_interval_set(const wchar_t* pipeline, 
+    uint interval)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->
-        PipelineXWindowKeyEventHandlerAdd(cstrPipeline.c_str(), handler, user_data);
-}    
+    return DSL::Services::GetServices()->PipelinePerfIntervalSet(
+        cstrPipeline.c_str(), interval);
+}
 
-DslReturnType dsl_pipeline_xwindow_key_event_handler_remove(const wchar_t* pipeline, 
-    dsl_xwindow_key_event_handler_cb handler)
+DslReturnType dsl_pipeline_perf_get(const wchar_t* pipeline, 
+    uint source_id, double* fps, double* latency_p50, 
+    double* latency_p95, double* latency_p99, uint* drops)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->
-        PipelineXWindowKeyEventHandlerRemove(cstrPipeline.c_str(), handler);
+    return DSL::Services::GetServices()->PipelinePerfGet(cstrPipeline.c_str(), 
+        source_id, fps, latency_p50, latency_p95, latency_p99, drops);
 }
 
-DslReturnType dsl_pipeline_xwindow_button_event_handler_add(const wchar_t* pipeline, 
-    dsl_xwindow_button_event_handler_cb handler, void* user_data)
+DslReturnType dsl_pipeline_perf_listener_add(const wchar_t* pipeline, 
+    dsl_perf_listener_cb listener, void* userdata)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
     return DSL::Services::GetServices()->
-        PipelineXWindowButtonEventHandlerAdd(cstrPipeline.c_str(), handler, user_data);
-}    
+        PipelinePerfListenerAdd(cstrPipeline.c_str(), listener, userdata);
+}
 
-DslReturnType dsl_pipeline_xwindow_button_event_handler_remove(const wchar_t* pipeline, 
-    dsl_xwindow_button_event_handler_cb handler)    
+DslReturnType dsl_pipeline_perf_listener_remove(const wchar_t* pipeline, 
+    dsl_perf_listener_cb listener)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
     return DSL::Services::GetServices()->
-        PipelineXWindowButtonEventHandlerRemove(cstrPipeline.c_str(), handler);
+        PipelinePerfListenerRemove(cstrPipeline.c_str(), listener);
 }
 
-DslReturnType dsl_pipeline_xwindow_delete_event_handler_add(const wchar_t* pipeline, 
-    dsl_xwindow_delete_event_handler_cb handler, void* user_data)
+DslReturnType dsl_pipeline_sgie_link_mode_get(const wchar_t* pipeline, uint* mode)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->
-        PipelineXWindowDeleteEventHandlerAdd(cstrPipeline.c_str(), handler, user_data);
-}    
+    return DSL::Services::GetServices()->PipelineSgieLinkModeGet(
+        cstrPipeline.c_str(), mode);
+}
 
-DslReturnType dsl_pipeline_xwindow_delete_event_handler_remove(const wchar_t* pipeline, 
-    dsl_xwindow_delete_event_handler_cb handler)    
+DslReturnType dsl_pipeline_sgie_link_mode_set(const wchar_t* pipeline, uint mode)
 {
     std::wstring wstrPipeline(pipeline);
     std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    return DSL::Services::GetServices()->
-        PipelineXWindowDeleteEventHandlerRemove(cstrPipeline.c_str(), handler);
+    return DSL::Services::GetServices()->PipelineSgieLinkModeSet(
+        cstrPipeline.c_str(), mode);
 }
 
-#define RETURN_IF_BRANCH_NAME_NOT_FOUND(branches, name) do \
-{ \
-    if (branches.find(name) == branches.end()) \
-    { \
-        LOG_ERROR("Branch name '" << name << "' was not found"); \
-        return DSL_RESULT_BRANCH_NAME_NOT_FOUND; \
-    } \
-}while(0); 
-    
-#define RETURN_IF_PIPELINE_NAME_NOT_FOUND(pipelines, name) do \
-{ \
-    if (pipelines.find(name) == pipelines.end()) \
-    { \
-        LOG_ERROR("Pipeline name '" << name << "' was not found"); \
-        return DSL_RESULT_PIPELINE_NAME_NOT_FOUND; \
-    } \
-}while(0); 
-    
-#define RETURN_IF_COMPONENT_NAME_NOT_FOUND(components, name) do \
-{ \
-    if (components.find(name) == components.end()) \
-    { \
-        LOG_ERROR("Component name '" << name << "' was not found"); \
-        return DSL_RESULT_COMPONENT_NAME_NOT_FOUND; \
-    } \
-}while(0); 
-
-#define RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(components, name, bintr) do \
-{ \
-    if (!components[name]->IsType(typeid(bintr)))\
-    { \
-        LOG_ERROR("Component '" << name << "' is not the correct type"); \
-        return DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE; \
-    } \
-}while(0); 
+DslReturnType dsl_pipeline_classification_cache_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-#define RETURN_IF_COMPONENT_IS_NOT_SOURCE(components, name) do \
-{ \
-    if (!components[name]->IsType(typeid(CsiSourceBintr)) and  \
-        !components[name]->IsType(typeid(UsbSourceBintr)) and  \
-        !components[name]->IsType(typeid(UriSourceBintr)) and  \
-        !components[name]->IsType(typeid(RtspSourceBintr))) \
-    { \
-        LOG_ERROR("Component '" << name << "' is not a Source"); \
-        return DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE; \
-    } \
-}while(0); 
+    return DSL::Services::GetServices()->PipelineClassificationCacheEnabledGet(
+        cstrPipeline.c_str(), enabled);
+}
 
-#define RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(components, name) do \
-{ \
-    if (!components[name]->IsType(typeid(UriSourceBintr)) and  \
-        !components[name]->IsType(typeid(RtspSourceBintr))) \
-    { \
-        LOG_ERROR("Component '" << name << "' is not a Decode Source"); \
-        return DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE; \
-    } \
-}while(0); 
+DslReturnType dsl_pipeline_classification_cache_enabled_set(const wchar_t* pipeline, 
+    boolean enabled)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-#define RETURN_IF_COMPONENT_IS_NOT_GIE(components, name) do \
-{ \
-    if (!components[name]->IsType(typeid(PrimaryGieBintr)) and  \
-        !components[name]->IsType(typeid(SecondaryGieBintr))) \
-    { \
-        LOG_ERROR("Component '" << name << "' is not a Primary or Secondary GIE"); \
-        return DSL_RESULT_GIE_COMPONENT_IS_NOT_GIE; \
-    } \
-}while(0); 
+    return DSL::Services::GetServices()->PipelineClassificationCacheEnabledSet(
+        cstrPipeline.c_str(), enabled);
+}
 
-#define RETURN_IF_COMPONENT_IS_NOT_TRACKER(components, name) do \
-{ \
-    if (!components[name]->IsType(typeid(KtlTrackerBintr)) and  \
-        !components[name]->IsType(typeid(IouTrackerBintr))) \
-    { \
-        LOG_ERROR("Component '" << name << "' is not a Tracker"); \
-        return DSL_RESULT_TRACKER_COMPONENT_IS_NOT_TRACKER; \
-    } \
-}while(0); 
+DslReturnType dsl_pipeline_classification_cache_settings_get(const wchar_t* pipeline, 
+    uint* min_count, double* min_confidence, uint* ttl)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-#define RETURN_IF_COMPONENT_IS_NOT_TEE(components, name) do \
-{ \
-    if (!components[name]->IsType(typeid(DemuxerBintr)) and  \
-        !components[name]->IsType(typeid(SplitterBintr))) \
-    { \
-        LOG_ERROR("Component '" << name << "' is not a Tee"); \
-        return DSL_RESULT_TEE_COMPONENT_IS_NOT_TEE; \
-    } \
-}while(0); 
+    return DSL::Services::GetServices()->PipelineClassificationCacheSettingsGet(
+        cstrPipeline.c_str(), min_count, min_confidence, ttl);
+}
 
-#define RETURN_IF_COMPONENT_IS_NOT_BRANCH(components, name) do \
-{ \
-    if (!components[name]->IsType(typeid(FakeSinkBintr)) and  \
-        !components[name]->IsType(typeid(OverlaySinkBintr)) and  \
-        !components[name]->IsType(typeid(WindowSinkBintr)) and  \
-        !components[name]->IsType(typeid(FileSinkBintr)) and  \
-        !components[name]->IsType(typeid(RtspSinkBintr)) and \
-        !components[name]->IsType(typeid(BranchBintr)) and \
-        !components[name]->IsType(typeid(DemuxerBintr)) and \
-        !components[name]->IsType(typeid(BranchBintr))) \
-    { \
-        LOG_ERROR("Component '" << name << "' is not a Branch type"); \
-        return DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE; \
-    } \
-}while(0); 
+DslReturnType dsl_pipeline_classification_cache_settings_set(const wchar_t* pipeline, 
+    uint min_count, double min_confidence, uint ttl)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-#define RETURN_IF_COMPONENT_IS_NOT_SINK(components, name) do \
-{ \
-    if (!components[name]->IsType(typeid(FakeSinkBintr)) and  \
-        !components[name]->IsType(typeid(OverlaySinkBintr)) and  \
-        !components[name]->IsType(typeid(WindowSinkBintr)) and  \
-        !components[name]->IsType(typeid(FileSinkBintr)) and  \
-        !components[name]->IsType(typeid(RtspSinkBintr))) \
-    { \
-        LOG_ERROR("Component '" << name << "' is not a Sink"); \
-        return DSL_RESULT_SINK_COMPONENT_IS_NOT_SINK; \
-    } \
-}while(0); 
+    return DSL::Services::GetServices()->PipelineClassificationCacheSettingsSet(
+        cstrPipeline.c_str(), min_count, min_confidence, ttl);
+}
 
-#define INIT_MEMORY(m) memset(&m, 0, sizeof(m));
-#define INIT_STRUCT(type, name) struct type name; INIT_MEMORY(name) 
-/**
- * Function to handle program interrupt signal.
- * It installs default handler after handling the interrupt.
- */
-static void PrgItrSigIsr(int signum)
+DslReturnType dsl_pipeline_classification_cache_stats_get(const wchar_t* pipeline, 
+    double* hit_rate, uint* entries)
 {
-    dsl_main_loop_quit();
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineClassificationCacheStatsGet(
+        cstrPipeline.c_str(), hit_rate, entries);
 }
 
-/**
- * Function to install custom handler for program interrupt signal.
- */
-static void PrgItrSigIsrInstall(void)
+DslReturnType dsl_pipeline_trace_start(const wchar_t* pipeline, 
+    const wchar_t* file_path, uint format)
 {
-    INIT_STRUCT(sigaction, sa);
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrFilePath(file_path);
+    std::string cstrFilePath(wstrFilePath.begin(), wstrFilePath.end());
 
-    sa.sa_handler = PrgItrSigIsr;
-    sigaction(SIGINT, &sa, NULL);
-}    
+    return DSL::Services::GetServices()->PipelineTraceStart(cstrPipeline.c_str(), 
+        cstrFilePath.c_str(), format);
+}
 
-/**
- * Function to uninstall custom handler for program interrupt signal.
- */
-static void PrgItrSigIsrUninstall(void)
+DslReturnType dsl_pipeline_trace_stop(const wchar_t* pipeline)
 {
-    INIT_STRUCT(sigaction, sa);
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
 
-    sa.sa_handler = SIG_DFL;
-    sigaction(SIGINT, &sa, NULL);
+    return DSL::Services::GetServices()->PipelineTraceStop(cstrPipeline.c_str());
+}
+
+DslReturnType dsl_pipeline_xwindow_clear(const wchar_t* pipeline)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineXWindowClear(cstrPipeline.c_str());
+}
+ 
+DslReturnType dsl_pipeline_xwindow_dimensions_get(const wchar_t* pipeline, 
+    uint* width, uint* height)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineXWindowDimensionsGet(cstrPipeline.c_str(),
+        width, height);
+}
+
+DslReturnType dsl_pipeline_xwindow_dimensions_set(const wchar_t* pipeline, 
+    uint width, uint height)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineXWindowDimensionsSet(cstrPipeline.c_str(),
+        width, height);
 }    
 
-void dsl_main_loop_run()
+DslReturnType dsl_pipeline_pause(const wchar_t* pipeline)
 {
-    PrgItrSigIsrInstall();
-    g_main_loop_run(DSL::Services::GetServices()->GetMainLoopHandle());
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelinePause(cstrPipeline.c_str());
 }
 
-void dsl_main_loop_quit()
+DslReturnType dsl_pipeline_prepare(const wchar_t* pipeline, 
+    dsl_prepare_complete_cb listener, void* user_data)
 {
-    PrgItrSigIsrUninstall();
-    g_main_loop_quit(DSL::Services::GetServices()->GetMainLoopHandle());
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelinePrepare(cstrPipeline.c_str(),
+        listener, user_data);
+}
+
+DslReturnType dsl_pipeline_prepare_report_get(const wchar_t* pipeline, 
+    const wchar_t** report)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    
+    const char* cReport;
+    static std::string cstrReport;
+    static std::wstring wcstrReport;
+    
+    uint retval = DSL::Services::GetServices()->PipelinePrepareReportGet(
+        cstrPipeline.c_str(), &cReport);
+    if (retval ==  DSL_RESULT_SUCCESS)
+    {
+        cstrReport.assign(cReport);
+        wcstrReport.assign(cstrReport.begin(), cstrReport.end());
+        *report = wcstrReport.c_str();
+    }
+    return retval;
+}
+
+DslReturnType dsl_pipeline_play(const wchar_t* pipeline)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelinePlay(cstrPipeline.c_str());
+}
+
+DslReturnType dsl_pipeline_stop(const wchar_t* pipeline)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineStop(cstrPipeline.c_str());
+}
+
+DslReturnType dsl_pipeline_get_state(const wchar_t* pipeline)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineGetState(cstrPipeline.c_str());
+}
+
+DslReturnType dsl_pipeline_dump_to_dot(const wchar_t* pipeline, wchar_t* filename)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrFilename(filename);
+    std::string cstrFilename(wstrFilename.begin(), wstrFilename.end());
+
+    return DSL::Services::GetServices()->PipelineDumpToDot(cstrPipeline.c_str(), 
+        const_cast<char*>(cstrFilename.c_str()));
 }
 
-const wchar_t* dsl_return_value_to_string(uint result)
-{
-    return DSL::Services::GetServices()->ReturnValueToString(result);
-}
+DslReturnType dsl_pipeline_dump_to_dot_with_ts(const wchar_t* pipeline, wchar_t* filename)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+    std::wstring wstrFilename(filename);
+    std::string cstrFilename(wstrFilename.begin(), wstrFilename.end());
+
+    return DSL::Services::GetServices()->PipelineDumpToDotWithTs(cstrPipeline.c_str(), 
+        const_cast<char*>(cstrFilename.c_str()));
+}
+
+DslReturnType dsl_pipeline_state_change_listener_add(const wchar_t* pipeline, 
+    dsl_state_change_listener_cb listener, void* userdata)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineStateChangeListenerAdd(cstrPipeline.c_str(), listener, userdata);
+}
+
+DslReturnType dsl_pipeline_state_change_listener_remove(const wchar_t* pipeline, 
+    dsl_state_change_listener_cb listener)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineStateChangeListenerRemove(cstrPipeline.c_str(), listener);
+}
+
+DslReturnType dsl_pipeline_eos_listener_add(const wchar_t* pipeline, 
+    dsl_eos_listener_cb listener, void* userdata)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineEosListenerAdd(cstrPipeline.c_str(), listener, userdata);
+}
+
+DslReturnType dsl_pipeline_eos_listener_remove(const wchar_t* pipeline, 
+    dsl_eos_listener_cb listener)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineEosListenerRemove(cstrPipeline.c_str(), listener);
+}
+
+DslReturnType dsl_pipeline_xwindow_key_event_handler_add(const wchar_t* pipeline, 
+    dsl_xwindow_key_event_handler_cb handler, void* user_data)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineXWindowKeyEventHandlerAdd(cstrPipeline.c_str(), handler, user_data);
+}    
+
+DslReturnType dsl_pipeline_xwindow_key_event_handler_remove(const wchar_t* pipeline, 
+    dsl_xwindow_key_event_handler_cb handler)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineXWindowKeyEventHandlerRemove(cstrPipeline.c_str(), handler);
+}
+
+DslReturnType dsl_pipeline_xwindow_button_event_handler_add(const wchar_t* pipeline, 
+    dsl_xwindow_button_event_handler_cb handler, void* user_data)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineXWindowButtonEventHandlerAdd(cstrPipeline.c_str(), handler, user_data);
+}    
+
+DslReturnType dsl_pipeline_xwindow_button_event_handler_remove(const wchar_t* pipeline, 
+    dsl_xwindow_button_event_handler_cb handler)    
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineXWindowButtonEventHandlerRemove(cstrPipeline.c_str(), handler);
+}
+
+DslReturnType dsl_pipeline_xwindow_delete_event_handler_add(const wchar_t* pipeline, 
+    dsl_xwindow_delete_event_handler_cb handler, void* user_data)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineXWindowDeleteEventHandlerAdd(cstrPipeline.c_str(), handler, user_data);
+}    
+
+DslReturnType dsl_pipeline_xwindow_delete_event_handler_remove(const wchar_t* pipeline, 
+    dsl_xwindow_delete_event_handler_cb handler)    
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->
+        PipelineXWindowDeleteEventHandlerRemove(cstrPipeline.c_str(), handler);
+}
+
+DslReturnType dsl_pipeline_main_context_enabled_get(const wchar_t* pipeline, 
+    boolean* enabled)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineMainContextEnabledGet(
+        cstrPipeline.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_main_context_enabled_set(const wchar_t* pipeline, 
+    boolean enabled)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineMainContextEnabledSet(
+        cstrPipeline.c_str(), enabled);
+}
+
+DslReturnType dsl_pipeline_event_fd_get(const wchar_t* pipeline, int* fd)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineEventFdGet(
+        cstrPipeline.c_str(), fd);
+}
+
+DslReturnType dsl_pipeline_events_dispatch(const wchar_t* pipeline, uint* count)
+{
+    std::wstring wstrPipeline(pipeline);
+    std::string cstrPipeline(wstrPipeline.begin(), wstrPipeline.end());
+
+    return DSL::Services::GetServices()->PipelineEventsDispatch(
+        cstrPipeline.c_str(), count);
+}
+
+/**
+ * @brief Locks the Services registries for the current scope. The writer lock
+ * is held by the thread that owns a transaction from begin until commit or abort,
+ * so the owning thread skips the lock while all other threads wait for it.
+ */
+#define LOCK_SERVICES_READER_FOR_CURRENT_SCOPE() \
+    LockReaderForCurrentScope lock(TransactionInProgress() ? NULL : &m_servicesRWLock)
+
+#define LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE() \
+    LockWriterForCurrentScope lock(TransactionInProgress() ? NULL : &m_servicesRWLock)
+
+/**
+ * @brief Edits recorded within a transaction, validated on commit and 
+ * undone in reverse on abort
+ */
+#define DSL_TRANSACTION_EDIT_PIPELINE_COMPONENT_ADD                 0
+#define DSL_TRANSACTION_EDIT_PIPELINE_COMPONENT_REMOVE              1
+#define DSL_TRANSACTION_EDIT_BRANCH_COMPONENT_ADD                   2
+#define DSL_TRANSACTION_EDIT_BRANCH_COMPONENT_REMOVE                3
+#define DSL_TRANSACTION_EDIT_TEE_BRANCH_ADD                         4
+#define DSL_TRANSACTION_EDIT_TEE_BRANCH_REMOVE                      5
+#define DSL_TRANSACTION_EDIT_PIPELINE_NEW                           6
+#define DSL_TRANSACTION_EDIT_COMPONENT_NEW                          7
+#define DSL_TRANSACTION_EDIT_COMPONENT_DELETE                       8
+
+/**
+ * @brief Locks the named Component's or Pipeline's API mutex for the current scope. 
+ * Must be used after the Services reader lock and the name-not-found check.
+ */
+#define LOCK_COMPONENT_FOR_CURRENT_SCOPE(components, name) \
+    LockMutexForCurrentScope componentLock(components[name]->GetApiMutex())
+
+/**
+ * @brief Component handles hold the slot index in the lower 16 bits and 
+ * the slot's generation, from 1 to 0xFFFF, in the upper 16 bits.
+ */
+#define DSL_HANDLE_SLOT(handle) ((handle) & 0xFFFF)
+#define DSL_HANDLE_GENERATION(handle) ((handle) >> 16)
+#define DSL_HANDLE_NEW(slot, generation) (((generation) << 16) | (slot))
+#define DSL_HANDLE_MAX_SLOTS 0x10000
+
+#define RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(slots, generations, handle) do \
+{ \
+    if (DSL_HANDLE_SLOT(handle) >= slots.size() or \
+        !slots[DSL_HANDLE_SLOT(handle)] or \
+        generations[DSL_HANDLE_SLOT(handle)] != DSL_HANDLE_GENERATION(handle)) \
+    { \
+        LOG_ERROR("Component handle '" << handle << "' was not found"); \
+        return DSL_RESULT_COMPONENT_HANDLE_NOT_FOUND; \
+    } \
+}while(0); 
+
+#define RETURN_IF_BRANCH_NAME_NOT_FOUND(branches, name) do \
+{ \
+    if (branches.find(name) == branches.end()) \
+    { \
+        LOG_ERROR("Branch name '" << name << "' was not found"); \
+        return DSL_RESULT_BRANCH_NAME_NOT_FOUND; \
+    } \
+}while(0); 
+    
+#define RETURN_IF_PIPELINE_NAME_NOT_FOUND(pipelines, name) do \
+{ \
+    if (pipelines.find(name) == pipelines.end()) \
+    { \
+        LOG_ERROR("Pipeline name '" << name << "' was not found"); \
+        return DSL_RESULT_PIPELINE_NAME_NOT_FOUND; \
+    } \
+}while(0); 
+    
+#define RETURN_IF_COMPONENT_NAME_NOT_FOUND(components, name) do \
+{ \
+    if (components.find(name) == components.end()) \
+    { \
+        LOG_ERROR("Component name '" << name << "' was not found"); \
+        return DSL_RESULT_COMPONENT_NAME_NOT_FOUND; \
+    } \
+}while(0); 
+
+#define RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(components, name, bintr) do \
+{ \
+    if (!components[name]->IsType(typeid(bintr)))\
+    { \
+        LOG_ERROR("Component '" << name << "' is not the correct type"); \
+        return DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE; \
+    } \
+}while(0); 
+
+#define RETURN_IF_COMPONENT_IS_NOT_SOURCE(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(CsiSourceBintr)) and  \
+        !components[name]->IsType(typeid(UsbSourceBintr)) and  \
+        !components[name]->IsType(typeid(UriSourceBintr)) and  \
+        !components[name]->IsType(typeid(RtspSourceBintr)) and  \
+        !components[name]->IsType(typeid(MultiImageSourceBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Source"); \
+        return DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE; \
+    } \
+}while(0); 
+
+#define RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(UriSourceBintr)) and  \
+        !components[name]->IsType(typeid(RtspSourceBintr)) and  \
+        !components[name]->IsType(typeid(MultiImageSourceBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Decode Source"); \
+        return DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE; \
+    } \
+}while(0); 
+
+#define RETURN_IF_COMPONENT_IS_NOT_GIE(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(PrimaryGieBintr)) and  \
+        !components[name]->IsType(typeid(SecondaryGieBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Primary or Secondary GIE"); \
+        return DSL_RESULT_GIE_COMPONENT_IS_NOT_GIE; \
+    } \
+}while(0); 
+
+#define RETURN_IF_COMPONENT_IS_NOT_TRACKER(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(KtlTrackerBintr)) and  \
+        !components[name]->IsType(typeid(IouTrackerBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Tracker"); \
+        return DSL_RESULT_TRACKER_COMPONENT_IS_NOT_TRACKER; \
+    } \
+}while(0); 
+
+#define RETURN_IF_COMPONENT_IS_NOT_TEE(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(DemuxerBintr)) and  \
+        !components[name]->IsType(typeid(SplitterBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Tee"); \
+        return DSL_RESULT_TEE_COMPONENT_IS_NOT_TEE; \
+    } \
+}while(0); 
+
+#define RETURN_IF_COMPONENT_IS_NOT_BRANCH(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(FakeSinkBintr)) and  \
+        !components[name]->IsType(typeid(OverlaySinkBintr)) and  \
+        !components[name]->IsType(typeid(WindowSinkBintr)) and  \
+        !components[name]->IsType(typeid(FileSinkBintr)) and  \
+        !components[name]->IsType(typeid(RtspSinkBintr)) and \
+        !components[name]->IsType(typeid(BranchBintr)) and \
+        !components[name]->IsType(typeid(DemuxerBintr)) and \
+        !components[name]->IsType(typeid(BranchBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Branch type"); \
+        return DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE; \
+    } \
+}while(0); 
+
+#define RETURN_IF_COMPONENT_IS_NOT_SINK(components, name) do \
+{ \
+    if (!components[name]->IsType(typeid(FakeSinkBintr)) and  \
+        !components[name]->IsType(typeid(OverlaySinkBintr)) and  \
+        !components[name]->IsType(typeid(WindowSinkBintr)) and  \
+        !components[name]->IsType(typeid(FileSinkBintr)) and  \
+        !components[name]->IsType(typeid(RtspSinkBintr))) \
+    { \
+        LOG_ERROR("Component '" << name << "' is not a Sink"); \
+        return DSL_RESULT_SINK_COMPONENT_IS_NOT_SINK; \
+    } \
+}while(0); 
+
+#define INIT_MEMORY(m) memset(&m, 0, sizeof(m));
+#define INIT_STRUCT(type, name) struct type name; INIT_MEMORY(name) 
+/**
+ * Function to handle program interrupt signal.
+ * It installs default handler after handling the interrupt.
+ */
+static void PrgItrSigIsr(int signum)
+{
+    dsl_main_loop_quit();
+}
+
+/**
+ * Function to install custom handler for program interrupt signal.
+ */
+static void PrgItrSigIsrInstall(void)
+{
+    INIT_STRUCT(sigaction, sa);
+
+    sa.sa_handler = PrgItrSigIsr;
+    sigaction(SIGINT, &sa, NULL);
+}    
+
+/**
+ * Function to uninstall custom handler for program interrupt signal.
+ */
+static void PrgItrSigIsrUninstall(void)
+{
+    INIT_STRUCT(sigaction, sa);
+
+    sa.sa_handler = SIG_DFL;
+    sigaction(SIGINT, &sa, NULL);
+}    
+
+void dsl_main_loop_run()
+{
+    PrgItrSigIsrInstall();
+    g_main_loop_run(DSL::Services::GetServices()->GetMainLoopHandle());
+}
+
+void dsl_main_loop_quit()
+{
+    PrgItrSigIsrUninstall();
+    g_main_loop_quit(DSL::Services::GetServices()->GetMainLoopHandle());
+}
+
+const wchar_t* dsl_return_value_to_string(uint result)
+{
+    return DSL::Services::GetServices()->ReturnValueToString(result);
+}
+
+const wchar_t* dsl_version_get()
+{
+    return DSL_VERSION;
+}
+
+namespace DSL
+{
+    // Initialize the Services's single instance pointer
+    Services* Services::m_pInstatnce = NULL;
+
+    Services* Services::GetServices()
+    {
+        // one time initialization of the single instance pointer
+        if (!m_pInstatnce)
+        {
+            boolean doGstDeinit(false);
+        
+            // If gst has not been initialized by the client software
+            if (!gst_is_initialized())
+            {
+                int argc = 0;
+                char** argv = NULL;
+                
+                // initialize the GStreamer library
+                gst_init(&argc, &argv);
+                doGstDeinit = true;
+            }
+            // Initialize the single debug category used by the lib
+            GST_DEBUG_CATEGORY_INIT(GST_CAT_DSL, "DSL", 0, "DeepStream Services");
+            
+            // Safe to start logging
+            LOG_INFO("Services Initialization");
+            
+            // Single instantiation for the lib's lifetime
+            m_pInstatnce = new Services(doGstDeinit);
+            m_pInstatnce->InitToStringMaps();
+        }
+        return m_pInstatnce;
+    }
+        
+    Services::Services(bool doGstDeinit)
+        : m_doGstDeinit(doGstDeinit)
+        , m_pMainLoop(g_main_loop_new(NULL, FALSE))
+        , m_sourceNumInUseMax(DSL_DEFAULT_SOURCE_IN_USE_MAX)
+        , m_sinkNumInUseMax(DSL_DEFAULT_SINK_IN_USE_MAX)
+        , m_pTransactionThread(nullptr)
+    {
+        LOG_FUNC();
+        
+        g_rw_lock_init(&m_servicesRWLock);
+    }
+
+    Services::~Services()
+    {
+        LOG_FUNC();
+        
+        {
+            LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+            
+            // If this Services object called gst_init(), and not the client.
+            if (m_doGstDeinit)
+            {
+                gst_deinit();
+            }
+            
+            if (m_pMainLoop)
+            {
+                g_main_loop_unref(m_pMainLoop);
+            }
+        }
+        g_rw_lock_clear(&m_servicesRWLock);
+    }
+    
+    DslReturnType Services::SourceCsiNew(const char* name,
+        uint width, uint height, uint fps_n, uint fps_d)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Source name '" << name << "' is not unique");
+            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = DSL_CSI_SOURCE_NEW(name, width, height, fps_n, fps_d);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New CSI Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        LOG_INFO("new CSI Source '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceUsbNew(const char* name,
+        uint width, uint height, uint fps_n, uint fps_d)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Source name '" << name << "' is not unique");
+            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = DSL_USB_SOURCE_NEW(name, width, height, fps_n, fps_d);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New USB Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        LOG_INFO("new USB Source '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceUriNew(const char* name, const char* uri, 
+        boolean isLive, uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Source name '" << name << "' is not unique");
+            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+        }
+        std::string stringUri(uri);
+        if (stringUri.find("http") == std::string::npos)
+        {
+            if (isLive)
+            {
+                LOG_ERROR("Invalid URI '" << uri << "' for Live source '" << name << "'");
+                return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+            }
+            std::ifstream streamUriFile(uri);
+            if (!streamUriFile.good())
+            {
+                LOG_ERROR("URI Source'" << uri << "' Not found");
+                return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+            }
+        }
+        try
+        {
+            m_components[name] = DSL_URI_SOURCE_NEW(
+                name, uri, isLive, cudadecMemType, intraDecode, dropFrameInterval);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New URI Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        LOG_INFO("new URI Source '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceRtspNew(const char* name, const char* uri, 
+        uint protocol, uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Source name '" << name << "' is not unique");
+            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = DSL_RTSP_SOURCE_NEW(
+                name, uri, protocol, cudadecMemType, intraDecode, dropFrameInterval);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New RTSP Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        LOG_INFO("new RTSP Source '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceImageMultiNew(const char* name, 
+        const char* location, uint readahead)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Source name '" << name << "' is not unique");
+            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+        }
+        std::string stringLocation(location);
+        if (stringLocation.find_first_of("*?[") == std::string::npos and
+            !g_file_test(location, G_FILE_TEST_EXISTS))
+        {
+            LOG_ERROR("Multi Image Source location '" << location << "' Not found");
+            return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+        }
+        try
+        {
+            m_components[name] = DSL_MULTI_IMAGE_SOURCE_NEW(name, location, readahead);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Multi Image Source '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        LOG_INFO("new Multi Image Source '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceImageMultiStatsGet(const char* name, 
+        uint* filesRead, double* filesPerSecond)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, MultiImageSourceBintr);
+            
+            DSL_MULTI_IMAGE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<MultiImageSourceBintr>(m_components[name]);
+         
+            pSourceBintr->GetStats(filesRead, filesPerSecond);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Multi Image Source '" << name << "' threw exception getting stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceDimensionsGet(const char* name, uint* width, uint* height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+         
+            pSourceBintr->GetDimensions(width, height);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << name << "' threw exception getting dimensions");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }                
+    
+    DslReturnType Services::SourceFrameRateGet(const char* name, uint* fps_n, uint* fps_d)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+         
+            pSourceBintr->GetFrameRate(fps_n, fps_d);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << name << "' threw exception getting dimensions");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceDimensionsGet(DslHandle source, uint* width, uint* height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(m_componentSlots, m_componentSlotGenerations, source);
+
+        uint slot = DSL_HANDLE_SLOT(source);
+        try
+        {
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_componentSlots, slot);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_componentSlots, slot);
+
+            std::static_pointer_cast<SourceBintr>(
+                m_componentSlots[slot])->GetDimensions(width, height);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << m_componentSlots[slot]->GetName() 
+                << "' threw exception getting dimensions");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceFrameRateGet(DslHandle source, uint* fps_n, uint* fps_d)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(m_componentSlots, m_componentSlotGenerations, source);
+
+        uint slot = DSL_HANDLE_SLOT(source);
+        try
+        {
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_componentSlots, slot);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_componentSlots, slot);
+
+            std::static_pointer_cast<SourceBintr>(
+                m_componentSlots[slot])->GetFrameRate(fps_n, fps_d);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << m_componentSlots[slot]->GetName() 
+                << "' threw exception getting frame rate");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeUriGet(const char* name, const char** uri)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+
+            *uri = pSourceBintr->GetUri();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+            
+
+    DslReturnType Services::SourceDecodeUriSet(const char* name, const char* uri)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+
+            if (!pSourceBintr->SetUri(uri));
+            {
+                LOG_ERROR("Failed to Set URI '" << uri << "' for Decode Source '" << name << "'");
+                return DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED;
+            }
+            
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SourceUriPlaylistAdd(const char* name, const char* uri)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, UriSourceBintr);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->AddPlaylistUri(uri))
+            {
+                LOG_ERROR("Failed to add URI '" << uri << "' to the playlist of URI Source '" << name << "'");
+                return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name << "' threw exception adding playlist URI");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceUriPlaylistClear(const char* name)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, UriSourceBintr);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+                
+            pSourceBintr->ClearPlaylist();
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name << "' threw exception clearing playlist");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceUriPlaylistSizeGet(const char* name, uint* size)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, UriSourceBintr);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+                
+            *size = pSourceBintr->GetPlaylistSize();
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name << "' threw exception getting playlist size");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeSurfacesGet(const char* name, 
+        uint* numDecodeSurfaces, uint* numExtraSurfaces)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+            
+            pSourceBintr->GetNumSurfaces(numDecodeSurfaces, numExtraSurfaces);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Decode Source '" << name << "' threw exception getting surfaces");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeSurfacesSet(const char* name, 
+        uint numDecodeSurfaces, uint numExtraSurfaces)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+            
+            if (!pSourceBintr->SetNumSurfaces(numDecodeSurfaces, numExtraSurfaces))
+            {
+                LOG_ERROR("Decode Source '" << name << "' failed to set surfaces");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Decode Source '" << name << "' threw exception setting surfaces");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeRtspConfigGet(const char* name, uint* latency,
+        boolean* dropOnLatency, boolean* doRetransmission, uint* protocols, 
+        uint* bufferMode, uint* timeout)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+            
+            bool drop(false), retransmit(false);
+            pSourceBintr->GetRtspConfig(latency, &drop, &retransmit, 
+                protocols, bufferMode, timeout);
+            *dropOnLatency = drop;
+            *doRetransmission = retransmit;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Decode Source '" << name << "' threw exception getting RTSP config");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeRtspConfigSet(const char* name, uint latency,
+        boolean dropOnLatency, boolean doRetransmission, uint protocols, 
+        uint bufferMode, uint timeout)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->SetRtspConfig(latency, dropOnLatency, doRetransmission,
+                protocols, bufferMode, timeout))
+            {
+                LOG_ERROR("Decode Source '" << name << "' failed to set RTSP config");
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Decode Source '" << name << "' threw exception setting RTSP config");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeRtspPresetSet(const char* name, uint preset)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->SetRtspPreset(preset))
+            {
+                LOG_ERROR("Decode Source '" << name << "' failed to set RTSP preset " << preset);
+                return DSL_RESULT_SOURCE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Decode Source '" << name << "' threw exception setting RTSP preset");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeRtspStatsGet(const char* name, double* jitter,
+        uint* packetsReceived, uint* packetsLost)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+                
+            pSourceBintr->GetRtspStats(jitter, packetsReceived, packetsLost);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Decode Source '" << name << "' threw exception getting RTSP stats");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceUriSwitch(const char* name, const char* uri)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, UriSourceBintr);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->SwitchUri(uri))
+            {
+                LOG_ERROR("URI Source '" << name << "' failed to switch to URI '" << uri << "'");
+                return DSL_RESULT_SOURCE_SWITCH_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name << "' threw exception switching URI");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceUriSwitchLatencyGet(const char* name, uint* latency)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, UriSourceBintr);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+                
+            *latency = pSourceBintr->GetSwitchLatency();
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name << "' threw exception getting switch latency");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceUriPlaylistFileListenerAdd(const char* name, 
+        dsl_playlist_file_listener_cb listener, void* userdata)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, UriSourceBintr);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->AddPlaylistFileListener(listener, userdata))
+            {
+                LOG_ERROR("URI Source '" << name << "' failed to add a Playlist File Listener");
+                return DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name << "' threw exception adding a Playlist File Listener");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceUriPlaylistFileListenerRemove(const char* name, 
+        dsl_playlist_file_listener_cb listener)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, UriSourceBintr);
+
+            DSL_URI_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<UriSourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->RemovePlaylistFileListener(listener))
+            {
+                LOG_ERROR("URI Source '" << name << "' failed to remove a Playlist File Listener");
+                return DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("URI Source '" << name << "' threw exception removing a Playlist File Listener");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeDewarperAdd(const char* name, const char* dewarper)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, dewarper);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, dewarper, DewarperBintr);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+         
+            DSL_DEWARPER_PTR pDewarperBintr = 
+                std::dynamic_pointer_cast<DewarperBintr>(m_components[dewarper]);
+         
+            if (!pSourceBintr->AddDewarperBintr(pDewarperBintr))
+            {
+                LOG_ERROR("Failed to add Dewarper '" << dewarper << "' to Decode Source '" << name << "'");
+                return DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourceDecodeDewarperRemove(const char* name)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+
+            DSL_DECODE_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+         
+            if (!pSourceBintr->RemoveDewarperBintr())
+            {
+                LOG_ERROR("Failed to remove Dewarper from Decode Source '" << name << "'");
+                return DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Source '" << name << "' threw exception removing Dewarper");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SourcePause(const char* name)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->IsInUse())
+            {
+                LOG_ERROR("Source '" << name << "' can not be paused - is not in use");
+                return DSL_RESULT_SOURCE_NOT_IN_USE;
+            }
+            if (pSourceBintr->GetState() != GST_STATE_PLAYING)
+            {
+                LOG_ERROR("Source '" << name << "' can not be paused - is not in play");
+                return DSL_RESULT_SOURCE_NOT_IN_PLAY;
+            }
+            if (!pSourceBintr->SetState(GST_STATE_PAUSED))
+            {
+                LOG_ERROR("Source '" << name << "' failed to change state to paused");
+                return DSL_RESULT_SOURCE_FAILED_TO_CHANGE_STATE;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Component '" << name << "' threw exception on pause");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+
+    DslReturnType Services::SourceResume(const char* name)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+
+            DSL_SOURCE_PTR pSourceBintr = 
+                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
+                
+            if (!pSourceBintr->IsInUse())
+            {
+                LOG_ERROR("Source '" << name << "' can not be resumed - is not in use");
+                return DSL_RESULT_SOURCE_NOT_IN_USE;
+            }
+            if (pSourceBintr->GetState() != GST_STATE_PAUSED)
+            {
+                LOG_ERROR("Source '" << name << "' can not be resumed - is not in pause");
+                return DSL_RESULT_SOURCE_NOT_IN_PAUSE;
+            }
+
+            if (!pSourceBintr->SetState(GST_STATE_PLAYING))
+            {
+                LOG_ERROR("Source '" << name << "' failed to change state to play");
+                return DSL_RESULT_SOURCE_FAILED_TO_CHANGE_STATE;
+            }
+            return DSL_RESULT_SUCCESS;
+        }
+        catch(...)
+        {
+            LOG_ERROR("Component '" << name << "' threw exception on pause");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+        
+    boolean Services::SourceIsLive(const char* name)
+    {
+        LOG_FUNC();
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+
+            return std::dynamic_pointer_cast<SourceBintr>(m_components[name])->IsLive();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Component '" << name << "' threw exception on create");
+            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+        }
+    }
+    
+    uint Services::SourceNumInUseGet()
+    {
+        LOG_FUNC();
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        uint numInUse(0);
+        
+        for (auto const& imap: m_pipelines)
+        {
+            numInUse += imap.second->GetNumSourcesInUse();
+        }
+        return numInUse;
+    }
+    
+    uint Services::SourceNumInUseMaxGet()
+    {
+        LOG_FUNC();
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        return m_sourceNumInUseMax;
+    }
+    
+    boolean Services::SourceNumInUseMaxSet(uint max)
+    {
+        LOG_FUNC();
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        
+        uint numInUse(0);
+        
+        if (max < GetNumSourcesInUse())
+        {
+            LOG_ERROR("max setting = " << max << 
+                " is less than the current number of Sources in use = " << numInUse);
+            return false;
+        }
+        m_sourceNumInUseMax = max;
+        return true;
+    }
+
+    DslReturnType Services::DewarperNew(const char* name, const char* configFile)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Dewarper name '" << name << "' is not unique");
+            return DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE;
+        }
+        
+        LOG_INFO("Dewarper config file: " << configFile);
+        
+        std::ifstream ifsConfigFile(configFile);
+        if (!ifsConfigFile.good())
+        {
+            LOG_ERROR("Dewarper Config File not found");
+            return DSL_RESULT_DEWARPER_CONFIG_FILE_NOT_FOUND;
+        }
+
+        try
+        {
+            m_components[name] = DSL_DEWARPER_NEW(name, configFile);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Dewarper '" << name << "' threw exception on create");
+            return DSL_RESULT_DEWARPER_THREW_EXCEPTION;
+        }
+        LOG_INFO("new Dewarper '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::PrimaryGieNew(const char* name, const char* inferConfigFile,
+        const char* modelEngineFile, uint interval)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("GIE name '" << name << "' is not unique");
+            return DSL_RESULT_GIE_NAME_NOT_UNIQUE;
+        }
+        
+        LOG_INFO("Infer config file: " << inferConfigFile);
+        
+        std::ifstream configFile(inferConfigFile);
+        if (!configFile.good())
+        {
+            LOG_ERROR("Infer Config File not found");
+            return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+        }
+        
+        LOG_INFO("Model engine file: " << modelEngineFile);
+        
+        std::ifstream modelFile(modelEngineFile);
+        if (!modelFile.good())
+        {
+            LOG_ERROR("Model Engine File not found");
+            return DSL_RESULT_GIE_MODEL_FILE_NOT_FOUND;
+        }
+        try
+        {
+            m_components[name] = DSL_PRIMARY_GIE_NEW(name, 
+                inferConfigFile, modelEngineFile, interval);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Primary GIE '" << name << "' threw exception on create");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        LOG_INFO("new Primary GIE '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+
+    DslReturnType Services::PrimaryGieBatchMetaHandlerAdd(const char* name, uint pad, dsl_batch_meta_handler_cb handler, void* user_data)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        if (pad > DSL_PAD_SRC)
+        {
+            LOG_ERROR("Invalid Pad type = " << pad << " for Primary GIE '" << name << "'");
+            return DSL_RESULT_GIE_PAD_TYPE_INVALID;
+        }
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
+
+            if (!pPrimaryGieBintr->AddBatchMetaHandler(pad, handler, user_data))
+            {
+                LOG_ERROR("Primary GIE '" << name << "' failed to add a Batch Meta Handler");
+                return DSL_RESULT_GIE_HANDLER_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Primary GIE '" << name << "' threw an exception adding Batch Meta Handler");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PrimaryGieBatchMetaHandlerRemove(const char* name, 
+        uint pad, dsl_batch_meta_handler_cb handler)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        if (pad > DSL_PAD_SRC)
+        {
+            LOG_ERROR("Invalid Pad type = " << pad << " for Primary GIE '" << name << "'");
+            return DSL_RESULT_GIE_PAD_TYPE_INVALID;
+        }
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
+
+            if (!pPrimaryGieBintr->RemoveBatchMetaHandler(pad, handler))
+            {
+                LOG_ERROR("Primary GIE '" << name << "' has no matching Batch Meta Handler");
+                return DSL_RESULT_GIE_HANDLER_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Primary GIE '" << name << "' threw an exception removing Batch Meta Handle");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType  Services::PrimaryGieKittiOutputEnabledSet(const char* name, boolean enabled,
+        const char* file)    
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            
+            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
+
+            if (!pPrimaryGieBintr->SetKittiOutputEnabled(enabled, file))
+            {
+                LOG_ERROR("Invalid Kitti file path " << file << "for Primary GIE '" << name << "'");
+                return DSL_RESULT_GIE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Primary GIE '" << name << "' threw an exception setting Kitti output enabled");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+        
+    DslReturnType Services::SecondaryGieNew(const char* name, const char* inferConfigFile,
+        const char* modelEngineFile, const char* inferOnGieName, uint interval)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("GIE name '" << name << "' is not unique");
+            return DSL_RESULT_GIE_NAME_NOT_UNIQUE;
+        }
+        
+        LOG_INFO("Infer config file: " << inferConfigFile);
+        
+        std::ifstream configFile(inferConfigFile);
+        if (!configFile.good())
+        {
+            LOG_ERROR("Infer Config File not found");
+            return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+        }
+        
+        LOG_INFO("Model engine file: " << modelEngineFile);
+        
+        std::ifstream modelFile(modelEngineFile);
+        if (!modelFile.good())
+        {
+            LOG_ERROR("Model Engine File not found");
+            return DSL_RESULT_GIE_MODEL_FILE_NOT_FOUND;
+        }
+        try
+        {
+            m_components[name] = DSL_SECONDARY_GIE_NEW(name, 
+                inferConfigFile, modelEngineFile, inferOnGieName, interval);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Primary GIE '" << name << "' threw exception on create");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        LOG_INFO("new Secondary GIE '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::GieRawOutputEnabledSet(const char* name, boolean enabled,
+        const char* path)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+                
+            if (!pGieBintr->SetRawOutputEnabled(enabled, path))
+            {
+                LOG_ERROR("GIE '" << name << "' failed to enable raw output");
+                return DSL_RESULT_GIE_OUTPUT_DIR_DOES_NOT_EXIST;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("GIE '" << name << "' threw exception on raw output enabled set");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::GieInferConfigFileGet(const char* name, const char** inferConfigFile)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+
+            *inferConfigFile = pGieBintr->GetInferConfigFile();
+        }
+        catch(...)
+        {
+            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::GieInferConfigFileSet(const char* name, const char* inferConfigFile)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+
+            if (!pGieBintr->SetInferConfigFile(inferConfigFile))
+            {
+                LOG_ERROR("GIE '" << name << "' failed to set the Infer Config file");
+                return DSL_RESULT_GIE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::GieModelEngineFileGet(const char* name, const char** inferConfigFile)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+
+            *inferConfigFile = pGieBintr->GetModelEngineFile();
+        }
+        catch(...)
+        {
+            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::GieModelEngineFileSet(const char* name, const char* inferConfigFile)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+
+            if (!pGieBintr->SetModelEngineFile(inferConfigFile))
+            {
+                LOG_ERROR("GIE '" << name << "' failed to set the Infer Config file");
+                return DSL_RESULT_GIE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::GieIntervalGet(const char* name, uint* interval)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+
+            *interval = pGieBintr->GetInterval();
+        }
+        catch(...)
+        {
+            LOG_ERROR("GIE '" << name << "' threw an exception adding Batch Meta Handler");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::GieIntervalSet(const char* name, uint interval)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
+            
+            DSL_GIE_PTR pGieBintr = 
+                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+
+            if (!pGieBintr->SetInterval(interval))
+            {
+                LOG_ERROR("GIE '" << name << "' failed to set new Interval");
+                return DSL_RESULT_GIE_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("GIE '" << name << "' threw an exception setting Interval");
+            return DSL_RESULT_GIE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TrackerKtlNew(const char* name, uint width, uint height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("KTL Tracker name '" << name << "' is not unique");
+            return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = std::shared_ptr<Bintr>(new KtlTrackerBintr(
+                name, width, height));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("KTL Tracker '" << name << "' threw exception on create");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+        }
+        LOG_INFO("New KTL Tracker '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::TrackerIouNew(const char* name, const char* configFile, 
+        uint width, uint height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("IOU Tracker name '" << name << "' is not unique");
+            return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
+        }
+        LOG_INFO("Infer config file: " << configFile);
+        
+        std::ifstream streamConfigFile(configFile);
+        if (!streamConfigFile.good())
+        {
+            LOG_ERROR("Infer Config File not found");
+            return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+        }
+        try
+        {
+            m_components[name] = std::shared_ptr<Bintr>(new IouTrackerBintr(
+                name, configFile, width, height));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("IOU Tracker '" << name << "' threw exception on create");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+        }
+        LOG_INFO("New IOU Tracker '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+   
+       DslReturnType Services::TrackerMaxDimensionsGet(const char* name, uint* width, uint* height)
+    {
+        LOG_FUNC();
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+
+            DSL_TRACKER_PTR trackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            trackerBintr->GetMaxDimensions(width, height);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tracker '" << name << "' threw an exception getting dimensions");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TrackerMaxDimensionsSet(const char* name, uint width, uint height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set Max Dimensions for Tracker '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_TILER_IS_IN_USE;
+            }
+
+            DSL_TRACKER_PTR trackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!trackerBintr->SetMaxDimensions(width, height))
+            {
+                LOG_ERROR("Tracker '" << name << "' failed to set dimensions");
+                return DSL_RESULT_TRACKER_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tracker '" << name << "' threw an exception setting dimensions");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TrackerBatchMetaHandlerAdd(const char* name, uint pad, 
+        dsl_batch_meta_handler_cb handler, void* user_data)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        if (pad > DSL_PAD_SRC)
+        {
+            LOG_ERROR("Invalid Pad type = " << pad << " for Tracker '" << name << "'");
+            return DSL_RESULT_TRACKER_PAD_TYPE_INVALID;
+        }
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+
+            DSL_TRACKER_PTR pTrackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            if (!pTrackerBintr->AddBatchMetaHandler(pad, handler, user_data))
+            {
+                LOG_ERROR("Tracker '" << name << "' failed to add Batch Meta Handler");
+                return DSL_RESULT_TRACKER_HANDLER_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tracker '" << name << "' threw an exception adding Batch Meta Handler");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TrackerBatchMetaHandlerRemove(const char* name, 
+        uint pad, dsl_batch_meta_handler_cb handler)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        if (pad > DSL_PAD_SRC)
+        {
+            LOG_ERROR("Invalid Pad type = " << pad << " for Tracker '" << name << "'");
+            return DSL_RESULT_TRACKER_PAD_TYPE_INVALID;
+        }
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+
+            DSL_TRACKER_PTR pTrackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            if (!pTrackerBintr->RemoveBatchMetaHandler(pad, handler))
+            {
+                LOG_ERROR("Tracker '" << name << "' has no matching Batch Meta Handler");
+                return DSL_RESULT_TRACKER_HANDLER_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tracker '" << name << "' threw an exception removing Batch Meta Handle");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+   
+    DslReturnType  Services::TrackerKittiOutputEnabledSet(const char* name, boolean enabled,
+        const char* file)    
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            
+            DSL_TRACKER_PTR pTrackerBintr = 
+                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+
+            if (!pTrackerBintr->SetKittiOutputEnabled(enabled, file))
+            {
+                LOG_ERROR("Invalid Kitti file path " << file << "for Tracker '" << name << "'");
+                return DSL_RESULT_TRACKER_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tracker '" << name << "' threw an exception setting Kitti output enabled");
+            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+        
+    DslReturnType Services::TeeDemuxerNew(const char* name)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Demuxer Tee name '" << name << "' is not unique");
+            return DSL_RESULT_TEE_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = std::shared_ptr<Bintr>(new DemuxerBintr(name));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Demuxer Tee '" << name << "' threw exception on create");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
+        }
+        LOG_INFO("New Demuxer Tee '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TeeSplitterNew(const char* name)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Splitter Tee name '" << name << "' is not unique");
+            return DSL_RESULT_TILER_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = std::shared_ptr<Bintr>(new SplitterBintr(name));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Splitter Tee '" << name << "' threw exception on create");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
+        }
+        LOG_INFO("New Splitter Tee '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::TeeBranchAdd(const char* tee, 
+        const char* branch)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
+            RETURN_IF_COMPONENT_IS_NOT_BRANCH(m_components, branch);
+            
+            // Can't add components if they're In use by another Branch
+            if (m_components[branch]->IsInUse())
+            {
+                LOG_ERROR("Unable to add branch '" << branch 
+                    << "' as it's currently in use");
+                return DSL_RESULT_COMPONENT_IN_USE;
+            }
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+
+            // Cast the Branch to a Bintr to call the correct AddChile method.
+            DSL_BINTR_PTR pBranchBintr = 
+                std::dynamic_pointer_cast<Bintr>(m_components[branch]);
+
+            if (!pTeeBintr->AddChild(pBranchBintr))
+            {
+                LOG_ERROR("Tee '" << tee << 
+                    "' failed to add branch '" << branch << "'");
+                return DSL_RESULT_TEE_BRANCH_ADD_FAILED;
+            }
+
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tee '" << tee 
+                << "' threw an exception removing branch '" << branch << "'");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
+        }
+        LOG_INFO("Branch '" << branch 
+            << "' was added to Tee '" << tee << "' successfully");
+        TransactionEditRecord(DSL_TRANSACTION_EDIT_TEE_BRANCH_ADD, tee, branch);
+        return DSL_RESULT_SUCCESS;
+    }    
+    
+    DslReturnType Services::TeeBranchRemove(const char* tee, 
+        const char* branch)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
+            RETURN_IF_BRANCH_NAME_NOT_FOUND(m_components, branch);
+
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+
+            if (!pTeeBintr->IsChild(m_components[branch]))
+            {
+                LOG_ERROR("Branch '" << branch << 
+                    "' is not in use by Tee '" << tee << "'");
+                return DSL_RESULT_TEE_BRANCH_IS_NOT_CHILD;
+            }
+
+            // Cast the Branch to a Bintr to call the correct AddChile method.
+            DSL_BINTR_PTR pBranchBintr = 
+                std::dynamic_pointer_cast<Bintr>(m_components[branch]);
+
+            if (!pTeeBintr->RemoveChild(pBranchBintr))
+            {
+                LOG_ERROR("Tee '" << tee << 
+                    "' failed to remove branch '" << branch << "'");
+                return DSL_RESULT_TEE_BRANCH_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tee '" << tee 
+                << "' threw an exception removing branch '" << branch << "'");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
+        }
+        TransactionEditRecord(DSL_TRANSACTION_EDIT_TEE_BRANCH_REMOVE, tee, branch);
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TeeBranchRemoveAll(const char* tee)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
+
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+//            m_components[tee]->RemoveAll();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tee '" <<  tee
+                << "' threw an exception removing all branches");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TeeBranchCountGet(const char* tee, uint* count)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, tee);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
+
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+
+            *count = pTeeBintr->GetNumChildren();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tee '" <<  tee
+                << "' threw an exception getting branch count");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TeeBatchMetaHandlerAdd(const char* name, 
+        dsl_batch_meta_handler_cb handler, void* user_data)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, name);
+
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[name]);
+
+            if (!pTeeBintr->AddBatchMetaHandler(DSL_PAD_SINK, handler, user_data))
+            {
+                LOG_ERROR("Tee '" << name << "' failed to add Batch Meta Handler");
+                return DSL_RESULT_TILER_HANDLER_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception adding Batch Meta Handler");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TeeBatchMetaHandlerRemove(const char* name, 
+        dsl_batch_meta_handler_cb handler)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, name);
+
+            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[name]);
+
+            if (!pTeeBintr->RemoveBatchMetaHandler(DSL_PAD_SINK, handler))
+            {
+                LOG_ERROR("Tee '" << name << "' has no matching Batch Meta Handler");
+                return DSL_RESULT_TEE_HANDLER_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tee '" << name << "' threw an exception removing Batch Meta Handle");
+            return DSL_RESULT_TEE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::TilerNew(const char* name, uint width, uint height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Tiler name '" << name << "' is not unique");
+            return DSL_RESULT_TILER_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = std::shared_ptr<Bintr>(new TilerBintr(
+                name, width, height));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Tiler'" << name << "' threw exception on create");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        LOG_INFO("New Tiler '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TilerDimensionsGet(const char* name, uint* width, uint* height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            tilerBintr->GetDimensions(width, height);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception getting dimensions");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TilerDimensionsSet(const char* name, uint width, uint height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set Dimensions for Tiler '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_TILER_IS_IN_USE;
+            }
+
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!tilerBintr->SetDimensions(width, height))
+            {
+                LOG_ERROR("Tiler '" << name << "' failed to settin dimensions");
+                return DSL_RESULT_TILER_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception setting dimensions");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TilerTilesGet(const char* name, uint* cols, uint* rows)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            tilerBintr->GetTiles(cols, rows);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception getting Tiles");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TilerTilesSet(const char* name, uint cols, uint rows)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set Tiles for Tiler '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_TILER_IS_IN_USE;
+            }
+
+            DSL_TILER_PTR tilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!tilerBintr->SetTiles(cols, rows))
+            {
+                LOG_ERROR("Tiler '" << name << "' failed to set Tiles");
+                return DSL_RESULT_TILER_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception setting Tiles");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TilerDimensionsGet(DslHandle tiler, uint* width, uint* height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(m_componentSlots, m_componentSlotGenerations, tiler);
+
+        uint slot = DSL_HANDLE_SLOT(tiler);
+        try
+        {
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_componentSlots, slot);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_componentSlots, slot, TilerBintr);
+
+            std::static_pointer_cast<TilerBintr>(
+                m_componentSlots[slot])->GetDimensions(width, height);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << m_componentSlots[slot]->GetName() 
+                << "' threw an exception getting dimensions");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TilerDimensionsSet(DslHandle tiler, uint width, uint height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(m_componentSlots, m_componentSlotGenerations, tiler);
+
+        uint slot = DSL_HANDLE_SLOT(tiler);
+        try
+        {
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_componentSlots, slot);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_componentSlots, slot, TilerBintr);
+
+            if (m_componentSlots[slot]->IsInUse())
+            {
+                LOG_ERROR("Unable to set Dimensions for Tiler '" << m_componentSlots[slot]->GetName() 
+                    << "' as it's currently in use");
+                return DSL_RESULT_TILER_IS_IN_USE;
+            }
+            if (!std::static_pointer_cast<TilerBintr>(
+                m_componentSlots[slot])->SetDimensions(width, height))
+            {
+                LOG_ERROR("Tiler '" << m_componentSlots[slot]->GetName() 
+                    << "' failed to set Dimensions");
+                return DSL_RESULT_TILER_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << m_componentSlots[slot]->GetName() 
+                << "' threw an exception setting dimensions");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
 
-const wchar_t* dsl_version_get()
-{
-    return DSL_VERSION;
-}
+    DslReturnType Services::TilerTilesGet(DslHandle tiler, uint* cols, uint* rows)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(m_componentSlots, m_componentSlotGenerations, tiler);
 
-namespace DSL
-{
-    // Initialize the Services's single instance pointer
-    Services* Services::m_pInstatnce = NULL;
+        uint slot = DSL_HANDLE_SLOT(tiler);
+        try
+        {
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_componentSlots, slot);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_componentSlots, slot, TilerBintr);
 
-    Services* Services::GetServices()
+            std::static_pointer_cast<TilerBintr>(
+                m_componentSlots[slot])->GetTiles(cols, rows);
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << m_componentSlots[slot]->GetName() 
+                << "' threw an exception getting Tiles");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::TilerTilesSet(DslHandle tiler, uint cols, uint rows)
     {
-        // one time initialization of the single instance pointer
-        if (!m_pInstatnce)
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(m_componentSlots, m_componentSlotGenerations, tiler);
+
+        uint slot = DSL_HANDLE_SLOT(tiler);
+        try
         {
-            boolean doGstDeinit(false);
-        
-            // If gst has not been initialized by the client software
-            if (!gst_is_initialized())
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_componentSlots, slot);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_componentSlots, slot, TilerBintr);
+
+            if (m_componentSlots[slot]->IsInUse())
             {
-                int argc = 0;
-                char** argv = NULL;
-                
-                // initialize the GStreamer library
-                gst_init(&argc, &argv);
-                doGstDeinit = true;
+                LOG_ERROR("Unable to set Tiles for Tiler '" << m_componentSlots[slot]->GetName() 
+                    << "' as it's currently in use");
+                return DSL_RESULT_TILER_IS_IN_USE;
+            }
+            if (!std::static_pointer_cast<TilerBintr>(
+                m_componentSlots[slot])->SetTiles(cols, rows))
+            {
+                LOG_ERROR("Tiler '" << m_componentSlots[slot]->GetName() 
+                    << "' failed to set Tiles");
+                return DSL_RESULT_TILER_SET_FAILED;
             }
-            // Initialize the single debug category used by the lib
-            GST_DEBUG_CATEGORY_INIT(GST_CAT_DSL, "DSL", 0, "DeepStream Services");
-            
-            // Safe to start logging
-            LOG_INFO("Services Initialization");
-            
-            // Single instantiation for the lib's lifetime
-            m_pInstatnce = new Services(doGstDeinit);
-            m_pInstatnce->InitToStringMaps();
         }
-        return m_pInstatnce;
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << m_componentSlots[slot]->GetName() 
+                << "' threw an exception setting Tiles");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
     }
-        
-    Services::Services(bool doGstDeinit)
-        : m_doGstDeinit(doGstDeinit)
-        , m_pMainLoop(g_main_loop_new(NULL, FALSE))
-        , m_sourceNumInUseMax(DSL_DEFAULT_SOURCE_IN_USE_MAX)
-        , m_sinkNumInUseMax(DSL_DEFAULT_SINK_IN_USE_MAX)
+
+    DslReturnType Services::TilerBatchMetaHandlerAdd(const char* name, uint pad, 
+        dsl_batch_meta_handler_cb handler, void* user_data)
     {
         LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         
-        g_mutex_init(&m_servicesMutex);
+        if (pad > DSL_PAD_SRC)
+        {
+            LOG_ERROR("Invalid Pad type = " << pad << " for Tiler '" << name << "'");
+            return DSL_RESULT_TILER_PAD_TYPE_INVALID;
+        }
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR pTilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            if (!pTilerBintr->AddBatchMetaHandler(pad, handler, user_data))
+            {
+                LOG_ERROR("Tiler '" << name << "' failed to add Batch Meta Handler");
+                return DSL_RESULT_TILER_HANDLER_ADD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception adding Batch Meta Handler");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
     }
 
-    Services::~Services()
+    DslReturnType Services::TilerBatchMetaHandlerRemove(const char* name, 
+        uint pad, dsl_batch_meta_handler_cb handler)
     {
         LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
         
+        if (pad > DSL_PAD_SRC)
         {
-            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-            
-            // If this Services object called gst_init(), and not the client.
-            if (m_doGstDeinit)
-            {
-                gst_deinit();
-            }
-            
-            if (m_pMainLoop)
+            LOG_ERROR("Invalid Pad type = " << pad << " for Tiler '" << name << "'");
+            return DSL_RESULT_TILER_PAD_TYPE_INVALID;
+        }
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
+
+            DSL_TILER_PTR pTilerBintr = 
+                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+
+            if (!pTilerBintr->RemoveBatchMetaHandler(pad, handler))
             {
-                g_main_loop_unref(m_pMainLoop);
+                LOG_ERROR("Tiler '" << name << "' has no matching Batch Meta Handler");
+                return DSL_RESULT_TILER_HANDLER_REMOVE_FAILED;
             }
         }
-        g_mutex_clear(&m_servicesMutex);
+        catch(...)
+        {
+            LOG_ERROR("Tiler '" << name << "' threw an exception removing Batch Meta Handle");
+            return DSL_RESULT_TILER_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::SourceCsiNew(const char* name,
-        uint width, uint height, uint fps_n, uint fps_d)
+   
+    DslReturnType Services::OfvNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
 
         // ensure component name uniqueness 
         if (m_components.find(name) != m_components.end())
         {   
-            LOG_ERROR("Source name '" << name << "' is not unique");
-            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+            LOG_ERROR("OFV name '" << name << "' is not unique");
+            return DSL_RESULT_OFV_NAME_NOT_UNIQUE;
         }
         try
-        {
-            m_components[name] = DSL_CSI_SOURCE_NEW(name, width, height, fps_n, fps_d);
+        {   
+            m_components[name] = std::shared_ptr<Bintr>(new OfvBintr(name));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
         }
         catch(...)
         {
-            LOG_ERROR("New CSI Source '" << name << "' threw exception on create");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("New OFV '" << name << "' threw exception on create");
+            return DSL_RESULT_OFV_THREW_EXCEPTION;
         }
-        LOG_INFO("new CSI Source '" << name << "' created successfully");
+        LOG_INFO("new OFV '" << name << "' created successfully");
 
         return DSL_RESULT_SUCCESS;
     }
     
-    DslReturnType Services::SourceUsbNew(const char* name,
-        uint width, uint height, uint fps_n, uint fps_d)
+    DslReturnType Services::OsdNew(const char* name, boolean isClockEnabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
 
         // ensure component name uniqueness 
         if (m_components.find(name) != m_components.end())
         {   
-            LOG_ERROR("Source name '" << name << "' is not unique");
-            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+            LOG_ERROR("OSD name '" << name << "' is not unique");
+            return DSL_RESULT_OSD_NAME_NOT_UNIQUE;
         }
         try
-        {
-            m_components[name] = DSL_USB_SOURCE_NEW(name, width, height, fps_n, fps_d);
+        {   
+            m_components[name] = std::shared_ptr<Bintr>(new OsdBintr(
+                name, isClockEnabled));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
         }
         catch(...)
         {
-            LOG_ERROR("New USB Source '" << name << "' threw exception on create");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("New OSD '" << name << "' threw exception on create");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
-        LOG_INFO("new USB Source '" << name << "' created successfully");
+        LOG_INFO("new OSD '" << name << "' created successfully");
 
         return DSL_RESULT_SUCCESS;
     }
     
-    DslReturnType Services::SourceUriNew(const char* name, const char* uri, 
-        boolean isLive, uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
+    DslReturnType Services::OsdClockEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Source name '" << name << "' is not unique");
-            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            osdBintr->GetClockEnabled(enabled);
         }
-        std::string stringUri(uri);
-        if (stringUri.find("http") == std::string::npos)
+        catch(...)
         {
-            if (isLive)
+            LOG_ERROR("OSD '" << name << "' threw an exception getting clock enabled");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::OsdClockEnabledSet(const char* name, boolean enabled)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
+        {
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            if (m_components[name]->IsInUse())
             {
-                LOG_ERROR("Invalid URI '" << uri << "' for Live source '" << name << "'");
-                return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+                LOG_ERROR("Unable to set The clock enabled setting for the OSD '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_OSD_IS_IN_USE;
             }
-            std::ifstream streamUriFile(uri);
-            if (!streamUriFile.good())
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetClockEnabled(enabled))
             {
-                LOG_ERROR("URI Source'" << uri << "' Not found");
-                return DSL_RESULT_SOURCE_FILE_NOT_FOUND;
+                LOG_ERROR("OSD '" << name << "' failed to set Clock enabled");
+                return DSL_RESULT_OSD_SET_FAILED;
             }
         }
+        catch(...)
+        {
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock enabled");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::OsdClockOffsetsGet(const char* name, uint* offsetX, uint* offsetY)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
-            m_components[name] = DSL_URI_SOURCE_NEW(
-                name, uri, isLive, cudadecMemType, intraDecode, dropFrameInterval);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            osdBintr->GetClockOffsets(offsetX, offsetY);
         }
         catch(...)
         {
-            LOG_ERROR("New URI Source '" << name << "' threw exception on create");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception getting clock offsets");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
-        LOG_INFO("new URI Source '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::SourceRtspNew(const char* name, const char* uri, 
-        uint protocol, uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
+    DslReturnType Services::OsdClockOffsetsSet(const char* name, uint offsetX, uint offsetY)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Source name '" << name << "' is not unique");
-            return DSL_RESULT_SOURCE_NAME_NOT_UNIQUE;
-        }
         try
         {
-            m_components[name] = DSL_RTSP_SOURCE_NEW(
-                name, uri, protocol, cudadecMemType, intraDecode, dropFrameInterval);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set The clock offsets for the OSD '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_OSD_IS_IN_USE;
+            }
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetClockOffsets(offsetX, offsetY))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to set Clock offsets");
+                return DSL_RESULT_OSD_SET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("New RTSP Source '" << name << "' threw exception on create");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
-        LOG_INFO("new RTSP Source '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::SourceDimensionsGet(const char* name, uint* width, uint* height)
+    DslReturnType Services::OsdClockFontGet(const char* name, const char** font, uint* size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
-            
-            DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
-         
-            pSourceBintr->GetDimensions(width, height);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            osdBintr->GetClockFont(font, size);
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception getting dimensions");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception getting clock font");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
-    }                
-    
-    DslReturnType Services::SourceFrameRateGet(const char* name, uint* fps_n, uint* fps_d)
+    }
+
+    DslReturnType Services::OsdClockFontSet(const char* name, const char* font, uint size)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
-            
-            DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
-         
-            pSourceBintr->GetFrameRate(fps_n, fps_d);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set The clock offsets for the OSD '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_OSD_IS_IN_USE;
+            }
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetClockFont(font, size))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to set Clock font");
+                return DSL_RESULT_OSD_SET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception getting dimensions");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::SourceDecodeUriGet(const char* name, const char** uri)
+
+    DslReturnType Services::OsdClockColorGet(const char* name, double* red, double* green, double* blue, double* alpha)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
 
-            DSL_DECODE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
 
-            *uri = pSourceBintr->GetUri();
+            osdBintr->GetClockColor(red, green, blue, alpha);
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception getting clock font");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-            
 
-    DslReturnType Services::SourceDecodeUriSet(const char* name, const char* uri)
+    DslReturnType Services::OsdClockColorSet(const char* name, double red, double green, double blue, double alpha)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
 
-            DSL_DECODE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
+            if (m_components[name]->IsInUse())
+            {
+                LOG_ERROR("Unable to set The clock RGB colors for the OSD '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_OSD_IS_IN_USE;
+            }
 
-            if (!pSourceBintr->SetUri(uri));
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetClockColor(red, green, blue, alpha))
             {
-                LOG_ERROR("Failed to Set URI '" << uri << "' for Decode Source '" << name << "'");
-                return DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED;
+                LOG_ERROR("OSD '" << name << "' failed to set Clock RGB colors");
+                return DSL_RESULT_OSD_SET_FAILED;
             }
-            
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SourceDecodeDewarperAdd(const char* name, const char* dewarper)
+    
+    DslReturnType Services::OsdCropSettingsGet(const char* name, uint* left, uint* top, uint* width, uint* height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, dewarper);
-            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, dewarper, DewarperBintr);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
 
-            DSL_DECODE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
-         
-            DSL_DEWARPER_PTR pDewarperBintr = 
-                std::dynamic_pointer_cast<DewarperBintr>(m_components[dewarper]);
-         
-            if (!pSourceBintr->AddDewarperBintr(pDewarperBintr))
-            {
-                LOG_ERROR("Failed to add Dewarper '" << dewarper << "' to Decode Source '" << name << "'");
-                return DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED;
-            }
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            osdBintr->GetCropSettings(left, top, width, height);
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception adding Dewarper");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception getting crop settings");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::SourceDecodeDewarperRemove(const char* name)
+
+    DslReturnType Services::OsdCropSettingsSet(const char* name, uint left, uint top, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_DECODE_SOURCE(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
 
-            DSL_DECODE_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<DecodeSourceBintr>(m_components[name]);
-         
-            if (!pSourceBintr->RemoveDewarperBintr())
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            // TODO verify args before calling
+            if (!osdBintr->SetCropSettings(left, top, width, height))
             {
-                LOG_ERROR("Failed to remove Dewarper from Decode Source '" << name << "'");
-                return DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED;
+                LOG_ERROR("OSD '" << name << "' failed to set crop settings");
+                return DSL_RESULT_OSD_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Source '" << name << "' threw exception removing Dewarper");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception setting crop settings");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::SourcePause(const char* name)
+
+    DslReturnType Services::OsdRedactionEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
 
-            DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
-                
-            if (!pSourceBintr->IsInUse())
-            {
-                LOG_ERROR("Source '" << name << "' can not be paused - is not in use");
-                return DSL_RESULT_SOURCE_NOT_IN_USE;
-            }
-            if (pSourceBintr->GetState() != GST_STATE_PLAYING)
-            {
-                LOG_ERROR("Source '" << name << "' can not be paused - is not in play");
-                return DSL_RESULT_SOURCE_NOT_IN_PLAY;
-            }
-            if (!pSourceBintr->SetState(GST_STATE_PAUSED))
-            {
-                LOG_ERROR("Source '" << name << "' failed to change state to paused");
-                return DSL_RESULT_SOURCE_FAILED_TO_CHANGE_STATE;
-            }
-            return DSL_RESULT_SUCCESS;
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            *enabled = osdBintr->GetRedactionEnabled();
         }
         catch(...)
         {
-            LOG_ERROR("Component '" << name << "' threw exception on pause");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception getting Redaction enabled");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
+        return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::SourceResume(const char* name)
+    DslReturnType Services::OsdRedactionEnabledSet(const char* name, boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
 
-            DSL_SOURCE_PTR pSourceBintr = 
-                std::dynamic_pointer_cast<SourceBintr>(m_components[name]);
-                
-            if (!pSourceBintr->IsInUse())
-            {
-                LOG_ERROR("Source '" << name << "' can not be resumed - is not in use");
-                return DSL_RESULT_SOURCE_NOT_IN_USE;
-            }
-            if (pSourceBintr->GetState() != GST_STATE_PAUSED)
-            {
-                LOG_ERROR("Source '" << name << "' can not be resumed - is not in pause");
-                return DSL_RESULT_SOURCE_NOT_IN_PAUSE;
-            }
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
 
-            if (!pSourceBintr->SetState(GST_STATE_PLAYING))
+            if (!osdBintr->SetRedactionEnabled(enabled))
             {
-                LOG_ERROR("Source '" << name << "' failed to change state to play");
-                return DSL_RESULT_SOURCE_FAILED_TO_CHANGE_STATE;
+                LOG_ERROR("OSD '" << name << "' failed to set Redaction enabled");
+                return DSL_RESULT_OSD_SET_FAILED;
             }
-            return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Component '" << name << "' threw exception on pause");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception setting Redaction enabled");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
+        return DSL_RESULT_SUCCESS;
     }
-        
-    boolean Services::SourceIsLive(const char* name)
+    
+    DslReturnType Services::OsdRedactionClassAdd(const char* name, int classId, 
+        double red, double green, double blue, double alpha)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_SOURCE(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
 
-            return std::dynamic_pointer_cast<SourceBintr>(m_components[name])->IsLive();
+            if (red > 1.0 or green > 1.0 or blue > 1.0 or alpha > 1.0)
+            {
+                LOG_ERROR("Invalid Redaction color param passed to OSD '" << name << "'");
+                return DSL_RESULT_OSD_COLOR_PARAM_INVALID;
+            }
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            if (!osdBintr->AddRedactionClass(classId, red, green, blue, alpha))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to add Redaction Class");
+                return DSL_RESULT_OSD_REDACTION_CLASS_ADD_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("Component '" << name << "' threw exception on create");
-            return DSL_RESULT_SOURCE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception adding Redaction Class");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
+        return DSL_RESULT_SUCCESS;
     }
     
-    uint Services::SourceNumInUseGet()
+    DslReturnType Services::OsdRedactionClassRemove(const char* name, int classId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
-        uint numInUse(0);
-        
-        for (auto const& imap: m_pipelines)
+        try
         {
-            numInUse += imap.second->GetNumSourcesInUse();
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR osdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            if (!osdBintr->RemoveRedactionClass(classId))
+            {
+                LOG_ERROR("OSD '" << name << "' failed to remove Redaction Class");
+                return DSL_RESULT_OSD_REDACTION_CLASS_REMOVE_FAILED;
+            }
         }
-        return numInUse;
-    }
-    
-    uint Services::SourceNumInUseMaxGet()
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        return m_sourceNumInUseMax;
-    }
-    
-    boolean Services::SourceNumInUseMaxSet(uint max)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        uint numInUse(0);
-        
-        if (max < GetNumSourcesInUse())
+        catch(...)
         {
-            LOG_ERROR("max setting = " << max << 
-                " is less than the current number of Sources in use = " << numInUse);
-            return false;
+            LOG_ERROR("OSD '" << name << "' threw an exception removing Redaction Class");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
-        m_sourceNumInUseMax = max;
-        return true;
+        return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::DewarperNew(const char* name, const char* configFile)
+    DslReturnType Services::OsdBatchMetaHandlerAdd(const char* name, uint pad, 
+        dsl_batch_meta_handler_cb handler, void* user_data)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Dewarper name '" << name << "' is not unique");
-            return DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE;
-        }
-        
-        LOG_INFO("Dewarper config file: " << configFile);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         
-        std::ifstream ifsConfigFile(configFile);
-        if (!ifsConfigFile.good())
+        if (pad > DSL_PAD_SRC)
         {
-            LOG_ERROR("Dewarper Config File not found");
-            return DSL_RESULT_DEWARPER_CONFIG_FILE_NOT_FOUND;
+            LOG_ERROR("Invalid Pad type = " << pad << " for OSD '" << name << "'");
+            return DSL_RESULT_OSD_PAD_TYPE_INVALID;
         }
-
         try
         {
-            m_components[name] = DSL_DEWARPER_NEW(name, configFile);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR pOsdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            if (!pOsdBintr->AddBatchMetaHandler(pad, handler, user_data))
+            {
+                LOG_ERROR("OSD '" << name << "' already has a Batch Meta Handler");
+                return DSL_RESULT_OSD_HANDLER_ADD_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("New Dewarper '" << name << "' threw exception on create");
-            return DSL_RESULT_DEWARPER_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception adding Batch Meta Handler");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
-        LOG_INFO("new Dewarper '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::PrimaryGieNew(const char* name, const char* inferConfigFile,
-        const char* modelEngineFile, uint interval)
+
+    DslReturnType Services::OsdBatchMetaHandlerRemove(const char* name, 
+        uint pad, dsl_batch_meta_handler_cb handler)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("GIE name '" << name << "' is not unique");
-            return DSL_RESULT_GIE_NAME_NOT_UNIQUE;
-        }
-        
-        LOG_INFO("Infer config file: " << inferConfigFile);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         
-        std::ifstream configFile(inferConfigFile);
-        if (!configFile.good())
-        {
-            LOG_ERROR("Infer Config File not found");
-            return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
-        }
-        
-        LOG_INFO("Model engine file: " << modelEngineFile);
-        
-        std::ifstream modelFile(modelEngineFile);
-        if (!modelFile.good())
+        if (pad > DSL_PAD_SRC)
         {
-            LOG_ERROR("Model Engine File not found");
-            return DSL_RESULT_GIE_MODEL_FILE_NOT_FOUND;
+            LOG_ERROR("Invalid Pad type = " << pad << " for OSD '" << name << "'");
+            return DSL_RESULT_OSD_PAD_TYPE_INVALID;
         }
         try
         {
-            m_components[name] = DSL_PRIMARY_GIE_NEW(name, 
-                inferConfigFile, modelEngineFile, interval);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+
+            DSL_OSD_PTR pOsdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+
+            if (!pOsdBintr->RemoveBatchMetaHandler(pad, handler))
+            {
+                LOG_ERROR("OSD '" << name << "' has no Batch Meta Handler");
+                return DSL_RESULT_OSD_HANDLER_REMOVE_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("New Primary GIE '" << name << "' threw exception on create");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception removing Batch Meta Handle");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
-        LOG_INFO("new Primary GIE '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
 
-
-    DslReturnType Services::PrimaryGieBatchMetaHandlerAdd(const char* name, uint pad, dsl_batch_meta_handler_cb handler, void* user_data)
+    DslReturnType  Services::OsdKittiOutputEnabledSet(const char* name, boolean enabled,
+        const char* file)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (pad > DSL_PAD_SRC)
-        {
-            LOG_ERROR("Invalid Pad type = " << pad << " for Primary GIE '" << name << "'");
-            return DSL_RESULT_GIE_PAD_TYPE_INVALID;
-        }
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
             
-            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
-                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
+            DSL_OSD_PTR pOsdBintr = 
+                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
 
-            if (!pPrimaryGieBintr->AddBatchMetaHandler(pad, handler, user_data))
+            if (!pOsdBintr->SetKittiOutputEnabled(enabled, file))
             {
-                LOG_ERROR("Primary GIE '" << name << "' failed to add a Batch Meta Handler");
-                return DSL_RESULT_GIE_HANDLER_ADD_FAILED;
+                LOG_ERROR("Invalid Kitti file path " << file << "for Tracker '" << name << "'");
+                return DSL_RESULT_OSD_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Primary GIE '" << name << "' threw an exception adding Batch Meta Handler");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("Tracker '" << name << "' threw an exception setting Kitti output enabled");
+            return DSL_RESULT_OSD_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PrimaryGieBatchMetaHandlerRemove(const char* name, 
-        uint pad, dsl_batch_meta_handler_cb handler)
+   
+    DslReturnType Services::SinkFakeNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (pad > DSL_PAD_SRC)
-        {
-            LOG_ERROR("Invalid Pad type = " << pad << " for Primary GIE '" << name << "'");
-            return DSL_RESULT_GIE_PAD_TYPE_INVALID;
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Sink name '" << name << "' is not unique");
+            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
         }
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
-            
-            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
-                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
-
-            if (!pPrimaryGieBintr->RemoveBatchMetaHandler(pad, handler))
-            {
-                LOG_ERROR("Primary GIE '" << name << "' has no matching Batch Meta Handler");
-                return DSL_RESULT_GIE_HANDLER_REMOVE_FAILED;
-            }
+            m_components[name] = DSL_FAKE_SINK_NEW(name);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
         }
         catch(...)
         {
-            LOG_ERROR("Primary GIE '" << name << "' threw an exception removing Batch Meta Handle");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
+        LOG_INFO("New Fake Sink '" << name << "' created successfully");
+
         return DSL_RESULT_SUCCESS;
     }
+    
+    DslReturnType Services::SinkOverlayNew(const char* name, uint overlay_id, uint display_id,
+        uint depth, uint offsetX, uint offsetY, uint width, uint height)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
 
-    DslReturnType  Services::PrimaryGieKittiOutputEnabledSet(const char* name, boolean enabled,
-        const char* file)    
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Sink name '" << name << "' is not unique");
+            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+        }
+        try
+        {
+            m_components[name] = DSL_OVERLAY_SINK_NEW(
+                name, overlay_id, display_id, depth, offsetX, offsetY, width, height);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
+        }
+        catch(...)
+        {
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
+        }
+        LOG_INFO("New Overlay Sink '" << name << "' created successfully");
+
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::SinkWindowNew(const char* name, 
+        uint offsetX, uint offsetY, uint width, uint height)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
 
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Sink name '" << name << "' is not unique");
+            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+        }
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, PrimaryGieBintr);
-            
-            DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
-                std::dynamic_pointer_cast<PrimaryGieBintr>(m_components[name]);
-
-            if (!pPrimaryGieBintr->SetKittiOutputEnabled(enabled, file))
-            {
-                LOG_ERROR("Invalid Kitti file path " << file << "for Primary GIE '" << name << "'");
-                return DSL_RESULT_GIE_SET_FAILED;
-            }
+            m_components[name] = DSL_WINDOW_SINK_NEW(name, offsetX, offsetY, width, height);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
         }
         catch(...)
         {
-            LOG_ERROR("Primary GIE '" << name << "' threw an exception setting Kitti output enabled");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
+        LOG_INFO("New Window Sink '" << name << "' created successfully");
+
         return DSL_RESULT_SUCCESS;
     }
-        
-    DslReturnType Services::SecondaryGieNew(const char* name, const char* inferConfigFile,
-        const char* modelEngineFile, const char* inferOnGieName, uint interval)
+    
+    DslReturnType Services::SinkFileNew(const char* name, const char* filepath, 
+            uint codec, uint container, uint bitrate, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
 
         // ensure component name uniqueness 
         if (m_components.find(name) != m_components.end())
         {   
-            LOG_ERROR("GIE name '" << name << "' is not unique");
-            return DSL_RESULT_GIE_NAME_NOT_UNIQUE;
+            LOG_ERROR("Sink name '" << name << "' is not unique");
+            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
         }
-        
-        LOG_INFO("Infer config file: " << inferConfigFile);
-        
-        std::ifstream configFile(inferConfigFile);
-        if (!configFile.good())
-        {
-            LOG_ERROR("Infer Config File not found");
-            return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+        if (codec > DSL_CODEC_MPEG4)
+        {   
+            LOG_ERROR("Invalid Codec value = " << codec << " for File Sink '" << name << "'");
+            return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
         }
-        
-        LOG_INFO("Model engine file: " << modelEngineFile);
-        
-        std::ifstream modelFile(modelEngineFile);
-        if (!modelFile.good())
-        {
-            LOG_ERROR("Model Engine File not found");
-            return DSL_RESULT_GIE_MODEL_FILE_NOT_FOUND;
+        if (container > DSL_CONTAINER_MKV)
+        {   
+            LOG_ERROR("Invalid Container value = " << container << " for File Sink '" << name << "'");
+            return DSL_RESULT_SINK_CONTAINER_VALUE_INVALID;
         }
         try
         {
-            m_components[name] = DSL_SECONDARY_GIE_NEW(name, 
-                inferConfigFile, modelEngineFile, inferOnGieName, interval);
+            m_components[name] = DSL_FILE_SINK_NEW(name, filepath, codec, container, bitrate, interval);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
         }
         catch(...)
         {
-            LOG_ERROR("New Primary GIE '" << name << "' threw exception on create");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("New Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-        LOG_INFO("new Secondary GIE '" << name << "' created successfully");
+        LOG_INFO("New File Sink '" << name << "' created successfully");
 
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::GieRawOutputEnabledSet(const char* name, boolean enabled,
-        const char* path)
+    
+    DslReturnType Services::SinkFileVideoFormatsGet(const char* name, uint* codec, uint* container)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
-                
-            if (!pGieBintr->SetRawOutputEnabled(enabled, path))
-            {
-                LOG_ERROR("GIE '" << name << "' failed to enable raw output");
-                return DSL_RESULT_GIE_OUTPUT_DIR_DOES_NOT_EXIST;
-            }
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, FileSinkBintr);
+
+            DSL_FILE_SINK_PTR fileSinkBintr = 
+                std::dynamic_pointer_cast<FileSinkBintr>(m_components[name]);
+
+            fileSinkBintr->GetVideoFormats(codec, container);
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw exception on raw output enabled set");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("File Sink '" << name << "' threw an exception getting Video formats");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::GieInferConfigFileGet(const char* name, const char** inferConfigFile)
+    DslReturnType Services::SinkFileEncoderSettingsGet(const char* name, uint* bitrate, uint* interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, FileSinkBintr);
 
-            *inferConfigFile = pGieBintr->GetInferConfigFile();
+            DSL_FILE_SINK_PTR fileSinkBintr = 
+                std::dynamic_pointer_cast<FileSinkBintr>(m_components[name]);
+
+            fileSinkBintr->GetEncoderSettings(bitrate, interval);
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("File Sink '" << name << "' threw an exception getting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::GieInferConfigFileSet(const char* name, const char* inferConfigFile)
+    DslReturnType Services::SinkFileEncoderSettingsSet(const char* name, uint bitrate, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, FileSinkBintr);
 
-            if (!pGieBintr->SetInferConfigFile(inferConfigFile))
+            if (m_components[name]->IsInUse())
             {
-                LOG_ERROR("GIE '" << name << "' failed to set the Infer Config file");
-                return DSL_RESULT_GIE_SET_FAILED;
+                LOG_ERROR("Unable to set Encoder settings for File Sink '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_SINK_IS_IN_USE;
+            }
+
+            DSL_FILE_SINK_PTR fileSinkBintr = 
+                std::dynamic_pointer_cast<FileSinkBintr>(m_components[name]);
+
+            if (!fileSinkBintr->SetEncoderSettings(bitrate, interval))
+            {
+                LOG_ERROR("File Sink '" << name << "' failed to set Encoder settings");
+                return DSL_RESULT_SINK_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("File Sink'" << name << "' threw an exception setting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::GieModelEngineFileGet(const char* name, const char** inferConfigFile)
+    DslReturnType Services::SinkRtspNew(const char* name, const char* host, 
+            uint udpPort, uint rtspPort, uint codec, uint bitrate, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
 
+        // ensure component name uniqueness 
+        if (m_components.find(name) != m_components.end())
+        {   
+            LOG_ERROR("Sink name '" << name << "' is not unique");
+            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+        }
+        if (codec > DSL_CODEC_H265)
+        {   
+            LOG_ERROR("Invalid Codec value = " << codec << " for File Sink '" << name << "'");
+            return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
+        }
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
-
-            *inferConfigFile = pGieBintr->GetModelEngineFile();
+            m_components[name] = DSL_RTSP_SINK_NEW(name, host, udpPort, rtspPort, codec, bitrate, interval);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("New RTSP Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
+        LOG_INFO("New RTSP Sink '" << name << "' created successfully");
 
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::GieModelEngineFileSet(const char* name, const char* inferConfigFile)
+    
+    DslReturnType Services::SinkRtspServerSettingsGet(const char* name, uint* udpPort, uint* rtspPort, uint* codec)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
 
-            if (!pGieBintr->SetModelEngineFile(inferConfigFile))
-            {
-                LOG_ERROR("GIE '" << name << "' failed to set the Infer Config file");
-                return DSL_RESULT_GIE_SET_FAILED;
-            }
+            rtspSinkBintr->GetServerSettings(udpPort, rtspPort, codec);
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw exception on Infer Config file get");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::GieIntervalGet(const char* name, uint* interval)
+    DslReturnType Services::SinkRtspEncoderSettingsGet(const char* name, uint* bitrate, uint* interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
 
-            *interval = pGieBintr->GetInterval();
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+
+            rtspSinkBintr->GetEncoderSettings(bitrate, interval);
         }
         catch(...)
         {
-            LOG_ERROR("GIE '" << name << "' threw an exception adding Batch Meta Handler");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::GieIntervalSet(const char* name, uint interval)
+    DslReturnType Services::SinkRtspEncoderSettingsSet(const char* name, uint bitrate, uint interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_GIE(m_components, name);
-            
-            DSL_GIE_PTR pGieBintr = 
-                std::dynamic_pointer_cast<GieBintr>(m_components[name]);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
 
-            if (!pGieBintr->SetInterval(interval))
+            DSL_RTSP_SINK_PTR rtspSinkBintr = 
+                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
+
+            if (m_components[name]->IsInUse())
             {
-                LOG_ERROR("GIE '" << name << "' failed to set new Interval");
-                return DSL_RESULT_GIE_SET_FAILED;
+                LOG_ERROR("Unable to set Encoder settings for RTSP Sink '" << name 
+                    << "' as it's currently in use");
+                return DSL_RESULT_SINK_IS_IN_USE;
             }
-        }
-        catch(...)
-        {
-            LOG_ERROR("GIE '" << name << "' threw an exception setting Interval");
-            return DSL_RESULT_GIE_THREW_EXCEPTION;
-        }
-        return DSL_RESULT_SUCCESS;
-    }
-
-    DslReturnType Services::TrackerKtlNew(const char* name, uint width, uint height)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("KTL Tracker name '" << name << "' is not unique");
-            return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
-        }
-        try
-        {
-            m_components[name] = std::shared_ptr<Bintr>(new KtlTrackerBintr(
-                name, width, height));
+            if (!rtspSinkBintr->SetEncoderSettings(bitrate, interval))
+            {
+                LOG_ERROR("RTSP Sink '" << name << "' failed to set Encoder settings");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("KTL Tracker '" << name << "' threw exception on create");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("RTSP Sink '" << name << "' threw an exception setting Encoder settings");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-        LOG_INFO("New KTL Tracker '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::TrackerIouNew(const char* name, const char* configFile, 
-        uint width, uint height)
+
+    DslReturnType Services::SinkImageNew(const char* name, const char* outdir)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        
+        struct stat info;
 
         // ensure component name uniqueness 
         if (m_components.find(name) != m_components.end())
         {   
-            LOG_ERROR("IOU Tracker name '" << name << "' is not unique");
-            return DSL_RESULT_TRACKER_NAME_NOT_UNIQUE;
+            LOG_ERROR("Sink name '" << name << "' is not unique");
+            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
         }
-        LOG_INFO("Infer config file: " << configFile);
-        
-        std::ifstream streamConfigFile(configFile);
-        if (!streamConfigFile.good())
+        // ensure outdir exists
+        if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
         {
-            LOG_ERROR("Infer Config File not found");
-            return DSL_RESULT_GIE_CONFIG_FILE_NOT_FOUND;
+            LOG_ERROR("Unable to access outdir '" << outdir << "' for Image Sink '" << name << "'");
+            return DSL_RESULT_SINK_FILE_PATH_NOT_FOUND;
         }
         try
         {
-            m_components[name] = std::shared_ptr<Bintr>(new IouTrackerBintr(
-                name, configFile, width, height));
+            m_components[name] = DSL_IMAGE_SINK_NEW(name, outdir);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
         }
         catch(...)
         {
-            LOG_ERROR("IOU Tracker '" << name << "' threw exception on create");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("New Image Sink '" << name << "' threw exception on create");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-        LOG_INFO("New IOU Tracker '" << name << "' created successfully");
+        LOG_INFO("New Image Sink '" << name << "' created successfully");
 
         return DSL_RESULT_SUCCESS;
     }
-   
-       DslReturnType Services::TrackerMaxDimensionsGet(const char* name, uint* width, uint* height)
+    
+    DslReturnType Services::SinkImageOutdirGet(const char* name, const char** outdir)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
 
-            DSL_TRACKER_PTR trackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
 
-            // TODO verify args before calling
-            trackerBintr->GetMaxDimensions(width, height);
+            *outdir = sinkBintr->GetOutdir();
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception getting dimensions");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("Image Sink '" << name << "' threw exception on Outdir get");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
+
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TrackerMaxDimensionsSet(const char* name, uint width, uint height)
+    DslReturnType Services::SinkImageOutdirSet(const char* name, const char* outdir)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
 
-            if (m_components[name]->IsInUse())
+            // ensure outdir exists
+            struct stat info;
+            if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
             {
-                LOG_ERROR("Unable to set Max Dimensions for Tracker '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_TILER_IS_IN_USE;
+                LOG_ERROR("Unable to access outdir '" << outdir << "' for Image Sink '" << name << "'");
+                return DSL_RESULT_SINK_FILE_PATH_NOT_FOUND;
             }
+            
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
 
-            DSL_TRACKER_PTR trackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            if (!trackerBintr->SetMaxDimensions(width, height))
+            if (!sinkBintr->SetOutdir(outdir))
             {
-                LOG_ERROR("Tracker '" << name << "' failed to set dimensions");
-                return DSL_RESULT_TRACKER_SET_FAILED;
+                LOG_ERROR("Failed to set outdir '" << outdir << "' for Image Sink '" << name << "'");
+                return DSL_RESULT_SINK_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception setting dimensions");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("Image Sink '" << name << "' threw exception on Outdir set");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
+
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TrackerBatchMetaHandlerAdd(const char* name, uint pad, 
-        dsl_batch_meta_handler_cb handler, void* user_data)
+
+    DslReturnType Services::SinkImageFrameCaptureIntervalGet(const char* name, uint* interval)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (pad > DSL_PAD_SRC)
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
+        try
         {
-            LOG_ERROR("Invalid Pad type = " << pad << " for Tracker '" << name << "'");
-            return DSL_RESULT_TRACKER_PAD_TYPE_INVALID;
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
+
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
+
+            *interval = sinkBintr->GetFrameCaptureInterval();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Image Sink '" << name << "' threw an exception getting Frame Capture interval");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::SinkImageFrameCaptureIntervalSet(const char* name, uint interval)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
 
-            DSL_TRACKER_PTR pTrackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
 
-            if (!pTrackerBintr->AddBatchMetaHandler(pad, handler, user_data))
+            if (!sinkBintr->SetFrameCaptureInterval(interval))
             {
-                LOG_ERROR("Tracker '" << name << "' failed to add Batch Meta Handler");
-                return DSL_RESULT_TRACKER_HANDLER_ADD_FAILED;
+                LOG_ERROR("Image Sink '" << name << "' failed to set Frame Capture interval");
+                return DSL_RESULT_SINK_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception adding Batch Meta Handler");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("Image Sink '" << name << "' threw an exception setting Frame Capture interval");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TrackerBatchMetaHandlerRemove(const char* name, 
-        uint pad, dsl_batch_meta_handler_cb handler)
+    DslReturnType Services::SinkImageFrameCaptureEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (pad > DSL_PAD_SRC)
-        {
-            LOG_ERROR("Invalid Pad type = " << pad << " for Tracker '" << name << "'");
-            return DSL_RESULT_TRACKER_PAD_TYPE_INVALID;
-        }
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
 
-            DSL_TRACKER_PTR pTrackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
 
-            if (!pTrackerBintr->RemoveBatchMetaHandler(pad, handler))
-            {
-                LOG_ERROR("Tracker '" << name << "' has no matching Batch Meta Handler");
-                return DSL_RESULT_TRACKER_HANDLER_REMOVE_FAILED;
-            }
+            *enabled = sinkBintr->GetFrameCaptureEnabled();
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception removing Batch Meta Handle");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Image Sink '" << name << "' threw an exception getting Frame Capture enabled");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-   
-    DslReturnType  Services::TrackerKittiOutputEnabledSet(const char* name, boolean enabled,
-        const char* file)    
+
+    DslReturnType Services::SinkImageFrameCaptureEnabledSet(const char* name, boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
             RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TRACKER(m_components, name);
-            
-            DSL_TRACKER_PTR pTrackerBintr = 
-                std::dynamic_pointer_cast<TrackerBintr>(m_components[name]);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
 
-            if (!pTrackerBintr->SetKittiOutputEnabled(enabled, file))
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
+
+            if (!sinkBintr->SetFrameCaptureEnabled(enabled))
             {
-                LOG_ERROR("Invalid Kitti file path " << file << "for Tracker '" << name << "'");
-                return DSL_RESULT_TRACKER_SET_FAILED;
+                LOG_ERROR("Image Sink '" << name << "' failed to set Frame Capture enabled");
+                return DSL_RESULT_SINK_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception setting Kitti output enabled");
-            return DSL_RESULT_TRACKER_THREW_EXCEPTION;
+            LOG_ERROR("Image Sink '" << name << "' threw an exception setting Frame Capture enabled");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-        
-    DslReturnType Services::TeeDemuxerNew(const char* name)
+
+    DslReturnType Services::SinkImageObjectCaptureEnabledGet(const char* name, boolean* enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Demuxer Tee name '" << name << "' is not unique");
-            return DSL_RESULT_TEE_NAME_NOT_UNIQUE;
-        }
         try
         {
-            m_components[name] = std::shared_ptr<Bintr>(new DemuxerBintr(name));
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
+
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
+
+            *enabled = sinkBintr->GetObjectCaptureEnabled();
         }
         catch(...)
         {
-            LOG_ERROR("New Demuxer Tee '" << name << "' threw exception on create");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Image Sink '" << name << "' threw an exception getting Object Capture enabled");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-        LOG_INFO("New Demuxer Tee '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TeeSplitterNew(const char* name)
+    DslReturnType Services::SinkImageObjectCaptureEnabledSet(const char* name, boolean enabled)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Splitter Tee name '" << name << "' is not unique");
-            return DSL_RESULT_TILER_NAME_NOT_UNIQUE;
-        }
         try
         {
-            m_components[name] = std::shared_ptr<Bintr>(new SplitterBintr(name));
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
+
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
+
+            if (!sinkBintr->SetObjectCaptureEnabled(enabled))
+            {
+                LOG_ERROR("Image Sink '" << name << "' failed to set Object Capture enabled");
+                return DSL_RESULT_SINK_SET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("New Splitter Tee '" << name << "' threw exception on create");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Image Sink '" << name << "' threw an exception setting Object Capture enabled");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-        LOG_INFO("New Splitter Tee '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::TeeBranchAdd(const char* tee, 
-        const char* branch)
+
+    DslReturnType Services::SinkImageObjectCaptureClassAdd(const char* name, 
+        uint classId, boolean fullFrame, uint captureLimit)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
-            RETURN_IF_COMPONENT_IS_NOT_BRANCH(m_components, branch);
-            
-            // Can't add components if they're In use by another Branch
-            if (m_components[branch]->IsInUse())
-            {
-                LOG_ERROR("Unable to add branch '" << branch 
-                    << "' as it's currently in use");
-                return DSL_RESULT_COMPONENT_IN_USE;
-            }
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
 
-            // Cast the Branch to a Bintr to call the correct AddChile method.
-            DSL_BINTR_PTR pBranchBintr = 
-                std::dynamic_pointer_cast<Bintr>(m_components[branch]);
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
 
-            if (!pTeeBintr->AddChild(pBranchBintr))
-            {
-                LOG_ERROR("Tee '" << tee << 
-                    "' failed to add branch '" << branch << "'");
-                return DSL_RESULT_TEE_BRANCH_ADD_FAILED;
+            if (!sinkBintr->AddObjectCaptureClass(classId, fullFrame, captureLimit))
+            {
+                LOG_ERROR("Image Sink '" << name << "' failed to add Object Capture Class");
+                return DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_ADD_FAILED;
             }
-
         }
         catch(...)
         {
-            LOG_ERROR("Tee '" << tee 
-                << "' threw an exception removing branch '" << branch << "'");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Image Sink '" << name << "' threw an exception adding Object Capture Class");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
-        LOG_INFO("Branch '" << branch 
-            << "' was added to Tee '" << tee << "' successfully");
         return DSL_RESULT_SUCCESS;
-    }    
+    }
     
-    DslReturnType Services::TeeBranchRemove(const char* tee, 
-        const char* branch)
+    DslReturnType Services::SinkImageObjectCaptureClassRemove(const char* name, uint classId)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
-            RETURN_IF_BRANCH_NAME_NOT_FOUND(m_components, branch);
-
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
-
-            if (!pTeeBintr->IsChild(m_components[branch]))
-            {
-                LOG_ERROR("Branch '" << branch << 
-                    "' is not in use by Tee '" << tee << "'");
-                return DSL_RESULT_TEE_BRANCH_IS_NOT_CHILD;
-            }
+            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
 
-            // Cast the Branch to a Bintr to call the correct AddChile method.
-            DSL_BINTR_PTR pBranchBintr = 
-                std::dynamic_pointer_cast<Bintr>(m_components[branch]);
+            DSL_IMAGE_SINK_PTR sinkBintr = 
+                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
 
-            if (!pTeeBintr->RemoveChild(pBranchBintr))
+            if (!sinkBintr->RemoveObjectCaptureClass(classId))
             {
-                LOG_ERROR("Tee '" << tee << 
-                    "' failed to remove branch '" << branch << "'");
-                return DSL_RESULT_TEE_BRANCH_REMOVE_FAILED;
+                LOG_ERROR("Image Sink '" << name << "' failed to remove Object Capture Class");
+                return DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_REMOVE_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Tee '" << tee 
-                << "' threw an exception removing branch '" << branch << "'");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("OSD '" << name << "' threw an exception removing Redaction Class");
+            return DSL_RESULT_SINK_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TeeBranchRemoveAll(const char* tee)
+    uint Services::SinkNumInUseGet()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
 
-        try
+        return GetNumSinksInUse();
+    }
+    
+    uint Services::SinkNumInUseMaxGet()
+    {
+        LOG_FUNC();
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        return m_sinkNumInUseMax;
+    }
+    
+    boolean Services::SinkNumInUseMaxSet(uint max)
+    {
+        LOG_FUNC();
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        
+        uint numInUse(0);
+        
+        if (max < GetNumSinksInUse())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
-
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
-//            m_components[tee]->RemoveAll();
+            LOG_ERROR("max setting = " << max << 
+                " is less than the current number of Sinks in use = " << numInUse);
+            return false;
         }
-        catch(...)
+        m_sinkNumInUseMax = max;
+        return true;
+    }
+
+
+    DslReturnType Services::ComponentDelete(const char* component)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        
+        if (m_components[component]->IsInUse())
         {
-            LOG_ERROR("Tee '" <<  tee
-                << "' threw an exception removing all branches");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_INFO("Component '" << component << "' is in use");
+            return DSL_RESULT_COMPONENT_IN_USE;
         }
+        auto handle = m_componentHandles.find(component);
+        TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_DELETE, component, 
+            m_components[component], 
+            (handle != m_componentHandles.end()) ? handle->second : 0);
+        ComponentHandleRelease(component);
+        m_components.erase(component);
+
+        LOG_INFO("Component '" << component << "' deleted successfully");
+
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::TeeBranchCountGet(const char* tee, uint* count)
+    
+    DslReturnType Services::ComponentDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
 
-        try
+        // Only if there are Pipelines do we check if the component is in use.
+        if (m_pipelines.size())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, tee);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, tee);
-
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[tee]);
-
-            *count = pTeeBintr->GetNumChildren();
+            for (auto const& imap: m_components)
+            {
+                // In the case of Delete all
+                if (imap.second->IsInUse())
+                {
+                    LOG_ERROR("Component '" << imap.second->GetName() << "' is currently in use");
+                    return DSL_RESULT_COMPONENT_IN_USE;
+                }
+            }
         }
-        catch(...)
+
+        for (auto const& imap: m_components)
         {
-            LOG_ERROR("Tee '" <<  tee
-                << "' threw an exception getting branch count");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            auto handle = m_componentHandles.find(imap.first);
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_DELETE, 
+                imap.first.c_str(), imap.second, 
+                (handle != m_componentHandles.end()) ? handle->second : 0);
+            ComponentHandleRelease(imap.first.c_str());
         }
+        m_components.clear();
+        LOG_INFO("All Components deleted successfully");
+
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TeeBatchMetaHandlerAdd(const char* name, 
-        dsl_batch_meta_handler_cb handler, void* user_data)
+    uint Services::ComponentListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         
-        try
+        return m_components.size();
+    }
+
+    DslReturnType Services::ComponentGpuIdGet(const char* component, uint* gpuid)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, component);
+        
+        if (m_components[component]->IsInUse())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, name);
+            LOG_INFO("Component '" << component << "' is in use");
+            return DSL_RESULT_COMPONENT_IN_USE;
+        }
+        *gpuid = m_components[component]->GetGpuId();
 
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[name]);
+        LOG_INFO("Current GPU ID = " << *gpuid << " for component '" << component << "'");
 
-            if (!pTeeBintr->AddBatchMetaHandler(DSL_PAD_SINK, handler, user_data))
-            {
-                LOG_ERROR("Tee '" << name << "' failed to add Batch Meta Handler");
-                return DSL_RESULT_TILER_HANDLER_ADD_FAILED;
-            }
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::ComponentGpuIdSet(const char* component, uint gpuid)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, component);
+        
+        if (m_components[component]->IsInUse())
+        {
+            LOG_INFO("Component '" << component << "' is in use");
+            return DSL_RESULT_COMPONENT_IN_USE;
         }
-        catch(...)
+        if (!m_components[component]->SetGpuId(gpuid))
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception adding Batch Meta Handler");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_INFO("Component '" << component << "' faild to set GPU ID = " << gpuid);
+            return DSL_RESULT_COMPONENT_SET_GPUID_FAILED;
         }
+
+        LOG_INFO("New GPU ID = " << gpuid << " for component '" << component << "'");
+
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TeeBatchMetaHandlerRemove(const char* name, 
-        dsl_batch_meta_handler_cb handler)
+    DslReturnType Services::ComponentQueuePolicyGet(const char* component, 
+        uint* maxSizeBuffers, uint* maxSizeTime, uint* leaky, uint* latencyBudget)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, component);
         
-        try
+        DSL_QUEUE_POLICY_PTR pQueuePolicy = m_components[component]->GetQueuePolicy();
+        if (!pQueuePolicy)
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_TEE(m_components, name);
+            LOG_ERROR("Component '" << component << "' does not support a Queue policy");
+            return DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE;
+        }
+        pQueuePolicy->GetSettings(maxSizeBuffers, maxSizeTime, leaky, latencyBudget);
 
-            DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
-                std::dynamic_pointer_cast<MultiComponentsBintr>(m_components[name]);
+        LOG_INFO("Queue policy for component '" << component << "' = max-size-buffers: " 
+            << *maxSizeBuffers << ", max-size-time: " << *maxSizeTime << ", leaky: " 
+            << *leaky << ", latency-budget: " << *latencyBudget);
 
-            if (!pTeeBintr->RemoveBatchMetaHandler(DSL_PAD_SINK, handler))
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::ComponentQueuePolicySet(const char* component, 
+        uint maxSizeBuffers, uint maxSizeTime, uint leaky, uint latencyBudget)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, component);
+        
+        try
+        {
+            DSL_QUEUE_POLICY_PTR pQueuePolicy = m_components[component]->GetQueuePolicy();
+            if (!pQueuePolicy)
             {
-                LOG_ERROR("Tee '" << name << "' has no matching Batch Meta Handler");
-                return DSL_RESULT_TEE_HANDLER_REMOVE_FAILED;
+                LOG_ERROR("Component '" << component << "' does not support a Queue policy");
+                return DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE;
+            }
+            if (!pQueuePolicy->SetSettings(maxSizeBuffers, maxSizeTime, leaky, latencyBudget))
+            {
+                LOG_ERROR("Component '" << component << "' failed to set Queue policy");
+                return DSL_RESULT_COMPONENT_QUEUE_POLICY_SET_FAILED;
             }
+            LOG_INFO("New Queue policy for component '" << component << "' = max-size-buffers: " 
+                << maxSizeBuffers << ", max-size-time: " << maxSizeTime << ", leaky: " 
+                << leaky << ", latency-budget: " << latencyBudget);
+
+            return DSL_RESULT_SUCCESS;
         }
         catch(...)
         {
-            LOG_ERROR("Tee '" << name << "' threw an exception removing Batch Meta Handle");
-            return DSL_RESULT_TEE_THREW_EXCEPTION;
+            LOG_ERROR("Component '" << component << "' threw an exception setting Queue policy");
+            return DSL_RESULT_COMPONENT_QUEUE_POLICY_SET_FAILED;
         }
-        return DSL_RESULT_SUCCESS;
     }
     
-    DslReturnType Services::TilerNew(const char* name, uint width, uint height)
+    DslReturnType Services::ComponentQueueDroppedGet(const char* component, uint* dropped)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, component);
+        
+        DSL_QUEUE_POLICY_PTR pQueuePolicy = m_components[component]->GetQueuePolicy();
+        if (!pQueuePolicy)
+        {
+            LOG_ERROR("Component '" << component << "' does not support a Queue policy");
+            return DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE;
+        }
+        *dropped = pQueuePolicy->GetDropped();
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Tiler name '" << name << "' is not unique");
-            return DSL_RESULT_TILER_NAME_NOT_UNIQUE;
+        LOG_INFO("Queue dropped = " << *dropped << " for component '" << component << "'");
+
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::ComponentHandleGet(const char* component, DslHandle* handle)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        
+        if (m_componentHandles.find(component) != m_componentHandles.end())
+        {
+            *handle = m_componentHandles[component];
+            return DSL_RESULT_SUCCESS;
         }
-        try
+        uint slot(0);
+        if (m_freeComponentSlots.size())
         {
-            m_components[name] = std::shared_ptr<Bintr>(new TilerBintr(
-                name, width, height));
+            slot = m_freeComponentSlots.back();
+            m_freeComponentSlots.pop_back();
         }
-        catch(...)
+        else if (m_componentSlots.size() < DSL_HANDLE_MAX_SLOTS)
         {
-            LOG_ERROR("New Tiler'" << name << "' threw exception on create");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            slot = m_componentSlots.size();
+            m_componentSlots.push_back(nullptr);
+            m_componentSlotGenerations.push_back(1);
         }
-        LOG_INFO("New Tiler '" << name << "' created successfully");
+        else
+        {
+            LOG_ERROR("Unable to get handle for Component '" << component 
+                << "' as all handle slots are in use");
+            return DSL_RESULT_COMPONENT_HANDLE_GET_FAILED;
+        }
+        m_componentSlots[slot] = m_components[component];
+        m_componentHandles[component] = 
+            DSL_HANDLE_NEW(slot, m_componentSlotGenerations[slot]);
+        *handle = m_componentHandles[component];
+
+        LOG_INFO("Handle = " << *handle << " for component '" << component << "'");
 
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::TilerDimensionsGet(const char* name, uint* width, uint* height)
+    
+    void Services::ComponentHandleRelease(const char* component)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        
+        if (m_componentHandles.find(component) == m_componentHandles.end())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            tilerBintr->GetDimensions(width, height);
+            return;
         }
-        catch(...)
+        uint slot = DSL_HANDLE_SLOT(m_componentHandles[component]);
+        
+        m_componentSlots[slot] = nullptr;
+        m_componentSlotGenerations[slot] = 
+            (m_componentSlotGenerations[slot] == 0xFFFF) ? 1 : m_componentSlotGenerations[slot]+1;
+        m_freeComponentSlots.push_back(slot);
+        m_componentHandles.erase(component);
+    }
+    
+    bool Services::ComponentHandleRestore(const char* component, DslHandle handle)
+    {
+        LOG_FUNC();
+        
+        uint slot = DSL_HANDLE_SLOT(handle);
+        uint generation = DSL_HANDLE_GENERATION(handle);
+        uint releasedGeneration = (generation == 0xFFFF) ? 1 : generation+1;
+        
+        // The slot must still be free, and not reused and released since
+        auto freeSlot = std::find(m_freeComponentSlots.begin(), 
+            m_freeComponentSlots.end(), slot);
+        if (freeSlot == m_freeComponentSlots.end() or
+            m_componentSlotGenerations[slot] != releasedGeneration)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception getting dimensions");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            return false;
         }
-        return DSL_RESULT_SUCCESS;
+        m_freeComponentSlots.erase(freeSlot);
+        m_componentSlots[slot] = m_components[component];
+        m_componentSlotGenerations[slot] = generation;
+        m_componentHandles[component] = handle;
+        
+        LOG_INFO("Handle = " << handle << " restored for component '" << component << "'");
+        
+        return true;
     }
 
-    DslReturnType Services::TilerDimensionsSet(const char* name, uint width, uint height)
+    DslReturnType Services::ComponentGpuIdGet(DslHandle component, uint* gpuid)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(m_componentSlots, m_componentSlotGenerations, component);
+
+        uint slot = DSL_HANDLE_SLOT(component);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_componentSlots, slot);
         
-        try
+        if (m_componentSlots[slot]->IsInUse())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            if (m_components[name]->IsInUse())
-            {
-                LOG_ERROR("Unable to set Dimensions for Tiler '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_TILER_IS_IN_USE;
-            }
+            LOG_INFO("Component '" << m_componentSlots[slot]->GetName() << "' is in use");
+            return DSL_RESULT_COMPONENT_IN_USE;
+        }
+        *gpuid = m_componentSlots[slot]->GetGpuId();
 
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+        return DSL_RESULT_SUCCESS;
+    }
+    
+    DslReturnType Services::ComponentGpuIdSet(DslHandle component, uint gpuid)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_HANDLE_NOT_FOUND(m_componentSlots, m_componentSlotGenerations, component);
 
-            // TODO verify args before calling
-            if (!tilerBintr->SetDimensions(width, height))
-            {
-                LOG_ERROR("Tiler '" << name << "' failed to settin dimensions");
-                return DSL_RESULT_TILER_SET_FAILED;
-            }
+        uint slot = DSL_HANDLE_SLOT(component);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_componentSlots, slot);
+        
+        if (m_componentSlots[slot]->IsInUse())
+        {
+            LOG_INFO("Component '" << m_componentSlots[slot]->GetName() << "' is in use");
+            return DSL_RESULT_COMPONENT_IN_USE;
         }
-        catch(...)
+        if (!m_componentSlots[slot]->SetGpuId(gpuid))
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception setting dimensions");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_INFO("Component '" << m_componentSlots[slot]->GetName() 
+                << "' faild to set GPU ID = " << gpuid);
+            return DSL_RESULT_COMPONENT_SET_GPUID_FAILED;
         }
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TilerTilesGet(const char* name, uint* cols, uint* rows)
+    DslReturnType Services::BranchNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        
+        if (m_components[name])
+        {   
+            LOG_ERROR("Branch name '" << name << "' is not unique");
+            return DSL_RESULT_BRANCH_NAME_NOT_UNIQUE;
+        }
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            tilerBintr->GetTiles(cols, rows);
+            m_components[name] = std::shared_ptr<Bintr>(new BranchBintr(name));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_COMPONENT_NEW, name, m_components[name]);
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception getting Tiles");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("New Branch '" << name << "' threw exception on create");
+            return DSL_RESULT_BRANCH_THREW_EXCEPTION;
         }
+        LOG_INFO("new BRANCH '" << name << "' created successfully");
+
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::TilerTilesSet(const char* name, uint cols, uint rows)
+    DslReturnType Services::BranchComponentAdd(const char* branch, 
+        const char* component)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            if (m_components[name]->IsInUse())
+            // Can't add components if they're In use by another Pipeline
+            if (m_components[component]->IsInUse())
             {
-                LOG_ERROR("Unable to set Tiles for Tiler '" << name 
+                LOG_ERROR("Unable to add component '" << component 
                     << "' as it's currently in use");
-                return DSL_RESULT_TILER_IS_IN_USE;
+                return DSL_RESULT_COMPONENT_IN_USE;
             }
 
-            DSL_TILER_PTR tilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+            // Check for MAX Sources in Use - Do not exceed!
+            if (IsSourceComponent(component) )
+            {
+                LOG_ERROR("Can't add source '" << component << "' to branch '" << branch << 
+                    "' sources can only be added to Pipelines");
+                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
+            }
 
-            // TODO verify args before calling
-            if (!tilerBintr->SetTiles(cols, rows))
+            if (IsSinkComponent(component) and (GetNumSinksInUse() == m_sinkNumInUseMax))
             {
-                LOG_ERROR("Tiler '" << name << "' failed to set Tiles");
-                return DSL_RESULT_TILER_SET_FAILED;
+                LOG_ERROR("Adding Sink '" << component << "' to Branch '" << branch << 
+                    "' would exceed the maximum num-in-use limit");
+                return DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED;
+            }
+            if (!m_components[component]->AddToParent(m_components[branch]))
+            {
+                LOG_ERROR("Branch '" << branch
+                    << "' failed to add component '" << component << "'");
+                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
+            }
+            // Components added to a linked Branch are linked in place
+            if (!std::dynamic_pointer_cast<BranchBintr>(m_components[branch])->Relink())
+            {
+                m_components[component]->RemoveFromParent(m_components[branch]);
+                LOG_ERROR("Branch '" << branch
+                    << "' failed to relink with component '" << component << "'");
+                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception setting Tiles");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Branch '" << branch
+                << "' threw exception adding component '" << component << "'");
+            return DSL_RESULT_BRANCH_THREW_EXCEPTION;
         }
+        LOG_INFO("Component '" << component 
+            << "' was added to Branch '" << branch << "' successfully");
+
+        TransactionEditRecord(DSL_TRANSACTION_EDIT_BRANCH_COMPONENT_ADD, branch, component);
+
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::TilerBatchMetaHandlerAdd(const char* name, uint pad, 
-        dsl_batch_meta_handler_cb handler, void* user_data)
+    
+    DslReturnType Services::BranchComponentRemove(const char* branch, 
+        const char* component)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (pad > DSL_PAD_SRC)
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+
+        if (!m_components[component]->IsParent(m_components[branch]))
         {
-            LOG_ERROR("Invalid Pad type = " << pad << " for Tiler '" << name << "'");
-            return DSL_RESULT_TILER_PAD_TYPE_INVALID;
+            LOG_ERROR("Component '" << component << 
+                "' is not in use by Branch '" << branch << "'");
+            return DSL_RESULT_COMPONENT_NOT_USED_BY_BRANCH;
         }
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR pTilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
-
-            if (!pTilerBintr->AddBatchMetaHandler(pad, handler, user_data))
+            if (!m_components[component]->RemoveFromParent(m_components[branch]))
             {
-                LOG_ERROR("Tiler '" << name << "' failed to add Batch Meta Handler");
-                return DSL_RESULT_TILER_HANDLER_ADD_FAILED;
+                LOG_ERROR("Branch '" << branch
+                    << "' failed to remove component '" << component << "'");
+                return DSL_RESULT_BRANCH_COMPONENT_REMOVE_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Tiler '" << name << "' threw an exception adding Batch Meta Handler");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
+            LOG_ERROR("Branch '" << branch 
+                << "' threw an exception removing component");
+            return DSL_RESULT_BRANCH_COMPONENT_REMOVE_FAILED;
         }
+        LOG_INFO("Component '" << component 
+            << "' was removed from Branch '" << branch << "' successfully");
+
+        TransactionEditRecord(DSL_TRANSACTION_EDIT_BRANCH_COMPONENT_REMOVE, branch, component);
+
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::TilerBatchMetaHandlerRemove(const char* name, 
-        uint pad, dsl_batch_meta_handler_cb handler)
+    
+    DslReturnType Services::TransactionBegin()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        TRACE_SCOPE("api", __func__);
         
-        if (pad > DSL_PAD_SRC)
+        if (TransactionInProgress())
         {
-            LOG_ERROR("Invalid Pad type = " << pad << " for Tiler '" << name << "'");
-            return DSL_RESULT_TILER_PAD_TYPE_INVALID;
+            LOG_ERROR("A transaction is already in progress for the calling thread");
+            return DSL_RESULT_TRANSACTION_IN_PROGRESS;
         }
-        try
-        {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, TilerBintr);
-
-            DSL_TILER_PTR pTilerBintr = 
-                std::dynamic_pointer_cast<TilerBintr>(m_components[name]);
+        // Held until commit or abort, so that the transaction's edits are applied
+        // as one, with a single lock round-trip, and never seen half built.
+        g_rw_lock_writer_lock(&m_servicesRWLock);
+        m_pTransactionThread = g_thread_self();
+        m_transactionEdits.clear();
 
-            if (!pTilerBintr->RemoveBatchMetaHandler(pad, handler))
-            {
-                LOG_ERROR("Tiler '" << name << "' has no matching Batch Meta Handler");
-                return DSL_RESULT_TILER_HANDLER_REMOVE_FAILED;
-            }
-        }
-        catch(...)
-        {
-            LOG_ERROR("Tiler '" << name << "' threw an exception removing Batch Meta Handle");
-            return DSL_RESULT_TILER_THREW_EXCEPTION;
-        }
+        LOG_INFO("Transaction begun successfully");
+        
         return DSL_RESULT_SUCCESS;
     }
-   
-    DslReturnType Services::OfvNew(const char* name)
+    
+    DslReturnType Services::TransactionCommit(bool validateGraph)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("OFV name '" << name << "' is not unique");
-            return DSL_RESULT_OFV_NAME_NOT_UNIQUE;
-        }
-        try
-        {   
-            m_components[name] = std::shared_ptr<Bintr>(new OfvBintr(name));
+        TRACE_SCOPE("api", __func__);
+        
+        if (!TransactionInProgress())
+        {
+            LOG_ERROR("No transaction is in progress for the calling thread");
+            return DSL_RESULT_TRANSACTION_NOT_IN_PROGRESS;
         }
-        catch(...)
+        LOG_INFO("Committing transaction with " << m_transactionEdits.size() << " edits");
+        
+        DslReturnType retval(DSL_RESULT_SUCCESS);
+        if (validateGraph and !TransactionValidate())
         {
-            LOG_ERROR("New OFV '" << name << "' threw exception on create");
-            return DSL_RESULT_OFV_THREW_EXCEPTION;
+            LOG_ERROR("Transaction failed validation on commit, undoing all edits");
+            TransactionUndo();
+            retval = DSL_RESULT_TRANSACTION_VALIDATION_FAILED;
         }
-        LOG_INFO("new OFV '" << name << "' created successfully");
-
-        return DSL_RESULT_SUCCESS;
+        m_transactionEdits.clear();
+        m_pTransactionThread = nullptr;
+        g_rw_lock_writer_unlock(&m_servicesRWLock);
+        
+        return retval;
     }
     
-    DslReturnType Services::OsdNew(const char* name, boolean isClockEnabled)
+    DslReturnType Services::TransactionAbort()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("OSD name '" << name << "' is not unique");
-            return DSL_RESULT_OSD_NAME_NOT_UNIQUE;
-        }
-        try
-        {   
-            m_components[name] = std::shared_ptr<Bintr>(new OsdBintr(
-                name, isClockEnabled));
-        }
-        catch(...)
+        TRACE_SCOPE("api", __func__);
+        
+        if (!TransactionInProgress())
         {
-            LOG_ERROR("New OSD '" << name << "' threw exception on create");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("No transaction is in progress for the calling thread");
+            return DSL_RESULT_TRANSACTION_NOT_IN_PROGRESS;
         }
-        LOG_INFO("new OSD '" << name << "' created successfully");
-
+        LOG_INFO("Aborting transaction with " << m_transactionEdits.size() << " edits");
+        
+        TransactionUndo();
+        
+        m_transactionEdits.clear();
+        m_pTransactionThread = nullptr;
+        g_rw_lock_writer_unlock(&m_servicesRWLock);
+        
         return DSL_RESULT_SUCCESS;
     }
     
-    DslReturnType Services::OsdClockEnabledGet(const char* name, boolean* enabled)
+    bool Services::TransactionInProgress()
+    {
+        // No lock required, only the owning thread can match itself
+        return m_pTransactionThread == g_thread_self();
+    }
+    
+    void Services::TransactionEditRecord(uint editType, 
+        const char* parent, const char* child)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        
+        if (TransactionInProgress())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            osdBintr->GetClockEnabled(enabled);
+            m_transactionEdits.push_back({editType, parent, child, nullptr, 0});
         }
-        catch(...)
+    }
+    
+    void Services::TransactionEditRecord(uint editType, 
+        const char* name, DSL_BINTR_PTR pBintr, DslHandle handle)
+    {
+        LOG_FUNC();
+        
+        if (TransactionInProgress())
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting clock enabled");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            m_transactionEdits.push_back({editType, "", name, pBintr, handle});
+        }
+    }
+    
+    DSL_BINTR_PTR Services::TransactionBintrFind(const std::string& name)
+    {
+        auto pipeline = m_pipelines.find(name);
+        if (pipeline != m_pipelines.end() and pipeline->second)
+        {
+            return pipeline->second;
         }
-        return DSL_RESULT_SUCCESS;
+        auto component = m_components.find(name);
+        return (component != m_components.end()) ? component->second : nullptr;
     }
-
-    DslReturnType Services::OsdClockEnabledSet(const char* name, boolean enabled)
+    
+    bool Services::TransactionValidate()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        
+        // The Services lock is held for the whole transaction, so the graph can
+        // only have been changed by the transaction's own edits. Validate every
+        // Pipeline, Branch, Demuxer and Splitter created or edited within it.
+        std::set<std::string> parents;
+        for (auto const& edit: m_transactionEdits)
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            if (m_components[name]->IsInUse())
+            switch (edit.editType)
             {
-                LOG_ERROR("Unable to set The clock enabled setting for the OSD '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_OSD_IS_IN_USE;
+            case DSL_TRANSACTION_EDIT_PIPELINE_NEW :
+            case DSL_TRANSACTION_EDIT_COMPONENT_NEW :
+                parents.insert(edit.child);
+                break;
+            case DSL_TRANSACTION_EDIT_COMPONENT_DELETE :
+                break;
+            default :
+                parents.insert(edit.parent);
             }
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            if (!osdBintr->SetClockEnabled(enabled))
+        }
+        for (auto const& name: parents)
+        {
+            // Skip if deleted within the transaction
+            DSL_BINTR_PTR pBintr = TransactionBintrFind(name);
+            if (!pBintr)
             {
-                LOG_ERROR("OSD '" << name << "' failed to set Clock enabled");
-                return DSL_RESULT_OSD_SET_FAILED;
+                continue;
+            }
+            DSL_PIPELINE_PTR pPipeline = std::dynamic_pointer_cast<PipelineBintr>(pBintr);
+            if (pPipeline and !pPipeline->GetNumSourcesInUse())
+            {
+                LOG_ERROR("Pipeline '" << name << "' has no Sources");
+                return false;
+            }
+            DSL_BRANCH_PTR pBranch = std::dynamic_pointer_cast<BranchBintr>(pBintr);
+            if (pBranch and !pBranch->ValidateComponents())
+            {
+                return false;
+            }
+            DSL_MULTI_COMPONENTS_PTR pTee = 
+                std::dynamic_pointer_cast<MultiComponentsBintr>(pBintr);
+            if (pTee and !pTee->GetNumChildren())
+            {
+                LOG_ERROR("Tee '" << name << "' has no Branches");
+                return false;
             }
         }
-        catch(...)
+        return true;
+    }
+    
+    void Services::TransactionUndo()
+    {
+        LOG_FUNC();
+        
+        // Undoing an edit records its inverse, so undo from a copy
+        std::vector<TransactionEdit> edits;
+        edits.swap(m_transactionEdits);
+        
+        for (auto iter = edits.rbegin(); iter != edits.rend(); ++iter)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock enabled");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            const char* parent = iter->parent.c_str();
+            const char* child = iter->child.c_str();
+            DslReturnType retval(DSL_RESULT_SUCCESS);
+            
+            switch (iter->editType)
+            {
+            case DSL_TRANSACTION_EDIT_PIPELINE_COMPONENT_ADD :
+                retval = PipelineComponentRemove(parent, child);
+                break;
+            case DSL_TRANSACTION_EDIT_PIPELINE_COMPONENT_REMOVE :
+                retval = PipelineComponentAdd(parent, child);
+                break;
+            case DSL_TRANSACTION_EDIT_BRANCH_COMPONENT_ADD :
+                retval = BranchComponentRemove(parent, child);
+                break;
+            case DSL_TRANSACTION_EDIT_BRANCH_COMPONENT_REMOVE :
+                retval = BranchComponentAdd(parent, child);
+                break;
+            case DSL_TRANSACTION_EDIT_TEE_BRANCH_ADD :
+                retval = TeeBranchRemove(parent, child);
+                break;
+            case DSL_TRANSACTION_EDIT_TEE_BRANCH_REMOVE :
+                retval = TeeBranchAdd(parent, child);
+                break;
+            case DSL_TRANSACTION_EDIT_PIPELINE_NEW :
+                {
+                    LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+                    auto pipeline = m_pipelines.find(child);
+                    if (pipeline == m_pipelines.end() or pipeline->second != iter->pBintr)
+                    {
+                        retval = DSL_RESULT_PIPELINE_NAME_NOT_FOUND;
+                        break;
+                    }
+                    pipeline->second->RemoveAllChildren();
+                    m_pipelines.erase(pipeline);
+                }
+                break;
+            case DSL_TRANSACTION_EDIT_COMPONENT_NEW :
+                {
+                    LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+                    auto component = m_components.find(child);
+                    if (component == m_components.end() or component->second != iter->pBintr)
+                    {
+                        retval = DSL_RESULT_COMPONENT_NAME_NOT_FOUND;
+                        break;
+                    }
+                    if (component->second->IsInUse())
+                    {
+                        retval = DSL_RESULT_COMPONENT_IN_USE;
+                        break;
+                    }
+                    ComponentHandleRelease(child);
+                    m_components.erase(component);
+                }
+                break;
+            case DSL_TRANSACTION_EDIT_COMPONENT_DELETE :
+                {
+                    // Restore the original Component, not a copy, as the client 
+                    // may still hold references to it, e.g. in callbacks.
+                    LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+                    if (m_components.find(child) != m_components.end())
+                    {
+                        retval = DSL_RESULT_COMPONENT_NAME_NOT_UNIQUE;
+                        break;
+                    }
+                    m_components[child] = iter->pBintr;
+                    if (iter->handle and !ComponentHandleRestore(child, iter->handle))
+                    {
+                        LOG_WARN("Handle for Component '" << child 
+                            << "' was reused and could not be restored on undo");
+                    }
+                }
+                break;
+            }
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                LOG_ERROR("Failed to undo edit " << iter->editType << " of '" << child 
+                    << "' with result " << retval << " on transaction end");
+            }
         }
-        return DSL_RESULT_SUCCESS;
+        m_transactionEdits.clear();
     }
 
-    DslReturnType Services::OsdClockOffsetsGet(const char* name, uint* offsetX, uint* offsetY)
+    DslReturnType Services::PipelineNew(const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        
+        if (m_pipelines[name])
+        {   
+            LOG_ERROR("Pipeline name '" << name << "' is not unique");
+            return DSL_RESULT_PIPELINE_NAME_NOT_UNIQUE;
+        }
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            osdBintr->GetClockOffsets(offsetX, offsetY);
+            m_pipelines[name] = std::shared_ptr<PipelineBintr>(new PipelineBintr(name));
+            TransactionEditRecord(DSL_TRANSACTION_EDIT_PIPELINE_NEW, name, m_pipelines[name]);
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting clock offsets");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("New Pipeline '" << name << "' threw exception on create");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
+        LOG_INFO("new PIPELINE '" << name << "' created successfully");
+
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::OsdClockOffsetsSet(const char* name, uint offsetX, uint offsetY)
+    DslReturnType Services::PipelineDelete(const char* pipeline)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        
+        if (TransactionInProgress())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+            LOG_ERROR("Unable to delete Pipeline '" << pipeline 
+                << "' within a transaction");
+            return DSL_RESULT_TRANSACTION_IN_PROGRESS;
+        }
 
-            if (m_components[name]->IsInUse())
-            {
-                LOG_ERROR("Unable to set The clock offsets for the OSD '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_OSD_IS_IN_USE;
-            }
+        m_pipelines[pipeline]->RemoveAllChildren();
+        m_pipelines.erase(pipeline);
 
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+        LOG_INFO("Pipeline '" << pipeline << "' deleted successfully");
 
-            // TODO verify args before calling
-            if (!osdBintr->SetClockOffsets(offsetX, offsetY))
-            {
-                LOG_ERROR("OSD '" << name << "' failed to set Clock offsets");
-                return DSL_RESULT_OSD_SET_FAILED;
-            }
-        }
-        catch(...)
-        {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
-        }
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::OsdClockFontGet(const char* name, const char** font, uint* size)
+    DslReturnType Services::PipelineDeleteAll()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        
+        if (TransactionInProgress())
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            osdBintr->GetClockFont(font, size);
+            LOG_ERROR("Unable to delete all Pipelines within a transaction");
+            return DSL_RESULT_TRANSACTION_IN_PROGRESS;
         }
-        catch(...)
+
+        for (auto &imap: m_pipelines)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting clock font");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            imap.second->RemoveAllChildren();
+            imap.second = nullptr;
         }
+        m_pipelines.clear();
+
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::OsdClockFontSet(const char* name, const char* font, uint size)
+    uint Services::PipelineListSize()
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        
+        return m_pipelines.size();
+    }
+    
+    DslReturnType Services::PipelineComponentAdd(const char* pipeline, 
+        const char* component)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            if (m_components[name]->IsInUse())
+            // Can't add components if they're In use by another Pipeline
+            if (m_components[component]->IsInUse())
             {
-                LOG_ERROR("Unable to set The clock offsets for the OSD '" << name 
+                LOG_ERROR("Unable to add component '" << component 
                     << "' as it's currently in use");
-                return DSL_RESULT_OSD_IS_IN_USE;
+                return DSL_RESULT_COMPONENT_IN_USE;
             }
 
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+            // Check for MAX Sources in Use - Do not exceed!
+            if (IsSourceComponent(component) and (GetNumSourcesInUse() == m_sourceNumInUseMax))
+            {
+                LOG_ERROR("Adding Source '" << component << "' to Pipeline '" << pipeline << 
+                    "' would exceed the maximum num-in-use limit");
+                return DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED;
+            }
 
-            // TODO verify args before calling
-            if (!osdBintr->SetClockFont(font, size))
+            if (IsSinkComponent(component) and (GetNumSinksInUse() == m_sinkNumInUseMax))
             {
-                LOG_ERROR("OSD '" << name << "' failed to set Clock font");
-                return DSL_RESULT_OSD_SET_FAILED;
+                LOG_ERROR("Adding Sink '" << component << "' to Pipeline '" << pipeline << 
+                    "' would exceed the maximum num-in-use limit");
+                return DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED;
+            }
+
+            if (!m_components[component]->AddToParent(m_pipelines[pipeline]))
+            {
+                LOG_ERROR("Pipeline '" << pipeline
+                    << "' failed component '" << component << "'");
+                return DSL_RESULT_PIPELINE_COMPONENT_ADD_FAILED;
+            }
+            // Components added to a linked Pipeline are linked in place
+            if (!m_pipelines[pipeline]->Relink())
+            {
+                m_components[component]->RemoveFromParent(m_pipelines[pipeline]);
+                LOG_ERROR("Pipeline '" << pipeline
+                    << "' failed to relink with component '" << component << "'");
+                return DSL_RESULT_PIPELINE_COMPONENT_ADD_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw exception adding component '" << component << "'");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        return DSL_RESULT_SUCCESS;
-    }
-
-    DslReturnType Services::OsdClockColorGet(const char* name, double* red, double* green, double* blue, double* alpha)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
-        {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
+        LOG_INFO("Component '" << component 
+            << "' was added to Pipeline '" << pipeline << "' successfully");
 
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
+        TransactionEditRecord(DSL_TRANSACTION_EDIT_PIPELINE_COMPONENT_ADD, pipeline, component);
 
-            osdBintr->GetClockColor(red, green, blue, alpha);
-        }
-        catch(...)
-        {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting clock font");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
-        }
         return DSL_RESULT_SUCCESS;
-    }
-
-    DslReturnType Services::OsdClockColorSet(const char* name, double red, double green, double blue, double alpha)
+    }    
+    
+    DslReturnType Services::PipelineComponentRemove(const char* pipeline, 
+        const char* component)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
 
+        if (!m_components[component]->IsParent(m_pipelines[pipeline]))
+        {
+            LOG_ERROR("Component '" << component << 
+                "' is not in use by Pipeline '" << pipeline << "'");
+            return DSL_RESULT_COMPONENT_NOT_USED_BY_PIPELINE;
+        }
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            if (m_components[name]->IsInUse())
+            if (!m_components[component]->RemoveFromParent(m_pipelines[pipeline]))
             {
-                LOG_ERROR("Unable to set The clock RGB colors for the OSD '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_OSD_IS_IN_USE;
+                LOG_ERROR("Pipeline '" << pipeline
+                    << "' failed to remove component '" << component << "'");
+                return DSL_RESULT_PIPELINE_COMPONENT_REMOVE_FAILED;
             }
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            if (!osdBintr->SetClockColor(red, green, blue, alpha))
+            // Sources and Sinks are unlinked in place, leaving the linked chain 
+            // unchanged, so there is nothing to relink or retrace
+            if (m_pipelines[pipeline]->IsRelinkRequired())
             {
-                LOG_ERROR("OSD '" << name << "' failed to set Clock RGB colors");
-                return DSL_RESULT_OSD_SET_FAILED;
+                m_pipelines[pipeline]->Relink();
             }
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Clock offsets");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception removing component");
+            return DSL_RESULT_PIPELINE_COMPONENT_REMOVE_FAILED;
         }
+        TransactionEditRecord(DSL_TRANSACTION_EDIT_PIPELINE_COMPONENT_REMOVE, pipeline, component);
         return DSL_RESULT_SUCCESS;
     }
     
-    DslReturnType Services::OsdCropSettingsGet(const char* name, uint* left, uint* top, uint* width, uint* height)
+    /**
+     * @brief Pipeline definition helpers returning a key's value, or the 
+     * default value if the key is not present in the component's group.
+     * A present key with a malformed or out of range value is logged, and
+     * pValid cleared, so that the definition can be rejected as invalid.
+     */
+    static uint DefinitionUintGet(GKeyFile* pKeyFile, const char* group, 
+        const char* key, bool* pValid, uint defaultValue=0)
     {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        if (!g_key_file_has_key(pKeyFile, group, key, NULL))
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            osdBintr->GetCropSettings(left, top, width, height);
+            return defaultValue;
         }
-        catch(...)
+        GError* pError(NULL);
+        guint64 value = g_key_file_get_uint64(pKeyFile, group, key, &pError);
+        if (pError)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting crop settings");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline definition of '" << group << "' has an invalid '" 
+                << key << "' value: " << pError->message);
+            g_error_free(pError);
+            *pValid = false;
+            return defaultValue;
         }
-        return DSL_RESULT_SUCCESS;
+        if (value > G_MAXUINT)
+        {
+            LOG_ERROR("Pipeline definition of '" << group << "' has an out of range '" 
+                << key << "' value of " << value);
+            *pValid = false;
+            return defaultValue;
+        }
+        return (uint)value;
     }
-
-    DslReturnType Services::OsdCropSettingsSet(const char* name, uint left, uint top, uint width, uint height)
+    
+    static boolean DefinitionBoolGet(GKeyFile* pKeyFile, const char* group, 
+        const char* key, bool* pValid, boolean defaultValue=false)
     {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        if (!g_key_file_has_key(pKeyFile, group, key, NULL))
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            // TODO verify args before calling
-            if (!osdBintr->SetCropSettings(left, top, width, height))
-            {
-                LOG_ERROR("OSD '" << name << "' failed to set crop settings");
-                return DSL_RESULT_OSD_SET_FAILED;
-            }
+            return defaultValue;
         }
-        catch(...)
+        GError* pError(NULL);
+        boolean value = g_key_file_get_boolean(pKeyFile, group, key, &pError);
+        if (pError)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting crop settings");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline definition of '" << group << "' has an invalid '" 
+                << key << "' value: " << pError->message);
+            g_error_free(pError);
+            *pValid = false;
+            return defaultValue;
         }
-        return DSL_RESULT_SUCCESS;
+        return value;
     }
-
-    DslReturnType Services::OsdRedactionEnabledGet(const char* name, boolean* enabled)
+    
+    static void DefinitionDoublesGet(GKeyFile* pKeyFile, const char* group, 
+        const char* key, bool* pValid, double* values, gsize count)
     {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        if (!g_key_file_has_key(pKeyFile, group, key, NULL))
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            *enabled = osdBintr->GetRedactionEnabled();
+            return;
         }
-        catch(...)
+        GError* pError(NULL);
+        gsize length(0);
+        gdouble* list = g_key_file_get_double_list(pKeyFile, group, key, &length, &pError);
+        if (pError)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception getting Redaction enabled");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline definition of '" << group << "' has an invalid '" 
+                << key << "' value: " << pError->message);
+            g_error_free(pError);
+            *pValid = false;
+            return;
         }
-        return DSL_RESULT_SUCCESS;
+        if (length != count)
+        {
+            LOG_ERROR("Pipeline definition of '" << group << "' has " << length 
+                << " '" << key << "' values, expected " << count);
+            *pValid = false;
+        }
+        else
+        {
+            std::copy(list, list + count, values);
+        }
+        g_free(list);
     }
-
-    DslReturnType Services::OsdRedactionEnabledSet(const char* name, boolean enabled)
+    
+    static std::string DefinitionStringGet(GKeyFile* pKeyFile, 
+        const char* group, const char* key)
+    {
+        gchar* value = g_key_file_get_string(pKeyFile, group, key, NULL);
+        if (!value)
+        {
+            return std::string();
+        }
+        std::string retval(value);
+        g_free(value);
+        return retval;
+    }
+    
+    DslReturnType Services::PipelineDefinitionLoad(const char* definition, 
+        const char** report)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        TRACE_SCOPE("api", __func__);
+        
+        // No lock, each component is created and added by the public services
+        GKeyFile* pKeyFile = g_key_file_new();
+        GError* pError(NULL);
+        
+        gboolean loaded = g_file_test(definition, G_FILE_TEST_IS_REGULAR)
+            ? g_key_file_load_from_file(pKeyFile, definition, G_KEY_FILE_NONE, &pError)
+            : g_key_file_load_from_data(pKeyFile, definition, -1, G_KEY_FILE_NONE, &pError);
+        if (!loaded)
+        {
+            LOG_ERROR("Failed to parse Pipeline definition: " << pError->message);
+            g_error_free(pError);
+            g_key_file_free(pKeyFile);
+            return DSL_RESULT_PIPELINE_DEFINITION_LOAD_FAILED;
+        }
+        gchar** groups = g_key_file_get_groups(pKeyFile, NULL);
+        std::string created;
+        DslReturnType retval(DSL_RESULT_SUCCESS);
+        
+        // Create all components first so that the adds are independent of group order
+        for (gchar** group = groups; *group and retval == DSL_RESULT_SUCCESS; group++)
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            if (!osdBintr->SetRedactionEnabled(enabled))
+            retval = DefinitionComponentNew(pKeyFile, *group);
+            if (retval == DSL_RESULT_SUCCESS)
             {
-                LOG_ERROR("OSD '" << name << "' failed to set Redaction enabled");
-                return DSL_RESULT_OSD_SET_FAILED;
+                created += (created.empty() ? "" : ";") + std::string(*group);
             }
         }
-        catch(...)
+        for (gchar** group = groups; *group and retval == DSL_RESULT_SUCCESS; group++)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception setting Redaction enabled");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            retval = DefinitionComponentAdd(pKeyFile, *group);
+        }
+        g_strfreev(groups);
+        g_key_file_free(pKeyFile);
+
+        if (retval != DSL_RESULT_SUCCESS)
+        {
+            LOG_ERROR("Failed to load Pipeline definition after creating '" << created << "'");
+            return retval;
         }
+        LOG_INFO("Pipeline definition loaded '" << created << "' successfully");
+        
+        m_definitionReport = created;
+        *report = m_definitionReport.c_str();
+        
         return DSL_RESULT_SUCCESS;
     }
     
-    DslReturnType Services::OsdRedactionClassAdd(const char* name, int classId, 
-        double red, double green, double blue, double alpha)
+    DslReturnType Services::PipelineDefinitionSave(const char* pipeline, 
+        const char* path)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        
+        GKeyFile* pKeyFile = g_key_file_new();
+        DslReturnType retval(DSL_RESULT_SUCCESS);
+        
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            if (red > 1.0 or green > 1.0 or blue > 1.0 or alpha > 1.0)
+            LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+            
+            DSL_PIPELINE_PTR pPipeline = m_pipelines[pipeline];
+            uint values[2]{0};
+            bool padding(false);
+            
+            auto setUintKey = [&](const char* key, uint value)
+                {g_key_file_set_uint64(pKeyFile, pipeline, key, value);};
+            auto setBoolKey = [&](const char* key, boolean value)
+                {g_key_file_set_boolean(pKeyFile, pipeline, key, value);};
+            
+            g_key_file_set_string(pKeyFile, pipeline, "type", "pipeline");
+            
+            pPipeline->GetStreamMuxBatchProperties(&values[0], &values[1]);
+            setUintKey("batch-size", values[0]);
+            setUintKey("batch-timeout", values[1]);
+            if (pPipeline->GetStreamMuxDimensions(&values[0], &values[1]))
             {
-                LOG_ERROR("Invalid Redaction color param passed to OSD '" << name << "'");
-                return DSL_RESULT_OSD_COLOR_PARAM_INVALID;
+                setUintKey("streammux-width", values[0]);
+                setUintKey("streammux-height", values[1]);
             }
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            if (!osdBintr->AddRedactionClass(classId, red, green, blue, alpha))
+            if (pPipeline->GetStreamMuxPadding(&padding))
             {
-                LOG_ERROR("OSD '" << name << "' failed to add Redaction Class");
-                return DSL_RESULT_OSD_REDACTION_CLASS_ADD_FAILED;
+                setBoolKey("streammux-padding", padding);
             }
+            pPipeline->GetSurfaceBudget(&values[0], &values[1]);
+            setUintKey("surface-budget", values[0]);
+            setUintKey("surface-budget-policy", values[1]);
+            setBoolKey("latency-tracing", pPipeline->GetLatencyTracingEnabled());
+            setBoolKey("link-optimization", pPipeline->GetLinkOptimizationEnabled());
+            setUintKey("perf-interval", pPipeline->GetPerfInterval());
+            setBoolKey("perf-enabled", pPipeline->GetPerfEnabled());
+            setUintKey("sgie-link-mode", pPipeline->GetSecondaryGieLinkMode());
+            setBoolKey("classification-cache", pPipeline->GetClassificationCacheEnabled());
+            
+            retval = DefinitionChildrenSave(pKeyFile, pipeline, pPipeline);
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception adding Redaction Class");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception saving its definition");
+            retval = DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        return DSL_RESULT_SUCCESS;
-    }
-    
-    DslReturnType Services::OsdRedactionClassRemove(const char* name, int classId)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        if (retval == DSL_RESULT_SUCCESS)
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR osdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            if (!osdBintr->RemoveRedactionClass(classId))
+            GError* pError(NULL);
+            if (!g_key_file_save_to_file(pKeyFile, path, &pError))
             {
-                LOG_ERROR("OSD '" << name << "' failed to remove Redaction Class");
-                return DSL_RESULT_OSD_REDACTION_CLASS_REMOVE_FAILED;
+                LOG_ERROR("Failed to save Pipeline '" << pipeline 
+                    << "' definition to '" << path << "': " << pError->message);
+                g_error_free(pError);
+                retval = DSL_RESULT_PIPELINE_DEFINITION_SAVE_FAILED;
             }
         }
-        catch(...)
+        g_key_file_free(pKeyFile);
+
+        if (retval == DSL_RESULT_SUCCESS)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception removing Redaction Class");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            LOG_INFO("Pipeline '" << pipeline 
+                << "' definition saved to '" << path << "' successfully");
         }
-        return DSL_RESULT_SUCCESS;
+        return retval;
     }
-
-    DslReturnType Services::OsdBatchMetaHandlerAdd(const char* name, uint pad, 
-        dsl_batch_meta_handler_cb handler, void* user_data)
+    
+    DslReturnType Services::DefinitionComponentNew(GKeyFile* pKeyFile, const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         
-        if (pad > DSL_PAD_SRC)
+        std::string type = DefinitionStringGet(pKeyFile, name, "type");
+        
+        bool valid(true);
+        
+        auto uintKey = [&](const char* key, uint defaultValue=0)
+            {return DefinitionUintGet(pKeyFile, name, key, &valid, defaultValue);};
+        auto boolKey = [&](const char* key, boolean defaultValue=false)
+            {return DefinitionBoolGet(pKeyFile, name, key, &valid, defaultValue);};
+        auto stringKey = [&](const char* key){return DefinitionStringGet(pKeyFile, name, key);};
+
+        DslReturnType retval(DSL_RESULT_PIPELINE_DEFINITION_LOAD_FAILED);
+        
+        if (type == "pipeline")
         {
-            LOG_ERROR("Invalid Pad type = " << pad << " for OSD '" << name << "'");
-            return DSL_RESULT_OSD_PAD_TYPE_INVALID;
+            retval = PipelineNew(name);
         }
-        try
+        else if (type == "branch")
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR pOsdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            if (!pOsdBintr->AddBatchMetaHandler(pad, handler, user_data))
-            {
-                LOG_ERROR("OSD '" << name << "' already has a Batch Meta Handler");
-                return DSL_RESULT_OSD_HANDLER_ADD_FAILED;
-            }
+            retval = BranchNew(name);
         }
-        catch(...)
+        else if (type == "tee-demuxer")
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception adding Batch Meta Handler");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            retval = TeeDemuxerNew(name);
         }
-        return DSL_RESULT_SUCCESS;
+        else if (type == "tee-splitter")
+        {
+            retval = TeeSplitterNew(name);
+        }
+        else if (type == "source-csi")
+        {
+            retval = SourceCsiNew(name, uintKey("width"), uintKey("height"),
+                uintKey("fps-n"), uintKey("fps-d"));
+        }
+        else if (type == "source-usb")
+        {
+            retval = SourceUsbNew(name, uintKey("width"), uintKey("height"),
+                uintKey("fps-n"), uintKey("fps-d"));
+        }
+        else if (type == "source-uri")
+        {
+            retval = SourceUriNew(name, stringKey("uri").c_str(), boolKey("is-live"),
+                uintKey("cudadec-mem-type"), uintKey("intra-decode"), 
+                uintKey("drop-frame-interval"));
+        }
+        else if (type == "source-rtsp")
+        {
+            retval = SourceRtspNew(name, stringKey("uri").c_str(), 
+                uintKey("protocol", DSL_RTP_ALL),
+                uintKey("cudadec-mem-type"), uintKey("intra-decode"), 
+                uintKey("drop-frame-interval"));
+        }
+        else if (type == "gie-primary")
+        {
+            retval = PrimaryGieNew(name, stringKey("infer-config-file").c_str(),
+                stringKey("model-engine-file").c_str(), uintKey("interval"));
+        }
+        else if (type == "gie-secondary")
+        {
+            retval = SecondaryGieNew(name, stringKey("infer-config-file").c_str(),
+                stringKey("model-engine-file").c_str(), stringKey("infer-on-gie").c_str(), 
+                uintKey("interval"));
+        }
+        else if (type == "tracker-ktl")
+        {
+            retval = TrackerKtlNew(name, uintKey("width"), uintKey("height"));
+        }
+        else if (type == "tracker-iou")
+        {
+            retval = TrackerIouNew(name, stringKey("config-file").c_str(), 
+                uintKey("width"), uintKey("height"));
+        }
+        else if (type == "tiler")
+        {
+            retval = TilerNew(name, uintKey("width"), uintKey("height"));
+        }
+        else if (type == "osd")
+        {
+            retval = OsdNew(name, boolKey("clock-enabled"));
+        }
+        else if (type == "sink-fake")
+        {
+            retval = SinkFakeNew(name);
+        }
+        else if (type == "sink-overlay")
+        {
+            retval = SinkOverlayNew(name, uintKey("overlay-id"), uintKey("display-id"),
+                uintKey("depth"), uintKey("offset-x"), uintKey("offset-y"), 
+                uintKey("width"), uintKey("height"));
+        }
+        else if (type == "sink-window")
+        {
+            retval = SinkWindowNew(name, uintKey("offset-x"), uintKey("offset-y"), 
+                uintKey("width"), uintKey("height"));
+        }
+        else if (type == "sink-file")
+        {
+            retval = SinkFileNew(name, stringKey("file-path").c_str(), uintKey("codec"),
+                uintKey("container"), uintKey("bitrate"), uintKey("interval"));
+        }
+        else if (type == "sink-rtsp")
+        {
+            retval = SinkRtspNew(name, stringKey("host").c_str(), uintKey("udp-port"),
+                uintKey("rtsp-port"), uintKey("codec"), uintKey("bitrate"), 
+                uintKey("interval"));
+        }
+        else
+        {
+            LOG_ERROR("Pipeline definition of '" << name 
+                << "' has an unknown type '" << type << "'");
+        }
+        if (retval == DSL_RESULT_SUCCESS and valid)
+        {
+            retval = DefinitionSettingsSet(pKeyFile, name, type, &valid);
+        }
+        if (!valid)
+        {
+            // The component, if created, is removed when the load's transaction aborts
+            return DSL_RESULT_PIPELINE_DEFINITION_INVALID;
+        }
+        return retval;
     }
-
-    DslReturnType Services::OsdBatchMetaHandlerRemove(const char* name, 
-        uint pad, dsl_batch_meta_handler_cb handler)
+    
+    DslReturnType Services::DefinitionSettingsSet(GKeyFile* pKeyFile, 
+        const char* name, const std::string& type, bool* pValid)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         
-        if (pad > DSL_PAD_SRC)
-        {
-            LOG_ERROR("Invalid Pad type = " << pad << " for OSD '" << name << "'");
-            return DSL_RESULT_OSD_PAD_TYPE_INVALID;
-        }
-        try
+        auto hasKey = [&](const char* key)
+            {return g_key_file_has_key(pKeyFile, name, key, NULL);};
+        auto uintKey = [&](const char* key, uint defaultValue=0)
+            {return DefinitionUintGet(pKeyFile, name, key, pValid, defaultValue);};
+        auto boolKey = [&](const char* key, boolean defaultValue=false)
+            {return DefinitionBoolGet(pKeyFile, name, key, pValid, defaultValue);};
+
+        // Each setting is only present in the definition if it can be set after 
+        // construction, and is only applied if present, so the defaults are kept.
+        DslReturnType retval(DSL_RESULT_SUCCESS);
+        
+        if (type == "pipeline")
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-
-            DSL_OSD_PTR pOsdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            if (!pOsdBintr->RemoveBatchMetaHandler(pad, handler))
+            if (hasKey("batch-size"))
             {
-                LOG_ERROR("OSD '" << name << "' has no Batch Meta Handler");
-                return DSL_RESULT_OSD_HANDLER_REMOVE_FAILED;
+                retval = PipelineStreamMuxBatchPropertiesSet(name, 
+                    uintKey("batch-size"), uintKey("batch-timeout"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("streammux-width"))
+            {
+                retval = PipelineStreamMuxDimensionsSet(name, 
+                    uintKey("streammux-width"), uintKey("streammux-height"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("streammux-padding"))
+            {
+                retval = PipelineStreamMuxPaddingSet(name, boolKey("streammux-padding"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("surface-budget"))
+            {
+                retval = PipelineSurfaceBudgetSet(name, 
+                    uintKey("surface-budget"), uintKey("surface-budget-policy"));
             }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("latency-tracing"))
+            {
+                retval = PipelineLatencyTracingEnabledSet(name, boolKey("latency-tracing"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("link-optimization"))
+            {
+                retval = PipelineLinkOptimizationEnabledSet(name, 
+                    boolKey("link-optimization"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("perf-interval"))
+            {
+                retval = PipelinePerfIntervalSet(name, uintKey("perf-interval"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("perf-enabled"))
+            {
+                retval = PipelinePerfEnabledSet(name, boolKey("perf-enabled"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("sgie-link-mode"))
+            {
+                retval = PipelineSgieLinkModeSet(name, uintKey("sgie-link-mode"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("classification-cache"))
+            {
+                retval = PipelineClassificationCacheEnabledSet(name, 
+                    boolKey("classification-cache"));
+            }
+            return retval;
         }
-        catch(...)
+        if (hasKey("gpu-id"))
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception removing Batch Meta Handle");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            retval = ComponentGpuIdSet(name, uintKey("gpu-id"));
         }
-        return DSL_RESULT_SUCCESS;
-    }
-
-    DslReturnType  Services::OsdKittiOutputEnabledSet(const char* name, boolean enabled,
-        const char* file)    
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        if (retval == DSL_RESULT_SUCCESS and hasKey("queue-leaky"))
+        {
+            retval = ComponentQueuePolicySet(name, uintKey("queue-max-size-buffers"),
+                uintKey("queue-max-size-time"), uintKey("queue-leaky"), 
+                uintKey("queue-latency-budget"));
+        }
+        if (type == "source-uri" or type == "source-rtsp")
+        {
+            if (retval == DSL_RESULT_SUCCESS and hasKey("num-decode-surfaces"))
+            {
+                retval = SourceDecodeSurfacesSet(name, uintKey("num-decode-surfaces"),
+                    uintKey("num-extra-surfaces"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("latency"))
+            {
+                // Any missing key keeps the Source's current value
+                uint latency(0), protocol(0), bufferMode(0), timeout(0);
+                boolean dropOnLatency(false), doRetransmission(false);
+                retval = SourceDecodeRtspConfigGet(name, &latency, &dropOnLatency,
+                    &doRetransmission, &protocol, &bufferMode, &timeout);
+                if (retval == DSL_RESULT_SUCCESS)
+                {
+                    retval = SourceDecodeRtspConfigSet(name, uintKey("latency", latency),
+                        boolKey("drop-on-latency", dropOnLatency), 
+                        boolKey("do-retransmission", doRetransmission),
+                        uintKey("protocol", protocol), uintKey("buffer-mode", bufferMode),
+                        uintKey("timeout", timeout));
+                }
+            }
+        }
+        else if (type == "tiler")
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, OsdBintr);
-            
-            DSL_OSD_PTR pOsdBintr = 
-                std::dynamic_pointer_cast<OsdBintr>(m_components[name]);
-
-            if (!pOsdBintr->SetKittiOutputEnabled(enabled, file))
+            if (retval == DSL_RESULT_SUCCESS and hasKey("columns"))
             {
-                LOG_ERROR("Invalid Kitti file path " << file << "for Tracker '" << name << "'");
-                return DSL_RESULT_OSD_SET_FAILED;
+                retval = TilerTilesSet(name, uintKey("columns"), uintKey("rows"));
             }
         }
-        catch(...)
+        else if (type == "osd")
         {
-            LOG_ERROR("Tracker '" << name << "' threw an exception setting Kitti output enabled");
-            return DSL_RESULT_OSD_THREW_EXCEPTION;
+            if (retval == DSL_RESULT_SUCCESS and hasKey("clock-offset-x"))
+            {
+                retval = OsdClockOffsetsSet(name, uintKey("clock-offset-x"), 
+                    uintKey("clock-offset-y"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("clock-font"))
+            {
+                retval = OsdClockFontSet(name, 
+                    DefinitionStringGet(pKeyFile, name, "clock-font").c_str(), 
+                    uintKey("clock-font-size"));
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("clock-color"))
+            {
+                double color[4]{0};
+                DefinitionDoublesGet(pKeyFile, name, "clock-color", pValid, color, 4);
+                retval = OsdClockColorSet(name, color[0], color[1], color[2], color[3]);
+            }
+            if (retval == DSL_RESULT_SUCCESS and hasKey("redaction-enabled"))
+            {
+                retval = OsdRedactionEnabledSet(name, boolKey("redaction-enabled"));
+            }
         }
-        return DSL_RESULT_SUCCESS;
+        return retval;
     }
-   
-    DslReturnType Services::SinkFakeNew(const char* name)
+    
+    DslReturnType Services::DefinitionComponentAdd(GKeyFile* pKeyFile, const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        
+        std::string type = DefinitionStringGet(pKeyFile, name, "type");
+        bool isTee(type == "tee-demuxer" or type == "tee-splitter");
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Sink name '" << name << "' is not unique");
-            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+        if (type != "pipeline" and type != "branch" and !isTee)
+        {
+            return DSL_RESULT_SUCCESS;
         }
-        try
+        gchar** children = g_key_file_get_string_list(pKeyFile, name, 
+            isTee ? "branches" : "components", NULL, NULL);
+        if (!children)
         {
-            m_components[name] = DSL_FAKE_SINK_NEW(name);
+            return DSL_RESULT_SUCCESS;
         }
-        catch(...)
+        DslReturnType retval(DSL_RESULT_SUCCESS);
+        
+        for (gchar** child = children; *child and retval == DSL_RESULT_SUCCESS; child++)
         {
-            LOG_ERROR("New Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            if (type == "pipeline")
+            {
+                retval = PipelineComponentAdd(name, *child);
+            }
+            else if (type == "branch")
+            {
+                retval = BranchComponentAdd(name, *child);
+            }
+            else
+            {
+                retval = TeeBranchAdd(name, *child);
+            }
         }
-        LOG_INFO("New Fake Sink '" << name << "' created successfully");
-
-        return DSL_RESULT_SUCCESS;
+        g_strfreev(children);
+        
+        return retval;
     }
     
-    DslReturnType Services::SinkOverlayNew(const char* name, uint overlay_id, uint display_id,
-        uint depth, uint offsetX, uint offsetY, uint width, uint height)
+    DslReturnType Services::DefinitionChildrenSave(GKeyFile* pKeyFile, 
+        const char* parent, DSL_BINTR_PTR pParentBintr)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Sink name '" << name << "' is not unique");
-            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+        
+        DSL_MULTI_COMPONENTS_PTR pTeeBintr = 
+            std::dynamic_pointer_cast<MultiComponentsBintr>(pParentBintr);
+        std::vector<std::string> children;
+        
+        for (auto const& imap: m_components)
+        {
+            if ((pTeeBintr and pTeeBintr->IsChild(imap.second)) or
+                (!pTeeBintr and imap.second->IsParent(pParentBintr)))
+            {
+                children.push_back(imap.first);
+            }
         }
-        try
+        std::vector<const gchar*> list;
+        for (auto const& child: children)
         {
-            m_components[name] = DSL_OVERLAY_SINK_NEW(
-                name, overlay_id, display_id, depth, offsetX, offsetY, width, height);
+            list.push_back(child.c_str());
         }
-        catch(...)
+        g_key_file_set_string_list(pKeyFile, parent, 
+            pTeeBintr ? "branches" : "components", list.data(), list.size());
+            
+        for (auto const& child: children)
         {
-            LOG_ERROR("New Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            DslReturnType retval = DefinitionComponentSave(pKeyFile, child.c_str());
+            if (retval != DSL_RESULT_SUCCESS)
+            {
+                return retval;
+            }
         }
-        LOG_INFO("New Overlay Sink '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
     
-    DslReturnType Services::SinkWindowNew(const char* name, 
-        uint offsetX, uint offsetY, uint width, uint height)
+    DslReturnType Services::DefinitionComponentSave(GKeyFile* pKeyFile, const char* name)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Sink name '" << name << "' is not unique");
-            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_components, name);
+        
+        DSL_BINTR_PTR pBintr = m_components[name];
+        uint values[4]{0};
+        
+        auto setUintKey = [&](const char* key, uint value)
+            {g_key_file_set_uint64(pKeyFile, name, key, value);};
+        auto setBoolKey = [&](const char* key, boolean value)
+            {g_key_file_set_boolean(pKeyFile, name, key, value);};
+        auto setStringKey = [&](const char* key, const char* value)
+            {g_key_file_set_string(pKeyFile, name, key, value);};
+        
+        DslReturnType retval(DSL_RESULT_SUCCESS);
+        
+        if (pBintr->IsType(typeid(BranchBintr)))
+        {
+            setStringKey("type", "branch");
+            retval = DefinitionChildrenSave(pKeyFile, name, pBintr);
         }
-        try
+        else if (pBintr->IsType(typeid(DemuxerBintr)) or pBintr->IsType(typeid(SplitterBintr)))
         {
-            m_components[name] = DSL_WINDOW_SINK_NEW(name, offsetX, offsetY, width, height);
+            setStringKey("type", pBintr->IsType(typeid(DemuxerBintr)) 
+                ? "tee-demuxer" : "tee-splitter");
+            retval = DefinitionChildrenSave(pKeyFile, name, pBintr);
         }
-        catch(...)
+        else if (pBintr->IsType(typeid(CsiSourceBintr)) or pBintr->IsType(typeid(UsbSourceBintr)))
         {
-            LOG_ERROR("New Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            DSL_SOURCE_PTR pSource = std::dynamic_pointer_cast<SourceBintr>(pBintr);
+            pSource->GetDimensions(&values[0], &values[1]);
+            pSource->GetFrameRate(&values[2], &values[3]);
+            
+            setStringKey("type", pBintr->IsType(typeid(CsiSourceBintr)) 
+                ? "source-csi" : "source-usb");
+            setUintKey("width", values[0]);
+            setUintKey("height", values[1]);
+            setUintKey("fps-n", values[2]);
+            setUintKey("fps-d", values[3]);
+        }
+        else if (pBintr->IsType(typeid(UriSourceBintr)) or pBintr->IsType(typeid(RtspSourceBintr)))
+        {
+            DSL_DECODE_SOURCE_PTR pSource = 
+                std::dynamic_pointer_cast<DecodeSourceBintr>(pBintr);
+            pSource->GetDecodeSettings(&values[0], &values[1], &values[2]);
+            
+            setStringKey("uri", pSource->GetUri());
+            if (pBintr->IsType(typeid(UriSourceBintr)))
+            {
+                setStringKey("type", "source-uri");
+                setBoolKey("is-live", pSource->IsLive());
+            }
+            else
+            {
+                uint latency(0), protocol(0), bufferMode(0), timeout(0);
+                bool dropOnLatency(false), doRetransmission(false);
+                pSource->GetRtspConfig(&latency, &dropOnLatency, &doRetransmission,
+                    &protocol, &bufferMode, &timeout);
+                    
+                setStringKey("type", "source-rtsp");
+                setUintKey("protocol", protocol);
+                setUintKey("latency", latency);
+                setBoolKey("drop-on-latency", dropOnLatency);
+                setBoolKey("do-retransmission", doRetransmission);
+                setUintKey("buffer-mode", bufferMode);
+                setUintKey("timeout", timeout);
+            }
+            setUintKey("cudadec-mem-type", values[0]);
+            setUintKey("intra-decode", values[1]);
+            setUintKey("drop-frame-interval", values[2]);
+            pSource->GetNumSurfaces(&values[0], &values[1]);
+            setUintKey("num-decode-surfaces", values[0]);
+            setUintKey("num-extra-surfaces", values[1]);
         }
-        LOG_INFO("New Window Sink '" << name << "' created successfully");
-
-        return DSL_RESULT_SUCCESS;
-    }
-    
-    DslReturnType Services::SinkFileNew(const char* name, const char* filepath, 
-            uint codec, uint container, uint bitrate, uint interval)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        else if (pBintr->IsType(typeid(PrimaryGieBintr)) or pBintr->IsType(typeid(SecondaryGieBintr)))
+        {
+            DSL_GIE_PTR pGie = std::dynamic_pointer_cast<GieBintr>(pBintr);
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Sink name '" << name << "' is not unique");
-            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
+            setStringKey("infer-config-file", pGie->GetInferConfigFile());
+            setStringKey("model-engine-file", pGie->GetModelEngineFile());
+            setUintKey("interval", pGie->GetInterval());
+            if (pBintr->IsType(typeid(PrimaryGieBintr)))
+            {
+                setStringKey("type", "gie-primary");
+            }
+            else
+            {
+                setStringKey("type", "gie-secondary");
+                setStringKey("infer-on-gie", std::dynamic_pointer_cast<SecondaryGieBintr>
+                    (pBintr)->GetInferOnGieName());
+            }
         }
-        if (codec > DSL_CODEC_MPEG4)
-        {   
-            LOG_ERROR("Invalid Codec value = " << codec << " for File Sink '" << name << "'");
-            return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
+        else if (pBintr->IsType(typeid(KtlTrackerBintr)) or pBintr->IsType(typeid(IouTrackerBintr)))
+        {
+            DSL_TRACKER_PTR pTracker = std::dynamic_pointer_cast<TrackerBintr>(pBintr);
+            pTracker->GetMaxDimensions(&values[0], &values[1]);
+            
+            if (pBintr->IsType(typeid(KtlTrackerBintr)))
+            {
+                setStringKey("type", "tracker-ktl");
+            }
+            else
+            {
+                setStringKey("type", "tracker-iou");
+                setStringKey("config-file", pTracker->GetConfigFile());
+            }
+            setUintKey("width", values[0]);
+            setUintKey("height", values[1]);
         }
-        if (container > DSL_CONTAINER_MKV)
-        {   
-            LOG_ERROR("Invalid Container value = " << container << " for File Sink '" << name << "'");
-            return DSL_RESULT_SINK_CONTAINER_VALUE_INVALID;
+        else if (pBintr->IsType(typeid(TilerBintr)))
+        {
+            DSL_TILER_PTR pTiler = std::dynamic_pointer_cast<TilerBintr>(pBintr);
+            pTiler->GetDimensions(&values[0], &values[1]);
+            pTiler->GetTiles(&values[2], &values[3]);
+            
+            setStringKey("type", "tiler");
+            setUintKey("width", values[0]);
+            setUintKey("height", values[1]);
+            setUintKey("columns", values[2]);
+            setUintKey("rows", values[3]);
+        }
+        else if (pBintr->IsType(typeid(OsdBintr)))
+        {
+            DSL_OSD_PTR pOsd = std::dynamic_pointer_cast<OsdBintr>(pBintr);
+            boolean clockEnabled(false);
+            const char* clockFont(NULL);
+            double clockColor[4]{0};
+            pOsd->GetClockEnabled(&clockEnabled);
+            pOsd->GetClockOffsets(&values[0], &values[1]);
+            pOsd->GetClockFont(&clockFont, &values[2]);
+            pOsd->GetClockColor(&clockColor[0], &clockColor[1], 
+                &clockColor[2], &clockColor[3]);
+            
+            setStringKey("type", "osd");
+            setBoolKey("clock-enabled", clockEnabled);
+            setUintKey("clock-offset-x", values[0]);
+            setUintKey("clock-offset-y", values[1]);
+            setStringKey("clock-font", clockFont);
+            setUintKey("clock-font-size", values[2]);
+            g_key_file_set_double_list(pKeyFile, name, "clock-color", clockColor, 4);
+            setBoolKey("redaction-enabled", pOsd->GetRedactionEnabled());
         }
-        try
+        else if (pBintr->IsType(typeid(FakeSinkBintr)))
         {
-            m_components[name] = DSL_FILE_SINK_NEW(name, filepath, codec, container, bitrate, interval);
+            setStringKey("type", "sink-fake");
         }
-        catch(...)
+        else if (pBintr->IsType(typeid(OverlaySinkBintr)))
         {
-            LOG_ERROR("New Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            DSL_OVERLAY_SINK_PTR pSink = std::dynamic_pointer_cast<OverlaySinkBintr>(pBintr);
+            pSink->GetOverlaySettings(&values[0], &values[1]);
+            
+            setStringKey("type", "sink-overlay");
+            setUintKey("overlay-id", values[0]);
+            setUintKey("display-id", pSink->GetDisplayId());
+            setUintKey("depth", values[1]);
+            pSink->GetOffsets(&values[0], &values[1]);
+            pSink->GetDimensions(&values[2], &values[3]);
+            setUintKey("offset-x", values[0]);
+            setUintKey("offset-y", values[1]);
+            setUintKey("width", values[2]);
+            setUintKey("height", values[3]);
+        }
+        else if (pBintr->IsType(typeid(WindowSinkBintr)))
+        {
+            DSL_WINDOW_SINK_PTR pSink = std::dynamic_pointer_cast<WindowSinkBintr>(pBintr);
+            pSink->GetOffsets(&values[0], &values[1]);
+            pSink->GetDimensions(&values[2], &values[3]);
+            
+            setStringKey("type", "sink-window");
+            setUintKey("offset-x", values[0]);
+            setUintKey("offset-y", values[1]);
+            setUintKey("width", values[2]);
+            setUintKey("height", values[3]);
         }
-        LOG_INFO("New File Sink '" << name << "' created successfully");
-
-        return DSL_RESULT_SUCCESS;
-    }
-    
-    DslReturnType Services::SinkFileVideoFormatsGet(const char* name, uint* codec, uint* container)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        else if (pBintr->IsType(typeid(FileSinkBintr)))
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, FileSinkBintr);
-
-            DSL_FILE_SINK_PTR fileSinkBintr = 
-                std::dynamic_pointer_cast<FileSinkBintr>(m_components[name]);
-
-            fileSinkBintr->GetVideoFormats(codec, container);
+            DSL_FILE_SINK_PTR pSink = std::dynamic_pointer_cast<FileSinkBintr>(pBintr);
+            pSink->GetVideoFormats(&values[0], &values[1]);
+            pSink->GetEncoderSettings(&values[2], &values[3]);
+            
+            setStringKey("type", "sink-file");
+            setStringKey("file-path", pSink->GetFilePath());
+            setUintKey("codec", values[0]);
+            setUintKey("container", values[1]);
+            setUintKey("bitrate", values[2]);
+            setUintKey("interval", values[3]);
         }
-        catch(...)
+        else if (pBintr->IsType(typeid(RtspSinkBintr)))
         {
-            LOG_ERROR("File Sink '" << name << "' threw an exception getting Video formats");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            DSL_RTSP_SINK_PTR pSink = std::dynamic_pointer_cast<RtspSinkBintr>(pBintr);
+            pSink->GetServerSettings(&values[0], &values[1], &values[2]);
+            
+            setStringKey("type", "sink-rtsp");
+            setStringKey("host", pSink->GetHost());
+            setUintKey("udp-port", values[0]);
+            setUintKey("rtsp-port", values[1]);
+            setUintKey("codec", values[2]);
+            pSink->GetEncoderSettings(&values[0], &values[1]);
+            setUintKey("bitrate", values[0]);
+            setUintKey("interval", values[1]);
         }
-        return DSL_RESULT_SUCCESS;
-    }
-
-    DslReturnType Services::SinkFileEncoderSettingsGet(const char* name, uint* bitrate, uint* interval)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
+        else
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, FileSinkBintr);
-
-            DSL_FILE_SINK_PTR fileSinkBintr = 
-                std::dynamic_pointer_cast<FileSinkBintr>(m_components[name]);
-
-            fileSinkBintr->GetEncoderSettings(bitrate, interval);
+            LOG_ERROR("Component '" << name 
+                << "' is of a type not supported by Pipeline definitions");
+            return DSL_RESULT_PIPELINE_DEFINITION_SAVE_FAILED;
         }
-        catch(...)
+        
+        // Settings common to all components, saved only when changed from the default
+        if (pBintr->GetGpuId())
         {
-            LOG_ERROR("File Sink '" << name << "' threw an exception getting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            setUintKey("gpu-id", pBintr->GetGpuId());
         }
-        return DSL_RESULT_SUCCESS;
+        DSL_QUEUE_POLICY_PTR pQueuePolicy = pBintr->GetQueuePolicy();
+        if (pQueuePolicy and pQueuePolicy->IsSet())
+        {
+            pQueuePolicy->GetSettings(&values[0], &values[1], &values[2], &values[3]);
+            setUintKey("queue-max-size-buffers", values[0]);
+            setUintKey("queue-max-size-time", values[1]);
+            setUintKey("queue-leaky", values[2]);
+            setUintKey("queue-latency-budget", values[3]);
+        }
+        return retval;
     }
-
-    DslReturnType Services::SinkFileEncoderSettingsSet(const char* name, uint bitrate, uint interval)
+    
+    DslReturnType Services::PipelineStreamMuxBatchPropertiesGet(const char* pipeline,
+        uint* batchSize, uint* batchTimeout)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, FileSinkBintr);
-
-            if (m_components[name]->IsInUse())
-            {
-                LOG_ERROR("Unable to set Encoder settings for File Sink '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_SINK_IS_IN_USE;
-            }
-
-            DSL_FILE_SINK_PTR fileSinkBintr = 
-                std::dynamic_pointer_cast<FileSinkBintr>(m_components[name]);
-
-            if (!fileSinkBintr->SetEncoderSettings(bitrate, interval))
-            {
-                LOG_ERROR("File Sink '" << name << "' failed to set Encoder settings");
-                return DSL_RESULT_SINK_SET_FAILED;
-            }
+            m_pipelines[pipeline]->GetStreamMuxBatchProperties(batchSize, batchTimeout);
         }
         catch(...)
         {
-            LOG_ERROR("File Sink'" << name << "' threw an exception setting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the Stream Muxer Batch Properties");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
 
-    DslReturnType Services::SinkRtspNew(const char* name, const char* host, 
-            uint udpPort, uint rtspPort, uint codec, uint bitrate, uint interval)
+    DslReturnType Services::PipelineStreamMuxBatchPropertiesSet(const char* pipeline,
+        uint batchSize, uint batchTimeout)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Sink name '" << name << "' is not unique");
-            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
-        }
-        if (codec > DSL_CODEC_H265)
-        {   
-            LOG_ERROR("Invalid Codec value = " << codec << " for File Sink '" << name << "'");
-            return DSL_RESULT_SINK_CODEC_VALUE_INVALID;
-        }
         try
         {
-            m_components[name] = DSL_RTSP_SINK_NEW(name, host, udpPort, rtspPort, codec, bitrate, interval);
+            if (!m_pipelines[pipeline]->SetStreamMuxBatchProperties(batchSize, batchTimeout))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Set the Stream Muxer Batch Properties");
+                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("New RTSP Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer Batch Properties");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("New RTSP Sink '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::SinkRtspServerSettingsGet(const char* name, uint* udpPort, uint* rtspPort, uint* codec)
+
+    DslReturnType Services::PipelineStreamMuxDimensionsGet(const char* pipeline,
+        uint* width, uint* height)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            DSL_RTSP_SINK_PTR rtspSinkBintr = 
-                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
-
-            rtspSinkBintr->GetServerSettings(udpPort, rtspPort, codec);
+            if (!m_pipelines[pipeline]->GetStreamMuxDimensions(width, height))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Get the Stream Muxer Output Dimensions");
+                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer Output Dimensions");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkRtspEncoderSettingsGet(const char* name, uint* bitrate, uint* interval)
+        
+    DslReturnType Services::PipelineStreamMuxDimensionsSet(const char* pipeline,
+        uint width, uint height)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
-
-            DSL_RTSP_SINK_PTR rtspSinkBintr = 
-                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
-
-            rtspSinkBintr->GetEncoderSettings(bitrate, interval);
+            if (!m_pipelines[pipeline]->SetStreamMuxDimensions(width, height))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Set the Stream Muxer Output Dimensions");
+                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("RTSP Sink '" << name << "' threw an exception getting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer output size");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkRtspEncoderSettingsSet(const char* name, uint bitrate, uint interval)
+        
+    DslReturnType Services::PipelineStreamMuxPaddingGet(const char* pipeline,
+        boolean* enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, RtspSinkBintr);
-
-            DSL_RTSP_SINK_PTR rtspSinkBintr = 
-                std::dynamic_pointer_cast<RtspSinkBintr>(m_components[name]);
-
-            if (m_components[name]->IsInUse())
-            {
-                LOG_ERROR("Unable to set Encoder settings for RTSP Sink '" << name 
-                    << "' as it's currently in use");
-                return DSL_RESULT_SINK_IS_IN_USE;
-            }
-
-            if (!rtspSinkBintr->SetEncoderSettings(bitrate, interval))
+            if (!m_pipelines[pipeline]->GetStreamMuxPadding((bool*)enabled))
             {
-                LOG_ERROR("RTSP Sink '" << name << "' failed to set Encoder settings");
-                return DSL_RESULT_SINK_SET_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Get the Stream Muxer is Padding enabled setting");
+                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("RTSP Sink '" << name << "' threw an exception setting Encoder settings");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline
+                << "' threw an exception getting the Stream Muxer padding");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkImageNew(const char* name, const char* outdir)
+        
+    DslReturnType Services::PipelineStreamMuxPaddingSet(const char* pipeline,
+        boolean enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        struct stat info;
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
-        // ensure component name uniqueness 
-        if (m_components.find(name) != m_components.end())
-        {   
-            LOG_ERROR("Sink name '" << name << "' is not unique");
-            return DSL_RESULT_SINK_NAME_NOT_UNIQUE;
-        }
-        // ensure outdir exists
-        if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
-        {
-            LOG_ERROR("Unable to access outdir '" << outdir << "' for Image Sink '" << name << "'");
-            return DSL_RESULT_SINK_FILE_PATH_NOT_FOUND;
-        }
         try
         {
-            m_components[name] = DSL_IMAGE_SINK_NEW(name, outdir);
+            if (!m_pipelines[pipeline]->SetStreamMuxPadding((bool)enabled))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to Get the Stream Muxer is Padding enabled setting");
+                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("New Image Sink '" << name << "' threw exception on create");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the Stream Muxer padding");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("New Image Sink '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::SinkImageOutdirGet(const char* name, const char** outdir)
+        
+    DslReturnType Services::PipelineSurfaceBudgetGet(const char* pipeline, 
+        uint* budget, uint* policy)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            *outdir = sinkBintr->GetOutdir();
+            m_pipelines[pipeline]->GetSurfaceBudget(budget, policy);
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw exception on Outdir get");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the surface budget");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkImageOutdirSet(const char* name, const char* outdir)
+        
+    DslReturnType Services::PipelineSurfaceBudgetSet(const char* pipeline, 
+        uint budget, uint policy)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            // ensure outdir exists
-            struct stat info;
-            if ((stat(outdir, &info) != 0) or !(info.st_mode & S_IFDIR))
-            {
-                LOG_ERROR("Unable to access outdir '" << outdir << "' for Image Sink '" << name << "'");
-                return DSL_RESULT_SINK_FILE_PATH_NOT_FOUND;
-            }
-            
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            if (!sinkBintr->SetOutdir(outdir))
+            if (!m_pipelines[pipeline]->SetSurfaceBudget(budget, policy))
             {
-                LOG_ERROR("Failed to set outdir '" << outdir << "' for Image Sink '" << name << "'");
-                return DSL_RESULT_SINK_SET_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline << "' failed to set the surface budget");
+                return DSL_RESULT_PIPELINE_SURFACE_BUDGET_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw exception on Outdir set");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the surface budget");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-
         return DSL_RESULT_SUCCESS;
     }
-
-
-    DslReturnType Services::SinkImageFrameCaptureIntervalGet(const char* name, uint* interval)
+        
+    DslReturnType Services::PipelineSurfaceMemoryGet(const char* pipeline, uint* size)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            *interval = sinkBintr->GetFrameCaptureInterval();
+            *size = m_pipelines[pipeline]->GetProjectedSurfaceMemory();
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw an exception getting Frame Capture interval");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the projected surface memory");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkImageFrameCaptureIntervalSet(const char* name, uint interval)
+        
+    DslReturnType Services::PipelineLatencyTracingEnabledGet(const char* pipeline, 
+        boolean* enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            if (!sinkBintr->SetFrameCaptureInterval(interval))
-            {
-                LOG_ERROR("Image Sink '" << name << "' failed to set Frame Capture interval");
-                return DSL_RESULT_SINK_SET_FAILED;
-            }
+            *enabled = m_pipelines[pipeline]->GetLatencyTracingEnabled();
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw an exception setting Frame Capture interval");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the latency tracing enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkImageFrameCaptureEnabledGet(const char* name, boolean* enabled)
+        
+    DslReturnType Services::PipelineLatencyTracingEnabledSet(const char* pipeline, 
+        boolean enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            *enabled = sinkBintr->GetFrameCaptureEnabled();
+            m_pipelines[pipeline]->SetLatencyTracingEnabled(enabled);
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw an exception getting Frame Capture enabled");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the latency tracing enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkImageFrameCaptureEnabledSet(const char* name, boolean enabled)
+        
+    DslReturnType Services::PipelineLinkOptimizationEnabledGet(const char* pipeline, 
+        boolean* enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            if (!sinkBintr->SetFrameCaptureEnabled(enabled))
-            {
-                LOG_ERROR("Image Sink '" << name << "' failed to set Frame Capture enabled");
-                return DSL_RESULT_SINK_SET_FAILED;
-            }
+            *enabled = m_pipelines[pipeline]->GetLinkOptimizationEnabled();
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw an exception setting Frame Capture enabled");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the link optimization enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkImageObjectCaptureEnabledGet(const char* name, boolean* enabled)
+        
+    DslReturnType Services::PipelineLinkOptimizationEnabledSet(const char* pipeline, 
+        boolean enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            *enabled = sinkBintr->GetObjectCaptureEnabled();
+            if (!m_pipelines[pipeline]->SetLinkOptimizationEnabled(enabled))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to set the link optimization enabled setting");
+                return DSL_RESULT_PIPELINE_LINK_OPTIMIZATION_SET_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw an exception getting Object Capture enabled");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the link optimization enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkImageObjectCaptureEnabledSet(const char* name, boolean enabled)
+        
+    DslReturnType Services::PipelineLinkOptimizationReportGet(const char* pipeline, 
+        const char** report)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        try
-        {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
-            if (!sinkBintr->SetObjectCaptureEnabled(enabled))
-            {
-                LOG_ERROR("Image Sink '" << name << "' failed to set Object Capture enabled");
-                return DSL_RESULT_SINK_SET_FAILED;
-            }
+        try
+        {
+            *report = m_pipelines[pipeline]->GetLinkOptimizationReport();
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw an exception setting Object Capture enabled");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the link optimization report");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::SinkImageObjectCaptureClassAdd(const char* name, 
-        uint classId, boolean fullFrame, uint captureLimit)
+        
+    DslReturnType Services::PipelineThreadRoleAffinityGet(const char* pipeline, 
+        uint role, const char** cpus, int* priority)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            if (!sinkBintr->AddObjectCaptureClass(classId, fullFrame, captureLimit))
+            if (!m_pipelines[pipeline]->GetThreadRoleAffinity(role, cpus, priority))
             {
-                LOG_ERROR("Image Sink '" << name << "' failed to add Object Capture Class");
-                return DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_ADD_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to get the affinity for thread role " << role);
+                return DSL_RESULT_PIPELINE_THREAD_AFFINITY_GET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Image Sink '" << name << "' threw an exception adding Object Capture Class");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the affinity for thread role " << role);
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::SinkImageObjectCaptureClassRemove(const char* name, uint classId)
+        
+    DslReturnType Services::PipelineThreadRoleAffinitySet(const char* pipeline, 
+        uint role, const char* cpus, int priority)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, name);
-            RETURN_IF_COMPONENT_IS_NOT_CORRECT_TYPE(m_components, name, ImageSinkBintr);
-
-            DSL_IMAGE_SINK_PTR sinkBintr = 
-                std::dynamic_pointer_cast<ImageSinkBintr>(m_components[name]);
-
-            if (!sinkBintr->RemoveObjectCaptureClass(classId))
+            if (!m_pipelines[pipeline]->SetThreadRoleAffinity(role, cpus, priority))
             {
-                LOG_ERROR("Image Sink '" << name << "' failed to remove Object Capture Class");
-                return DSL_RESULT_SINK_OBJECT_CAPTURE_CLASS_REMOVE_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to set the affinity for thread role " << role);
+                return DSL_RESULT_PIPELINE_THREAD_AFFINITY_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("OSD '" << name << "' threw an exception removing Redaction Class");
-            return DSL_RESULT_SINK_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the affinity for thread role " << role);
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    uint Services::SinkNumInUseGet()
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-
-        return GetNumSinksInUse();
-    }
-    
-    uint Services::SinkNumInUseMaxGet()
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         
-        return m_sinkNumInUseMax;
-    }
-    
-    boolean Services::SinkNumInUseMaxSet(uint max)
+    DslReturnType Services::PipelineThreadReportGet(const char* pipeline, 
+        const char** report)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        uint numInUse(0);
-        
-        if (max < GetNumSinksInUse())
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+
+        try
         {
-            LOG_ERROR("max setting = " << max << 
-                " is less than the current number of Sinks in use = " << numInUse);
-            return false;
+            *report = m_pipelines[pipeline]->GetThreadReport();
         }
-        m_sinkNumInUseMax = max;
-        return true;
-    }
-
-
-    DslReturnType Services::ComponentDelete(const char* component)
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
-        
-        if (m_components[component]->IsInUse())
+        catch(...)
         {
-            LOG_INFO("Component '" << component << "' is in use");
-            return DSL_RESULT_COMPONENT_IN_USE;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the thread report");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        m_components.erase(component);
-
-        LOG_INFO("Component '" << component << "' deleted successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::ComponentDeleteAll()
+        
+    DslReturnType Services::PipelineLatencyReportGet(const char* pipeline, 
+        const char** report)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
-        // Only if there are Pipelines do we check if the component is in use.
-        if (m_pipelines.size())
+        try
         {
-            for (auto const& imap: m_components)
-            {
-                // In the case of Delete all
-                if (imap.second->IsInUse())
-                {
-                    LOG_ERROR("Component '" << imap.second->GetName() << "' is currently in use");
-                    return DSL_RESULT_COMPONENT_IN_USE;
-                }
-            }
+            *report = m_pipelines[pipeline]->GetLatencyReport();
         }
-
-        for (auto const& imap: m_components)
+        catch(...)
         {
-            m_components.erase(imap.second->GetName());
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the latency report");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("All Components deleted successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-
-    uint Services::ComponentListSize()
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         
-        return m_components.size();
-    }
-
-    DslReturnType Services::ComponentGpuIdGet(const char* component, uint* gpuid)
+    DslReturnType Services::PipelinePerfEnabledGet(const char* pipeline, 
+        boolean* enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
-        
-        if (m_components[component]->IsInUse())
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+
+        try
         {
-            LOG_INFO("Component '" << component << "' is in use");
-            return DSL_RESULT_COMPONENT_IN_USE;
+            *enabled = m_pipelines[pipeline]->GetPerfEnabled();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the perf enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        *gpuid = m_components[component]->GetGpuId();
-
-        LOG_INFO("Current GPU ID = " << *gpuid << " for component '" << component << "'");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::ComponentGpuIdSet(const char* component, uint gpuid)
+        
+    DslReturnType Services::PipelinePerfEnabledSet(const char* pipeline, 
+        boolean enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
-        
-        if (m_components[component]->IsInUse())
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+
+        try
         {
-            LOG_INFO("Component '" << component << "' is in use");
-            return DSL_RESULT_COMPONENT_IN_USE;
+            m_pipelines[pipeline]->SetPerfEnabled(enabled);
         }
-        if (!m_components[component]->SetGpuId(gpuid))
+        catch(...)
         {
-            LOG_INFO("Component '" << component << "' faild to set GPU ID = " << gpuid);
-            return DSL_RESULT_COMPONENT_SET_GPUID_FAILED;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the perf enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-
-        LOG_INFO("New GPU ID = " << gpuid << " for component '" << component << "'");
-
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::BranchNew(const char* name)
+        
+    DslReturnType Services::PipelinePerfIntervalGet(const char* pipeline, 
+        uint* interval)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (m_components[name])
-        {   
-            LOG_ERROR("Branch name '" << name << "' is not unique");
-            return DSL_RESULT_BRANCH_NAME_NOT_UNIQUE;
-        }
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+
         try
         {
-            m_components[name] = std::shared_ptr<Bintr>(new BranchBintr(name));
+            *interval = m_pipelines[pipeline]->GetPerfInterval();
         }
         catch(...)
         {
-            LOG_ERROR("New Branch '" << name << "' threw exception on create");
-            return DSL_RESULT_BRANCH_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the perf interval");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("new BRANCH '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::BranchComponentAdd(const char* branch, 
-        const char* component)
+        
+    DslReturnType Services::PipelinePerfIntervalSet(const char* pipeline, 
+        uint interval)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            // Can't add components if they're In use by another Pipeline
-            if (m_components[component]->IsInUse())
-            {
-                LOG_ERROR("Unable to add component '" << component 
-                    << "' as it's currently in use");
-                return DSL_RESULT_COMPONENT_IN_USE;
-            }
-
-            // Check for MAX Sources in Use - Do not exceed!
-            if (IsSourceComponent(component) )
-            {
-                LOG_ERROR("Can't add source '" << component << "' to branch '" << branch << 
-                    "' sources can only be added to Pipelines");
-                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
-            }
-
-            if (IsSinkComponent(component) and (GetNumSinksInUse() == m_sinkNumInUseMax))
+            if (!m_pipelines[pipeline]->SetPerfInterval(interval))
             {
-                LOG_ERROR("Adding Sink '" << component << "' to Branch '" << branch << 
-                    "' would exceed the maximum num-in-use limit");
-                return DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED;
-            }
-            if (!m_components[component]->AddToParent(m_components[branch]))
-            {
-                LOG_ERROR("Branch '" << branch
-                    << "' failed to add component '" << component << "'");
-                return DSL_RESULT_BRANCH_COMPONENT_ADD_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to set the perf interval");
+                return DSL_RESULT_PIPELINE_PERF_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Branch '" << branch
-                << "' threw exception adding component '" << component << "'");
-            return DSL_RESULT_BRANCH_THREW_EXCEPTION;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the perf interval");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("Component '" << component 
-            << "' was added to Branch '" << branch << "' successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::BranchComponentRemove(const char* branch, 
-        const char* component)
+        
+    DslReturnType Services::PipelinePerfGet(const char* pipeline, uint sourceId, 
+        double* fps, double* latencyP50, double* latencyP95, double* latencyP99, uint* drops)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, branch);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
-        if (!m_components[component]->IsParent(m_components[branch]))
-        {
-            LOG_ERROR("Component '" << component << 
-                "' is not in use by Branch '" << branch << "'");
-            return DSL_RESULT_COMPONENT_NOT_USED_BY_BRANCH;
-        }
         try
         {
-            if (!m_components[component]->RemoveFromParent(m_components[branch]))
+            if (!m_pipelines[pipeline]->GetPerf(sourceId, fps, 
+                latencyP50, latencyP95, latencyP99, drops))
             {
-                LOG_ERROR("Branch '" << branch
-                    << "' failed to remove component '" << component << "'");
-                return DSL_RESULT_BRANCH_COMPONENT_REMOVE_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to get the perf for source-id " << sourceId);
+                return DSL_RESULT_PIPELINE_PERF_GET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Branch '" << branch 
-                << "' threw an exception removing component");
-            return DSL_RESULT_BRANCH_COMPONENT_REMOVE_FAILED;
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting perf");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("Component '" << component 
-            << "' was removed from Branch '" << branch << "' successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-    
-    DslReturnType Services::PipelineNew(const char* name)
+        
+    DslReturnType Services::PipelinePerfListenerAdd(const char* pipeline, 
+        dsl_perf_listener_cb listener, void* userdata)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
-        
-        if (m_pipelines[name])
-        {   
-            LOG_ERROR("Pipeline name '" << name << "' is not unique");
-            return DSL_RESULT_PIPELINE_NAME_NOT_UNIQUE;
-        }
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+
         try
         {
-            m_pipelines[name] = std::shared_ptr<PipelineBintr>(new PipelineBintr(name));
+            if (!m_pipelines[pipeline]->AddPerfListener(listener, userdata))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to add a Perf Listener");
+                return DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED;
+            }
         }
         catch(...)
         {
-            LOG_ERROR("New Pipeline '" << name << "' threw exception on create");
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception adding a Perf Listener");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("new PIPELINE '" << name << "' created successfully");
-
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PipelineDelete(const char* pipeline)
+        
+    DslReturnType Services::PipelinePerfListenerRemove(const char* pipeline, 
+        dsl_perf_listener_cb listener)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
-        m_pipelines[pipeline]->RemoveAllChildren();
-        m_pipelines.erase(pipeline);
-
-        LOG_INFO("Pipeline '" << pipeline << "' deleted successfully");
-
+        try
+        {
+            if (!m_pipelines[pipeline]->RemovePerfListener(listener))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to remove a Perf Listener");
+                return DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception removing a Perf Listener");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PipelineDeleteAll()
+        
+    DslReturnType Services::PipelineSgieLinkModeGet(const char* pipeline, 
+        uint* mode)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
-        for (auto &imap: m_pipelines)
+        try
         {
-            imap.second->RemoveAllChildren();
-            imap.second = nullptr;
+            *mode = m_pipelines[pipeline]->GetSecondaryGieLinkMode();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the SGIE link mode");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        m_pipelines.clear();
-
         return DSL_RESULT_SUCCESS;
     }
-
-    uint Services::PipelineListSize()
-    {
-        LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
         
-        return m_pipelines.size();
-    }
-    
-    DslReturnType Services::PipelineComponentAdd(const char* pipeline, 
-        const char* component)
+    DslReturnType Services::PipelineSgieLinkModeSet(const char* pipeline, 
+        uint mode)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
-        
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+
         try
         {
-            // Can't add components if they're In use by another Pipeline
-            if (m_components[component]->IsInUse())
-            {
-                LOG_ERROR("Unable to add component '" << component 
-                    << "' as it's currently in use");
-                return DSL_RESULT_COMPONENT_IN_USE;
-            }
-
-            // Check for MAX Sources in Use - Do not exceed!
-            if (IsSourceComponent(component) and (GetNumSourcesInUse() == m_sourceNumInUseMax))
-            {
-                LOG_ERROR("Adding Source '" << component << "' to Pipeline '" << pipeline << 
-                    "' would exceed the maximum num-in-use limit");
-                return DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED;
-            }
-
-            if (IsSinkComponent(component) and (GetNumSinksInUse() == m_sinkNumInUseMax))
+            if (!m_pipelines[pipeline]->SetSecondaryGieLinkMode(mode))
             {
-                LOG_ERROR("Adding Sink '" << component << "' to Pipeline '" << pipeline << 
-                    "' would exceed the maximum num-in-use limit");
-                return DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED;
-            }
-
-            if (!m_components[component]->AddToParent(m_pipelines[pipeline]))
-            {
-                LOG_ERROR("Pipeline '" << pipeline
-                    << "' failed component '" << component << "'");
-                return DSL_RESULT_PIPELINE_COMPONENT_ADD_FAILED;
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to set the SGIE link mode");
+                return DSL_RESULT_PIPELINE_SGIE_LINK_MODE_SET_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Pipeline '" << pipeline
-                << "' threw exception adding component '" << component << "'");
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the SGIE link mode");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
-        LOG_INFO("Component '" << component 
-            << "' was added to Pipeline '" << pipeline << "' successfully");
-
         return DSL_RESULT_SUCCESS;
-    }    
-    
-    DslReturnType Services::PipelineComponentRemove(const char* pipeline, 
-        const char* component)
+    }
+        
+    DslReturnType Services::PipelineClassificationCacheEnabledGet(const char* pipeline, 
+        boolean* enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
-        RETURN_IF_COMPONENT_NAME_NOT_FOUND(m_components, component);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
-        if (!m_components[component]->IsParent(m_pipelines[pipeline]))
-        {
-            LOG_ERROR("Component '" << component << 
-                "' is not in use by Pipeline '" << pipeline << "'");
-            return DSL_RESULT_COMPONENT_NOT_USED_BY_PIPELINE;
-        }
         try
         {
-            m_components[component]->RemoveFromParent(m_pipelines[pipeline]);
+            *enabled = m_pipelines[pipeline]->GetClassificationCacheEnabled();
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception removing component");
-            return DSL_RESULT_PIPELINE_COMPONENT_REMOVE_FAILED;
+                << "' threw an exception getting the classification cache enabled setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
-}
-    
-    DslReturnType Services::PipelineStreamMuxBatchPropertiesGet(const char* pipeline,
-        uint* batchSize, uint* batchTimeout)    
+    }
+        
+    DslReturnType Services::PipelineClassificationCacheEnabledSet(const char* pipeline, 
+        boolean enabled)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            m_pipelines[pipeline]->GetStreamMuxBatchProperties(batchSize, batchTimeout);
+            if (!m_pipelines[pipeline]->SetClassificationCacheEnabled(enabled))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to set the classification cache enabled setting");
+                return DSL_RESULT_PIPELINE_CACHE_SET_FAILED;
+            }
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception getting the Stream Muxer Batch Properties");
+                << "' threw an exception setting the classification cache enabled setting");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PipelineStreamMuxBatchPropertiesSet(const char* pipeline,
-        uint batchSize, uint batchTimeout)    
+        
+    DslReturnType Services::PipelineClassificationCacheSettingsGet(const char* pipeline, 
+        uint* minCount, double* minConfidence, uint* ttl)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            if (!m_pipelines[pipeline]->SetStreamMuxBatchProperties(batchSize, batchTimeout))
-            {
-                LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Set the Stream Muxer Batch Properties");
-                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
-            }
+            m_pipelines[pipeline]->GetClassificationCacheSettings(minCount, minConfidence, ttl);
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception setting the Stream Muxer Batch Properties");
+                << "' threw an exception getting the classification cache settings");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
-
-    DslReturnType Services::PipelineStreamMuxDimensionsGet(const char* pipeline,
-        uint* width, uint* height)    
+        
+    DslReturnType Services::PipelineClassificationCacheSettingsSet(const char* pipeline, 
+        uint minCount, double minConfidence, uint ttl)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            if (!m_pipelines[pipeline]->GetStreamMuxDimensions(width, height))
+            if (!m_pipelines[pipeline]->SetClassificationCacheSettings(minCount, minConfidence, ttl))
             {
                 LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Get the Stream Muxer Output Dimensions");
-                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+                    << "' failed to set the classification cache settings");
+                return DSL_RESULT_PIPELINE_CACHE_SET_FAILED;
             }
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception setting the Stream Muxer Output Dimensions");
+                << "' threw an exception setting the classification cache settings");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
         
-    DslReturnType Services::PipelineStreamMuxDimensionsSet(const char* pipeline,
-        uint width, uint height)    
+    DslReturnType Services::PipelineClassificationCacheStatsGet(const char* pipeline, 
+        double* hitRate, uint* entries)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            if (!m_pipelines[pipeline]->SetStreamMuxDimensions(width, height))
+            if (!m_pipelines[pipeline]->GetClassificationCacheStats(hitRate, entries))
             {
                 LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Set the Stream Muxer Output Dimensions");
-                return DSL_RESULT_PIPELINE_STREAMMUX_SET_FAILED;
+                    << "' failed to get the classification cache stats");
+                return DSL_RESULT_PIPELINE_CACHE_GET_FAILED;
             }
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception setting the Stream Muxer output size");
+                << "' threw an exception getting the classification cache stats");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
         
-    DslReturnType Services::PipelineStreamMuxPaddingGet(const char* pipeline,
-        boolean* enabled)    
+    DslReturnType Services::PipelineTraceStart(const char* pipeline, 
+        const char* filePath, uint format)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            if (!m_pipelines[pipeline]->GetStreamMuxPadding((bool*)enabled))
+            if (!m_pipelines[pipeline]->StartTrace(filePath, format))
             {
                 LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Get the Stream Muxer is Padding enabled setting");
-                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+                    << "' failed to start a trace");
+                return DSL_RESULT_PIPELINE_TRACE_FAILED;
             }
         }
         catch(...)
         {
-            LOG_ERROR("Pipeline '" << pipeline
-                << "' threw an exception getting the Stream Muxer padding");
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception starting a trace");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
     }
         
-    DslReturnType Services::PipelineStreamMuxPaddingSet(const char* pipeline,
-        boolean enabled)    
+    DslReturnType Services::PipelineTraceStop(const char* pipeline)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
-            if (!m_pipelines[pipeline]->SetStreamMuxPadding((bool)enabled))
+            if (!m_pipelines[pipeline]->StopTrace())
             {
                 LOG_ERROR("Pipeline '" << pipeline 
-                    << "' failed to Get the Stream Muxer is Padding enabled setting");
-                return DSL_RESULT_PIPELINE_STREAMMUX_GET_FAILED;
+                    << "' failed to stop its trace");
+                return DSL_RESULT_PIPELINE_TRACE_FAILED;
             }
         }
         catch(...)
         {
             LOG_ERROR("Pipeline '" << pipeline 
-                << "' threw an exception setting the Stream Muxer padding");
+                << "' threw an exception stopping its trace");
             return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
         }
         return DSL_RESULT_SUCCESS;
@@ -4950,8 +8567,10 @@ namespace DSL
     DslReturnType Services::PipelineXWindowClear(const char* pipeline)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
@@ -4973,8 +8592,10 @@ namespace DSL
         uint* width, uint* height)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
@@ -4993,8 +8614,10 @@ namespace DSL
         uint width, uint height)    
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
@@ -5017,8 +8640,10 @@ namespace DSL
     DslReturnType Services::PipelinePause(const char* pipeline)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         if (!std::dynamic_pointer_cast<PipelineBintr>(m_pipelines[pipeline])->Pause())
         {
@@ -5028,10 +8653,57 @@ namespace DSL
         return DSL_RESULT_SUCCESS;
     }
 
+    DslReturnType Services::PipelinePrepare(const char* pipeline, 
+        dsl_prepare_complete_cb listener, void* userData)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+
+        try
+        {
+            if (!std::dynamic_pointer_cast<PipelineBintr>(m_pipelines[pipeline])->
+                Prepare(listener, userData))
+            {
+                return DSL_RESULT_PIPELINE_FAILED_TO_PREPARE;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline << "' threw an exception on Prepare");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelinePrepareReportGet(const char* pipeline, 
+        const char** report)    
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+
+        try
+        {
+            *report = m_pipelines[pipeline]->GetPrepareReport();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the prepare report");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
     DslReturnType Services::PipelinePlay(const char* pipeline)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
         if (!std::dynamic_pointer_cast<PipelineBintr>(m_pipelines[pipeline])->Play())
@@ -5045,7 +8717,8 @@ namespace DSL
     DslReturnType Services::PipelineStop(const char* pipeline)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_WRITER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
 
         if (!std::dynamic_pointer_cast<PipelineBintr>(m_pipelines[pipeline])->Stop())
@@ -5059,8 +8732,10 @@ namespace DSL
     DslReturnType Services::PipelineGetState(const char* pipeline)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         return DSL_RESULT_API_NOT_IMPLEMENTED;
     }
@@ -5068,8 +8743,10 @@ namespace DSL
     DslReturnType Services::PipelineDumpToDot(const char* pipeline, char* filename)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         // TODO check state of debug env var and return NON-success if not set
 
@@ -5081,8 +8758,10 @@ namespace DSL
     DslReturnType Services::PipelineDumpToDotWithTs(const char* pipeline, char* filename)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         // TODO check state of debug env var and return NON-success if not set
 
@@ -5095,8 +8774,10 @@ namespace DSL
         dsl_state_change_listener_cb listener, void* userdata)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
@@ -5120,8 +8801,10 @@ namespace DSL
         dsl_state_change_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
     
         try
         {
@@ -5145,8 +8828,10 @@ namespace DSL
         dsl_eos_listener_cb listener, void* userdata)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
 
         try
         {
@@ -5170,8 +8855,10 @@ namespace DSL
         dsl_eos_listener_cb listener)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
     
         try
         {
@@ -5195,8 +8882,10 @@ namespace DSL
         dsl_xwindow_key_event_handler_cb handler, void* userdata)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
         
         try
         {
@@ -5220,8 +8909,10 @@ namespace DSL
         dsl_xwindow_key_event_handler_cb handler)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
         
         try
         {
@@ -5245,8 +8936,10 @@ namespace DSL
         dsl_xwindow_button_event_handler_cb handler, void* userdata)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
         
         try
         {
@@ -5270,8 +8963,10 @@ namespace DSL
         dsl_xwindow_button_event_handler_cb handler)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
         
         try
         {
@@ -5295,8 +8990,10 @@ namespace DSL
         dsl_xwindow_delete_event_handler_cb handler, void* userdata)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
         
         try
         {
@@ -5320,8 +9017,10 @@ namespace DSL
         dsl_xwindow_delete_event_handler_cb handler)
     {
         LOG_FUNC();
-        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_servicesMutex);
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
         RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
         
         try
         {
@@ -5341,13 +9040,116 @@ namespace DSL
         return DSL_RESULT_SUCCESS;
     }
 
+    DslReturnType Services::PipelineMainContextEnabledGet(const char* pipeline, 
+        boolean* enabled)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+        
+        try
+        {
+            *enabled = m_pipelines[pipeline]->GetMainContextEnabled();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the main context setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineMainContextEnabledSet(const char* pipeline, 
+        boolean enabled)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+        
+        try
+        {
+            if (!m_pipelines[pipeline]->SetMainContextEnabled(enabled))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to set the main context setting");
+                return DSL_RESULT_PIPELINE_MAIN_CONTEXT_SET_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception setting the main context setting");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineEventFdGet(const char* pipeline, int* fd)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+        RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+        LOCK_COMPONENT_FOR_CURRENT_SCOPE(m_pipelines, pipeline);
+        
+        try
+        {
+            if (!m_pipelines[pipeline]->GetEventFd(fd))
+            {
+                LOG_ERROR("Pipeline '" << pipeline 
+                    << "' failed to get the event fd");
+                return DSL_RESULT_PIPELINE_EVENT_FD_FAILED;
+            }
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception getting the event fd");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
+    DslReturnType Services::PipelineEventsDispatch(const char* pipeline, uint* count)
+    {
+        LOG_FUNC();
+        TRACE_SCOPE("api", __func__);
+        
+        // Hold a reference to the Pipeline so that the Services lock can be
+        // released before calling the client's listeners, which may call back in
+        std::shared_ptr<PipelineBintr> pPipeline;
+        {
+            LOCK_SERVICES_READER_FOR_CURRENT_SCOPE();
+            RETURN_IF_PIPELINE_NAME_NOT_FOUND(m_pipelines, pipeline);
+            
+            pPipeline = m_pipelines[pipeline];
+        }
+        try
+        {
+            *count = pPipeline->DispatchEvents();
+        }
+        catch(...)
+        {
+            LOG_ERROR("Pipeline '" << pipeline 
+                << "' threw an exception dispatching events");
+            return DSL_RESULT_PIPELINE_THREW_EXCEPTION;
+        }
+        return DSL_RESULT_SUCCESS;
+    }
+
     bool Services::IsSourceComponent(const char* component)
     {
         LOG_FUNC();
      
         return (m_components[component]->IsType(typeid(CsiSourceBintr)) or 
             m_components[component]->IsType(typeid(UriSourceBintr)) or
-            m_components[component]->IsType(typeid(RtspSourceBintr)));
+            m_components[component]->IsType(typeid(RtspSourceBintr)) or
+            m_components[component]->IsType(typeid(MultiImageSourceBintr)));
     }
  
     uint Services::GetNumSourcesInUse()
@@ -5419,6 +9221,7 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_COMPONENT_NOT_USED_BY_BRANCH] = L"DSL_RESULT_COMPONENT_NOT_USED_BY_BRANCH";
         m_returnValueToString[DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE] = L"DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE";
         m_returnValueToString[DSL_RESULT_COMPONENT_SET_GPUID_FAILED] = L"DSL_RESULT_COMPONENT_SET_GPUID_FAILED";
+        m_returnValueToString[DSL_RESULT_COMPONENT_QUEUE_POLICY_SET_FAILED] = L"DSL_RESULT_COMPONENT_QUEUE_POLICY_SET_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_RESULT] = L"DSL_RESULT_SOURCE_RESULT";
         m_returnValueToString[DSL_RESULT_SOURCE_NAME_NOT_UNIQUE] = L"DSL_RESULT_SOURCE_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_SOURCE_NAME_NOT_FOUND] = L"DSL_RESULT_SOURCE_NAME_NOT_FOUND";
@@ -5433,6 +9236,10 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED] = L"DSL_RESULT_SOURCE_DEWARPER_ADD_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED] = L"DSL_RESULT_SOURCE_DEWARPER_REMOVE_FAILED";
         m_returnValueToString[DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE] = L"DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE";
+        m_returnValueToString[DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED] = L"DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED";
+        m_returnValueToString[DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED] = L"DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED";
+        m_returnValueToString[DSL_RESULT_SOURCE_SWITCH_FAILED] = L"DSL_RESULT_SOURCE_SWITCH_FAILED";
+        m_returnValueToString[DSL_RESULT_SOURCE_SET_FAILED] = L"DSL_RESULT_SOURCE_SET_FAILED";
         m_returnValueToString[DSL_RESULT_DEWARPER_RESULT] = L"DSL_RESULT_DEWARPER_RESULT";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE] = L"DSL_RESULT_DEWARPER_NAME_NOT_UNIQUE";
         m_returnValueToString[DSL_RESULT_DEWARPER_NAME_NOT_FOUND] = L"DSL_RESULT_DEWARPER_NAME_NOT_FOUND";
@@ -5543,8 +9350,17 @@ namespace DSL
         m_returnValueToString[DSL_RESULT_PIPELINE_FAILED_TO_PLAY] = L"DSL_RESULT_PIPELINE_FAILED_TO_PLAY";
         m_returnValueToString[DSL_RESULT_PIPELINE_FAILED_TO_PAUSE] = L"DSL_RESULT_PIPELINE_FAILED_TO_PAUSE";
         m_returnValueToString[DSL_RESULT_PIPELINE_FAILED_TO_STOP] = L"DSL_RESULT_PIPELINE_FAILED_TO_STOP";
+        m_returnValueToString[DSL_RESULT_PIPELINE_FAILED_TO_PREPARE] = L"DSL_RESULT_PIPELINE_FAILED_TO_PREPARE";
+        m_returnValueToString[DSL_RESULT_PIPELINE_LINK_OPTIMIZATION_SET_FAILED] = L"DSL_RESULT_PIPELINE_LINK_OPTIMIZATION_SET_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_DEFINITION_INVALID] = L"DSL_RESULT_PIPELINE_DEFINITION_INVALID";
+        m_returnValueToString[DSL_RESULT_PIPELINE_THREAD_AFFINITY_GET_FAILED] = L"DSL_RESULT_PIPELINE_THREAD_AFFINITY_GET_FAILED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_THREAD_AFFINITY_SET_FAILED] = L"DSL_RESULT_PIPELINE_THREAD_AFFINITY_SET_FAILED";
         m_returnValueToString[DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED] = L"DSL_RESULT_PIPELINE_SOURCE_MAX_IN_USE_REACHED";
         m_returnValueToString[DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED] = L"DSL_RESULT_PIPELINE_SINK_MAX_IN_USE_REACHED";
+        m_returnValueToString[DSL_RESULT_PIPELINE_SURFACE_BUDGET_SET_FAILED] = L"DSL_RESULT_PIPELINE_SURFACE_BUDGET_SET_FAILED";
+        m_returnValueToString[DSL_RESULT_TRANSACTION_IN_PROGRESS] = L"DSL_RESULT_TRANSACTION_IN_PROGRESS";
+        m_returnValueToString[DSL_RESULT_TRANSACTION_NOT_IN_PROGRESS] = L"DSL_RESULT_TRANSACTION_NOT_IN_PROGRESS";
+        m_returnValueToString[DSL_RESULT_TRANSACTION_VALIDATION_FAILED] = L"DSL_RESULT_TRANSACTION_VALIDATION_FAILED";
         m_returnValueToString[0xFFFFFFFF] = L"Invalid DSL Reslult CODE";
     }
 
@@ -61,14 +61,59 @@ namespace DSL {
         DslReturnType SourceRtspNew(const char* name, const char* uri, 
             uint protocol, uint cudadecMemType, uint intraDecode, uint dropFrameInterval);
             
+        DslReturnType SourceImageMultiNew(const char* name, 
+            const char* location, uint readahead);
+        
+        DslReturnType SourceImageMultiStatsGet(const char* name, 
+            uint* filesRead, double* filesPerSecond);
+        
         DslReturnType SourceDimensionsGet(const char* name, uint* width, uint* height);
         
         DslReturnType SourceFrameRateGet(const char* name, uint* fps_n, uint* fps_d);
 
+        DslReturnType SourceDimensionsGet(DslHandle source, uint* width, uint* height);
+        
+        DslReturnType SourceFrameRateGet(DslHandle source, uint* fps_n, uint* fps_d);
+
         DslReturnType SourceDecodeUriGet(const char* name, const char** uri);
 
         DslReturnType SourceDecodeUriSet(const char* name, const char* uri);
     
+        DslReturnType SourceUriPlaylistAdd(const char* name, const char* uri);
+        
+        DslReturnType SourceUriPlaylistClear(const char* name);
+        
+        DslReturnType SourceUriPlaylistSizeGet(const char* name, uint* size);
+        
+        DslReturnType SourceDecodeSurfacesGet(const char* name, 
+            uint* numDecodeSurfaces, uint* numExtraSurfaces);
+        
+        DslReturnType SourceDecodeSurfacesSet(const char* name, 
+            uint numDecodeSurfaces, uint numExtraSurfaces);
+        
+        DslReturnType SourceDecodeRtspConfigGet(const char* name, uint* latency,
+            boolean* dropOnLatency, boolean* doRetransmission, uint* protocols, 
+            uint* bufferMode, uint* timeout);
+        
+        DslReturnType SourceDecodeRtspConfigSet(const char* name, uint latency,
+            boolean dropOnLatency, boolean doRetransmission, uint protocols, 
+            uint bufferMode, uint timeout);
+        
+        DslReturnType SourceDecodeRtspPresetSet(const char* name, uint preset);
+        
+        DslReturnType SourceDecodeRtspStatsGet(const char* name, double* jitter,
+            uint* packetsReceived, uint* packetsLost);
+        
+        DslReturnType SourceUriSwitch(const char* name, const char* uri);
+        
+        DslReturnType SourceUriSwitchLatencyGet(const char* name, uint* latency);
+        
+        DslReturnType SourceUriPlaylistFileListenerAdd(const char* name, 
+            dsl_playlist_file_listener_cb listener, void* userdata);
+        
+        DslReturnType SourceUriPlaylistFileListenerRemove(const char* name, 
+            dsl_playlist_file_listener_cb listener);
+        
         DslReturnType SourceDecodeDewarperAdd(const char* name, const char* dewarper);
     
         DslReturnType SourceDecodeDewarperRemove(const char* name);
@@ -154,6 +199,14 @@ namespace DSL {
 
         DslReturnType TilerTilesSet(const char* name, uint cols, uint rows);
 
+        DslReturnType TilerDimensionsGet(DslHandle tiler, uint* width, uint* height);
+
+        DslReturnType TilerDimensionsSet(DslHandle tiler, uint width, uint height);
+
+        DslReturnType TilerTilesGet(DslHandle tiler, uint* cols, uint* rows);
+
+        DslReturnType TilerTilesSet(DslHandle tiler, uint cols, uint rows);
+
         DslReturnType TilerBatchMetaHandlerAdd(const char* name, uint pad, dsl_batch_meta_handler_cb handler, void* user_data);
 
         DslReturnType TilerBatchMetaHandlerRemove(const char* name, uint pad, dsl_batch_meta_handler_cb handler);
@@ -263,12 +316,44 @@ namespace DSL {
         
         DslReturnType ComponentGpuIdSet(const char* component, uint gpuid);
         
+        DslReturnType ComponentQueuePolicyGet(const char* component, uint* maxSizeBuffers,
+            uint* maxSizeTime, uint* leaky, uint* latencyBudget);
+        
+        DslReturnType ComponentQueuePolicySet(const char* component, uint maxSizeBuffers,
+            uint maxSizeTime, uint leaky, uint latencyBudget);
+        
+        DslReturnType ComponentQueueDroppedGet(const char* component, uint* dropped);
+        
+        DslReturnType ComponentHandleGet(const char* component, DslHandle* handle);
+
+        DslReturnType ComponentGpuIdGet(DslHandle component, uint* gpuid);
+        
+        DslReturnType ComponentGpuIdSet(DslHandle component, uint gpuid);
+        
         DslReturnType BranchNew(const char* name);
         
         DslReturnType BranchComponentAdd(const char* branch, const char* component);
 
         DslReturnType BranchComponentRemove(const char* branch, const char* component);
 
+        DslReturnType TransactionBegin();
+        
+        /**
+         * @brief commits the calling thread's transaction
+         * @param[in] validateGraph if true, the graphs edited within the transaction
+         * are validated, and all edits undone if invalid. Set to false for the 
+         * services that run as a transaction of their own.
+         */
+        DslReturnType TransactionCommit(bool validateGraph=true);
+        
+        DslReturnType TransactionAbort();
+        
+        /**
+         * @brief checks if the calling thread has a transaction in progress
+         * @return true if the calling thread owns the current transaction
+         */
+        bool TransactionInProgress();
+
         DslReturnType PipelineNew(const char* pipeline);
         
         DslReturnType PipelineDelete(const char* pipeline);
@@ -281,6 +366,10 @@ namespace DSL {
 
         DslReturnType PipelineComponentRemove(const char* pipeline, const char* component);
 
+        DslReturnType PipelineDefinitionLoad(const char* definition, const char** report);
+
+        DslReturnType PipelineDefinitionSave(const char* pipeline, const char* path);
+
         DslReturnType PipelineStreamMuxBatchPropertiesGet(const char* pipeline,
             uint* batchSize, uint* batchTimeout);
 
@@ -297,6 +386,73 @@ namespace DSL {
 
         DslReturnType PipelineStreamMuxPaddingSet(const char* pipeline, boolean enabled);
 
+        DslReturnType PipelineSurfaceBudgetGet(const char* pipeline, uint* budget, uint* policy);
+
+        DslReturnType PipelineSurfaceBudgetSet(const char* pipeline, uint budget, uint policy);
+
+        DslReturnType PipelineSurfaceMemoryGet(const char* pipeline, uint* size);
+
+        DslReturnType PipelineLatencyTracingEnabledGet(const char* pipeline, boolean* enabled);
+
+        DslReturnType PipelineLatencyTracingEnabledSet(const char* pipeline, boolean enabled);
+
+        DslReturnType PipelineLatencyReportGet(const char* pipeline, const char** report);
+        
+        DslReturnType PipelineLinkOptimizationEnabledGet(const char* pipeline, boolean* enabled);
+        
+        DslReturnType PipelineLinkOptimizationEnabledSet(const char* pipeline, boolean enabled);
+        
+        DslReturnType PipelineLinkOptimizationReportGet(const char* pipeline, const char** report);
+        
+        DslReturnType PipelineThreadRoleAffinityGet(const char* pipeline, 
+            uint role, const char** cpus, int* priority);
+        
+        DslReturnType PipelineThreadRoleAffinitySet(const char* pipeline, 
+            uint role, const char* cpus, int priority);
+        
+        DslReturnType PipelineThreadReportGet(const char* pipeline, const char** report);
+
+        DslReturnType PipelinePerfEnabledGet(const char* pipeline, boolean* enabled);
+
+        DslReturnType PipelinePerfEnabledSet(const char* pipeline, boolean enabled);
+
+        DslReturnType PipelinePerfIntervalGet(const char* pipeline, uint* interval);
+
+        DslReturnType PipelinePerfIntervalSet(const char* pipeline, uint interval);
+
+        DslReturnType PipelinePerfGet(const char* pipeline, uint sourceId, double* fps, 
+            double* latencyP50, double* latencyP95, double* latencyP99, uint* drops);
+
+        DslReturnType PipelinePerfListenerAdd(const char* pipeline, 
+            dsl_perf_listener_cb listener, void* userdata);
+
+        DslReturnType PipelinePerfListenerRemove(const char* pipeline, 
+            dsl_perf_listener_cb listener);
+
+        DslReturnType PipelineSgieLinkModeGet(const char* pipeline, uint* mode);
+
+        DslReturnType PipelineSgieLinkModeSet(const char* pipeline, uint mode);
+
+        DslReturnType PipelineClassificationCacheEnabledGet(const char* pipeline, 
+            boolean* enabled);
+
+        DslReturnType PipelineClassificationCacheEnabledSet(const char* pipeline, 
+            boolean enabled);
+
+        DslReturnType PipelineClassificationCacheSettingsGet(const char* pipeline, 
+            uint* minCount, double* minConfidence, uint* ttl);
+
+        DslReturnType PipelineClassificationCacheSettingsSet(const char* pipeline, 
+            uint minCount, double minConfidence, uint ttl);
+
+        DslReturnType PipelineClassificationCacheStatsGet(const char* pipeline, 
+            double* hitRate, uint* entries);
+
+        DslReturnType PipelineTraceStart(const char* pipeline, 
+            const char* filePath, uint format);
+
+        DslReturnType PipelineTraceStop(const char* pipeline);
+
         DslReturnType PipelineXWindowClear(const char* pipeline);
         
         DslReturnType PipelineXWindowDimensionsGet(const char* pipeline,
@@ -305,6 +461,11 @@ namespace DSL {
         DslReturnType PipelineXWindowDimensionsSet(const char* pipeline,
             uint width, uint height);
             
+        DslReturnType PipelinePrepare(const char* pipeline, 
+            dsl_prepare_complete_cb listener, void* userData);
+            
+        DslReturnType PipelinePrepareReportGet(const char* pipeline, const char** report);
+            
         DslReturnType PipelinePause(const char* pipeline);
         
         DslReturnType PipelinePlay(const char* pipeline);
@@ -346,6 +507,16 @@ namespace DSL {
 
         DslReturnType PipelineXWindowDeleteEventHandlerRemove(const char* pipeline, 
             dsl_xwindow_delete_event_handler_cb handler);
+
+        DslReturnType PipelineMainContextEnabledGet(const char* pipeline, 
+            boolean* enabled);
+
+        DslReturnType PipelineMainContextEnabledSet(const char* pipeline, 
+            boolean enabled);
+
+        DslReturnType PipelineEventFdGet(const char* pipeline, int* fd);
+
+        DslReturnType PipelineEventsDispatch(const char* pipeline, uint* count);
         
         GMainLoop* GetMainLoopHandle()
         {
@@ -379,6 +550,121 @@ namespace DSL {
          */
         ~Services();
 
+        /**
+         * @brief private helper function to record a graph edit made within the 
+         * calling thread's transaction, if any, to be undone on abort.
+         * @param[in] editType one of the DSL_TRANSACTION_EDIT constant values
+         * @param[in] parent unique name of the Pipeline, Branch, or Tee edited
+         * @param[in] child unique name of the component added or removed
+         */
+        void TransactionEditRecord(uint editType, const char* parent, const char* child);
+
+        /**
+         * @brief private helper function to record the creation or deletion of a 
+         * Pipeline or Component within the calling thread's transaction, if any.
+         * The original object, and its handle, are kept so that a deletion can be 
+         * undone on abort.
+         * @param[in] editType one of the DSL_TRANSACTION_EDIT constant values
+         * @param[in] name unique name of the Pipeline or Component 
+         * @param[in] pBintr shared pointer to the Pipeline or Component
+         * @param[in] handle handle of the Component being deleted, 0 if none
+         */
+        void TransactionEditRecord(uint editType, const char* name, 
+            DSL_BINTR_PTR pBintr, DslHandle handle=0);
+        
+        /**
+         * @brief private helper function to find a Pipeline or Component by name
+         * without inserting into either map. The caller must hold the Services lock.
+         * @param[in] name unique name of the Pipeline or Component to find
+         * @return shared pointer to the Pipeline or Component, nullptr if not found
+         */
+        DSL_BINTR_PTR TransactionBintrFind(const std::string& name);
+
+        /**
+         * @brief private helper function to validate, on commit, the graph of each 
+         * Pipeline, Branch, Demuxer and Splitter created or edited within the 
+         * transaction. Pipelines require Sources, Pipelines and Branches require 
+         * a Sink, Demuxer or Splitter, and a Primary GIE if a Tracker or 
+         * Secondary GIE is added, and Demuxers and Splitters require a Branch.
+         * @return true if all graphs are valid, false otherwise.
+         */
+        bool TransactionValidate();
+
+        /**
+         * @brief private helper function to undo all edits of the calling thread's
+         * transaction, in reverse order. Called with the Services lock held by the
+         * calling thread for the transaction.
+         */
+        void TransactionUndo();
+
+        /**
+         * @brief private helper function to release the handle slot, if any, 
+         * held by a component that is being deleted. 
+         * @param[in] component unique name of the component being deleted
+         */
+        void ComponentHandleRelease(const char* component);
+
+        /**
+         * @brief private helper function to restore the handle released by a 
+         * component whose deletion is being undone, if its slot has not been 
+         * reused since, so that the client's handle remains valid.
+         * @param[in] component unique name of the restored component
+         * @param[in] handle handle held by the component when deleted
+         * @return true if the handle was restored, false otherwise
+         */
+        bool ComponentHandleRestore(const char* component, DslHandle handle);
+
+        /**
+         * @brief private helper function to create the component defined by
+         * the named group of a Pipeline definition
+         * @param[in] pKeyFile Pipeline definition to create from
+         * @param[in] name unique name of the component, the group name
+         * @return DSL_RESULT_SUCCESS on success, the failing service result otherwise.
+         */
+        DslReturnType DefinitionComponentNew(GKeyFile* pKeyFile, const char* name);
+
+        /**
+         * @brief private helper function to apply the settings of a newly created
+         * component, or Pipeline, that can only be set after construction
+         * @param[in] pKeyFile Pipeline definition to read the settings from
+         * @param[in] name unique name of the component, the group name
+         * @param[in] type definition type of the component
+         * @param[out] pValid cleared if a setting's value is malformed or out of range
+         * @return DSL_RESULT_SUCCESS on success, the failing service result otherwise.
+         */
+        DslReturnType DefinitionSettingsSet(GKeyFile* pKeyFile, const char* name,
+            const std::string& type, bool* pValid);
+
+        /**
+         * @brief private helper function to add the components, or branches, listed 
+         * by the named group of a Pipeline definition to their Pipeline, Branch, or Tee
+         * @param[in] pKeyFile Pipeline definition to add from
+         * @param[in] name unique name of the Pipeline, Branch, or Tee
+         * @return DSL_RESULT_SUCCESS on success, the failing service result otherwise.
+         */
+        DslReturnType DefinitionComponentAdd(GKeyFile* pKeyFile, const char* name);
+
+        /**
+         * @brief private helper function to save the list of child components of
+         * a Pipeline, Branch, or Tee, and the definition of each child, recursively.
+         * @param[in] pKeyFile Pipeline definition to save to
+         * @param[in] parent unique name of the Pipeline, Branch, or Tee
+         * @param[in] pParentBintr shared pointer to the Pipeline, Branch, or Tee
+         * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_DEFINITION_SAVE_FAILED
+         * if a child is of a type not supported by Pipeline definitions.
+         */
+        DslReturnType DefinitionChildrenSave(GKeyFile* pKeyFile, 
+            const char* parent, DSL_BINTR_PTR pParentBintr);
+
+        /**
+         * @brief private helper function to save the definition of a single component
+         * @param[in] pKeyFile Pipeline definition to save to
+         * @param[in] name unique name of the component to save
+         * @return DSL_RESULT_SUCCESS on success, DSL_RESULT_PIPELINE_DEFINITION_SAVE_FAILED
+         * if the component is of a type not supported by Pipeline definitions.
+         */
+        DslReturnType DefinitionComponentSave(GKeyFile* pKeyFile, const char* name);
+
         /**
          * @brief private helper function to test component for Source Type identity
          * @param[in] unique component name check
@@ -431,9 +717,12 @@ namespace DSL {
         GMainLoop* m_pMainLoop;
             
         /**
-         * @brief mutex to prevent Services reentry
+         * @brief reader/writer lock for the Component and Pipeline registries. 
+         * The writer lock is held to create, delete, add, remove, play, and stop. 
+         * All other services hold the reader lock, with property access to a 
+         * single Component or Pipeline serialized by its own API mutex.
         */
-        GMutex m_servicesMutex;
+        GRWLock m_servicesRWLock;
 
         /**
          * @brief maximum number of sources that can be in use at one time
@@ -458,6 +747,67 @@ namespace DSL {
          * @brief map of all pipeline components creaated by the client, key=name
          */
         std::map <std::string, std::shared_ptr<Bintr>> m_components;
+        
+        /**
+         * @brief slot array of all components with handles, indexed by the
+         * slot bits of the handle. Released slots hold nullptr until reused.
+         */
+        std::vector<std::shared_ptr<Bintr>> m_componentSlots;
+        
+        /**
+         * @brief current generation of each slot, incremented on release so that
+         * handles to deleted components are rejected.
+         */
+        std::vector<uint> m_componentSlotGenerations;
+        
+        /**
+         * @brief list of released slots available for reuse
+         */
+        std::vector<uint> m_freeComponentSlots;
+        
+        /**
+         * @brief map of all component handles currently assigned, key=name
+         */
+        std::map <std::string, DslHandle> m_componentHandles;
+        
+        /**
+         * @brief thread that owns the transaction in progress, 
+         * nullptr if no transaction is in progress
+         */
+        std::atomic<GThread*> m_pTransactionThread;
+        
+        /**
+         * @struct TransactionEdit
+         * @brief graph edit, creation, or deletion made within a transaction
+         */
+        struct TransactionEdit
+        {
+            uint editType;
+            std::string parent;
+            std::string child;
+            
+            /**
+             * @brief the Pipeline or Component created or deleted, nullptr for
+             * graph edits
+             */
+            std::shared_ptr<Bintr> pBintr;
+            
+            /**
+             * @brief handle of the Component deleted, 0 if none
+             */
+            DslHandle handle;
+        };
+        
+        /**
+         * @brief all graph edits made within the current transaction, in order
+         */
+        std::vector<TransactionEdit> m_transactionEdits;
+        
+        /**
+         * @brief semicolon separated names of all pipelines and components 
+         * created by the last Pipeline definition loaded
+         */
+        std::string m_definitionReport;
     };  
 
     static gboolean MainLoopThread(gpointer arg);
@@ -43,6 +43,9 @@ namespace DSL
         m_pQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "sink-bin-queue");
         AddChild(m_pQueue);
         m_pQueue->AddGhostPadToParent("sink");
+        
+        m_pQueuePolicy = DSL_QUEUE_POLICY_NEW(name);
+        m_pQueuePolicy->Attach(m_pQueue->GetGstElement());
     }
 
     SinkBintr::~SinkBintr()
@@ -300,6 +303,14 @@ namespace DSL
         return m_displayId;
     }
     
+    void OverlaySinkBintr::GetOverlaySettings(uint* overlayId, uint* depth)
+    {
+        LOG_FUNC();
+        
+        *overlayId = m_overlayId;
+        *depth = m_depth;
+    }
+    
     bool OverlaySinkBintr::SetDisplayId(int id)
     {
         LOG_FUNC();
@@ -515,72 +526,47 @@ namespace DSL
         , m_bitRate(bitRate)
         , m_interval(interval)
         , m_container(container)
+        , m_filepath(filepath)
     {
         LOG_FUNC();
         
         m_isWindowCapable = false;
 
-        m_pFileSink = DSL_ELEMENT_NEW(NVDS_ELEM_SINK_FILE, "file-sink-bin");
-        m_pTransform = DSL_ELEMENT_NEW(NVDS_ELEM_VIDEO_CONV, "file-sink-bin-transform");
-        m_pCapsFilter = DSL_ELEMENT_NEW(NVDS_ELEM_CAPS_FILTER, "file-sink-bin-caps-filter");
-
-        m_pFileSink->SetAttribute("location", filepath);
-        m_pFileSink->SetAttribute("sync", m_sync);
-        m_pFileSink->SetAttribute("async", m_async);
-        
-        m_pTransform->SetAttribute("gpu-id", m_gpuId);
-
-        GstCaps* pCaps(NULL);
+        // Elementrs are created on first link, validate the formats now
         switch (codec)
         {
         case DSL_CODEC_H264 :
-            m_pEncoder = DSL_ELEMENT_NEW(NVDS_ELEM_ENC_H264, "file-sink-bin-encoder");
-            m_pEncoder->SetAttribute("bitrate", m_bitRate);
-            m_pEncoder->SetAttribute("iframeinterval", m_interval);
-            m_pEncoder->SetAttribute("bufapi-version", true);
-            m_pParser = DSL_ELEMENT_NEW("h264parse", "file-sink-bin-parser");
-            pCaps = gst_caps_from_string("video/x-raw(memory:NVMM), format=I420");
+            m_encoderFactory = NVDS_ELEM_ENC_H264;
+            m_parserFactory = "h264parse";
+            m_caps = "video/x-raw(memory:NVMM), format=I420";
             break;
         case DSL_CODEC_H265 :
-            m_pEncoder = DSL_ELEMENT_NEW(NVDS_ELEM_ENC_H265, "file-sink-bin-encoder");
-            m_pEncoder->SetAttribute("bitrate", m_bitRate);
-            m_pEncoder->SetAttribute("iframeinterval", m_interval);
-            m_pEncoder->SetAttribute("bufapi-version", true);
-            m_pParser = DSL_ELEMENT_NEW("h265parse", "file-sink-bin-parser");
-            pCaps = gst_caps_from_string("video/x-raw(memory:NVMM), format=I420");
+            m_encoderFactory = NVDS_ELEM_ENC_H265;
+            m_parserFactory = "h265parse";
+            m_caps = "video/x-raw(memory:NVMM), format=I420";
             break;
         case DSL_CODEC_MPEG4 :
-            m_pEncoder = DSL_ELEMENT_NEW(NVDS_ELEM_ENC_MPEG4, "file-sink-bin-encoder");
-            m_pParser = DSL_ELEMENT_NEW("mpeg4videoparse", "file-sink-bin-parser");
-            pCaps = gst_caps_from_string("video/x-raw, format=I420");
+            m_encoderFactory = NVDS_ELEM_ENC_MPEG4;
+            m_parserFactory = "mpeg4videoparse";
+            m_caps = "video/x-raw, format=I420";
             break;
         default:
             LOG_ERROR("Invalid codec = '" << codec << "' for new Sink '" << name << "'");
             throw;
         }
-
-        m_pCapsFilter->SetAttribute("caps", pCaps);
-        gst_caps_unref(pCaps);
         
         switch (container)
         {
         case DSL_CONTAINER_MP4 :
-            m_pContainer = DSL_ELEMENT_NEW(NVDS_ELEM_MUX_MP4, "file-sink-bin-container");        
+            m_containerFactory = NVDS_ELEM_MUX_MP4;
             break;
         case DSL_CONTAINER_MKV :
-            m_pContainer = DSL_ELEMENT_NEW(NVDS_ELEM_MKV, "file-sink-bin-container");        
+            m_containerFactory = NVDS_ELEM_MKV;
             break;
         default:
             LOG_ERROR("Invalid container = '" << container << "' for new Sink '" << name << "'");
             throw;
         }
-
-        AddChild(m_pFileSink);
-        AddChild(m_pTransform);
-        AddChild(m_pCapsFilter);
-        AddChild(m_pEncoder);
-        AddChild(m_pParser);
-        AddChild(m_pContainer);
     }
     
     FileSinkBintr::~FileSinkBintr()
@@ -593,6 +579,59 @@ namespace DSL
         }
     }
 
+    bool FileSinkBintr::AddToParent(DSL_NODETR_PTR pParentBintr)
+    {
+        LOG_FUNC();
+        
+        if (!m_pFileSink and
+            (!Elementr::FactoryExists(NVDS_ELEM_SINK_FILE) or
+            !Elementr::FactoryExists(NVDS_ELEM_VIDEO_CONV) or
+            !Elementr::FactoryExists(NVDS_ELEM_CAPS_FILTER) or
+            !Elementr::FactoryExists(m_encoderFactory.c_str()) or
+            !Elementr::FactoryExists(m_parserFactory.c_str()) or
+            !Elementr::FactoryExists(m_containerFactory.c_str())))
+        {
+            LOG_ERROR("FileSinkBintr '" << m_name << "' is missing a required plugin");
+            return false;
+        }
+        return SinkBintr::AddToParent(pParentBintr);
+    }
+
+    void FileSinkBintr::CreateElements()
+    {
+        LOG_FUNC();
+        
+        m_pFileSink = DSL_ELEMENT_NEW(NVDS_ELEM_SINK_FILE, "file-sink-bin");
+        m_pTransform = DSL_ELEMENT_NEW(NVDS_ELEM_VIDEO_CONV, "file-sink-bin-transform");
+        m_pCapsFilter = DSL_ELEMENT_NEW(NVDS_ELEM_CAPS_FILTER, "file-sink-bin-caps-filter");
+        m_pEncoder = DSL_ELEMENT_NEW(m_encoderFactory.c_str(), "file-sink-bin-encoder");
+        m_pParser = DSL_ELEMENT_NEW(m_parserFactory.c_str(), "file-sink-bin-parser");
+        m_pContainer = DSL_ELEMENT_NEW(m_containerFactory.c_str(), "file-sink-bin-container");        
+
+        m_pFileSink->SetAttribute("location", m_filepath.c_str());
+        m_pFileSink->SetAttribute("sync", m_sync);
+        m_pFileSink->SetAttribute("async", m_async);
+        
+        m_pTransform->SetAttribute("gpu-id", m_gpuId);
+
+        if (m_codec == DSL_CODEC_H264 or m_codec == DSL_CODEC_H265)
+        {
+            m_pEncoder->SetAttribute("bitrate", m_bitRate);
+            m_pEncoder->SetAttribute("iframeinterval", m_interval);
+            m_pEncoder->SetAttribute("bufapi-version", true);
+        }
+        GstCaps* pCaps = gst_caps_from_string(m_caps.c_str());
+        m_pCapsFilter->SetAttribute("caps", pCaps);
+        gst_caps_unref(pCaps);
+
+        AddChild(m_pFileSink);
+        AddChild(m_pTransform);
+        AddChild(m_pCapsFilter);
+        AddChild(m_pEncoder);
+        AddChild(m_pParser);
+        AddChild(m_pContainer);
+    }
+
     bool FileSinkBintr::LinkAll()
     {
         LOG_FUNC();
@@ -602,6 +641,10 @@ namespace DSL
             LOG_ERROR("FileSinkBintr '" << m_name << "' is already linked");
             return false;
         }
+        if (!m_pFileSink)
+        {
+            CreateElements();
+        }
         if (!m_pQueue->LinkToSink(m_pTransform) or
             !m_pTransform->LinkToSink(m_pCapsFilter) or
             !m_pCapsFilter->LinkToSink(m_pEncoder) or
@@ -641,6 +684,13 @@ namespace DSL
         *container = m_container;
     }
     
+    const char* FileSinkBintr::GetFilePath()
+    {
+        LOG_FUNC();
+        
+        return m_filepath.c_str();
+    }
+    
     void  FileSinkBintr::GetEncoderSettings(uint* bitRate, uint* interval)
     {
         LOG_FUNC();
@@ -663,7 +713,7 @@ namespace DSL
         m_bitRate = bitRate;
         m_interval = interval;
 
-        if (m_codec == DSL_CODEC_H264 or m_codec == DSL_CODEC_H265)
+        if (m_pEncoder and (m_codec == DSL_CODEC_H264 or m_codec == DSL_CODEC_H265))
         {
             m_pEncoder->SetAttribute("bitrate", m_bitRate);
             m_pEncoder->SetAttribute("iframeinterval", m_interval);
@@ -685,7 +735,10 @@ namespace DSL
         m_gpuId = gpuId;
         LOG_DEBUG("Setting GPU ID to '" << gpuId << "' for FileSinkBintr '" << m_name << "'");
 
-        m_pTransform->SetAttribute("gpu-id", m_gpuId);
+        if (m_pTransform)
+        {
+            m_pTransform->SetAttribute("gpu-id", m_gpuId);
+        }
         
         return true;
     }
@@ -704,15 +757,78 @@ namespace DSL
         , m_bitRate(bitRate)
         , m_interval(interval)
         , m_pServer(NULL)
+        , m_pServerSrcId(0)
         , m_pFactory(NULL)
     {
         LOG_FUNC();
         
         m_isWindowCapable = false;
 
+        // Elementrs and the RTSP Server are created on first link, validate the codec now
+        switch (codec)
+        {
+        case DSL_CODEC_H264 :
+            m_encoderFactory = NVDS_ELEM_ENC_H264;
+            m_parserFactory = "h264parse";
+            m_payloaderFactory = "rtph264pay";
+            m_encodingName = "H264";
+            break;
+        case DSL_CODEC_H265 :
+            m_encoderFactory = NVDS_ELEM_ENC_H265;
+            m_parserFactory = "h265parse";
+            m_payloaderFactory = "rtph265pay";
+            m_encodingName = "H265";
+            break;
+        default:
+            LOG_ERROR("Invalid codec = '" << codec << "' for new Sink '" << name << "'");
+            throw;
+        }
+    }
+    
+    RtspSinkBintr::~RtspSinkBintr()
+    {
+        LOG_FUNC();
+    
+        if (IsLinked())
+        {    
+            UnlinkAll();
+        }
+    }
+
+    bool RtspSinkBintr::AddToParent(DSL_NODETR_PTR pParentBintr)
+    {
+        LOG_FUNC();
+        
+        if (!m_pUdpSink and
+            (!Elementr::FactoryExists("udpsink") or
+            !Elementr::FactoryExists(NVDS_ELEM_VIDEO_CONV) or
+            !Elementr::FactoryExists(NVDS_ELEM_CAPS_FILTER) or
+            !Elementr::FactoryExists(m_encoderFactory.c_str()) or
+            !Elementr::FactoryExists(m_parserFactory.c_str()) or
+            !Elementr::FactoryExists(m_payloaderFactory.c_str())))
+        {
+            LOG_ERROR("RtspSinkBintr '" << m_name << "' is missing a required plugin");
+            return false;
+        }
+        return SinkBintr::AddToParent(pParentBintr);
+    }
+
+    void RtspSinkBintr::CreateElements()
+    {
+        LOG_FUNC();
+        
+        std::string codecName(m_encodingName);
+        std::transform(codecName.begin(), codecName.end(), codecName.begin(), ::tolower);
+
         m_pUdpSink = DSL_ELEMENT_NEW("udpsink", "rtsp-sink-bin");
         m_pTransform = DSL_ELEMENT_NEW(NVDS_ELEM_VIDEO_CONV, "rtsp-sink-bin-transform");
         m_pCapsFilter = DSL_ELEMENT_NEW(NVDS_ELEM_CAPS_FILTER, "rtsp-sink-bin-caps-filter");
+        m_pEncoder = DSL_ELEMENT_NEW(m_encoderFactory.c_str(), 
+            ("rtsp-sink-bin-" + codecName + "-encoder").c_str());
+        m_pParser = DSL_ELEMENT_NEW(m_parserFactory.c_str(), 
+            ("rtsp-sink-bin-" + codecName + "-parser").c_str());
+        m_pPayloader = DSL_ELEMENT_NEW(m_payloaderFactory.c_str(), 
+            ("rtsp-sink-bin-" + codecName + "-payloader").c_str());
 
         m_pUdpSink->SetAttribute("host", m_host.c_str());
         m_pUdpSink->SetAttribute("port", m_udpPort);
@@ -723,26 +839,6 @@ namespace DSL
         m_pCapsFilter->SetAttribute("caps", pCaps);
         gst_caps_unref(pCaps);
         
-        std::string codecString;
-        switch (codec)
-        {
-        case DSL_CODEC_H264 :
-            m_pEncoder = DSL_ELEMENT_NEW(NVDS_ELEM_ENC_H264, "rtsp-sink-bin-h264-encoder");
-            m_pParser = DSL_ELEMENT_NEW("h264parse", "rtsp-sink-bin-h264-parser");
-            m_pPayloader = DSL_ELEMENT_NEW("rtph264pay", "rtsp-sink-bin-h264-payloader");
-            codecString.assign("H264");
-            break;
-        case DSL_CODEC_H265 :
-            m_pEncoder = DSL_ELEMENT_NEW(NVDS_ELEM_ENC_H265, "rtsp-sink-bin-h265-encoder");
-            m_pParser = DSL_ELEMENT_NEW("h265parse", "rtsp-sink-bin-h265-parser");
-            m_pPayloader = DSL_ELEMENT_NEW("rtph265pay", "rtsp-sink-bin-h265-payloader");
-            codecString.assign("H265");
-            break;
-        default:
-            LOG_ERROR("Invalid codec = '" << codec << "' for new Sink '" << name << "'");
-            throw;
-        }
-
         m_pEncoder->SetAttribute("bitrate", m_bitRate);
         m_pEncoder->SetAttribute("iframeinterval", m_interval);
         m_pEncoder->SetAttribute("preset-level", true);
@@ -755,7 +851,7 @@ namespace DSL
 
         std::string udpSrc = "(udpsrc name=pay0 port=" + std::to_string(m_udpPort) + 
             " caps=\"application/x-rtp, media=video, clock-rate=90000, encoding-name=" +
-            codecString + ", payload=96 \")";
+            m_encodingName + ", payload=96 \")";
         
         // Create a nw RTSP Media Factory and set the launch settings
         // to the UDP source defined above
@@ -779,16 +875,6 @@ namespace DSL
         AddChild(m_pParser);
         AddChild(m_pPayloader);
     }
-    
-    RtspSinkBintr::~RtspSinkBintr()
-    {
-        LOG_FUNC();
-    
-        if (IsLinked())
-        {    
-            UnlinkAll();
-        }
-    }
 
     bool RtspSinkBintr::LinkAll()
     {
@@ -799,6 +885,10 @@ namespace DSL
             LOG_ERROR("RtspSinkBintr '" << m_name << "' is already linked");
             return false;
         }
+        if (!m_pUdpSink)
+        {
+            CreateElements();
+        }
         
         if (!m_pQueue->LinkToSink(m_pTransform) or
             !m_pTransform->LinkToSink(m_pCapsFilter) or
@@ -852,6 +942,13 @@ namespace DSL
         *codec = m_codec;
     }
     
+    const char* RtspSinkBintr::GetHost()
+    {
+        LOG_FUNC();
+        
+        return m_host.c_str();
+    }
+    
     void  RtspSinkBintr::GetEncoderSettings(uint* bitRate, uint* interval)
     {
         LOG_FUNC();
@@ -874,7 +971,7 @@ namespace DSL
         m_bitRate = bitRate;
         m_interval = interval;
 
-        if (m_codec == DSL_CODEC_H264 or m_codec == DSL_CODEC_H265)
+        if (m_pEncoder and (m_codec == DSL_CODEC_H264 or m_codec == DSL_CODEC_H265))
         {
             m_pEncoder->SetAttribute("bitrate", m_bitRate);
             m_pEncoder->SetAttribute("iframeinterval", m_interval);
@@ -154,6 +154,13 @@ namespace DSL
 
         int GetDisplayId();
 
+        /**
+         * @brief Gets the overlay id and depth this OverlaySinkBintr was created with
+         * @param[out] overlayId the unique overlay id in use
+         * @param[out] depth the current overlay depth
+         */
+        void GetOverlaySettings(uint* overlayId, uint* depth);
+
         bool SetDisplayId(int id);
 
         /**
@@ -279,9 +286,18 @@ namespace DSL
             uint codec, uint container, uint bitRate, uint interval);
 
         ~FileSinkBintr();
+
+        /**
+         * @brief overrides the base method to check that all plugins required by
+         * the codec and container are registered, as Elementrs are created on link.
+         * @param[in] pParentBintr parent Pipeline or Branch to add to
+         * @return true if added successfully, false otherwise
+         */
+        bool AddToParent(DSL_NODETR_PTR pParentBintr);
   
         /**
-         * @brief Links all Child Elementrs owned by this Bintr
+         * @brief Links all Child Elementrs owned by this Bintr, creating them
+         * on first link
          * @return true if all links were succesful, false otherwise
          */
         bool LinkAll();
@@ -299,6 +315,12 @@ namespace DSL
          */ 
         void GetVideoFormats(uint* codec, uint* container);
 
+        /**
+         * @brief Gets the file path this FileSinkBintr was created with
+         * @return const string for the file path
+         */
+        const char* GetFilePath();
+
         /**
          * @brief Gets the current bit-rate and interval settings for the Encoder in use
          * @param[out] bitRate the current bit-rate setting for the encoder in use
@@ -322,12 +344,27 @@ namespace DSL
 
     private:
 
+        /**
+         * @brief creates all Child Elementrs on first link, deferred from
+         * construction as most File Sinks are declared but never linked.
+         */
+        void CreateElements();
+
+        std::string m_filepath;
         uint m_codec;
         uint m_container;
         uint m_bitRate;
         uint m_interval;
         boolean m_sync;
         boolean m_async;
+        
+        /**
+         * @brief factory names and caps for the codec and container in use
+         */
+        std::string m_encoderFactory;
+        std::string m_parserFactory;
+        std::string m_containerFactory;
+        std::string m_caps;
  
         DSL_ELEMENT_PTR m_pFileSink;
         DSL_ELEMENT_PTR m_pTransform;
@@ -345,9 +382,18 @@ namespace DSL
          uint codec, uint bitRate, uint interval);
 
         ~RtspSinkBintr();
+
+        /**
+         * @brief overrides the base method to check that all plugins required by
+         * the codec are registered, as Elementrs are created on link.
+         * @param[in] pParentBintr parent Pipeline or Branch to add to
+         * @return true if added successfully, false otherwise
+         */
+        bool AddToParent(DSL_NODETR_PTR pParentBintr);
   
         /**
-         * @brief Links all Child Elementrs owned by this Bintr
+         * @brief Links all Child Elementrs owned by this Bintr, creating them,
+         * and the RTSP Server, on first link
          * @return true if all links were succesful, false otherwise
          */
         bool LinkAll();
@@ -366,6 +412,12 @@ namespace DSL
          */ 
         void GetServerSettings(uint* udpPort, uint* rtspPort, uint* codec);
 
+        /**
+         * @brief Gets the host URI the RTSP Server was created with
+         * @return const string for the host URI
+         */
+        const char* GetHost();
+
         /**
          * @brief Gets the current bit-rate and interval settings for the Encoder in use
          * @param[out] bitRate the current bit-rate setting for the Encoder in use
@@ -383,6 +435,12 @@ namespace DSL
 
     private:
 
+        /**
+         * @brief creates all Child Elementrs and the RTSP Server on first link, 
+         * deferred from construction as most RTSP Sinks are declared but never linked.
+         */
+        void CreateElements();
+
         std::string m_host;
         uint m_udpPort;
         uint m_rtspPort;
@@ -392,6 +450,14 @@ namespace DSL
         boolean m_sync;
         boolean m_async;
         
+        /**
+         * @brief factory names and RTP encoding name for the codec in use
+         */
+        std::string m_encoderFactory;
+        std::string m_parserFactory;
+        std::string m_payloaderFactory;
+        std::string m_encodingName;
+        
         GstRTSPServer* m_pServer;
         uint m_pServerSrcId;
         GstRTSPMediaFactory* m_pFactory;
@@ -22,6 +22,9 @@ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
 THE SOFTWARE.
 */
 
+#include <glob.h>
+#include <fcntl.h>
+
 #include "Dsl.h"
 #include "DslSourceBintr.h"
 #include "DslPipelineBintr.h"
@@ -41,6 +44,8 @@ namespace DSL
         , m_latency(100)
         , m_numDecodeSurfaces(N_DECODE_SURFACES)
         , m_numExtraSurfaces(N_EXTRA_SURFACES)
+        , m_effectiveDecodeSurfaces(N_DECODE_SURFACES)
+        , m_effectiveExtraSurfaces(N_EXTRA_SURFACES)
     {
         LOG_FUNC();
     }
@@ -356,11 +361,21 @@ namespace DSL
         , m_cudadecMemtype(cudadecMemType)
         , m_intraDecode(intraDecode)
         , m_dropFrameInterval(dropFrameInterval)
+        , m_decodeSurfacesHonoured(false)
+        , m_extraSurfacesHonoured(true)
         , m_accumulatedBase(0)
         , m_prevAccumulatedBase(0)
+        , m_dropOnLatency(true)
+        , m_doRetransmission(false)
+        , m_rtpProtocols(DSL_RTP_ALL)
+        , m_bufferMode(DSL_RTSP_BUFFER_MODE_AUTO)
+        , m_rtspTimeout(DSL_DEFAULT_RTSP_TIMEOUT)
+        , m_pRtpManager(NULL)
     {
         LOG_FUNC();
         
+        g_mutex_init(&m_rtpManagerMutex);
+        
         m_isLive = isLive;
         m_uri = uri;
         
@@ -392,6 +407,17 @@ namespace DSL
         AddChild(m_pSourceElement);
     }
     
+    DecodeSourceBintr::~DecodeSourceBintr()
+    {
+        LOG_FUNC();
+        
+        if (m_pRtpManager)
+        {
+            gst_object_unref(m_pRtpManager);
+        }
+        g_mutex_clear(&m_rtpManagerMutex);
+    }
+    
     void DecodeSourceBintr::HandleOnChildAdded(GstChildProxy* pChildProxy, GObject* pObject,
         gchar* name)
     {
@@ -412,7 +438,9 @@ namespace DSL
             g_object_set(pObject, "gpu-id", m_gpuId, NULL);
             g_object_set(pObject, "cuda-memory-type", m_cudadecMemtype, NULL);
             g_object_set(pObject, "source-id", m_uniqueId, NULL);
-            g_object_set(pObject, "num-decode-surfaces", m_numDecodeSurfaces, NULL);
+            g_object_set(pObject, "num-decode-surfaces", m_effectiveDecodeSurfaces, NULL);
+            m_decodeSurfacesHonoured = true;
+            m_extraSurfacesHonoured = false;
             
             if (m_intraDecode)
             {
@@ -443,7 +471,9 @@ namespace DSL
             g_object_set(pObject, "enable-max-performance", TRUE, NULL);
             g_object_set(pObject, "bufapi-version", TRUE, NULL);
             g_object_set(pObject, "drop-frame-interval", m_dropFrameInterval, NULL);
-            g_object_set(pObject, "num-extra-surfaces", m_numExtraSurfaces, NULL);
+            g_object_set(pObject, "num-extra-surfaces", m_effectiveExtraSurfaces, NULL);
+            m_decodeSurfacesHonoured = false;
+            m_extraSurfacesHonoured = true;
 
             // if the source is from file, then setup Stream buffer probe function
             // to handle the stream restart/loop on GST_EVENT_EOS.
@@ -465,6 +495,7 @@ namespace DSL
     GstPadProbeReturn DecodeSourceBintr::HandleStreamBufferRestart(GstPad* pPad, GstPadProbeInfo* pInfo)
     {
         LOG_FUNC();
+        TRACE_SCOPE("probe", __func__);
 
         GstEvent* event = GST_EVENT(pInfo->data);
 
@@ -509,9 +540,242 @@ namespace DSL
 
     void DecodeSourceBintr::HandleOnSourceSetup(GstElement* pObject, GstElement* arg0)
     {
-        if (g_object_class_find_property(G_OBJECT_GET_CLASS(arg0), "latency")) 
+        LOG_FUNC();
+        
+        // uridecodebin creates an rtspsrc for rtsp URIs
+        if (g_object_class_find_property(G_OBJECT_GET_CLASS(arg0), "drop-on-latency")) 
+        {
+            ApplyRtspConfig(arg0);
+            g_signal_connect(G_OBJECT(arg0), "new-manager", 
+                G_CALLBACK(OnNewManagerCB), this);
+        }
+    }
+
+    void DecodeSourceBintr::ApplyRtspConfig(GstElement* pRtspSrc)
+    {
+        LOG_FUNC();
+        
+        g_object_set(G_OBJECT(pRtspSrc), 
+            "latency", m_latency,
+            "drop-on-latency", m_dropOnLatency,
+            "do-retransmission", m_doRetransmission,
+            "protocols", m_rtpProtocols,
+            "buffer-mode", m_bufferMode,
+            "timeout", (guint64)m_rtspTimeout*1000,
+            "tcp-timeout", (guint64)m_rtspTimeout*1000, NULL);
+    }
+
+    void DecodeSourceBintr::GetNumSurfaces(uint* numDecodeSurfaces, uint* numExtraSurfaces)
+    {
+        LOG_FUNC();
+        
+        *numDecodeSurfaces = m_numDecodeSurfaces;
+        *numExtraSurfaces = m_numExtraSurfaces;
+    }
+
+    bool DecodeSourceBintr::SetNumSurfaces(uint numDecodeSurfaces, uint numExtraSurfaces)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set surfaces for DecodeSourceBintr '" << GetName() 
+                << "' as it's currently linked");
+            return false;
+        }
+        if (!numDecodeSurfaces)
+        {
+            LOG_ERROR("Invalid number of decode surfaces for DecodeSourceBintr '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_numDecodeSurfaces = numDecodeSurfaces;
+        m_numExtraSurfaces = numExtraSurfaces;
+        m_effectiveDecodeSurfaces = numDecodeSurfaces;
+        m_effectiveExtraSurfaces = numExtraSurfaces;
+        return true;
+    }
+
+    bool DecodeSourceBintr::SetEffectiveNumSurfaces(uint numDecodeSurfaces, 
+        uint numExtraSurfaces)
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            LOG_ERROR("Unable to set effective surfaces for DecodeSourceBintr '" 
+                << GetName() << "' as it's currently linked");
+            return false;
+        }
+        m_effectiveDecodeSurfaces = numDecodeSurfaces;
+        m_effectiveExtraSurfaces = numExtraSurfaces;
+        return true;
+    }
+
+    void DecodeSourceBintr::GetHonouredSurfaces(bool* decodeSurfaces, bool* extraSurfaces)
+    {
+        LOG_FUNC();
+        
+        *decodeSurfaces = m_decodeSurfacesHonoured;
+        *extraSurfaces = m_extraSurfacesHonoured;
+    }
+
+    void DecodeSourceBintr::GetRtspConfig(uint* latency, bool* dropOnLatency, 
+        bool* doRetransmission, uint* protocols, uint* bufferMode, uint* timeout)
+    {
+        LOG_FUNC();
+        
+        *latency = m_latency;
+        *dropOnLatency = m_dropOnLatency;
+        *doRetransmission = m_doRetransmission;
+        *protocols = m_rtpProtocols;
+        *bufferMode = m_bufferMode;
+        *timeout = m_rtspTimeout;
+    }
+
+    bool DecodeSourceBintr::SetRtspConfig(uint latency, bool dropOnLatency, 
+        bool doRetransmission, uint protocols, uint bufferMode, uint timeout)
+    {
+        LOG_FUNC();
+        
+        if (IsInUse())
+        {
+            LOG_ERROR("Unable to set RTSP config for DecodeSourceBintr '" << GetName() 
+                << "' as it's currently in use");
+            return false;
+        }
+        if (bufferMode > DSL_RTSP_BUFFER_MODE_SYNCED)
+        {
+            LOG_ERROR("Invalid RTSP buffer mode '" << bufferMode << "' for DecodeSourceBintr '" 
+                << GetName() << "'");
+            return false;
+        }
+        m_latency = latency;
+        m_dropOnLatency = dropOnLatency;
+        m_doRetransmission = doRetransmission;
+        m_rtpProtocols = protocols;
+        m_bufferMode = bufferMode;
+        m_rtspTimeout = timeout;
+        
+        // An RTSP Source owns its rtspsrc, a URI Source's is created on source-setup
+        if (g_object_class_find_property(G_OBJECT_GET_CLASS(m_pSourceElement->GetGObject()), 
+            "drop-on-latency"))
+        {
+            ApplyRtspConfig(m_pSourceElement->GetGstElement());
+        }
+        return true;
+    }
+    
+    bool DecodeSourceBintr::SetRtspPreset(uint preset)
+    {
+        LOG_FUNC();
+        
+        switch (preset)
+        {
+        // Minimum glass-to-glass delay. Late packets are dropped rather than waited 
+        // for, lost packets are not requested again, and timestamps are used as is.
+        case DSL_RTSP_PRESET_ULTRA_LOW_LATENCY :
+            return SetRtspConfig(50, true, false, DSL_RTP_ALL, DSL_RTSP_BUFFER_MODE_NONE, 2000);
+        
+        // Tolerates lossy and congested networks at the cost of delay. UDP is tried 
+        // first, with lost packets requested again within a deep jitterbuffer, 
+        // falling back to TCP, which needs no retransmission, if UDP is blocked.
+        case DSL_RTSP_PRESET_ROBUST :
+            return SetRtspConfig(2000, false, true, DSL_RTP_ALL, DSL_RTSP_BUFFER_MODE_AUTO, 10000);
+        
+        default :
+            LOG_ERROR("Invalid RTSP preset '" << preset << "' for DecodeSourceBintr '" 
+                << GetName() << "'");
+            return false;
+        }
+    }
+
+    void DecodeSourceBintr::GetRtspStats(double* jitter, uint* packetsReceived, uint* packetsLost)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_rtpManagerMutex);
+        
+        *jitter = 0;
+        *packetsReceived = 0;
+        *packetsLost = 0;
+        
+        if (!m_pRtpManager)
+        {
+            return;
+        }
+        GObject* pSession(NULL);
+        g_signal_emit_by_name(m_pRtpManager, "get-internal-session", 0, &pSession);
+        if (!pSession)
+        {
+            return;
+        }
+        GstStructure* pStats(NULL);
+        g_object_get(pSession, "stats", &pStats, NULL);
+        g_object_unref(pSession);
+        if (!pStats)
+        {
+            return;
+        }
+        
+        // Report the first remote sender, the camera, found in the session
+        const GValue* pSourceStats = gst_structure_get_value(pStats, "source-stats");
+        GValueArray* pSourceStatsArray = (GValueArray*)g_value_get_boxed(pSourceStats);
+        for (uint i = 0; pSourceStatsArray and i < pSourceStatsArray->n_values; i++)
+        {
+            const GstStructure* pSourceStruct = gst_value_get_structure(
+                g_value_array_get_nth(pSourceStatsArray, i));
+            
+            gboolean internal(TRUE), isSender(FALSE);
+            gst_structure_get_boolean(pSourceStruct, "internal", &internal);
+            gst_structure_get_boolean(pSourceStruct, "is-sender", &isSender);
+            if (internal or !isSender)
+            {
+                continue;
+            }
+            guint rtpJitter(0), clockRate(0);
+            gint lost(0);
+            guint64 received(0);
+            gst_structure_get_uint(pSourceStruct, "jitter", &rtpJitter);
+            gst_structure_get_int(pSourceStruct, "clock-rate", (gint*)&clockRate);
+            gst_structure_get_int(pSourceStruct, "packets-lost", &lost);
+            gst_structure_get_uint64(pSourceStruct, "packets-received", &received);
+            
+            // RTP jitter is measured in units of the stream's clock-rate
+            if (clockRate)
+            {
+                *jitter = (double)rtpJitter*1000/clockRate;
+            }
+            *packetsReceived = (uint)received;
+            *packetsLost = (lost > 0) ? (uint)lost : 0;
+            break;
+        }
+        gst_structure_free(pStats);
+    }
+
+    void DecodeSourceBintr::HandleOnNewManager(GstElement* pManager)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_rtpManagerMutex);
+        
+        // A new session, e.g. on reconnect, replaces the RTP bin of the last
+        if (m_pRtpManager)
+        {
+            LOG_INFO("Replacing the RTP manager for DecodeSourceBintr '" 
+                << GetName() << "' on new session");
+            gst_object_unref(m_pRtpManager);
+        }
+        m_pRtpManager = GST_ELEMENT(gst_object_ref(pManager));
+    }
+    
+    void DecodeSourceBintr::ReleaseRtpManager()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_rtpManagerMutex);
+        
+        if (m_pRtpManager)
         {
-            g_object_set(G_OBJECT(arg0), "latency", "cb_sourcesetup set %d latency\n", NULL);
+            gst_object_unref(m_pRtpManager);
+            m_pRtpManager = NULL;
         }
     }
     
@@ -573,9 +837,21 @@ namespace DSL
     UriSourceBintr::UriSourceBintr(const char* name, const char* uri, bool isLive,
         uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
         : DecodeSourceBintr(name, NVDS_ELEM_SRC_URI, uri, isLive, cudadecMemType, intraDecode, dropFrameInterval)
+        , m_playlistIndex(0)
+        , m_playlistElementCount(0)
+        , m_playlistPadOffset(0)
+        , m_fileFrames(0)
+        , m_fileStartTime(0)
+        , m_fileLastFrameTime(0)
+        , m_pTaskTarget(NULL)
+        , m_pActiveSrcPad(NULL)
+        , m_switchRequestTime(0)
+        , m_switchLatency(0)
     {
         LOG_FUNC();
         
+        m_currentUri = m_uri;
+        
         // New Elementrs for this Source
         m_pSourceQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "src-queue");
         m_pTee = DSL_ELEMENT_NEW(NVDS_ELEM_TEE, "tee");
@@ -604,18 +880,48 @@ namespace DSL
         AddChild(m_pFakeSinkQueue);
         AddChild(m_pFakeSink);
         
+        // Playlist probes - EOS from each file is intercepted at the Tee sink pad 
+        // while there are more files to play. Output frames are counted per file
+        // as they leave the Source, restarting with each new stream.
+        GstPad* pStaticPad = gst_element_get_static_pad(m_pTee->GetGstElement(), "sink");
+        gst_pad_add_probe(pStaticPad, GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM,
+            UriSourcePlaylistEosProbeCB, this, NULL);
+        gst_object_unref(pStaticPad);
+        
+        pStaticPad = gst_element_get_static_pad(m_pSourceQueue->GetGstElement(), "src");
+        gst_pad_add_probe(pStaticPad, 
+            (GstPadProbeType)(GST_PAD_PROBE_TYPE_BUFFER | GST_PAD_PROBE_TYPE_EVENT_DOWNSTREAM),
+            UriSourcePlaylistStatsProbeCB, this, NULL);
+        gst_object_unref(pStaticPad);
+
         // Source Ghost Pad for Source Queue
         m_pSourceQueue->AddGhostPadToParent("src");
+        
+        g_mutex_init(&m_playlistMutex);
+        
+        // The bin frees the task target once the last message posted by
+        // this Source, and still queued on the bus, has been released.
+        m_pTaskTarget = new TaskTarget;
+        g_mutex_init(&m_pTaskTarget->mutex);
+        m_pTaskTarget->pSource = this;
+        g_object_set_data_full(G_OBJECT(GetGstObject()), DSL_URI_SOURCE_TASK_TARGET,
+            m_pTaskTarget, FreeTaskTarget);
     }
 
     UriSourceBintr::~UriSourceBintr()
     {
         LOG_FUNC();
         
+        // Waits for any task in progress, later tasks are ignored
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_pTaskTarget->mutex);
+            m_pTaskTarget->pSource = NULL;
+        }
         if (IsLinked())
         {
             UnlinkAll();
         }
+        g_mutex_clear(&m_playlistMutex);
     }
 
     bool UriSourceBintr::LinkAll()
@@ -677,6 +983,16 @@ namespace DSL
         {
             return false;
         }
+        
+        // Playlist always starts from the Source's initial URI
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        m_playlistIndex = 0;
+        m_playlistPadOffset = 0;
+        m_countedUri = m_currentUri;
+        m_pendingUris.clear();
+        m_fileFrames = 0;
+        PrefetchNextPlaylistFile();
+        
         m_isLinked = true;
 
         return true;
@@ -710,6 +1026,35 @@ namespace DSL
             gst_object_unref(imap.second);
         }
         
+        DSL_ELEMENT_PTR pStandbySourceElement;
+        DSL_ELEMENT_PTR pStandbyFakeSink;
+        DSL_ELEMENT_PTR pRetiredSourceElement;
+        {
+            // If the playlist has advanced, re-point the current decode bin 
+            // back to the Source's initial URI for the next time played.
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+            if (m_currentUri != m_uri)
+            {
+                m_pSourceElement->SetAttribute("uri", m_uri.c_str());
+                m_currentUri = m_uri;
+            }
+            m_pNextSourceElement = nullptr;
+            
+            // Abandon any pending switch, the standby decode bin is never swapped in,
+            // and complete any switch whose task was flushed from the bus on stop.
+            pStandbySourceElement = m_pStandbySourceElement;
+            pStandbyFakeSink = m_pStandbyFakeSink;
+            pRetiredSourceElement = m_pRetiredSourceElement;
+            m_pStandbySourceElement = nullptr;
+            m_pStandbyFakeSink = nullptr;
+            m_pRetiredSourceElement = nullptr;
+            m_pActiveSrcPad = NULL;
+        }
+        RemoveStateChild(pStandbySourceElement);
+        RemoveStateChild(pStandbyFakeSink);
+        RemoveStateChild(pRetiredSourceElement);
+        ReleaseRtpManager();
+        
         m_isLinked = false;
     }
 
@@ -734,6 +1079,14 @@ namespace DSL
                 LOG_ERROR("Failed to get Static Source Pad for Streaming Source '" << GetName() << "'");
             }
             
+            // Playlist files after the first continue on from the running-time
+            // of the previous file, so downstream timestamps remain monotonic
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+                gst_pad_set_offset(pPad, m_playlistPadOffset);
+                m_pActiveSrcPad = pPad;
+            }
+            
             if (gst_pad_link(pPad, m_pGstStaticSinkPad) != GST_PAD_LINK_OK) 
             {
                 LOG_ERROR("Failed to link decodebin to pipeline");
@@ -779,126 +1132,713 @@ namespace DSL
             m_uri.insert(0, "file:");
         }        
         m_pSourceElement->SetAttribute("uri", m_uri.c_str());
+        m_currentUri = m_uri;
         
         return true;
     }
     
-    //*********************************************************************************
-    
-    RtspSourceBintr::RtspSourceBintr(const char* name, const char* uri, uint protocol,
-        uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
-        : DecodeSourceBintr(name, "rtspsrc", uri, true, cudadecMemType, intraDecode, dropFrameInterval)
-        , m_rtpProtocols(protocol)
+    bool UriSourceBintr::AddPlaylistUri(const char* uri)
     {
         LOG_FUNC();
         
-        // New RTSP Specific Elementrs for this Source
-        m_pDepayload = DSL_ELEMENT_NEW("rtph264depay", "src-depayload");
-        m_pDecodeQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "decode-queue");
-        m_pDecodeBin = DSL_ELEMENT_NEW("decodebin", "decode-bin");
-        m_pSourceQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "src-queue");
-
-        m_pSourceElement->SetAttribute("location", m_uri.c_str());
-        m_pSourceElement->SetAttribute("latency", m_latency);
-        m_pSourceElement->SetAttribute("drop-on-latency", true);
-        m_pSourceElement->SetAttribute("protocols", m_rtpProtocols);
-
-        // Connect RTSP Source Setup Callbacks
-        g_signal_connect(m_pSourceElement->GetGObject(), "pad-added", 
-            G_CALLBACK(RtspSourceElementOnPadAddedCB), this);
-
-        // Connect Decode Setup Callbacks
-        g_signal_connect(m_pDecodeBin->GetGObject(), "pad-added", 
-            G_CALLBACK(RtspDecodeElementOnPadAddedCB), this);
-        g_signal_connect(m_pDecodeBin->GetGObject(), "child-added", 
-            G_CALLBACK(OnChildAddedCB), this);
-
-//        g_object_set_data(G_OBJECT(m_pSourceElement->GetGObject()), "source", this);
-
-        AddChild(m_pDepayload);
-        AddChild(m_pDecodeQueue);
-        AddChild(m_pDecodeBin);
-        AddChild(m_pSourceQueue);
+        std::string newUri(uri);
+        if (newUri.find("http") == std::string::npos)
+        {
+            std::ifstream streamUriFile(uri);
+            if (!streamUriFile.good())
+            {
+                LOG_ERROR("Playlist URI '" << uri << "' Not found");
+                return false;
+            }
+            // File source - setup full path
+            char absolutePath[PATH_MAX+1];
+            newUri.assign(realpath(uri, absolutePath));
+            newUri.insert(0, "file:");
+        }        
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
         
-        // Source Ghost Pad for Source Queue
-        m_pSourceQueue->AddGhostPadToParent("src");
+        m_playlist.push_back(newUri);
+        
+        // If currently playing the last file, prefetch the new next file now
+        if (IsLinked() and !m_pNextSourceElement)
+        {
+            PrefetchNextPlaylistFile();
+        }
+        return true;
     }
-
-    RtspSourceBintr::~RtspSourceBintr()
+    
+    void UriSourceBintr::ClearPlaylist()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
         
-        if (IsLinked())
-        {
-            UnlinkAll();
-        }
+        m_playlist.clear();
+        m_playlistIndex = 0;
+        m_pNextSourceElement = nullptr;
     }
     
-    bool RtspSourceBintr::LinkAll()
+    uint UriSourceBintr::GetPlaylistSize()
     {
         LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        return m_playlist.size();
+    }
 
-        if (m_isLinked)
-        {
-            LOG_ERROR("RtspSourceBintr '" << GetName() << "' is already in a linked state");
+    bool UriSourceBintr::AddPlaylistFileListener(dsl_playlist_file_listener_cb listener, 
+        void* userdata)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        if (m_playlistFileListeners.find(listener) != m_playlistFileListeners.end())
+        {   
+            LOG_ERROR("Playlist file listener is not unique");
             return false;
         }
+        m_playlistFileListeners[listener] = userdata;
+        
+        return true;
+    }
 
-        if (!m_pDepayload->LinkToSink(m_pDecodeQueue) or
-            !m_pDecodeQueue->LinkToSink(m_pDecodeBin))
-        {
+    bool UriSourceBintr::RemovePlaylistFileListener(dsl_playlist_file_listener_cb listener)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        if (m_playlistFileListeners.find(listener) == m_playlistFileListeners.end())
+        {   
+            LOG_ERROR("Playlist file listener was not found");
             return false;
         }
-        m_isLinked = true;
+        m_playlistFileListeners.erase(listener);
         
         return true;
     }
 
-    void RtspSourceBintr::UnlinkAll()
+    GstPadProbeReturn UriSourceBintr::HandlePlaylistEosProbe(GstPad* pPad, 
+        GstPadProbeInfo* pInfo)
     {
-        LOG_FUNC();
-
-        if (!m_isLinked)
+        TRACE_SCOPE("probe", __func__);
+        GstEvent* event = GST_PAD_PROBE_INFO_EVENT(pInfo);
+        
+        if (GST_EVENT_TYPE(event) != GST_EVENT_EOS)
         {
-            LOG_ERROR("CsiSourceBintr '" << GetName() << "' is not in a linked state");
-            return;
+            return GST_PAD_PROBE_OK;
         }
-        m_pDepayload->UnlinkFromSink();
-        m_pDecodeQueue->UnlinkFromSink();
-        m_pDecodeBin->UnlinkFromSink();
-        m_isLinked = false;
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        if (m_playlistIndex < m_playlist.size())
+        {
+            // Drop the EOS so downstream never sees the end of the current file,
+            // the decode bin swap must be done outside of this streaming thread.
+            PostTask(gst_structure_new_empty(DSL_URI_SOURCE_TASK_NEXT_FILE));
+            return GST_PAD_PROBE_DROP;
+        }
+        return GST_PAD_PROBE_OK;
     }
 
-    bool RtspSourceBintr::SetUri(const char* uri)
+    GstPadProbeReturn UriSourceBintr::HandlePlaylistStatsProbe(GstPad* pPad, 
+        GstPadProbeInfo* pInfo)
     {
-        LOG_FUNC();
+        TRACE_SCOPE("probe", __func__);
         
-        if (IsInUse())
-        {
-            LOG_ERROR("Unable to set Uri for RtspSourceBintr '" << GetName() 
-                << "' as it's currently in use");
-            return false;
-        }
-        std::string newUri(uri);
-        if (newUri.find("rtsp") == std::string::npos)
+        if (pInfo->type & GST_PAD_PROBE_TYPE_BUFFER)
         {
-            if (m_isLive)
+            gint64 now = g_get_monotonic_time();
+            m_fileLastFrameTime = now;
+            if (!m_fileFrames++)
             {
-                LOG_ERROR("Invalid URI '" << uri << "' for Live source '" << GetName() << "'");
-                return false;
+                m_fileStartTime = now;
+                
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+                PostPlaylistFileEvent(DSL_PLAYLIST_FILE_STARTED, m_countedUri, 0, 0);
             }
-            std::ifstream streamUriFile(uri);
-            if (!streamUriFile.good())
+            return GST_PAD_PROBE_OK;
+        }
+        GstEvent* pEvent = GST_PAD_PROBE_INFO_EVENT(pInfo);
+        if (GST_EVENT_TYPE(pEvent) != GST_EVENT_STREAM_START and
+            GST_EVENT_TYPE(pEvent) != GST_EVENT_EOS)
+        {
+            return GST_PAD_PROBE_OK;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        // Events are serialized with buffers, so all frames of the previous 
+        // file have been counted and the next file's frames are yet to come.
+        uint frames = m_fileFrames;
+        if (frames)
+        {
+            double fps(0);
+            if (frames > 1 and m_fileLastFrameTime > m_fileStartTime)
             {
-                LOG_ERROR("URI Source'" << uri << "' Not found");
-                return false;
+                fps = (double)(frames - 1) * G_USEC_PER_SEC / 
+                    (double)(m_fileLastFrameTime - m_fileStartTime);
             }
-            // File source, not live - setup full path
-            char absolutePath[PATH_MAX+1];
-            m_uri.assign(realpath(uri, absolutePath));
-            m_uri.insert(0, "file:");
-        }        
-        m_pSourceElement->SetAttribute("location", m_uri.c_str());
+            PostPlaylistFileEvent(DSL_PLAYLIST_FILE_ENDED, m_countedUri, frames, fps);
+        }
+        if (GST_EVENT_TYPE(pEvent) == GST_EVENT_STREAM_START and m_pendingUris.size())
+        {
+            m_countedUri = m_pendingUris.front();
+            m_pendingUris.pop_front();
+        }
+        m_fileFrames = 0;
+        
+        return GST_PAD_PROBE_OK;
+    }
+
+    void UriSourceBintr::HandlePlaylistNextFile()
+    {
+        LOG_FUNC();
+        
+        DSL_ELEMENT_PTR pCurrentSourceElement;
+        DSL_ELEMENT_PTR pNextSourceElement;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+            
+            // The playlist may have been cleared, or the Source unlinked, since 
+            // the EOS was dropped. 
+            if (IsLinked() and m_playlistIndex < m_playlist.size())
+            {
+                if (!m_pNextSourceElement)
+                {
+                    m_pNextSourceElement = NewSourceElement(m_playlist[m_playlistIndex], 
+                        G_CALLBACK(UriSourceElementOnPadAddedCB));
+                }
+                m_currentUri = m_playlist[m_playlistIndex++];
+                m_pendingUris.push_back(m_currentUri);
+                
+                // The next file continues on from the current running-time
+                GstClock* pClock = gst_element_get_clock(GetGstElement());
+                if (pClock)
+                {
+                    m_playlistPadOffset = gst_clock_get_time(pClock) - 
+                        gst_element_get_base_time(GetGstElement());
+                    gst_object_unref(pClock);
+                }
+                pCurrentSourceElement = m_pSourceElement;
+                pNextSourceElement = m_pNextSourceElement;
+                m_pSourceElement = m_pNextSourceElement;
+                m_pNextSourceElement = nullptr;
+                m_pActiveSrcPad = NULL;
+            }
+        }
+        if (!pNextSourceElement)
+        {
+            // Resend the EOS, the probe will now let it pass downstream.
+            LOG_WARN("Playlist for UriSourceBintr '" << GetName() 
+                << "' has no next file, resending EOS");
+            GstPad* pStaticPad = gst_element_get_static_pad(m_pTee->GetGstElement(), "sink");
+            gst_pad_send_event(pStaticPad, gst_event_new_eos());
+            gst_object_unref(pStaticPad);
+            return;
+        }
+        LOG_INFO("UriSourceBintr '" << GetName() << "' switching to playlist file '" 
+            << pNextSourceElement->GetName() << "'");
+
+        // Tear down only the current decode bin, all other Elementrs remain linked 
+        // and in a state of playing. Removing from the bin unlinks its src pad.
+        RemoveStateChild(pCurrentSourceElement);
+        
+        AddChild(pNextSourceElement);
+        if (!gst_element_sync_state_with_parent(pNextSourceElement->GetGstElement()))
+        {
+            LOG_ERROR("UriSourceBintr '" << GetName() << "' failed to sync playlist file '" 
+                << pNextSourceElement->GetName() << "' with parent state");
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        // A file added while swapping may have been prefetched already
+        if (!m_pNextSourceElement)
+        {
+            PrefetchNextPlaylistFile();
+        }
+    }
+
+    bool UriSourceBintr::SwitchUri(const char* uri)
+    {
+        LOG_FUNC();
+        
+        std::string newUri(uri);
+        if ((newUri.find("http") == std::string::npos) and 
+            (newUri.find("rtsp") == std::string::npos))
+        {
+            std::ifstream streamUriFile(uri);
+            if (!streamUriFile.good())
+            {
+                LOG_ERROR("Switch URI '" << uri << "' Not found");
+                return false;
+            }
+            char absolutePath[PATH_MAX+1];
+            newUri.assign(realpath(uri, absolutePath));
+            newUri.insert(0, "file:");
+        }
+        DSL_ELEMENT_PTR pStandbySourceElement;
+        DSL_ELEMENT_PTR pStandbyFakeSink;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+
+            // Nothing to switch if not playing, the new URI is used on next link
+            if (!IsLinked())
+            {
+                m_uri = newUri;
+                m_currentUri = m_uri;
+                m_pSourceElement->SetAttribute("uri", m_uri.c_str());
+                return true;
+            }
+            if (m_pStandbySourceElement or m_pRetiredSourceElement)
+            {
+                LOG_ERROR("UriSourceBintr '" << GetName() << "' has a URI switch in progress");
+                return false;
+            }
+            m_switchRequestTime = g_get_monotonic_time();
+            m_standbyUri = newUri;
+
+            // The standby decode bin prerolls into its own fake sink while the
+            // active decode bin continues to feed the Tee, and StreamMux, undisturbed. 
+            m_pStandbySourceElement = NewSourceElement(m_standbyUri,
+                G_CALLBACK(UriSourceStandbyElementOnPadAddedCB));
+            
+            std::string fakeSinkName = "standby-fake-sink-" + std::to_string(m_playlistElementCount);
+            m_pStandbyFakeSink = DSL_ELEMENT_NEW(NVDS_ELEM_SINK_FAKESINK, fakeSinkName.c_str());
+            m_pStandbyFakeSink->SetAttribute("sync", false);
+            m_pStandbyFakeSink->SetAttribute("async", false);
+            
+            pStandbySourceElement = m_pStandbySourceElement;
+            pStandbyFakeSink = m_pStandbyFakeSink;
+        }
+        
+        // The state changes are made without the mutex held, as the standby 
+        // decode bin's streaming threads take it in the standby probe.
+        AddChild(pStandbyFakeSink);
+        AddChild(pStandbySourceElement);
+        
+        if (!gst_element_sync_state_with_parent(pStandbyFakeSink->GetGstElement()) or
+            !gst_element_sync_state_with_parent(pStandbySourceElement->GetGstElement()))
+        {
+            LOG_ERROR("UriSourceBintr '" << GetName() << "' failed to start standby decode bin");
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+                if (m_pStandbySourceElement == pStandbySourceElement)
+                {
+                    m_pStandbySourceElement = nullptr;
+                    m_pStandbyFakeSink = nullptr;
+                }
+            }
+            RemoveStateChild(pStandbySourceElement);
+            RemoveStateChild(pStandbyFakeSink);
+            return false;
+        }
+        LOG_INFO("UriSourceBintr '" << GetName() << "' prerolling standby URI '" 
+            << newUri << "'");
+        return true;
+    }
+    
+    uint UriSourceBintr::GetSwitchLatency()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        return m_switchLatency;
+    }
+
+    void UriSourceBintr::HandleStandbyElementOnPadAdded(GstElement* pBin, GstPad* pPad)
+    {
+        LOG_FUNC();
+
+        GstCaps* pCaps = gst_pad_query_caps(pPad, NULL);
+        GstStructure* structure = gst_caps_get_structure(pCaps, 0);
+        std::string name = gst_structure_get_name(structure);
+        gst_caps_unref(pCaps);
+        
+        if (name.find("video") == std::string::npos)
+        {
+            return;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        if (!m_pStandbyFakeSink)
+        {
+            LOG_WARN("Standby decode bin for URI source '" << GetName() << "' was abandoned");
+            return;
+        }
+        GstPad* pFakeSinkPad = gst_element_get_static_pad(
+            m_pStandbyFakeSink->GetGstElement(), "sink");
+        if (gst_pad_link(pPad, pFakeSinkPad) != GST_PAD_LINK_OK) 
+        {
+            LOG_ERROR("Failed to link standby decode bin for URI source '" << GetName() << "'");
+        }
+        gst_object_unref(pFakeSinkPad);
+        
+        // Block on the first buffer to swap the standby pad onto the Tee
+        gst_pad_add_probe(pPad, 
+            (GstPadProbeType)(GST_PAD_PROBE_TYPE_BLOCK | GST_PAD_PROBE_TYPE_BUFFER),
+            UriSourceStandbyBufferProbeCB, this, NULL);
+            
+        LOG_INFO("Standby video decode linked for URI source '" << GetName() << "'");
+    }
+
+    GstPadProbeReturn UriSourceBintr::HandleStandbyBufferProbe(GstPad* pPad, 
+        GstPadProbeInfo* pInfo)
+    {
+        TRACE_SCOPE("probe", __func__);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+        
+        // The switch was abandoned by UnlinkAll while this probe was pending
+        if (!m_pStandbySourceElement)
+        {
+            return GST_PAD_PROBE_REMOVE;
+        }
+        // The probe is on the decoder's output, and the decoder outputs no frames
+        // ahead of the first key frame, so the first buffer is always decodable.
+        GstPad* pTeeSinkPad = gst_element_get_static_pad(m_pTee->GetGstElement(), "sink");
+
+        // Silence, then detach, the active decode bin. Dropped data is reported
+        // as GST_FLOW_OK upstream so the retired decode bin does not error out.
+        if (m_pActiveSrcPad)
+        {
+            gst_pad_add_probe(m_pActiveSrcPad, GST_PAD_PROBE_TYPE_DATA_DOWNSTREAM,
+                UriSourceRetiredDropProbeCB, this, NULL);
+            gst_pad_unlink(m_pActiveSrcPad, pTeeSinkPad);
+        }
+        GstPad* pFakeSinkPad = gst_element_get_static_pad(
+            m_pStandbyFakeSink->GetGstElement(), "sink");
+        gst_pad_unlink(pPad, pFakeSinkPad);
+        gst_object_unref(pFakeSinkPad);
+
+        // Live streams are already timestamped in running-time, file streams 
+        // continue on from the current running-time.
+        if (!m_isLive)
+        {
+            GstClock* pClock = gst_element_get_clock(GetGstElement());
+            if (pClock)
+            {
+                m_playlistPadOffset = gst_clock_get_time(pClock) - 
+                    gst_element_get_base_time(GetGstElement());
+                gst_object_unref(pClock);
+            }
+            gst_pad_set_offset(pPad, m_playlistPadOffset);
+        }
+        if (gst_pad_link(pPad, pTeeSinkPad) != GST_PAD_LINK_OK)
+        {
+            LOG_ERROR("UriSourceBintr '" << GetName() << "' failed to link standby decode bin");
+        }
+        gst_object_unref(pTeeSinkPad);
+
+        m_pActiveSrcPad = pPad;
+        m_pRetiredSourceElement = m_pSourceElement;
+        m_pSourceElement = m_pStandbySourceElement;
+        m_pStandbySourceElement = nullptr;
+        m_currentUri = m_standbyUri;
+        m_pendingUris.push_back(m_currentUri);
+        
+        m_switchLatency = (g_get_monotonic_time() - m_switchRequestTime) / 1000;
+        
+        LOG_INFO("UriSourceBintr '" << GetName() << "' switched to URI '" << m_currentUri 
+            << "' with latency = " << m_switchLatency << "ms");
+
+        PostTask(gst_structure_new_empty(DSL_URI_SOURCE_TASK_SWITCH_COMPLETE));
+        
+        // Unblock, the buffer is pushed to the Tee as the new peer
+        return GST_PAD_PROBE_REMOVE;
+    }
+
+    void UriSourceBintr::HandleSwitchComplete()
+    {
+        LOG_FUNC();
+        
+        DSL_ELEMENT_PTR pRetiredSourceElement;
+        DSL_ELEMENT_PTR pStandbyFakeSink;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_playlistMutex);
+            
+            pRetiredSourceElement = m_pRetiredSourceElement;
+            pStandbyFakeSink = m_pStandbyFakeSink;
+            m_pRetiredSourceElement = nullptr;
+            m_pStandbyFakeSink = nullptr;
+        }
+        RemoveStateChild(pRetiredSourceElement);
+        RemoveStateChild(pStandbyFakeSink);
+    }
+
+    void UriSourceBintr::RemoveStateChild(DSL_ELEMENT_PTR pElement)
+    {
+        LOG_FUNC();
+        
+        if (pElement)
+        {
+            gst_element_set_state(pElement->GetGstElement(), GST_STATE_NULL);
+            RemoveChild(pElement);
+        }
+    }
+
+    void UriSourceBintr::PostTask(GstStructure* pTask)
+    {
+        // Bins forward application messages to the Pipeline's bus
+        gst_element_post_message(GetGstElement(), 
+            gst_message_new_application(GetGstObject(), pTask));
+    }
+
+    void UriSourceBintr::PostPlaylistFileEvent(uint event, const std::string& uri, 
+        uint frames, double fps)
+    {
+        PostTask(gst_structure_new(DSL_URI_SOURCE_TASK_FILE_EVENT, 
+            "event", G_TYPE_UINT, event,
+            "uri", G_TYPE_STRING, uri.c_str(),
+            "frames", G_TYPE_UINT, frames,
+            "fps", G_TYPE_DOUBLE, fps, NULL));
+    }
+
+    bool UriSourceBintr::HandleTaskMessage(GstMessage* pMessage)
+    {
+        const GstStructure* pTask = gst_message_get_structure(pMessage);
+        TaskTarget* pTaskTarget = (TaskTarget*)g_object_get_data(
+            G_OBJECT(GST_MESSAGE_SRC(pMessage)), DSL_URI_SOURCE_TASK_TARGET);
+        if (!pTask or !pTaskTarget)
+        {
+            return false;
+        }
+        std::map<dsl_playlist_file_listener_cb, void*> listeners;
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&pTaskTarget->mutex);
+            
+            UriSourceBintr* pSource = pTaskTarget->pSource;
+            if (!pSource)
+            {
+                LOG_INFO("Task '" << gst_structure_get_name(pTask) 
+                    << "' ignored for deleted UriSourceBintr");
+                return true;
+            }
+            if (!gst_structure_has_name(pTask, DSL_URI_SOURCE_TASK_FILE_EVENT))
+            {
+                pSource->HandleTask(pTask);
+                return true;
+            }
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&pSource->m_playlistMutex);
+            listeners = pSource->m_playlistFileListeners;
+        }
+        // Listeners are called with nothing locked, they are free to call 
+        // back into the playlist services or to delete the Source.
+        NotifyPlaylistFileListeners(listeners, pTask);
+        return true;
+    }
+
+    void UriSourceBintr::HandleTask(const GstStructure* pTask)
+    {
+        LOG_FUNC();
+        
+        if (gst_structure_has_name(pTask, DSL_URI_SOURCE_TASK_NEXT_FILE))
+        {
+            HandlePlaylistNextFile();
+        }
+        else if (gst_structure_has_name(pTask, DSL_URI_SOURCE_TASK_SWITCH_COMPLETE))
+        {
+            HandleSwitchComplete();
+        }
+    }
+
+    void UriSourceBintr::FreeTaskTarget(gpointer pTaskTarget)
+    {
+        g_mutex_clear(&static_cast<TaskTarget*>(pTaskTarget)->mutex);
+        delete static_cast<TaskTarget*>(pTaskTarget);
+    }
+
+    DSL_ELEMENT_PTR UriSourceBintr::NewSourceElement(const std::string& uri, 
+        GCallback padAddedCb)
+    {
+        LOG_FUNC();
+        
+        std::string sourceElementName = "src-element" + GetName() + 
+            "-" + std::to_string(++m_playlistElementCount);
+        DSL_ELEMENT_PTR pSourceElement = 
+            DSL_ELEMENT_NEW(NVDS_ELEM_SRC_URI, sourceElementName.c_str());
+
+        pSourceElement->SetAttribute("uri", uri.c_str());
+
+        g_signal_connect(pSourceElement->GetGObject(), "pad-added", 
+            padAddedCb, this);
+        g_signal_connect(pSourceElement->GetGObject(), "child-added", 
+            G_CALLBACK(OnChildAddedCB), this);
+        g_object_set_data(G_OBJECT(pSourceElement->GetGObject()), "source", this);
+        g_signal_connect(pSourceElement->GetGObject(), "source-setup",
+            G_CALLBACK(OnSourceSetupCB), this);
+            
+        return pSourceElement;
+    }
+
+    void UriSourceBintr::PrefetchNextPlaylistFile()
+    {
+        LOG_FUNC();
+        
+        if (m_playlistIndex >= m_playlist.size())
+        {
+            return;
+        }
+        const std::string& nextUri = m_playlist[m_playlistIndex];
+        m_pNextSourceElement = NewSourceElement(nextUri, 
+            G_CALLBACK(UriSourceElementOnPadAddedCB));
+        
+        // The uridecodebin stays in a state of NULL until swapped in, so the 
+        // demuxer and decoder are not built ahead of time. Only the file read
+        // is started early, into the page cache, so the swap does not wait on disk.
+        if (nextUri.find("file:") == 0)
+        {
+            int fd = open(nextUri.substr(5).c_str(), O_RDONLY);
+            if (fd >= 0)
+            {
+                posix_fadvise(fd, 0, 0, POSIX_FADV_WILLNEED);
+                close(fd);
+            }
+        }
+    }
+
+    void UriSourceBintr::NotifyPlaylistFileListeners(
+        const std::map<dsl_playlist_file_listener_cb, void*>& listeners,
+        const GstStructure* pTask)
+    {
+        uint event(0), frames(0);
+        double fps(0);
+        gst_structure_get_uint(pTask, "event", &event);
+        gst_structure_get_uint(pTask, "frames", &frames);
+        gst_structure_get_double(pTask, "fps", &fps);
+        
+        std::string uri(gst_structure_get_string(pTask, "uri"));
+        std::wstring wstrUri(uri.begin(), uri.end());
+        
+        for(auto const& imap: listeners)
+        {
+            try
+            {
+                imap.first(event, wstrUri.c_str(), frames, fps, imap.second);
+            }
+            catch(...)
+            {
+                LOG_ERROR("Client Playlist File Listener threw exception for file '" 
+                    << uri << "'");
+            }
+        }
+    }
+    
+    //*********************************************************************************
+    
+    RtspSourceBintr::RtspSourceBintr(const char* name, const char* uri, uint protocol,
+        uint cudadecMemType, uint intraDecode, uint dropFrameInterval)
+        : DecodeSourceBintr(name, "rtspsrc", uri, true, cudadecMemType, intraDecode, dropFrameInterval)
+    {
+        LOG_FUNC();
+        
+        m_rtpProtocols = protocol;
+        
+        // New RTSP Specific Elementrs for this Source
+        m_pDepayload = DSL_ELEMENT_NEW("rtph264depay", "src-depayload");
+        m_pDecodeQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "decode-queue");
+        m_pDecodeBin = DSL_ELEMENT_NEW("decodebin", "decode-bin");
+        m_pSourceQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "src-queue");
+
+        m_pSourceElement->SetAttribute("location", m_uri.c_str());
+        ApplyRtspConfig(m_pSourceElement->GetGstElement());
+        
+        // Retain the RTP bin, once created, for network statistics
+        g_signal_connect(m_pSourceElement->GetGObject(), "new-manager", 
+            G_CALLBACK(OnNewManagerCB), this);
+
+        // Connect RTSP Source Setup Callbacks
+        g_signal_connect(m_pSourceElement->GetGObject(), "pad-added", 
+            G_CALLBACK(RtspSourceElementOnPadAddedCB), this);
+
+        // Connect Decode Setup Callbacks
+        g_signal_connect(m_pDecodeBin->GetGObject(), "pad-added", 
+            G_CALLBACK(RtspDecodeElementOnPadAddedCB), this);
+        g_signal_connect(m_pDecodeBin->GetGObject(), "child-added", 
+            G_CALLBACK(OnChildAddedCB), this);
+
+//        g_object_set_data(G_OBJECT(m_pSourceElement->GetGObject()), "source", this);
+
+        AddChild(m_pDepayload);
+        AddChild(m_pDecodeQueue);
+        AddChild(m_pDecodeBin);
+        AddChild(m_pSourceQueue);
+        
+        // Source Ghost Pad for Source Queue
+        m_pSourceQueue->AddGhostPadToParent("src");
+    }
+
+    RtspSourceBintr::~RtspSourceBintr()
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            UnlinkAll();
+        }
+    }
+    
+    bool RtspSourceBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("RtspSourceBintr '" << GetName() << "' is already in a linked state");
+            return false;
+        }
+
+        if (!m_pDepayload->LinkToSink(m_pDecodeQueue) or
+            !m_pDecodeQueue->LinkToSink(m_pDecodeBin))
+        {
+            return false;
+        }
+        m_isLinked = true;
+        
+        return true;
+    }
+
+    void RtspSourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("CsiSourceBintr '" << GetName() << "' is not in a linked state");
+            return;
+        }
+        m_pDepayload->UnlinkFromSink();
+        m_pDecodeQueue->UnlinkFromSink();
+        m_pDecodeBin->UnlinkFromSink();
+        ReleaseRtpManager();
+        m_isLinked = false;
+    }
+
+    bool RtspSourceBintr::SetUri(const char* uri)
+    {
+        LOG_FUNC();
+        
+        if (IsInUse())
+        {
+            LOG_ERROR("Unable to set Uri for RtspSourceBintr '" << GetName() 
+                << "' as it's currently in use");
+            return false;
+        }
+        std::string newUri(uri);
+        if (newUri.find("rtsp") == std::string::npos)
+        {
+            if (m_isLive)
+            {
+                LOG_ERROR("Invalid URI '" << uri << "' for Live source '" << GetName() << "'");
+                return false;
+            }
+            std::ifstream streamUriFile(uri);
+            if (!streamUriFile.good())
+            {
+                LOG_ERROR("URI Source'" << uri << "' Not found");
+                return false;
+            }
+            // File source, not live - setup full path
+            char absolutePath[PATH_MAX+1];
+            m_uri.assign(realpath(uri, absolutePath));
+            m_uri.insert(0, "file:");
+        }        
+        m_pSourceElement->SetAttribute("location", m_uri.c_str());
         
         return true;
     }
@@ -963,6 +1903,424 @@ namespace DSL
     }
     
     
+    //*********************************************************************************
+
+    /**
+     * @brief returns the existing folder or file that roots a Multi Image location, 
+     * i.e. the folder portion of a glob pattern, or the location itself otherwise. 
+     */
+    static std::string MultiImageLocationRoot(const char* location)
+    {
+        std::string root(location);
+        
+        if (root.find_first_of("*?[") != std::string::npos)
+        {
+            size_t lastSlash = root.rfind('/', root.find_first_of("*?["));
+            root = (lastSlash == std::string::npos) ? "." : root.substr(0, lastSlash);
+        }
+        return root;
+    }
+
+    /**
+     * @brief returns true if the filename has a JPEG or PNG extension, case insensitive
+     */
+    static bool IsImageFile(const std::string& filename)
+    {
+        std::string lowerCase(filename);
+        std::transform(lowerCase.begin(), lowerCase.end(), lowerCase.begin(), ::tolower);
+        
+        return (g_str_has_suffix(lowerCase.c_str(), ".jpg") or
+            g_str_has_suffix(lowerCase.c_str(), ".jpeg") or
+            g_str_has_suffix(lowerCase.c_str(), ".png"));
+    }
+
+    /**
+     * @brief returns the image format of a file by extension, case insensitive
+     * @return "jpeg" or "png" for image files, "" otherwise 
+     */
+    static std::string ImageFileFormat(const std::string& filename)
+    {
+        std::string lowerCase(filename);
+        std::transform(lowerCase.begin(), lowerCase.end(), lowerCase.begin(), ::tolower);
+        
+        if (g_str_has_suffix(lowerCase.c_str(), ".png"))
+        {
+            return "png";
+        }
+        return IsImageFile(lowerCase) ? "jpeg" : "";
+    }
+
+    MultiImageSourceBintr::MultiImageSourceBintr(const char* name, 
+        const char* location, uint readahead)
+        : DecodeSourceBintr(name, "appsrc", MultiImageLocationRoot(location).c_str(), 
+            false, DSL_CUDADEC_MEMTYPE_DEVICE, false, 0)
+        , m_isMjpeg(false)
+        , m_readahead(readahead)
+        , m_pReadaheadThread(NULL)
+        , m_stopReadahead(false)
+        , m_filesRead(0)
+        , m_firstFrameTime(0)
+        , m_lastFrameTime(0)
+        , m_statsProbeId(0)
+    {
+        LOG_FUNC();
+        
+        if (!ListFiles(location, m_files))
+        {
+            LOG_ERROR("No image files, or files of mixed format, found at location '" 
+                << location << "' for Multi Image Source '" << name << "'");
+            throw;
+        }
+        m_isMjpeg = (m_files.size() == 1 and !IsImageFile(m_files[0]));
+
+        // New Elementrs for this Source
+        m_pReadaheadQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "readahead-queue");
+        m_pDecodeBin = DSL_ELEMENT_NEW("decodebin", "decode-bin");
+        m_pVidConv = DSL_ELEMENT_NEW(NVDS_ELEM_VIDEO_CONV, "src-vid-conv");
+        m_pCapsFilter = DSL_ELEMENT_NEW(NVDS_ELEM_CAPS_FILTER, "src-caps-filter");
+        m_pSourceQueue = DSL_ELEMENT_NEW(NVDS_ELEM_QUEUE, "src-queue");
+
+        // Non-live, un-timestamped stream - downstream sets the pace
+        m_pSourceElement->SetAttribute("is-live", false);
+        m_pSourceElement->SetAttribute("block", true);
+        m_pSourceElement->SetAttribute("format", GST_FORMAT_TIME);
+        m_pSourceElement->SetAttribute("do-timestamp", false);
+        
+        // The readahead depth is bounded by buffer count only
+        m_pReadaheadQueue->SetAttribute("max-size-buffers", m_readahead);
+        m_pReadaheadQueue->SetAttribute("max-size-bytes", 0);
+        g_object_set(m_pReadaheadQueue->GetGObject(), "max-size-time", (guint64)0, NULL);
+
+        m_pVidConv->SetAttribute("gpu-id", m_gpuId);
+        m_pVidConv->SetAttribute("nvbuf-memory-type", m_nvbufMemoryType);
+
+        GstCaps* pCaps = gst_caps_from_string("video/x-raw(memory:NVMM), format=NV12");
+        m_pCapsFilter->SetAttribute("caps", pCaps);
+        gst_caps_unref(pCaps);
+
+        g_signal_connect(m_pSourceElement->GetGObject(), "need-data", 
+            G_CALLBACK(MultiImageSourceNeedDataCB), this);
+
+        // Connect Decode Setup Callbacks
+        g_signal_connect(m_pDecodeBin->GetGObject(), "pad-added", 
+            G_CALLBACK(MultiImageDecodeElementOnPadAddedCB), this);
+        g_signal_connect(m_pDecodeBin->GetGObject(), "child-added", 
+            G_CALLBACK(OnChildAddedCB), this);
+
+        AddChild(m_pReadaheadQueue);
+        AddChild(m_pDecodeBin);
+        AddChild(m_pVidConv);
+        AddChild(m_pCapsFilter);
+        AddChild(m_pSourceQueue);
+        
+        // Count each frame leaving the source for the files-per-second stats
+        GstPad* pStaticSrcPad = gst_element_get_static_pad(m_pSourceQueue->GetGstElement(), "src");
+        m_statsProbeId = gst_pad_add_probe(pStaticSrcPad, GST_PAD_PROBE_TYPE_BUFFER,
+            MultiImageSourceBufferProbeCB, this, NULL);
+        gst_object_unref(pStaticSrcPad);
+
+        // Source Ghost Pad for Source Queue
+        m_pSourceQueue->AddGhostPadToParent("src");
+        
+        g_mutex_init(&m_readaheadMutex);
+        g_mutex_init(&m_statsMutex);
+    }
+
+    MultiImageSourceBintr::~MultiImageSourceBintr()
+    {
+        LOG_FUNC();
+        
+        if (IsLinked())
+        {
+            UnlinkAll();
+        }
+        g_mutex_clear(&m_readaheadMutex);
+        g_mutex_clear(&m_statsMutex);
+    }
+
+    bool MultiImageSourceBintr::LinkAll()
+    {
+        LOG_FUNC();
+
+        if (m_isLinked)
+        {
+            LOG_ERROR("MultiImageSourceBintr '" << GetName() << "' is already in a linked state");
+            return false;
+        }
+        if (!m_pSourceElement->LinkToSink(m_pReadaheadQueue) or
+            !m_pReadaheadQueue->LinkToSink(m_pDecodeBin) or
+            !m_pVidConv->LinkToSink(m_pCapsFilter) or
+            !m_pCapsFilter->LinkToSink(m_pSourceQueue))
+        {
+            return false;
+        }
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_statsMutex);
+        m_filesRead = 0;
+        m_firstFrameTime = 0;
+        m_lastFrameTime = 0;
+        
+        m_isLinked = true;
+        
+        return true;
+    }
+
+    void MultiImageSourceBintr::UnlinkAll()
+    {
+        LOG_FUNC();
+
+        if (!m_isLinked)
+        {
+            LOG_ERROR("MultiImageSourceBintr '" << GetName() << "' is not in a linked state");
+            return;
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_readaheadMutex);
+            m_stopReadahead = true;
+        }
+        // The thread will have been unblocked by the appsrc flushing on 
+        // transition to READY, we only need to wait for it to exit.
+        if (m_pReadaheadThread)
+        {
+            g_thread_join(m_pReadaheadThread);
+            m_pReadaheadThread = NULL;
+        }
+        m_stopReadahead = false;
+        
+        m_pSourceElement->UnlinkFromSink();
+        m_pReadaheadQueue->UnlinkFromSink();
+        m_pVidConv->UnlinkFromSink();
+        m_pCapsFilter->UnlinkFromSink();
+        m_isLinked = false;
+    }
+
+    bool MultiImageSourceBintr::SetUri(const char* location)
+    {
+        LOG_FUNC();
+        
+        if (IsInUse())
+        {
+            LOG_ERROR("Unable to set location for MultiImageSourceBintr '" << GetName() 
+                << "' as it's currently in use");
+            return false;
+        }
+        std::vector<std::string> files;
+        if (!ListFiles(location, files))
+        {
+            LOG_ERROR("No image files, or files of mixed format, found at location '" 
+                << location << "' for Multi Image Source '" << GetName() << "'");
+            return false;
+        }
+        m_files = files;
+        m_isMjpeg = (m_files.size() == 1 and !IsImageFile(m_files[0]));
+
+        char absolutePath[PATH_MAX+1];
+        m_uri.assign(realpath(MultiImageLocationRoot(location).c_str(), absolutePath));
+        m_uri.insert(0, "file:");
+        
+        return true;
+    }
+
+    void MultiImageSourceBintr::GetStats(uint* filesRead, double* filesPerSecond)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_statsMutex);
+        
+        *filesRead = m_filesRead;
+        *filesPerSecond = 0;
+        
+        if (m_filesRead > 1 and m_lastFrameTime > m_firstFrameTime)
+        {
+            *filesPerSecond = (double)(m_filesRead - 1) * G_USEC_PER_SEC / 
+                (double)(m_lastFrameTime - m_firstFrameTime);
+        }
+    }
+
+    void MultiImageSourceBintr::HandleNeedData()
+    {
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_readaheadMutex);
+
+        // need-data is signaled each time the appsrc queue runs dry. 
+        // Start the readahead thread on the first call only.
+        if (!m_pReadaheadThread and !m_stopReadahead)
+        {
+            std::string threadName = GetName() + "-readahead-thread";
+            m_pReadaheadThread = g_thread_new(threadName.c_str(), 
+                MultiImageSourceReadaheadThread, this);
+        }
+    }
+
+    void MultiImageSourceBintr::HandleReadahead()
+    {
+        LOG_FUNC();
+        
+        // M-JPEG files are read in fixed size chunks, the multipart 
+        // demuxer plugged by decodebin splits them back into frames
+        const size_t chunkSize(1024*1024);
+        
+        GstFlowReturn flowReturn(GST_FLOW_OK);
+        
+        for (auto const& ivec: m_files)
+        {
+            if (m_isMjpeg)
+            {
+                FILE* pFile = fopen(ivec.c_str(), "rb");
+                if (!pFile)
+                {
+                    LOG_ERROR("Failed to open M-JPEG file '" << ivec << "'");
+                    break;
+                }
+                while (!m_stopReadahead and flowReturn == GST_FLOW_OK)
+                {
+                    GstBuffer* pBuffer = gst_buffer_new_allocate(NULL, chunkSize, NULL);
+                    GstMapInfo map;
+                    gst_buffer_map(pBuffer, &map, GST_MAP_WRITE);
+                    size_t bytesRead = fread(map.data, 1, chunkSize, pFile);
+                    gst_buffer_unmap(pBuffer, &map);
+                    
+                    if (!bytesRead)
+                    {
+                        gst_buffer_unref(pBuffer);
+                        break;
+                    }
+                    gst_buffer_set_size(pBuffer, bytesRead);
+                    g_signal_emit_by_name(m_pSourceElement->GetGObject(), 
+                        "push-buffer", pBuffer, &flowReturn);
+                    gst_buffer_unref(pBuffer);
+                }
+                fclose(pFile);
+            }
+            else
+            {
+                gchar* pContents(NULL);
+                gsize length(0);
+                if (!g_file_get_contents(ivec.c_str(), &pContents, &length, NULL))
+                {
+                    LOG_WARN("Failed to read image file '" << ivec << "' - skipping");
+                    continue;
+                }
+                // Buffer takes ownership of the file contents
+                GstBuffer* pBuffer = gst_buffer_new_wrapped(pContents, length);
+                g_signal_emit_by_name(m_pSourceElement->GetGObject(), 
+                    "push-buffer", pBuffer, &flowReturn);
+                gst_buffer_unref(pBuffer);
+            }
+            if (m_stopReadahead or flowReturn != GST_FLOW_OK)
+            {
+                LOG_INFO("Readahead for MultiImageSourceBintr '" << GetName() 
+                    << "' stopped with flow return = " << flowReturn);
+                return;
+            }
+        }
+        g_signal_emit_by_name(m_pSourceElement->GetGObject(), "end-of-stream", &flowReturn);
+        
+        LOG_INFO("Readahead for MultiImageSourceBintr '" << GetName() << "' completed");
+    }
+
+    void MultiImageSourceBintr::HandleDecodeElementOnPadAdded(GstElement* pBin, GstPad* pPad)
+    {
+        LOG_FUNC();
+
+        GstCaps* pCaps = gst_pad_query_caps(pPad, NULL);
+        GstStructure* structure = gst_caps_get_structure(pCaps, 0);
+        std::string name = gst_structure_get_name(structure);
+        
+        LOG_INFO("Caps structs name " << name);
+        if (name.find("video") != std::string::npos)
+        {
+            m_pGstStaticSinkPad = gst_element_get_static_pad(m_pVidConv->GetGstElement(), "sink");
+            if (!m_pGstStaticSinkPad)
+            {
+                LOG_ERROR("Failed to get Static Sink Pad for Multi Image Source '" << GetName() << "'");
+            }
+            
+            if (gst_pad_link(pPad, m_pGstStaticSinkPad) != GST_PAD_LINK_OK) 
+            {
+                LOG_ERROR("Failed to link decodebin to pipeline");
+                throw;
+            }
+            
+            // Update the cap memebers for this Multi Image Source Bintr
+            gst_structure_get_uint(structure, "width", &m_width);
+            gst_structure_get_uint(structure, "height", &m_height);
+            gst_structure_get_fraction(structure, "framerate", (gint*)&m_fps_n, (gint*)&m_fps_d);
+            
+            LOG_INFO("Video decode linked for Multi Image source '" << GetName() << "'");
+        }
+        gst_caps_unref(pCaps);
+    }
+
+    GstPadProbeReturn MultiImageSourceBintr::HandleSourceQueueBuffer(GstPad* pPad, 
+        GstPadProbeInfo* pInfo)
+    {
+        TRACE_SCOPE("probe", __func__);
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_statsMutex);
+        
+        m_lastFrameTime = g_get_monotonic_time();
+        if (!m_filesRead++)
+        {
+            m_firstFrameTime = m_lastFrameTime;
+        }
+        return GST_PAD_PROBE_OK;
+    }
+
+    bool MultiImageSourceBintr::ListFiles(const char* location, 
+        std::vector<std::string>& files)
+    {
+        LOG_FUNC();
+        
+        files.clear();
+        std::string strLocation(location);
+        
+        if (strLocation.find_first_of("*?[") != std::string::npos)
+        {
+            // glob results are sorted by default
+            glob_t globResults;
+            if (glob(location, GLOB_TILDE, NULL, &globResults) == 0)
+            {
+                for (size_t i = 0; i < globResults.gl_pathc; i++)
+                {
+                    files.push_back(globResults.gl_pathv[i]);
+                }
+            }
+            globfree(&globResults);
+        }
+        else if (g_file_test(location, G_FILE_TEST_IS_DIR))
+        {
+            GDir* pDir = g_dir_open(location, 0, NULL);
+            if (!pDir)
+            {
+                return false;
+            }
+            const gchar* pFilename(NULL);
+            while ((pFilename = g_dir_read_name(pDir)))
+            {
+                if (IsImageFile(pFilename))
+                {
+                    files.push_back(strLocation + "/" + pFilename);
+                }
+            }
+            g_dir_close(pDir);
+            std::sort(files.begin(), files.end());
+        }
+        else if (g_file_test(location, G_FILE_TEST_IS_REGULAR))
+        {
+            files.push_back(strLocation);
+        }
+        
+        // The decoder is plugged for the format of the first file only
+        for (auto const& ivec: files)
+        {
+            if (ImageFileFormat(ivec) != ImageFileFormat(files.front()))
+            {
+                LOG_ERROR("Image file '" << ivec << "' does not match the format of '" 
+                    << files.front() << "' at location '" << location << "'");
+                files.clear();
+                return false;
+            }
+        }
+        return !files.empty();
+    }
+    
     static void UriSourceElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource)
     {
         static_cast<UriSourceBintr*>(pSource)->HandleSourceElementOnPadAdded(pBin, pPad);
@@ -1002,4 +2360,64 @@ namespace DSL
         return static_cast<DecodeSourceBintr*>(pSource)->HandleStreamBufferSeek();
     }
 
+    static void MultiImageSourceNeedDataCB(GstElement* pAppSrc, guint length, gpointer pSource)
+    {
+        static_cast<MultiImageSourceBintr*>(pSource)->HandleNeedData();
+    }
+
+    static gpointer MultiImageSourceReadaheadThread(gpointer pSource)
+    {
+        static_cast<MultiImageSourceBintr*>(pSource)->HandleReadahead();
+        
+        return NULL;
+    }
+
+    static void MultiImageDecodeElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource)
+    {
+        static_cast<MultiImageSourceBintr*>(pSource)->HandleDecodeElementOnPadAdded(pBin, pPad);
+    }
+
+    static GstPadProbeReturn MultiImageSourceBufferProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource)
+    {
+        return static_cast<MultiImageSourceBintr*>(pSource)->
+            HandleSourceQueueBuffer(pPad, pInfo);
+    }
+
+    static GstPadProbeReturn UriSourcePlaylistEosProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource)
+    {
+        return static_cast<UriSourceBintr*>(pSource)->
+            HandlePlaylistEosProbe(pPad, pInfo);
+    }
+
+    static GstPadProbeReturn UriSourcePlaylistStatsProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource)
+    {
+        return static_cast<UriSourceBintr*>(pSource)->HandlePlaylistStatsProbe(pPad, pInfo);
+    }
+
+    static void OnNewManagerCB(GstElement* pRtspSrc, GstElement* pManager, gpointer pSource)
+    {
+        static_cast<DecodeSourceBintr*>(pSource)->HandleOnNewManager(pManager);
+    }
+
+    static void UriSourceStandbyElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource)
+    {
+        static_cast<UriSourceBintr*>(pSource)->HandleStandbyElementOnPadAdded(pBin, pPad);
+    }
+
+    static GstPadProbeReturn UriSourceStandbyBufferProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource)
+    {
+        return static_cast<UriSourceBintr*>(pSource)->
+            HandleStandbyBufferProbe(pPad, pInfo);
+    }
+
+    static GstPadProbeReturn UriSourceRetiredDropProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource)
+    {
+        return GST_PAD_PROBE_DROP;
+    }
+
 } // SDL namespace
\ No newline at end of file
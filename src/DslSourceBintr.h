@@ -59,6 +59,18 @@ namespace DSL
     #define DSL_RTSP_SOURCE_NEW(name, uri, protocol, cudadecMemType, intraDecode, dropFrameInterval) \
         std::shared_ptr<RtspSourceBintr>(new RtspSourceBintr(name, uri, protocol, cudadecMemType, intraDecode, dropFrameInterval))
 
+    #define DSL_MULTI_IMAGE_SOURCE_PTR std::shared_ptr<MultiImageSourceBintr>
+    #define DSL_MULTI_IMAGE_SOURCE_NEW(name, location, readahead) \
+        std::shared_ptr<MultiImageSourceBintr>(new MultiImageSourceBintr(name, location, readahead))
+
+    /**
+     * @brief Names used by the UriSourceBintr to post tasks to the Pipeline's bus
+     */
+    #define DSL_URI_SOURCE_TASK_TARGET              "dsl-task-target"
+    #define DSL_URI_SOURCE_TASK_NEXT_FILE           "dsl-playlist-next-file"
+    #define DSL_URI_SOURCE_TASK_FILE_EVENT          "dsl-playlist-file"
+    #define DSL_URI_SOURCE_TASK_SWITCH_COMPLETE     "dsl-switch-complete"
+
     /**
      * @class SourceBintr
      * @brief Implements a base Source Bintr for all derived Source types.
@@ -169,6 +181,18 @@ namespace DSL
          */
         uint m_numExtraSurfaces;
 
+        /**
+         * @brief number of decode surfaces applied to the decoder, 
+         * less than m_numDecodeSurfaces if shrunk by a surface budget
+         */
+        uint m_effectiveDecodeSurfaces;
+
+        /**
+         * @brief number of extra surfaces applied to the decoder,
+         * less than m_numExtraSurfaces if shrunk by a surface budget
+         */
+        uint m_effectiveExtraSurfaces;
+
         /**
          * @brief Soure Element for this SourceBintr
          */
@@ -279,6 +303,8 @@ namespace DSL
         DecodeSourceBintr(const char* name, const char* factoryName, const char* uri, 
             bool isLive, uint cudadecMemType, uint intraDecode, uint dropFrameInterval);
 
+        ~DecodeSourceBintr();
+
         /**
          * @brief returns the current URI source for this DecodeSourceBintr
          * @return const string for either live or file source
@@ -292,6 +318,22 @@ namespace DSL
 
         virtual bool SetUri(const char* uri) = 0;
 
+        /**
+         * @brief Gets the decode settings this DecodeSourceBintr was created with
+         * @param[out] cudadecMemType one of the DSL_CUDADEC_MEMTYPE constants
+         * @param[out] intraDecode 1 if decoding intra-frames only, 0 otherwise
+         * @param[out] dropFrameInterval the interval of frames to drop, 0 = none
+         */
+        void GetDecodeSettings(uint* cudadecMemType, uint* intraDecode,
+            uint* dropFrameInterval)
+        {
+            LOG_FUNC();
+
+            *cudadecMemType = m_cudadecMemtype;
+            *intraDecode = m_intraDecode;
+            *dropFrameInterval = m_dropFrameInterval;
+        }
+
         /**
          * @brief Sets the unique source id for this Source bintr
          * @param id value to assign [0...MAX]
@@ -347,9 +389,105 @@ namespace DSL
          */
         bool HasDewarperBintr();
 
+        /**
+         * @brief Gets the decoder surface counts for this DecodeSourceBintr
+         * @param[out] numDecodeSurfaces number of decoder output surfaces
+         * @param[out] numExtraSurfaces number of extra surfaces for downstream
+         */
+        void GetNumSurfaces(uint* numDecodeSurfaces, uint* numExtraSurfaces);
+
+        /**
+         * @brief Sets the decoder surface counts for this DecodeSourceBintr.
+         * The counts are applied when the decoder is created on play.
+         * @param[in] numDecodeSurfaces number of decoder output surfaces
+         * @param[in] numExtraSurfaces number of extra surfaces for downstream
+         * @return false if the Source is currently linked, true otherwise
+         */
+        bool SetNumSurfaces(uint numDecodeSurfaces, uint numExtraSurfaces);
+
+        /**
+         * @brief Sets the decoder surface counts applied on play in place of
+         * the counts set by the client, i.e. when shrunk by a surface budget.
+         * The counts set by the client are left unchanged.
+         * @param[in] numDecodeSurfaces number of decoder output surfaces
+         * @param[in] numExtraSurfaces number of extra surfaces for downstream
+         * @return false if the Source is currently linked, true otherwise
+         */
+        bool SetEffectiveNumSurfaces(uint numDecodeSurfaces, uint numExtraSurfaces);
+
+        /**
+         * @brief Gets which surface counts are honoured by this DecodeSourceBintr's
+         * decoder. nvcuvid honours the decode count only, nvv4l2decoder the extra
+         * count only. Until first played, nvv4l2decoder is assumed.
+         * @param[out] decodeSurfaces true if the decode surface count is honoured
+         * @param[out] extraSurfaces true if the extra surface count is honoured
+         */
+        void GetHonouredSurfaces(bool* decodeSurfaces, bool* extraSurfaces);
+
+        /**
+         * @brief Gets the current RTSP ingest settings for this DecodeSourceBintr
+         * @param[out] latency jitterbuffer latency in milliseconds
+         * @param[out] dropOnLatency if true, packets later than latency are dropped
+         * @param[out] doRetransmission if true, RTCP NACKs are sent for lost packets
+         * @param[out] protocols allowed RTP protocols, UDP is tried before TCP
+         * @param[out] bufferMode one of the DSL_RTSP_BUFFER_MODE constant values
+         * @param[out] timeout UDP and TCP receive timeout in milliseconds
+         */
+        void GetRtspConfig(uint* latency, bool* dropOnLatency, bool* doRetransmission,
+            uint* protocols, uint* bufferMode, uint* timeout);
+
+        /**
+         * @brief Sets the RTSP ingest settings for this DecodeSourceBintr. The 
+         * settings apply to the "rtspsrc" of an RTSP Source, or of a URI Source 
+         * with an rtsp URI. 
+         * @param[in] latency jitterbuffer latency in milliseconds
+         * @param[in] dropOnLatency if true, packets later than latency are dropped
+         * @param[in] doRetransmission if true, RTCP NACKs are sent for lost packets
+         * @param[in] protocols allowed RTP protocols, UDP is tried before TCP
+         * @param[in] bufferMode one of the DSL_RTSP_BUFFER_MODE constant values
+         * @param[in] timeout UDP and TCP receive timeout in milliseconds
+         * @return false if the Source is in use, true otherwise
+         */
+        bool SetRtspConfig(uint latency, bool dropOnLatency, bool doRetransmission,
+            uint protocols, uint bufferMode, uint timeout);
+
+        /**
+         * @brief Sets the RTSP ingest settings to one of the predefined presets
+         * @param[in] preset one of the DSL_RTSP_PRESET constant values
+         * @return false if the Source is in use or the preset is invalid
+         */
+        bool SetRtspPreset(uint preset);
+
+        /**
+         * @brief Gets the network statistics for the remote RTP sender, 
+         * all zero if there is no current RTSP session
+         * @param[out] jitter current interarrival jitter in milliseconds
+         * @param[out] packetsReceived total RTP packets received
+         * @param[out] packetsLost total RTP packets lost
+         */
+        void GetRtspStats(double* jitter, uint* packetsReceived, uint* packetsLost);
+
+        /**
+         * @brief Handles the "new-manager" signal from an "rtspsrc" element 
+         * by retaining the RTP bin for statistics queries.
+         * @param[in] pManager new RTP bin created by the rtspsrc
+         */
+        void HandleOnNewManager(GstElement* pManager);
         
     protected:
 
+        /**
+         * @brief Releases the RTP bin of the last session, if any, so that stats
+         * are not read from a session that has ended. Called on UnlinkAll.
+         */
+        void ReleaseRtpManager();
+
+        /**
+         * @brief Applies the current RTSP ingest settings to an "rtspsrc" element
+         * @param[in] pRtspSrc rtspsrc element to update
+         */
+        void ApplyRtspConfig(GstElement* pRtspSrc);
+
         /**
          * @brief
          */
@@ -370,6 +508,18 @@ namespace DSL
          */
         guint m_dropFrameInterval;
         
+        /**
+         * @brief true if the decoder plugged on play honours num-decode-surfaces,
+         * i.e. nvcuvid. Unknown until first played, nvv4l2decoder is assumed.
+         */
+        bool m_decodeSurfacesHonoured;
+        
+        /**
+         * @brief true if the decoder plugged on play honours num-extra-surfaces,
+         * i.e. nvv4l2decoder. Unknown until first played, nvv4l2decoder is assumed.
+         */
+        bool m_extraSurfacesHonoured;
+        
         /**
          * @brief
          */
@@ -409,7 +559,42 @@ namespace DSL
          * @brief 
          */
         DSL_ELEMENT_PTR m_pFakeSinkQueue;
-        
+
+        /**
+         * @brief if true, the rtspsrc drops packets later than m_latency
+         */
+        bool m_dropOnLatency;
+
+        /**
+         * @brief if true, the rtspsrc requests retransmission of lost packets
+         */
+        bool m_doRetransmission;
+
+        /**
+         * @brief allowed RTP protocols for the rtspsrc, DSL_RTP_TCP or DSL_RTP_ALL
+         */
+        uint m_rtpProtocols;
+
+        /**
+         * @brief jitterbuffer mode for the rtspsrc, one of DSL_RTSP_BUFFER_MODE
+         */
+        uint m_bufferMode;
+
+        /**
+         * @brief UDP and TCP receive timeout for the rtspsrc in milliseconds
+         */
+        uint m_rtspTimeout;
+
+        /**
+         * @brief RTP bin of the current rtspsrc session, NULL until the session
+         * is setup and once the Source is unlinked
+         */
+        GstElement* m_pRtpManager;
+
+        /**
+         * @brief mutex to protect the RTP bin from concurrent access
+         */
+        GMutex m_rtpManagerMutex;
     };
     
     //*********************************************************************************
@@ -442,9 +627,296 @@ namespace DSL
 
         void HandleSourceElementOnPadAdded(GstElement* pBin, GstPad* pPad);
         
+        /**
+         * @brief Appends a file URI to this Source's playlist. 
+         * @param[in] uri file URI to add, can be called while in use
+         * @return false if the file is not found, true otherwise
+         */
+        bool AddPlaylistUri(const char* uri);
+        
+        /**
+         * @brief Clears all file URIs from this Source's playlist
+         */
+        void ClearPlaylist();
+        
+        /**
+         * @brief Gets the number of file URIs in this Source's playlist
+         * @return current playlist size
+         */
+        uint GetPlaylistSize();
+
+        /**
+         * @brief adds a callback to be notified on each playlist file start and end
+         * @param[in] listener pointer to the client's function to call
+         * @param[in] userdata opaque pointer to client data passed into the listener function.
+         * @return true on successful add, false otherwise
+         */
+        bool AddPlaylistFileListener(dsl_playlist_file_listener_cb listener, void* userdata);
+
+        /**
+         * @brief removes a previously added playlist file listener
+         * @param[in] listener pointer to the client's function to remove
+         * @return true on successful remove, false otherwise
+         */
+        bool RemovePlaylistFileListener(dsl_playlist_file_listener_cb listener);
+
+        /**
+         * @brief Tee sink pad Probe handler to intercept EOS from the current
+         * file while there are more files in the playlist to play.
+         * @param[in] pPad Tee sink pad
+         * @param[in] pInfo downstream event probe info
+         * @return GST_PAD_PROBE_DROP on EOS with next file pending, GST_PAD_PROBE_OK otherwise
+         */
+        GstPadProbeReturn HandlePlaylistEosProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
+
+        /**
+         * @brief Source Queue src pad buffer and event Probe handler to update 
+         * per-file stats. The stats for a file are complete, and restart for the
+         * next, when the next file's stream-start, or the final EOS, is received.
+         * @param[in] pPad Source Queue src pad
+         * @param[in] pInfo buffer or downstream event probe info
+         * @return GST_PAD_PROBE_OK always
+         */
+        GstPadProbeReturn HandlePlaylistStatsProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
+
+        /**
+         * @brief Dispatches a task message posted by a UriSourceBintr to its 
+         * Pipeline's bus, so that the task runs on the Pipeline's main context, 
+         * or client dispatch thread, outside of the Source's streaming threads. 
+         * Messages posted by a Source that has since been deleted are ignored.
+         * @param[in] pMessage application message to dispatch
+         * @return true if the message was a UriSourceBintr task, false otherwise
+         */
+        static bool HandleTaskMessage(GstMessage* pMessage);
+
+        /**
+         * @brief Switches this Source to a new URI while in use. The new URI is 
+         * prerolled in a standby decode bin and then swapped onto the Source's
+         * Tee at the first decodable frame. The Source's StreamMux pad and source-id 
+         * are unchanged. The URI is set directly if the Source is not linked.
+         * @param[in] uri new URI to switch to
+         * @return false if a switch is already pending, or the URI is invalid
+         */
+        bool SwitchUri(const char* uri);
+
+        /**
+         * @brief Gets the latency of the last completed URI switch, measured 
+         * from the SwitchUri call to the first frame of the new URI output.
+         * @return switch latency in milliseconds, 0 if no switch has completed
+         */
+        uint GetSwitchLatency();
+
+        void HandleStandbyElementOnPadAdded(GstElement* pBin, GstPad* pPad);
+
+        /**
+         * @brief Blocking buffer probe handler on the standby decode bin's video pad.
+         * Relinks the standby pad to the Tee on the first decoded frame.
+         * @param[in] pPad standby decode bin video pad
+         * @param[in] pInfo buffer probe info
+         * @return GST_PAD_PROBE_REMOVE once switched, GST_PAD_PROBE_OK otherwise
+         */
+        GstPadProbeReturn HandleStandbyBufferProbe(GstPad* pPad, GstPadProbeInfo* pInfo);
+
     private:
 
+        /**
+         * @brief shared by a UriSourceBintr and its bin, so that task messages 
+         * queued on the bus can outlive the Source
+         */
+        struct TaskTarget
+        {
+            /**
+             * @brief mutex held while a task is run, and while the Source is cleared
+             */
+            GMutex mutex;
+            
+            /**
+             * @brief Source to run tasks on, NULL once the Source is deleted
+             */
+            UriSourceBintr* pSource;
+        };
+
+        /**
+         * @brief Destroy notify function for the task target, called when 
+         * the Source's bin is finalized
+         * @param[in] pTaskTarget TaskTarget to free
+         */
+        static void FreeTaskTarget(gpointer pTaskTarget);
+
+        /**
+         * @brief Posts a task message to the Pipeline's bus, dispatched by
+         * HandleTaskMessage. The message is dropped if the Source is not in a Pipeline.
+         * @param[in] pTask structure naming the task, ownership is taken
+         */
+        void PostTask(GstStructure* pTask);
+
+        /**
+         * @brief Runs the next-file or switch-complete task
+         * @param[in] pTask structure naming the task
+         */
+        void HandleTask(const GstStructure* pTask);
 
+        /**
+         * @brief Posts a playlist file event task with a file's stats
+         * @param[in] event one of DSL_PLAYLIST_FILE_STARTED or DSL_PLAYLIST_FILE_ENDED
+         * @param[in] uri URI of the file
+         * @param[in] frames number of frames output for the file
+         * @param[in] fps average frame rate of the file's output
+         */
+        void PostPlaylistFileEvent(uint event, const std::string& uri, 
+            uint frames, double fps);
+
+        /**
+         * @brief Swaps the current uridecodebin for that of the next file in the 
+         * playlist. Run as a task on EOS of the current file.
+         */
+        void HandlePlaylistNextFile();
+
+        /**
+         * @brief Removes the retired decode bin and standby fake sink
+         * from this Source once a switch has completed. Run as a task.
+         */
+        void HandleSwitchComplete();
+
+        /**
+         * @brief Sets an Elementr to a state of NULL and removes it from this Source.
+         * Must be called without m_playlistMutex held, as the state change waits 
+         * on the Elementr's streaming threads.
+         * @param[in] pElement Elementr to remove, may be nullptr
+         */
+        void RemoveStateChild(DSL_ELEMENT_PTR pElement);
+
+        /**
+         * @brief Creates a new uridecodebin Elementr for a URI with
+         * all Source callbacks connected. 
+         * @param[in] uri URI for the new Elementr
+         * @param[in] padAddedCb "pad-added" callback for the new Elementr
+         * @return shared pointer to the new Elementr
+         */
+        DSL_ELEMENT_PTR NewSourceElement(const std::string& uri, GCallback padAddedCb);
+        
+        /**
+         * @brief Creates the uridecodebin for the next file in the playlist, if 
+         * any, and advises the kernel to read the file into the page cache. The 
+         * uridecodebin is left in a state of NULL, so its source, demuxer and 
+         * decoder are only created, and the stream only prerolled, on swap.
+         */
+        void PrefetchNextPlaylistFile();
+
+        /**
+         * @brief Calls playlist file listeners with the event and stats of a
+         * playlist file event task. 
+         * @param[in] listeners copy of the Source's listeners to call
+         * @param[in] pTask playlist file event task
+         */
+        static void NotifyPlaylistFileListeners(
+            const std::map<dsl_playlist_file_listener_cb, void*>& listeners,
+            const GstStructure* pTask);
+
+        /**
+         * @brief ordered list of file URIs to play after the Source's initial URI
+         */
+        std::vector<std::string> m_playlist;
+
+        /**
+         * @brief index into m_playlist of the next file to play
+         */
+        uint m_playlistIndex;
+
+        /**
+         * @brief URI of the file currently playing
+         */
+        std::string m_currentUri;
+
+        /**
+         * @brief counter used to give each new uridecodebin a unique name
+         */
+        uint m_playlistElementCount;
+
+        /**
+         * @brief uridecodebin for the next file in the playlist, in a state of NULL
+         */
+        DSL_ELEMENT_PTR m_pNextSourceElement;
+
+        /**
+         * @brief running-time offset applied to the current file's decoded pad
+         */
+        GstClockTimeDiff m_playlistPadOffset;
+
+        /**
+         * @brief map of all currently registered playlist file listeners
+         * callback functions mapped with the user provided data
+         */
+        std::map<dsl_playlist_file_listener_cb, void*> m_playlistFileListeners;
+
+        /**
+         * @brief mutex to protect the playlist, listeners and per-file stats
+         */
+        GMutex m_playlistMutex;
+
+        /**
+         * @brief number of frames output for the file being counted, 
+         * updated on each buffer without m_playlistMutex held
+         */
+        std::atomic<uint> m_fileFrames;
+
+        /**
+         * @brief monotonic times of the first and latest frames of the file being counted
+         */
+        std::atomic<gint64> m_fileStartTime;
+        std::atomic<gint64> m_fileLastFrameTime;
+
+        /**
+         * @brief URI of the file being counted, which lags m_currentUri while
+         * the previous file's frames are still queued downstream
+         */
+        std::string m_countedUri;
+
+        /**
+         * @brief URIs of the files swapped in, but whose streams have yet 
+         * to reach the stats probe
+         */
+        std::deque<std::string> m_pendingUris;
+
+        /**
+         * @brief task target shared with this Source's bin, owned by the bin
+         */
+        TaskTarget* m_pTaskTarget;
+
+        /**
+         * @brief the decode bin's video pad currently linked to the Tee
+         */
+        GstPad* m_pActiveSrcPad;
+
+        /**
+         * @brief standby decode bin prerolling a new URI, while a switch is pending
+         */
+        DSL_ELEMENT_PTR m_pStandbySourceElement;
+
+        /**
+         * @brief fake sink for the standby decode bin output while prerolling
+         */
+        DSL_ELEMENT_PTR m_pStandbyFakeSink;
+
+        /**
+         * @brief decode bin replaced by the last switch, pending removal
+         */
+        DSL_ELEMENT_PTR m_pRetiredSourceElement;
+
+        /**
+         * @brief URI for the standby decode bin
+         */
+        std::string m_standbyUri;
+
+        /**
+         * @brief monotonic time of the last SwitchUri call in microseconds
+         */
+        gint64 m_switchRequestTime;
+
+        /**
+         * @brief latency of the last completed switch in milliseconds
+         */
+        uint m_switchLatency;
     };
 
     /**
@@ -479,11 +951,6 @@ namespace DSL
 
     private:
 
-        /**
-         @brief 
-         */
-        uint m_rtpProtocols;
-        
         /**
          @brief
          */
@@ -500,6 +967,155 @@ namespace DSL
         DSL_ELEMENT_PTR m_pDecodeQueue;
     };
 
+    //*********************************************************************************
+
+    /**
+     * @class MultiImageSourceBintr
+     * @brief Implements a non-live Decode Source for a folder or glob of JPEG/PNG 
+     * image files, or a single multipart M-JPEG file. Files are read, in order,  
+     * by a readahead thread and pushed into an "appsrc" element as fast as 
+     * downstream allows. No clock is applied to the buffers produced.
+     */
+    class MultiImageSourceBintr : public DecodeSourceBintr
+    {
+    public: 
+    
+        MultiImageSourceBintr(const char* name, const char* location, uint readahead);
+
+        ~MultiImageSourceBintr();
+
+        /**
+         * @brief Links all Child Elementrs owned by this Source Bintr
+         * @return True success, false otherwise
+         */
+        bool LinkAll();
+        
+        /**
+         * @brief Unlinks all Child Elementrs owned by this Source Bintr
+         * Stops and joins the readahead thread if running.
+         */
+        void UnlinkAll();
+
+        /**
+         * @brief Sets a new location (folder, glob, or M-JPEG file) for this source
+         * @param[in] location new location to read from
+         * @return false if the Source is currently in use or if no files are found.
+         */
+        bool SetUri(const char* location);
+
+        /**
+         * @brief Gets the current file processing statistics for this source.
+         * @param[out] filesRead number of files (or M-JPEG frames) output since play
+         * @param[out] filesPerSecond average rate of output since the first frame
+         */
+        void GetStats(uint* filesRead, double* filesPerSecond);
+
+        /**
+         * @brief Handles the "need-data" signal from the appsrc element by
+         * starting the readahead thread on first call after linking.
+         */
+        void HandleNeedData();
+
+        /**
+         * @brief Readahead thread function, pushes each file in order into 
+         * the appsrc element until all files are read, or until stopped.
+         */
+        void HandleReadahead();
+
+        void HandleDecodeElementOnPadAdded(GstElement* pBin, GstPad* pPad);
+
+        /**
+         * @brief Buffer Pad Probe handler used to count output frames
+         * @param[in] pPad src pad of the Source Queue
+         * @param[in] pInfo buffer probe info
+         * @return GST_PAD_PROBE_OK always
+         */
+        GstPadProbeReturn HandleSourceQueueBuffer(GstPad* pPad, GstPadProbeInfo* pInfo);
+
+    private:
+
+        /**
+         * @brief builds the ordered list of files to read from a folder, 
+         * glob pattern, or single (M-JPEG) file.
+         * @param[in] location folder, glob or file path to expand.
+         * @param[out] files sorted list of absolute file paths
+         * @return true if one or more files were found, false otherwise
+         */
+        static bool ListFiles(const char* location, std::vector<std::string>& files);
+
+        /**
+         @brief ordered list of image files, or the single M-JPEG file, to read
+         */
+        std::vector<std::string> m_files;
+
+        /**
+         @brief true if m_files holds a single multipart M-JPEG file
+         */
+        bool m_isMjpeg;
+
+        /**
+         @brief maximum number of files to read ahead of the decoder
+         */
+        uint m_readahead;
+
+        /**
+         @brief readahead thread, valid while the source is linked and reading
+         */
+        GThread* m_pReadaheadThread;
+
+        /**
+         @brief set to true to request the readahead thread to exit early,
+         read by the readahead thread without holding m_readaheadMutex
+         */
+        std::atomic<bool> m_stopReadahead;
+
+        /**
+         @brief mutex to protect the readahead thread start/stop
+         */
+        GMutex m_readaheadMutex;
+
+        /**
+         @brief mutex to protect the file statistics
+         */
+        GMutex m_statsMutex;
+
+        /**
+         @brief number of frames output by this source since the first frame
+         */
+        uint m_filesRead;
+
+        /**
+         @brief monotonic time of the first and latest frames output in microseconds
+         */
+        gint64 m_firstFrameTime;
+        gint64 m_lastFrameTime;
+
+        /**
+         @brief buffer probe handle for the Source Queue src pad
+         */
+        guint m_statsProbeId;
+
+        /**
+         @brief bounded queue between the appsrc and decoder, sized by readahead
+         */
+        DSL_ELEMENT_PTR m_pReadaheadQueue;
+
+        /**
+         @brief
+         */
+        DSL_ELEMENT_PTR m_pDecodeBin;
+
+        /**
+         @brief converts PNG (system memory) and JPEG (NVMM) output to NVMM NV12
+         */
+        DSL_ELEMENT_PTR m_pVidConv;
+
+        /**
+         @brief
+         */
+        DSL_ELEMENT_PTR m_pCapsFilter;
+    };
+
     /**
      * @brief 
      * @param[in] pBin
@@ -543,6 +1159,14 @@ namespace DSL
      */
     static void OnSourceSetupCB(GstElement* pObject, GstElement* arg0, gpointer pSource);
 
+    /**
+     * @brief Called by an "rtspsrc" element on creation of its RTP bin
+     * @param pRtspSrc
+     * @param pManager
+     * @param pSource
+     */
+    static void OnNewManagerCB(GstElement* pRtspSrc, GstElement* pManager, gpointer pSource);
+
     /**
      * @brief Probe function to drop certain events to support
      * custom logic of looping of each decode source (file) stream.
@@ -561,5 +1185,87 @@ namespace DSL
      */
     static gboolean StreamBufferSeekCB(gpointer pSource);
 
+    /**
+     * @brief Called by the appsrc element of a Multi Image Source when 
+     * it requires more data.
+     * @param[in] pAppSrc appsrc element
+     * @param[in] length amount of bytes needed, unused
+     * @param[in] pSource (callback user data) pointer to the unique source object
+     */
+    static void MultiImageSourceNeedDataCB(GstElement* pAppSrc, guint length, gpointer pSource);
+
+    /**
+     * @brief Readahead thread entry point for the Multi Image Source
+     * @param[in] pSource pointer to the unique source object
+     * @return NULL 
+     */
+    static gpointer MultiImageSourceReadaheadThread(gpointer pSource);
+
+    /**
+     * @brief 
+     * @param pBin
+     * @param pPad
+     * @param pSource
+     */
+    static void MultiImageDecodeElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource);
+
+    /**
+     * @brief Buffer probe function to count frames output by a Multi Image Source
+     * @param pPad
+     * @param pInfo
+     * @param pSource
+     * @return 
+     */
+    static GstPadProbeReturn MultiImageSourceBufferProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource);
+
+    /**
+     * @brief Event probe function to intercept EOS for a URI Source playlist
+     * @param pPad
+     * @param pInfo
+     * @param pSource
+     * @return 
+     */
+    static GstPadProbeReturn UriSourcePlaylistEosProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource);
+
+    /**
+     * @brief Buffer and event probe function to count frames for a URI Source playlist
+     * @param pPad
+     * @param pInfo
+     * @param pSource
+     * @return 
+     */
+    static GstPadProbeReturn UriSourcePlaylistStatsProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource);
+
+    /**
+     * @brief 
+     * @param pBin
+     * @param pPad
+     * @param pSource
+     */
+    static void UriSourceStandbyElementOnPadAddedCB(GstElement* pBin, GstPad* pPad, gpointer pSource);
+
+    /**
+     * @brief Blocking probe function to swap in a URI Source's standby decode bin
+     * @param pPad
+     * @param pInfo
+     * @param pSource
+     * @return 
+     */
+    static GstPadProbeReturn UriSourceStandbyBufferProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource);
+
+    /**
+     * @brief Probe function to drop all data from a retired decode bin
+     * @param pPad
+     * @param pInfo
+     * @param pSource
+     * @return 
+     */
+    static GstPadProbeReturn UriSourceRetiredDropProbeCB(GstPad* pPad, 
+        GstPadProbeInfo* pInfo, gpointer pSource);
+
 } // DSL
 #endif // _DSL_SOURCE_BINTR_H
@@ -0,0 +1,156 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslSurfacePlanner.h"
+
+namespace DSL
+{
+    SurfaceMemoryPlanner::SurfaceMemoryPlanner()
+        : m_fixedSize(0)
+    {
+        LOG_FUNC();
+    }
+    
+    SurfaceMemoryPlanner::~SurfaceMemoryPlanner()
+    {
+        LOG_FUNC();
+    }
+
+    uint64_t SurfaceMemoryPlanner::GetSurfaceSize(uint width, uint height, uint format)
+    {
+        uint64_t alignedHeight = (height + 15) & ~15;
+        
+        if (format == DSL_SURFACE_FORMAT_RGBA)
+        {
+            uint64_t pitch = ((uint64_t)width*4 + 255) & ~255;
+            return pitch * alignedHeight;
+        }
+        // NV12 - full size luma plane plus half height interleaved chroma plane
+        uint64_t pitch = ((uint64_t)width + 255) & ~255;
+        return pitch * alignedHeight * 3 / 2;
+    }
+    
+    void SurfaceMemoryPlanner::AddDecoder(const std::string& name, uint width, uint height, 
+        uint numDecodeSurfaces, uint numExtraSurfaces, bool decodeSurfacesFixed)
+    {
+        LOG_FUNC();
+        
+        m_decoderSurfaceSizes[name] = GetSurfaceSize(width, height, DSL_SURFACE_FORMAT_NV12);
+        m_decoderNumDecodeSurfaces[name] = numDecodeSurfaces;
+        m_decoderNumExtraSurfaces[name] = numExtraSurfaces;
+        m_decoderDecodeSurfacesFixed[name] = decodeSurfacesFixed;
+    }
+
+    void SurfaceMemoryPlanner::AddStreamMux(uint width, uint height, uint batchSize)
+    {
+        LOG_FUNC();
+        
+        m_fixedSize += GetSurfaceSize(width, height, DSL_SURFACE_FORMAT_NV12) * 
+            batchSize * DSL_STREAMMUX_POOL_SIZE;
+    }
+
+    void SurfaceMemoryPlanner::AddSink(uint width, uint height)
+    {
+        LOG_FUNC();
+        
+        m_fixedSize += GetSurfaceSize(width, height, DSL_SURFACE_FORMAT_RGBA) * 
+            DSL_SINK_POOL_SIZE;
+    }
+    
+    uint64_t SurfaceMemoryPlanner::GetDecoderSize(const std::string& name)
+    {
+        return m_decoderSurfaceSizes[name] * 
+            (m_decoderNumDecodeSurfaces[name] + m_decoderNumExtraSurfaces[name]);
+    }
+
+    uint64_t SurfaceMemoryPlanner::GetProjectedSize()
+    {
+        LOG_FUNC();
+        
+        uint64_t projectedSize(m_fixedSize);
+        
+        for (auto const& imap: m_decoderSurfaceSizes)
+        {
+            projectedSize += GetDecoderSize(imap.first);
+        }
+        return projectedSize;
+    }
+    
+    bool SurfaceMemoryPlanner::FitToBudget(uint64_t budget)
+    {
+        LOG_FUNC();
+        
+        uint64_t projectedSize = GetProjectedSize();
+        
+        // Extra surfaces only add downstream slack, so they're the first to go
+        for (auto& imap: m_decoderNumExtraSurfaces)
+        {
+            if (projectedSize <= budget)
+            {
+                break;
+            }
+            projectedSize -= m_decoderSurfaceSizes[imap.first] * imap.second;
+            imap.second = 0;
+        }
+        
+        // Then take one decode surface at a time from the largest decoder
+        while (projectedSize > budget)
+        {
+            std::string largest;
+            for (auto const& imap: m_decoderNumDecodeSurfaces)
+            {
+                if (!m_decoderDecodeSurfacesFixed[imap.first] and
+                    imap.second > DSL_MIN_DECODE_SURFACES and 
+                    (largest.empty() or GetDecoderSize(imap.first) > GetDecoderSize(largest)))
+                {
+                    largest = imap.first;
+                }
+            }
+            if (largest.empty())
+            {
+                LOG_WARN("Projected surface memory of " << projectedSize 
+                    << " bytes can't be reduced to fit budget of " << budget << " bytes");
+                return false;
+            }
+            m_decoderNumDecodeSurfaces[largest]--;
+            projectedSize -= m_decoderSurfaceSizes[largest];
+        }
+        return true;
+    }
+
+    bool SurfaceMemoryPlanner::GetDecoderSurfaces(const std::string& name, 
+        uint* numDecodeSurfaces, uint* numExtraSurfaces)
+    {
+        LOG_FUNC();
+        
+        if (m_decoderSurfaceSizes.find(name) == m_decoderSurfaceSizes.end())
+        {
+            return false;
+        }
+        *numDecodeSurfaces = m_decoderNumDecodeSurfaces[name];
+        *numExtraSurfaces = m_decoderNumExtraSurfaces[name];
+        return true;
+    }
+}
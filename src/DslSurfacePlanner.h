@@ -0,0 +1,170 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_SURFACE_PLANNER_H
+#define _DSL_SURFACE_PLANNER_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief surface formats accounted for by the SurfaceMemoryPlanner
+     */
+    #define DSL_SURFACE_FORMAT_NV12                 0
+    #define DSL_SURFACE_FORMAT_RGBA                 1
+
+    /**
+     * @brief estimated number of batched buffers in the StreamMux output pool
+     */
+    #define DSL_STREAMMUX_POOL_SIZE                 4
+    
+    /**
+     * @brief estimated number of RGBA buffers in a Sink's converter pool
+     */
+    #define DSL_SINK_POOL_SIZE                      4
+    
+    /**
+     * @brief minimum number of decode surfaces the planner will shrink to
+     */
+    #define DSL_MIN_DECODE_SURFACES                 4
+
+    /**
+     * @class SurfaceMemoryPlanner
+     * @brief Accounts for the NVMM surface memory projected for a Pipeline's
+     * decoders, StreamMux and Sinks, and shrinks the decoder surface counts to 
+     * fit a memory budget. Accounting only, no GStreamer or CUDA calls are made.
+     */
+    class SurfaceMemoryPlanner
+    {
+    public:
+    
+        SurfaceMemoryPlanner();
+        
+        ~SurfaceMemoryPlanner();
+
+        /**
+         * @brief Calculates the size of a single surface. Pitch is aligned 
+         * to 256 bytes and height to 16 lines, as allocated by NvBufSurface. 
+         * @param[in] width surface width in pixels
+         * @param[in] height surface height in pixels
+         * @param[in] format one of the DSL_SURFACE_FORMAT constants
+         * @return surface size in bytes
+         */
+        static uint64_t GetSurfaceSize(uint width, uint height, uint format);
+        
+        /**
+         * @brief Adds a Source's decoder to the plan
+         * @param[in] name unique name of the Source
+         * @param[in] width decoded frame width in pixels
+         * @param[in] height decoded frame height in pixels
+         * @param[in] numDecodeSurfaces number of decoder output surfaces
+         * @param[in] numExtraSurfaces number of extra surfaces for downstream,
+         * 0 if the decoder does not allocate extra surfaces
+         * @param[in] decodeSurfacesFixed true if the decoder does not honour a
+         * reduced decode surface count, i.e. nvv4l2decoder
+         */
+        void AddDecoder(const std::string& name, uint width, uint height, 
+            uint numDecodeSurfaces, uint numExtraSurfaces, bool decodeSurfacesFixed);
+
+        /**
+         * @brief Adds the Pipeline's StreamMux to the plan, as a pool of
+         * DSL_STREAMMUX_POOL_SIZE batched NV12 buffers
+         * @param[in] width StreamMux output width in pixels
+         * @param[in] height StreamMux output height in pixels
+         * @param[in] batchSize StreamMux batch size
+         */
+        void AddStreamMux(uint width, uint height, uint batchSize);
+
+        /**
+         * @brief Adds a Sink to the plan, as a pool of DSL_SINK_POOL_SIZE RGBA buffers 
+         * @param[in] width Sink input width in pixels
+         * @param[in] height Sink input height in pixels
+         */
+        void AddSink(uint width, uint height);
+
+        /**
+         * @brief Gets the total projected surface memory for all planned components
+         * @return projected memory in bytes
+         */
+        uint64_t GetProjectedSize();
+
+        /**
+         * @brief Shrinks the decoder surface counts until the projected memory
+         * fits the budget. Extra surfaces are removed first, then decode surfaces 
+         * are reduced one at a time from the largest decoder down to 
+         * DSL_MIN_DECODE_SURFACES. Decoders with fixed decode surfaces are
+         * planned at their full decode surface count.
+         * @param[in] budget memory budget in bytes
+         * @return true if the projected memory fits the budget, false otherwise
+         */
+        bool FitToBudget(uint64_t budget);
+
+        /**
+         * @brief Gets the planned surface counts for a named decoder
+         * @param[in] name unique name of the Source
+         * @param[out] numDecodeSurfaces planned number of decode surfaces
+         * @param[out] numExtraSurfaces planned number of extra surfaces
+         * @return false if the decoder is not in the plan
+         */
+        bool GetDecoderSurfaces(const std::string& name, 
+            uint* numDecodeSurfaces, uint* numExtraSurfaces);
+
+    private:
+    
+        /**
+         * @brief projected surface memory for a single decoder
+         */
+        uint64_t GetDecoderSize(const std::string& name);
+
+        /**
+         * @brief decoder surface size in bytes, mapped by Source name
+         */
+        std::map<std::string, uint64_t> m_decoderSurfaceSizes;
+        
+        /**
+         * @brief decoder number of decode surfaces, mapped by Source name
+         */
+        std::map<std::string, uint> m_decoderNumDecodeSurfaces;
+
+        /**
+         * @brief decoder number of extra surfaces, mapped by Source name
+         */
+        std::map<std::string, uint> m_decoderNumExtraSurfaces;
+
+        /**
+         * @brief true if the decoder's decode surfaces can't be reduced, 
+         * mapped by Source name
+         */
+        std::map<std::string, bool> m_decoderDecodeSurfacesFixed;
+
+        /**
+         * @brief total projected memory for the StreamMux and all Sinks in bytes
+         */
+        uint64_t m_fixedSize;
+    };
+}
+
+#endif // _DSL_SURFACE_PLANNER_H
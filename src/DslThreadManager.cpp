@@ -0,0 +1,318 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslThreadManager.h"
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <errno.h>
+
+namespace DSL
+{
+    ThreadManager::ThreadManager(const char* name)
+        : m_name(name)
+    {
+        LOG_FUNC();
+
+        g_mutex_init(&m_threadsMutex);
+
+        for (uint role = 0; role < DSL_THREAD_NUM_ROLES; role++)
+        {
+            CPU_ZERO(&m_roleCpuSets[role]);
+            m_rolePriorities[role] = 0;
+            m_rolePrioritySet[role] = false;
+        }
+    }
+
+    ThreadManager::~ThreadManager()
+    {
+        LOG_FUNC();
+
+        g_mutex_clear(&m_threadsMutex);
+    }
+
+    bool ThreadManager::GetRoleAffinity(uint role, const char** cpus, int* priority)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadsMutex);
+
+        if (role >= DSL_THREAD_NUM_ROLES)
+        {
+            LOG_ERROR("Invalid thread role = " << role << " for Pipeline '" << m_name << "'");
+            return false;
+        }
+        *cpus = m_roleCpus[role].c_str();
+        *priority = m_rolePriorities[role];
+        return true;
+    }
+
+    bool ThreadManager::SetRoleAffinity(uint role, const char* cpus, int priority)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadsMutex);
+
+        if (role >= DSL_THREAD_NUM_ROLES)
+        {
+            LOG_ERROR("Invalid thread role = " << role << " for Pipeline '" << m_name << "'");
+            return false;
+        }
+        if (priority < -20 or priority > 19)
+        {
+            LOG_ERROR("Invalid thread priority = " << priority << " for Pipeline '"
+                << m_name << "'");
+            return false;
+        }
+        cpu_set_t cpuSet;
+        if (!ParseCpuList(cpus, &cpuSet))
+        {
+            LOG_ERROR("Invalid CPU list '" << cpus << "' for Pipeline '" << m_name << "'");
+            return false;
+        }
+        m_roleCpus[role] = cpus;
+        m_roleCpuSets[role] = cpuSet;
+        m_rolePriorities[role] = priority;
+        m_rolePrioritySet[role] = true;
+        return true;
+    }
+
+    void ThreadManager::ClearComponents()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadsMutex);
+
+        m_components.clear();
+        m_threads.clear();
+    }
+
+    void ThreadManager::AddComponent(GstObject* pObject, const char* name, uint role)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadsMutex);
+
+        m_components[pObject] = std::make_pair(std::string(name), role);
+    }
+
+    void ThreadManager::HandleStreamStatus(GstMessage* pMessage)
+    {
+        GstStreamStatusType type;
+        GstElement* pOwner(NULL);
+        gst_message_parse_stream_status(pMessage, &type, &pOwner);
+
+        // Enter and Leave are posted from within the streaming thread
+        if (type == GST_STREAM_STATUS_TYPE_ENTER)
+        {
+            pid_t tid = syscall(SYS_gettid);
+
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadsMutex);
+
+            ThreadRecord record;
+            record.tid = tid;
+            record.owner = (pOwner) ? GST_ELEMENT_NAME(pOwner) : "unknown";
+            FindComponent(pOwner, record.component, &record.role);
+            record.active = true;
+            record.cpuTicks = 0;
+            ReadCpuTicks(tid, &record.cpuTicks);
+            record.lastCpuTicks = record.cpuTicks;
+            record.lastReportTime = g_get_monotonic_time();
+
+            ApplyRoleAffinity(record.role, tid);
+            m_threads.push_back(record);
+        }
+        else if (type == GST_STREAM_STATUS_TYPE_LEAVE)
+        {
+            pid_t tid = syscall(SYS_gettid);
+
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadsMutex);
+
+            for (auto& ivec: m_threads)
+            {
+                if (ivec.active and ivec.tid == tid)
+                {
+                    ReadCpuTicks(tid, &ivec.cpuTicks);
+                    ivec.active = false;
+                }
+            }
+        }
+    }
+
+    const char* ThreadManager::GetReport()
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_threadsMutex);
+
+        static const char* roleNames[DSL_THREAD_NUM_ROLES] =
+            {"decode", "inference", "sink", "other"};
+
+        double ticksPerSec = (double)sysconf(_SC_CLK_TCK);
+        gint64 now = g_get_monotonic_time();
+
+        std::ostringstream report;
+        report << std::fixed << std::setprecision(1);
+
+        for (auto& ivec: m_threads)
+        {
+            if (ivec.active and !ReadCpuTicks(ivec.tid, &ivec.cpuTicks))
+            {
+                ivec.active = false;
+            }
+            // usage is the share of one CPU since the previous report
+            double usage(0);
+            if (now > ivec.lastReportTime)
+            {
+                usage = 100.0 * ((ivec.cpuTicks - ivec.lastCpuTicks) / ticksPerSec) /
+                    ((now - ivec.lastReportTime) / 1000000.0);
+            }
+            report << ivec.component << " owner=" << ivec.owner
+                << " role=" << roleNames[ivec.role] << " tid=" << ivec.tid
+                << " cpu=" << (ivec.cpuTicks / ticksPerSec) << "s usage=" << usage << "%"
+                << ((ivec.active) ? "" : " left") << "\n";
+
+            ivec.lastCpuTicks = ivec.cpuTicks;
+            ivec.lastReportTime = now;
+        }
+        m_report = report.str();
+        return m_report.c_str();
+    }
+
+    void ThreadManager::FindComponent(GstElement* pOwner, std::string& name, uint* role)
+    {
+        // Innermost component wins, e.g. a Sink within the Pipeline's sinks-bin
+        GstObject* pObject = (pOwner) ? GST_OBJECT(gst_object_ref(pOwner)) : NULL;
+        while (pObject)
+        {
+            auto ientry = m_components.find(pObject);
+            if (ientry != m_components.end())
+            {
+                name = ientry->second.first;
+                *role = ientry->second.second;
+                gst_object_unref(pObject);
+                return;
+            }
+            GstObject* pParent = gst_object_get_parent(pObject);
+            gst_object_unref(pObject);
+            pObject = pParent;
+        }
+        name = (pOwner) ? GST_ELEMENT_NAME(pOwner) : "unknown";
+        *role = DSL_THREAD_ROLE_OTHER;
+    }
+
+    void ThreadManager::ApplyRoleAffinity(uint role, pid_t tid)
+    {
+        if (m_roleCpus[role].size() and
+            sched_setaffinity(tid, sizeof(cpu_set_t), &m_roleCpuSets[role]))
+        {
+            LOG_WARN("Failed to set CPU affinity '" << m_roleCpus[role]
+                << "' for thread " << tid << " with errno = " << errno);
+        }
+        if (m_rolePrioritySet[role] and
+            setpriority(PRIO_PROCESS, tid, m_rolePriorities[role]))
+        {
+            LOG_WARN("Failed to set priority " << m_rolePriorities[role]
+                << " for thread " << tid << " with errno = " << errno);
+        }
+    }
+
+    bool ThreadManager::ReadCpuTicks(pid_t tid, uint64_t* cpuTicks)
+    {
+        std::ostringstream path;
+        path << "/proc/self/task/" << tid << "/stat";
+
+        std::ifstream statFile(path.str());
+        std::string stat;
+        if (!std::getline(statFile, stat))
+        {
+            return false;
+        }
+        // The thread name may contain spaces, so fields are counted after the
+        // last ')'. The state is field 3, with utime and stime fields 14 and 15
+        size_t pos = stat.rfind(')');
+        if (pos == std::string::npos or pos + 2 >= stat.size())
+        {
+            return false;
+        }
+        std::istringstream fields(stat.substr(pos + 2));
+        std::string field;
+        for (uint i = 3; i <= 13; i++)
+        {
+            fields >> field;
+        }
+        uint64_t utime(0), stime(0);
+        if (!(fields >> utime >> stime))
+        {
+            return false;
+        }
+        *cpuTicks = utime + stime;
+        return true;
+    }
+
+    bool ThreadManager::ParseCpuList(const char* cpus, cpu_set_t* cpuSet)
+    {
+        CPU_ZERO(cpuSet);
+
+        const char* p = cpus;
+        while (*p)
+        {
+            if (*p < '0' or *p > '9')
+            {
+                return false;
+            }
+            char* pEnd(NULL);
+            ulong first = strtoul(p, &pEnd, 10);
+            ulong last = first;
+            p = pEnd;
+
+            if (*p == '-')
+            {
+                p++;
+                if (*p < '0' or *p > '9')
+                {
+                    return false;
+                }
+                last = strtoul(p, &pEnd, 10);
+                p = pEnd;
+            }
+            if (last < first or last >= CPU_SETSIZE)
+            {
+                return false;
+            }
+            for (ulong cpu = first; cpu <= last; cpu++)
+            {
+                CPU_SET(cpu, cpuSet);
+            }
+            if (*p == ',')
+            {
+                p++;
+                if (!*p)
+                {
+                    return false;
+                }
+            }
+            else if (*p)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+}
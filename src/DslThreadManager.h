@@ -0,0 +1,242 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#ifndef _DSL_THREAD_MANAGER_H
+#define _DSL_THREAD_MANAGER_H
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include <sched.h>
+
+namespace DSL
+{
+    /**
+     * @brief convenience macros for shared pointer abstraction
+     */
+    #define DSL_THREAD_MANAGER_PTR std::shared_ptr<ThreadManager>
+    #define DSL_THREAD_MANAGER_NEW(name) \
+        std::shared_ptr<ThreadManager>(new ThreadManager(name))
+
+    /**
+     * @brief number of DSL_THREAD_ROLE constant values
+     */
+    #define DSL_THREAD_NUM_ROLES                    4
+
+    /**
+     * @class ThreadManager
+     * @brief Manages the streaming threads of a single Pipeline. Each thread
+     * is pinned to a CPU set, and given a nice value, by the role of the 
+     * component that owns it. The CPU time of each thread is reported by
+     * component name. The number of threads is not bounded, as each streaming
+     * task loops on its own thread until stopped and can't share a thread.
+     */
+    class ThreadManager
+    {
+    public:
+
+        /**
+         * @brief ctor for the ThreadManager class
+         * @param[in] name name of the Pipeline to manage
+         */
+        ThreadManager(const char* name);
+
+        /**
+         * @brief dtor for the ThreadManager class
+         */
+        ~ThreadManager();
+
+        /**
+         * @brief Gets the CPU affinity and priority for a thread role
+         * @param[in] role one of the DSL_THREAD_ROLE constant values
+         * @param[out] cpus CPU list, empty string if not pinned
+         * @param[out] priority nice value applied to each thread
+         * @return false if the role is invalid
+         */
+        bool GetRoleAffinity(uint role, const char** cpus, int* priority);
+
+        /**
+         * @brief Sets the CPU affinity and priority for a thread role,
+         * applied to each thread of the role as it is entered
+         * @param[in] role one of the DSL_THREAD_ROLE constant values
+         * @param[in] cpus CPU list, e.g. "0-3,6", empty string to not pin
+         * @param[in] priority nice value in the range -20 to 19
+         * @return false if the role, CPU list or priority is invalid
+         */
+        bool SetRoleAffinity(uint role, const char* cpus, int priority);
+
+        /**
+         * @brief Clears all components and thread records, called on link
+         */
+        void ClearComponents();
+
+        /**
+         * @brief Adds a component whose threads, including the threads of
+         * all of its un-added descendants, are to be managed by role
+         * @param[in] pObject GST Object for the component
+         * @param[in] name unique name of the component
+         * @param[in] role one of the DSL_THREAD_ROLE constant values
+         */
+        void AddComponent(GstObject* pObject, const char* name, uint role);
+
+        /**
+         * @brief Handles a Stream Status message from the Pipeline's bus sync
+         * handler. Entered threads have their affinity and priority set from 
+         * within the thread.
+         * @param[in] pMessage Stream Status message to handle
+         */
+        void HandleStreamStatus(GstMessage* pMessage);
+
+        /**
+         * @brief Gets a report of the CPU usage of each thread entered since link
+         * @return report with one line per thread, valid until the next call
+         */
+        const char* GetReport();
+
+    private:
+
+        /**
+         * @brief a single streaming thread entered since link
+         */
+        struct ThreadRecord
+        {
+            /**
+             * @brief kernel thread id
+             */
+            pid_t tid;
+
+            /**
+             * @brief name of the component that owns the thread
+             */
+            std::string component;
+
+            /**
+             * @brief name of the element that owns the thread
+             */
+            std::string owner;
+
+            /**
+             * @brief one of the DSL_THREAD_ROLE constant values
+             */
+            uint role;
+
+            /**
+             * @brief true until the thread leaves its task
+             */
+            bool active;
+
+            /**
+             * @brief total user and system CPU time in clock ticks
+             */
+            uint64_t cpuTicks;
+
+            /**
+             * @brief CPU time in clock ticks on the previous report
+             */
+            uint64_t lastCpuTicks;
+
+            /**
+             * @brief monotonic time in microseconds of the previous report
+             */
+            gint64 lastReportTime;
+        };
+
+        /**
+         * @brief Finds the innermost component for an element
+         * @param[in] pOwner element that owns the thread
+         * @param[out] name name of the component, or the element if not found
+         * @param[out] role role of the component, DSL_THREAD_ROLE_OTHER if not found
+         */
+        void FindComponent(GstElement* pOwner, std::string& name, uint* role);
+
+        /**
+         * @brief Applies the affinity and priority for a role to the calling thread
+         * @param[in] role one of the DSL_THREAD_ROLE constant values
+         * @param[in] tid kernel thread id of the calling thread
+         */
+        void ApplyRoleAffinity(uint role, pid_t tid);
+
+        /**
+         * @brief Reads the user and system CPU time for a thread of this process
+         * @param[in] tid kernel thread id of the thread to read
+         * @param[out] cpuTicks total CPU time in clock ticks
+         * @return false if the thread no longer exists
+         */
+        static bool ReadCpuTicks(pid_t tid, uint64_t* cpuTicks);
+
+        /**
+         * @brief Parses a CPU list, e.g. "0-3,6", into a CPU set
+         * @param[in] cpus CPU list to parse
+         * @param[out] cpuSet CPU set to update
+         * @return false if the CPU list is invalid
+         */
+        static bool ParseCpuList(const char* cpus, cpu_set_t* cpuSet);
+
+        /**
+         * @brief name of the Pipeline
+         */
+        std::string m_name;
+
+        /**
+         * @brief mutex to protect all members, streaming threads enter concurrently
+         */
+        GMutex m_threadsMutex;
+
+        /**
+         * @brief CPU list for each role, empty if not pinned
+         */
+        std::string m_roleCpus[DSL_THREAD_NUM_ROLES];
+
+        /**
+         * @brief CPU set parsed from the CPU list for each role
+         */
+        cpu_set_t m_roleCpuSets[DSL_THREAD_NUM_ROLES];
+
+        /**
+         * @brief nice value for each role
+         */
+        int m_rolePriorities[DSL_THREAD_NUM_ROLES];
+
+        /**
+         * @brief true if a priority has been set for the role
+         */
+        bool m_rolePrioritySet[DSL_THREAD_NUM_ROLES];
+
+        /**
+         * @brief map of component name and role, keyed by GST Object
+         */
+        std::map<GstObject*, std::pair<std::string, uint>> m_components;
+
+        /**
+         * @brief all threads entered since link, in order of entry
+         */
+        std::vector<ThreadRecord> m_threads;
+
+        /**
+         * @brief report built on the last call to GetReport
+         */
+        std::string m_report;
+    };
+}
+
+#endif // _DSL_THREAD_MANAGER_H
@@ -0,0 +1,390 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslApi.h"
+#include "DslTraceRecorder.h"
+
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <pthread.h>
+
+namespace DSL
+{
+    std::atomic<bool> TraceRecorder::m_active(false);
+    std::atomic<uint> TraceRecorder::m_session(0);
+    std::atomic<uint> TraceRecorder::m_producers(0);
+    
+    TraceRecorder* TraceRecorder::GetRecorder()
+    {
+        // Created on first use - thread safe as the recorder is used by the 
+        // client's threads to start and stop traces, and by any streaming thread
+        static TraceRecorder* pInstance = new TraceRecorder();
+        
+        return pInstance;
+    }
+    
+    TraceRecorder::TraceRecorder()
+        : m_format(DSL_TRACE_FORMAT_CHROME_JSON)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_recorderMutex);
+        g_mutex_init(&m_ringsMutex);
+    }
+
+    TraceRecorder::~TraceRecorder()
+    {
+        LOG_FUNC();
+        
+        g_mutex_clear(&m_ringsMutex);
+        g_mutex_clear(&m_recorderMutex);
+    }
+    
+    bool TraceRecorder::Start(const char* owner, const char* filePath, uint format)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_recorderMutex);
+        
+        if (m_active)
+        {
+            LOG_ERROR("Unable to start trace for '" << owner 
+                << "' as a trace is already active for '" << m_owner << "'");
+            return false;
+        }
+        if (format > DSL_TRACE_FORMAT_PERFETTO)
+        {
+            LOG_ERROR("Invalid trace format '" << format << "' for '" << owner << "'");
+            return false;
+        }
+        m_owner.assign(owner);
+        m_filePath.assign(filePath);
+        m_format = format;
+        
+        // Rings are never cleared as producers hold on to them. Only the rings 
+        // of exited threads are released, the remaining rings are reset by 
+        // their own thread on first use in the new session.
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringsMutex);
+            m_rings.erase(std::remove_if(m_rings.begin(), m_rings.end(),
+                [](const std::shared_ptr<TraceRing>& pRing)
+                {
+                    return pRing->retired.load();
+                }), m_rings.end());
+        }
+        m_session++;
+        m_active = true;
+        
+        LOG_INFO("Trace started for '" << owner << "' to file '" << filePath << "'");
+        return true;
+    }
+    
+    bool TraceRecorder::Stop(const char* owner)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_recorderMutex);
+        
+        if (!m_active or m_owner != owner)
+        {
+            LOG_ERROR("No trace is active for '" << owner << "'");
+            return false;
+        }
+        m_active = false;
+        
+        // Wait for all producers still within Record to leave before 
+        // taking a snapshot of the rings
+        while (m_producers.load(std::memory_order_acquire))
+        {
+            g_thread_yield();
+        }
+        
+        std::ofstream ostream(m_filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!ostream.is_open())
+        {
+            LOG_ERROR("Unable to open trace file '" << m_filePath << "' for '" << owner << "'");
+            return false;
+        }
+        {
+            LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringsMutex);
+            if (m_format == DSL_TRACE_FORMAT_CHROME_JSON)
+            {
+                WriteChromeJson(ostream);
+            }
+            else
+            {
+                WritePerfettoProto(ostream);
+            }
+        }
+        ostream.close();
+        
+        LOG_INFO("Trace for '" << owner << "' written to file '" << m_filePath << "'");
+        m_owner.clear();
+        return true;
+    }
+    
+    bool TraceRecorder::IsOwner(const char* owner)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_recorderMutex);
+        
+        return (m_active and m_owner == owner);
+    }
+    
+    TraceRing* TraceRecorder::GetRing()
+    {
+        static thread_local TraceRingHolder ringHolder;
+        
+        if (!ringHolder.pRing)
+        {
+            // First event for this thread - allocate and register
+            std::shared_ptr<TraceRing> pNewRing = std::make_shared<TraceRing>();
+            pNewRing->tid = syscall(SYS_gettid);
+            pNewRing->head = 0;
+            pNewRing->session = 0;
+            pNewRing->retired = false;
+            
+            char threadName[16] = {0};
+            pthread_getname_np(pthread_self(), threadName, sizeof(threadName));
+            pNewRing->threadName.assign(threadName);
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_ringsMutex);
+                m_rings.push_back(pNewRing);
+            }
+            ringHolder.pRing = pNewRing;
+        }
+        TraceRing* pRing = ringHolder.pRing.get();
+        
+        // First event for this thread in a new session - reset the ring's
+        // contents from the producing thread, the only writer of the ring
+        uint session = m_session.load(std::memory_order_acquire);
+        if (pRing->session.load(std::memory_order_relaxed) != session)
+        {
+            pRing->head.store(0, std::memory_order_relaxed);
+            pRing->session.store(session, std::memory_order_release);
+        }
+        return pRing;
+    }
+    
+    void TraceRecorder::Record(char phase, const char* category, const char* name, 
+        gint64 ts, gint64 dur)
+    {
+        // Register as a producer before checking the active flag, so that 
+        // Stop either sees this producer or this producer sees the trace stopped
+        m_producers.fetch_add(1);
+        if (m_active.load())
+        {
+            TraceRing* pRing = GetRing();
+            
+            // Single producer per ring - the head is only published once the
+            // event is complete so that the writer on Stop never reads a partial event
+            uint64_t head = pRing->head.load(std::memory_order_relaxed);
+            TraceEvent& event = pRing->events[head % DSL_TRACE_RING_SIZE];
+            
+            event.ts = ts;
+            event.dur = dur;
+            event.category = category;
+            event.phase = phase;
+            g_strlcpy(event.name, name, DSL_TRACE_NAME_MAX);
+            
+            pRing->head.store(head+1, std::memory_order_release);
+        }
+        m_producers.fetch_sub(1, std::memory_order_release);
+    }
+    
+    void TraceRecorder::WriteChromeJson(std::ofstream& ostream)
+    {
+        LOG_FUNC();
+        
+        guint64 pid = getpid();
+        
+        ostream << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        
+        uint session = m_session.load();
+        
+        bool first(true);
+        for (auto const& ivec: m_rings)
+        {
+            // Skip rings that hold events from a previous session only
+            if (ivec->session.load(std::memory_order_acquire) != session)
+            {
+                continue;
+            }
+            gchar* threadName = g_strescape(ivec->threadName.c_str(), NULL);
+            ostream << (first ? "" : ",") << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" 
+                << pid << ",\"tid\":" << ivec->tid << ",\"args\":{\"name\":\"" << threadName << "\"}}";
+            g_free(threadName);
+            first = false;
+            
+            uint64_t head = ivec->head.load(std::memory_order_acquire);
+            uint64_t tail = (head > DSL_TRACE_RING_SIZE) ? head - DSL_TRACE_RING_SIZE : 0;
+            
+            for (uint64_t i = tail; i < head; i++)
+            {
+                const TraceEvent& event = ivec->events[i % DSL_TRACE_RING_SIZE];
+                gchar* name = g_strescape(event.name, NULL);
+                
+                ostream << ",\n{\"name\":\"" << name << "\",\"cat\":\"" << event.category 
+                    << "\",\"ph\":\"" << event.phase << "\",\"ts\":" << event.ts;
+                if (event.phase == 'X')
+                {
+                    ostream << ",\"dur\":" << event.dur;
+                }
+                else
+                {
+                    ostream << ",\"s\":\"t\"";
+                }
+                ostream << ",\"pid\":" << pid << ",\"tid\":" << ivec->tid << "}";
+                g_free(name);
+            }
+        }
+        ostream << "\n]}\n";
+    }
+    
+    // Perfetto Trace protobuf field numbers - see perfetto/protos/perfetto/trace
+    #define PERFETTO_TRACE_PACKET                   1
+    #define PERFETTO_PACKET_TIMESTAMP               8
+    #define PERFETTO_PACKET_SEQUENCE_ID             10
+    #define PERFETTO_PACKET_TRACK_EVENT             11
+    #define PERFETTO_PACKET_TRACK_DESCRIPTOR        60
+    #define PERFETTO_DESCRIPTOR_UUID                1
+    #define PERFETTO_DESCRIPTOR_NAME                2
+    #define PERFETTO_DESCRIPTOR_THREAD              4
+    #define PERFETTO_THREAD_PID                     1
+    #define PERFETTO_THREAD_TID                     2
+    #define PERFETTO_EVENT_TYPE                     9
+    #define PERFETTO_EVENT_TRACK_UUID               11
+    #define PERFETTO_EVENT_CATEGORIES               22
+    #define PERFETTO_EVENT_NAME                     23
+    #define PERFETTO_EVENT_SLICE_BEGIN              1
+    #define PERFETTO_EVENT_SLICE_END                2
+    #define PERFETTO_EVENT_INSTANT                  3
+    
+    void TraceRecorder::WritePerfettoProto(std::ofstream& ostream)
+    {
+        LOG_FUNC();
+        
+        guint64 pid = getpid();
+        uint sequenceId(0);
+        
+        uint session = m_session.load();
+        
+        for (auto const& ivec: m_rings)
+        {
+            if (ivec->session.load(std::memory_order_acquire) != session)
+            {
+                continue;
+            }
+            sequenceId++;
+            
+            std::string thread, descriptor, packet, trace;
+            WriteVarintField(thread, PERFETTO_THREAD_PID, pid);
+            WriteVarintField(thread, PERFETTO_THREAD_TID, ivec->tid);
+            WriteVarintField(descriptor, PERFETTO_DESCRIPTOR_UUID, ivec->tid);
+            WriteBytesField(descriptor, PERFETTO_DESCRIPTOR_NAME, ivec->threadName);
+            WriteBytesField(descriptor, PERFETTO_DESCRIPTOR_THREAD, thread);
+            WriteBytesField(packet, PERFETTO_PACKET_TRACK_DESCRIPTOR, descriptor);
+            WriteBytesField(trace, PERFETTO_TRACE_PACKET, packet);
+            
+            // Copy out the ring's events and order by start time, with enclosing
+            // slices first, so that slice begin and end events nest correctly
+            uint64_t head = ivec->head.load(std::memory_order_acquire);
+            uint64_t tail = (head > DSL_TRACE_RING_SIZE) ? head - DSL_TRACE_RING_SIZE : 0;
+            
+            std::vector<TraceEvent> events;
+            for (uint64_t i = tail; i < head; i++)
+            {
+                events.push_back(ivec->events[i % DSL_TRACE_RING_SIZE]);
+            }
+            std::stable_sort(events.begin(), events.end(), 
+                [](const TraceEvent& a, const TraceEvent& b)
+                {
+                    return (a.ts < b.ts) or (a.ts == b.ts and a.dur > b.dur);
+                });
+            
+            auto writeEvent = [&](gint64 ts, uint type, const TraceEvent* pEvent)
+            {
+                std::string trackEvent, eventPacket;
+                WriteVarintField(trackEvent, PERFETTO_EVENT_TYPE, type);
+                WriteVarintField(trackEvent, PERFETTO_EVENT_TRACK_UUID, ivec->tid);
+                if (pEvent)
+                {
+                    WriteBytesField(trackEvent, PERFETTO_EVENT_CATEGORIES, pEvent->category);
+                    WriteBytesField(trackEvent, PERFETTO_EVENT_NAME, pEvent->name);
+                }
+                WriteVarintField(eventPacket, PERFETTO_PACKET_TIMESTAMP, ts*1000);
+                WriteVarintField(eventPacket, PERFETTO_PACKET_SEQUENCE_ID, sequenceId);
+                WriteBytesField(eventPacket, PERFETTO_PACKET_TRACK_EVENT, trackEvent);
+                WriteBytesField(trace, PERFETTO_TRACE_PACKET, eventPacket);
+            };
+            
+            std::vector<gint64> openSlices;
+            for (auto const& event: events)
+            {
+                while (openSlices.size() and openSlices.back() <= event.ts)
+                {
+                    writeEvent(openSlices.back(), PERFETTO_EVENT_SLICE_END, NULL);
+                    openSlices.pop_back();
+                }
+                if (event.phase == 'X')
+                {
+                    writeEvent(event.ts, PERFETTO_EVENT_SLICE_BEGIN, &event);
+                    openSlices.push_back(event.ts + event.dur);
+                }
+                else
+                {
+                    writeEvent(event.ts, PERFETTO_EVENT_INSTANT, &event);
+                }
+            }
+            while (openSlices.size())
+            {
+                writeEvent(openSlices.back(), PERFETTO_EVENT_SLICE_END, NULL);
+                openSlices.pop_back();
+            }
+            ostream.write(trace.data(), trace.size());
+        }
+    }
+    
+    void TraceRecorder::WriteVarint(std::string& buffer, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            buffer.push_back((char)((value & 0x7F) | 0x80));
+            value >>= 7;
+        }
+        buffer.push_back((char)value);
+    }
+
+    void TraceRecorder::WriteVarintField(std::string& buffer, uint field, uint64_t value)
+    {
+        WriteVarint(buffer, (field << 3) | 0);
+        WriteVarint(buffer, value);
+    }
+    
+    void TraceRecorder::WriteBytesField(std::string& buffer, uint field, const std::string& bytes)
+    {
+        WriteVarint(buffer, (field << 3) | 2);
+        WriteVarint(buffer, bytes.size());
+        buffer.append(bytes);
+    }
+}
@@ -0,0 +1,316 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_TRACE_RECORDER_H
+#define _DSL_TRACE_RECORDER_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief Records a complete trace event for the current scope {}, 
+     * if a trace is active. The name must remain valid for the scope.
+     */
+    #define TRACE_SCOPE(category, name) TraceScope traceScope(category, name)
+
+    /**
+     * @brief Records an instant trace event, if a trace is active.
+     */
+    #define TRACE_INSTANT(category, name) do { \
+        if (TraceRecorder::IsActive()) \
+            TraceRecorder::GetRecorder()->Record('i', category, name, g_get_monotonic_time(), 0); \
+        } while (0)
+
+    /**
+     * @brief number of events held in each per-thread ring buffer
+     */
+    #define DSL_TRACE_RING_SIZE                     8192
+
+    /**
+     * @brief maximum length of a trace event name, longer names are truncated
+     */
+    #define DSL_TRACE_NAME_MAX                      48
+
+    /**
+     * @struct TraceEvent
+     * @brief a single trace event as held in a TraceRing
+     */
+    struct TraceEvent
+    {
+        /**
+         * @brief monotonic start time in microseconds
+         */
+        gint64 ts;
+        
+        /**
+         * @brief duration in microseconds, 0 for instant events
+         */
+        gint64 dur;
+        
+        /**
+         * @brief static category string for the event
+         */
+        const char* category;
+        
+        /**
+         * @brief Chrome trace-event phase, 'X' complete or 'i' instant
+         */
+        char phase;
+        
+        /**
+         * @brief copy of the event name
+         */
+        char name[DSL_TRACE_NAME_MAX];
+    };
+
+    /**
+     * @struct TraceRing
+     * @brief single-producer ring buffer of trace events for one thread. 
+     * The oldest events are overwritten once the ring is full. The ring is 
+     * reused by each session, and is only reset by its producing thread.
+     */
+    struct TraceRing
+    {
+        /**
+         * @brief kernel thread id of the producing thread
+         */
+        guint64 tid;
+        
+        /**
+         * @brief name of the producing thread
+         */
+        std::string threadName;
+        
+        /**
+         * @brief total number of events written to the ring
+         */
+        std::atomic<uint64_t> head;
+        
+        /**
+         * @brief session the ring's events were recorded in
+         */
+        std::atomic<uint> session;
+        
+        /**
+         * @brief set once the producing thread has exited
+         */
+        std::atomic<bool> retired;
+        
+        /**
+         * @brief fixed array of DSL_TRACE_RING_SIZE events
+         */
+        TraceEvent events[DSL_TRACE_RING_SIZE];
+    };
+    
+    /**
+     * @struct TraceRingHolder
+     * @brief thread local owner of a thread's TraceRing, retires the ring
+     * when the thread exits so that it can be released by the next Start.
+     */
+    struct TraceRingHolder
+    {
+        ~TraceRingHolder()
+        {
+            if (pRing)
+            {
+                pRing->retired = true;
+            }
+        };
+        
+        std::shared_ptr<TraceRing> pRing;
+    };
+    
+    /**
+     * @class TraceRecorder
+     * @brief Process wide recorder of timeline trace events. Events are written
+     * lock-free into per-thread ring buffers, and flushed to file on Stop
+     * as Chrome trace-event JSON or Perfetto protobuf.
+     */
+    class TraceRecorder
+    {
+    public:
+    
+        /**
+         * @brief Returns the single instance of the TraceRecorder
+         */
+        static TraceRecorder* GetRecorder();
+        
+        /**
+         * @brief Returns true if a trace is currently being recorded
+         */
+        static bool IsActive()
+        {
+            return m_active.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Starts a new trace session for a named owner, i.e. a Pipeline.
+         * @param[in] owner name of the component that owns the session
+         * @param[in] filePath absolute or relative path to the file to write on Stop
+         * @param[in] format one of the DSL_TRACE_FORMAT constant values
+         * @return false if a session is already active or the format is invalid
+         */
+        bool Start(const char* owner, const char* filePath, uint format);
+
+        /**
+         * @brief Stops the current trace session and writes all events to file
+         * @param[in] owner name of the component that started the session
+         * @return false if the owner's session is not active or the file
+         * could not be written
+         */
+        bool Stop(const char* owner);
+        
+        /**
+         * @brief Returns true if the named owner has an active session
+         */
+        bool IsOwner(const char* owner);
+
+        /**
+         * @brief Records a single event into the calling thread's ring buffer
+         * @param[in] phase Chrome trace-event phase, 'X' complete or 'i' instant
+         * @param[in] category static category string for the event
+         * @param[in] name name of the event, copied and truncated as needed
+         * @param[in] ts monotonic start time in microseconds
+         * @param[in] dur duration in microseconds, 0 for instant events
+         */
+        void Record(char phase, const char* category, const char* name, 
+            gint64 ts, gint64 dur);
+
+    private:
+    
+        TraceRecorder();
+        ~TraceRecorder();
+
+        /**
+         * @brief Gets the calling thread's ring buffer, creating and registering
+         * a new ring on first use, and resetting the ring on first use in each
+         * new session.
+         */
+        TraceRing* GetRing();
+        
+        /**
+         * @brief Writes all recorded events as Chrome trace-event JSON
+         * @param[in] ostream output stream to write to
+         */
+        void WriteChromeJson(std::ofstream& ostream);
+
+        /**
+         * @brief Writes all recorded events as a Perfetto Trace protobuf
+         * @param[in] ostream output stream to write to
+         */
+        void WritePerfettoProto(std::ofstream& ostream);
+
+        static void WriteVarint(std::string& buffer, uint64_t value);
+
+        static void WriteVarintField(std::string& buffer, uint field, uint64_t value);
+        
+        static void WriteBytesField(std::string& buffer, uint field, const std::string& bytes);
+
+        /**
+         * @brief true while a session is active, read on every trace point
+         */
+        static std::atomic<bool> m_active;
+        
+        /**
+         * @brief incremented on each Start, used by each thread to reset 
+         * its ring on first use in a new session
+         */
+        static std::atomic<uint> m_session;
+        
+        /**
+         * @brief number of threads currently within Record, Stop waits for
+         * all producers to leave before writing the rings
+         */
+        static std::atomic<uint> m_producers;
+
+        /**
+         * @brief mutex to protect the session
+         */
+        GMutex m_recorderMutex;
+
+        /**
+         * @brief mutex to protect the ring registration, separate from the 
+         * session mutex so that producers can register while Stop waits
+         */
+        GMutex m_ringsMutex;
+        
+        /**
+         * @brief name of the component that owns the current session
+         */
+        std::string m_owner;
+        
+        /**
+         * @brief path to the file to write on Stop
+         */
+        std::string m_filePath;
+        
+        /**
+         * @brief one of the DSL_TRACE_FORMAT constant values
+         */
+        uint m_format;
+        
+        /**
+         * @brief all rings registered by threads that have recorded events
+         */
+        std::vector<std::shared_ptr<TraceRing>> m_rings;
+    };
+    
+    /**
+     * @class TraceScope
+     * @brief Records a complete trace event spanning the lifetime of the object
+     */
+    class TraceScope
+    {
+    public:
+        TraceScope(const char* category, const char* name)
+            : m_category(category)
+            , m_name(name)
+            , m_start(0)
+        {
+            if (TraceRecorder::IsActive())
+            {
+                m_start = g_get_monotonic_time();
+            }
+        };
+        
+        ~TraceScope()
+        {
+            if (m_start and TraceRecorder::IsActive())
+            {
+                gint64 now = g_get_monotonic_time();
+                TraceRecorder::GetRecorder()->Record('X', m_category, m_name, 
+                    m_start, now - m_start);
+            }
+        };
+        
+    private:
+        const char* m_category;
+        const char* m_name;
+        gint64 m_start;
+    };
+}
+
+#endif // _DSL_TRACE_RECORDER_H
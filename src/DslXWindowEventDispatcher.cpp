@@ -0,0 +1,197 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "Dsl.h"
+#include "DslXWindowEventDispatcher.h"
+
+#include <poll.h>
+#include <fcntl.h>
+
+namespace DSL
+{
+    XWindowEventDispatcher* XWindowEventDispatcher::GetDispatcher()
+    {
+        // Created on first use - thread safe as Displays are added from 
+        // the bus sync handler of any Pipeline
+        static XWindowEventDispatcher* pInstance = new XWindowEventDispatcher();
+        
+        return pInstance;
+    }
+
+    XWindowEventDispatcher::XWindowEventDispatcher()
+        : m_pCurrentDisplay(NULL)
+        , m_pDispatcherThread(NULL)
+    {
+        LOG_FUNC();
+        
+        g_mutex_init(&m_dispatcherMutex);
+        g_cond_init(&m_dispatcherCond);
+        
+        if (pipe2(m_wakeFds, O_NONBLOCK | O_CLOEXEC))
+        {
+            LOG_ERROR("Failed to create XWindow event wake-up pipe with errno = " << errno);
+            throw;
+        }
+    }
+
+    XWindowEventDispatcher::~XWindowEventDispatcher()
+    {
+        LOG_FUNC();
+        
+        close(m_wakeFds[0]);
+        close(m_wakeFds[1]);
+        g_cond_clear(&m_dispatcherCond);
+        g_mutex_clear(&m_dispatcherMutex);
+    }
+    
+    bool XWindowEventDispatcher::AddDisplay(Display* pDisplay, 
+        XDisplayEventHandler handler, gpointer pClient)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        if (m_displays.find(pDisplay) != m_displays.end())
+        {
+            LOG_ERROR("X Display is already registered with the XWindow event dispatcher");
+            return false;
+        }
+        m_displays[pDisplay] = std::make_pair(handler, pClient);
+        
+        if (!m_pDispatcherThread)
+        {
+            m_pDispatcherThread = g_thread_new("dsl-x-window-event-thread", 
+                XWindowEventDispatcherThread, this);
+        }
+        Wake();
+        return true;
+    }
+    
+    bool XWindowEventDispatcher::RemoveDisplay(Display* pDisplay)
+    {
+        LOG_FUNC();
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+        
+        if (m_displays.find(pDisplay) == m_displays.end())
+        {
+            LOG_ERROR("X Display is not registered with the XWindow event dispatcher");
+            return false;
+        }
+        m_displays.erase(pDisplay);
+        
+        if (g_thread_self() != m_pDispatcherThread)
+        {
+            while (m_pCurrentDisplay == pDisplay)
+            {
+                g_cond_wait(&m_dispatcherCond, &m_dispatcherMutex);
+            }
+        }
+        Wake();
+        return true;
+    }
+    
+    void XWindowEventDispatcher::Wake()
+    {
+        char wake(1);
+        if (write(m_wakeFds[1], &wake, 1) < 0 and errno != EAGAIN)
+        {
+            LOG_ERROR("Failed to wake the XWindow event dispatcher with errno = " << errno);
+        }
+    }
+    
+    void XWindowEventDispatcher::Run()
+    {
+        LOG_FUNC();
+        
+        std::vector<struct pollfd> pollFds;
+        std::vector<Display*> displays;
+        
+        while (true)
+        {
+            pollFds.clear();
+            displays.clear();
+            pollFds.push_back({m_wakeFds[0], POLLIN, 0});
+            {
+                LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+                
+                for (auto const& imap: m_displays)
+                {
+                    pollFds.push_back({ConnectionNumber(imap.first), POLLIN, 0});
+                    displays.push_back(imap.first);
+                }
+            }
+            if (poll(&pollFds[0], pollFds.size(), -1) < 0)
+            {
+                if (errno != EINTR)
+                {
+                    LOG_ERROR("XWindow event poll failed with errno = " << errno);
+                }
+                continue;
+            }
+            bool woken(pollFds[0].revents);
+            if (woken)
+            {
+                char wake[64];
+                while (read(m_wakeFds[0], wake, sizeof(wake)) > 0);
+            }
+            // Call the handler for every Display with data pending on its connection.
+            // All handlers are called on wake-up to flush events already read into the
+            // queue of a newly added Display, e.g. by XSync on window creation.
+            for (uint i = 0; i < displays.size(); i++)
+            {
+                if (!woken and !pollFds[i+1].revents)
+                {
+                    continue;
+                }
+                XDisplayEventHandler handler;
+                gpointer pClient;
+                {
+                    LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+                    
+                    auto imap = m_displays.find(displays[i]);
+                    if (imap == m_displays.end())
+                    {
+                        continue;
+                    }
+                    handler = imap->second.first;
+                    pClient = imap->second.second;
+                    m_pCurrentDisplay = displays[i];
+                }
+                handler(pClient);
+                {
+                    LOCK_MUTEX_FOR_CURRENT_SCOPE(&m_dispatcherMutex);
+                    
+                    m_pCurrentDisplay = NULL;
+                    g_cond_broadcast(&m_dispatcherCond);
+                }
+            }
+        }
+    }
+
+    static gpointer XWindowEventDispatcherThread(gpointer pDispatcher)
+    {
+        static_cast<XWindowEventDispatcher*>(pDispatcher)->Run();
+        
+        return NULL;
+    }
+}
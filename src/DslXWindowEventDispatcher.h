@@ -0,0 +1,128 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+
+#ifndef _DSL_XWINDOW_EVENT_DISPATCHER_H
+#define _DSL_XWINDOW_EVENT_DISPATCHER_H
+
+#include "Dsl.h"
+
+namespace DSL
+{
+    /**
+     * @brief callback function type to handle all pending events for a Display
+     * @param[in] pClient opaque pointer to the client, i.e. a PipelineBintr
+     */
+    typedef void (*XDisplayEventHandler)(gpointer pClient);
+
+    /**
+     * @class XWindowEventDispatcher
+     * @brief Process wide dispatcher of XWindow events for all Pipelines. A single
+     * thread blocks in poll() on the connection of each registered X Display, and 
+     * on a wake-up pipe used to signal changes to the set of Displays, calling the 
+     * client's handler when events are pending. The thread is started on first use.
+     */
+    class XWindowEventDispatcher
+    {
+    public:
+    
+        /**
+         * @brief Returns the single instance of the XWindowEventDispatcher
+         */
+        static XWindowEventDispatcher* GetDispatcher();
+        
+        /**
+         * @brief Adds a Display to be polled for events
+         * @param[in] pDisplay open X Display connection to poll
+         * @param[in] handler function to call when events are pending on the Display
+         * @param[in] pClient opaque pointer to the client passed to the handler
+         * @return false if the Display is already registered
+         */
+        bool AddDisplay(Display* pDisplay, XDisplayEventHandler handler, gpointer pClient);
+
+        /**
+         * @brief Removes a Display previously added with AddDisplay. Waits for the
+         * Display's handler to return if it's currently being called, unless called 
+         * from the handler itself. The Display can be closed safely on return.
+         * @param[in] pDisplay X Display connection to remove
+         * @return false if the Display was not found
+         */
+        bool RemoveDisplay(Display* pDisplay);
+        
+        /**
+         * @brief polls all registered Displays until the process exits,
+         * called by the dispatcher thread function
+         */
+        void Run();
+
+    private:
+    
+        XWindowEventDispatcher();
+        ~XWindowEventDispatcher();
+        
+        /**
+         * @brief writes to the wake-up pipe to interrupt the current poll()
+         */
+        void Wake();
+
+        /**
+         * @brief mutex to protect the map of Displays and current Display
+         */
+        GMutex m_dispatcherMutex;
+
+        /**
+         * @brief condition signaled each time a handler returns
+         */
+        GCond m_dispatcherCond;
+        
+        /**
+         * @brief map of registered Displays to their handler and client
+         */
+        std::map<Display*, std::pair<XDisplayEventHandler, gpointer>> m_displays;
+        
+        /**
+         * @brief Display whose handler is currently being called, NULL otherwise
+         */
+        Display* m_pCurrentDisplay;
+        
+        /**
+         * @brief read [0] and write [1] ends of the non-blocking wake-up pipe
+         */
+        int m_wakeFds[2];
+        
+        /**
+         * @brief handle to the dispatcher thread, NULL until the first Display is added
+         */
+        GThread* m_pDispatcherThread;
+    };
+
+    /**
+     * @brief Thread function to run the XWindowEventDispatcher
+     * @param[in] pDispatcher pointer to the XWindowEventDispatcher
+     * @return NULL on process exit
+     */
+    static gpointer XWindowEventDispatcherThread(gpointer pDispatcher);
+}
+
+#endif // _DSL_XWINDOW_EVENT_DISPATCHER_H
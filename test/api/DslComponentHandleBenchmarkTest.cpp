@@ -0,0 +1,86 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+
+#define NUM_ITERATIONS 1000000
+
+/**
+ * @brief Returns the number of calls per second for a function
+ */
+template<typename Function>
+static double CallsPerSecond(Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint i = 0; i < NUM_ITERATIONS; i++)
+    {
+        function();
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    
+    return NUM_ITERATIONS / std::chrono::duration<double>(duration).count();
+}
+
+SCENARIO( "The call rate of the named, UTF-8, and handle Tiler services is reported", 
+    "[.][benchmark][component-api]" )
+{
+    GIVEN( "A Tiler among several hundred Components" ) 
+    {
+        for (uint i = 0; i < 500; i++)
+        {
+            std::wstring sinkName(L"fake-sink-" + std::to_wstring(i));
+            REQUIRE( dsl_sink_fake_new(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+        }
+        std::wstring tilerName(L"tiler");
+        DslHandle handle(0);
+        uint width(0), height(0);
+        
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_component_handle_get(tilerName.c_str(), &handle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Tiler's dimensions are read repeatedly through each service" ) 
+        {
+            double namedRate = CallsPerSecond([&]()
+                {dsl_tiler_dimensions_get(tilerName.c_str(), &width, &height);});
+            double utf8Rate = CallsPerSecond([&]()
+                {dsl_tiler_dimensions_get_utf8("tiler", &width, &height);});
+            double handleRate = CallsPerSecond([&]()
+                {dsl_tiler_dimensions_get_by_handle(handle, &width, &height);});
+
+            THEN( "The call rates are reported" )
+            {
+                std::cout << "dsl_tiler_dimensions_get: " << namedRate << " calls/sec\n";
+                std::cout << "dsl_tiler_dimensions_get_utf8: " << utf8Rate << " calls/sec\n";
+                std::cout << "dsl_tiler_dimensions_get_by_handle: " << handleRate << " calls/sec\n";
+
+                REQUIRE( handleRate > namedRate );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -99,3 +99,152 @@ SCENARIO( "Multiple new components can Set and Get their GPU ID", "[component-ap
     }
 }    
     
+SCENARIO( "A Component Handle can be used to Set and Get properties", "[component-api]" )
+{
+    GIVEN( "A new Tiler and its Handle" ) 
+    {
+        std::wstring tilerName = L"tiler";
+        DslHandle handle(0), retHandle(0);
+        uint width(0), height(0);
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_component_handle_get(tilerName.c_str(), &handle) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_component_handle_get_utf8("tiler", &retHandle) == DSL_RESULT_SUCCESS );
+        REQUIRE( retHandle == handle );
+
+        WHEN( "The Tiler's dimensions are Set by Handle" ) 
+        {
+            REQUIRE( dsl_tiler_dimensions_set_by_handle(handle, 1920, 1080) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same dimensions are returned by name, by Handle, and by UTF-8 name" ) 
+            {
+                REQUIRE( dsl_tiler_dimensions_get(tilerName.c_str(), &width, &height) == DSL_RESULT_SUCCESS );
+                REQUIRE( width == 1920 );
+                REQUIRE( height == 1080 );
+                REQUIRE( dsl_tiler_dimensions_get_by_handle(handle, &width, &height) == DSL_RESULT_SUCCESS );
+                REQUIRE( width == 1920 );
+                REQUIRE( height == 1080 );
+                REQUIRE( dsl_tiler_dimensions_get_utf8("tiler", &width, &height) == DSL_RESULT_SUCCESS );
+                REQUIRE( width == 1920 );
+                REQUIRE( height == 1080 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "The Handle is used with a service for a different Component type" ) 
+        {
+            THEN( "The service fails" ) 
+            {
+                REQUIRE( dsl_source_dimensions_get_by_handle(handle, &width, &height) == 
+                    DSL_RESULT_SOURCE_COMPONENT_IS_NOT_SOURCE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "The Tiler is deleted and a new Tiler created with the same name" ) 
+        {
+            REQUIRE( dsl_component_delete(tilerName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+
+            THEN( "The old Handle is rejected and a new Handle is returned" ) 
+            {
+                REQUIRE( dsl_tiler_dimensions_get_by_handle(handle, &width, &height) == 
+                    DSL_RESULT_COMPONENT_HANDLE_NOT_FOUND );
+                REQUIRE( dsl_component_handle_get(tilerName.c_str(), &retHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( retHandle != handle );
+                REQUIRE( dsl_tiler_dimensions_get_by_handle(retHandle, &width, &height) == DSL_RESULT_SUCCESS );
+                REQUIRE( width == 1280 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
+    
+
+SCENARIO( "A Sink and a Branch can Set and Get their Queue policy", "[component-api]" )
+{
+    GIVEN( "A Fake Sink, a Branch, and a Tracker" ) 
+    {
+        std::wstring sinkName = L"fake-sink";
+        std::wstring branchName = L"branch";
+        std::wstring trackerName = L"ktl-tracker";
+        
+        uint maxSizeBuffers(0), maxSizeTime(0), leaky(99), latencyBudget(99), dropped(99);
+
+        REQUIRE( dsl_sink_fake_new(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_branch_new(branchName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tracker_ktl_new(trackerName.c_str(), 480, 272) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_component_queue_policy_get(sinkName.c_str(), &maxSizeBuffers, 
+            &maxSizeTime, &leaky, &latencyBudget) == DSL_RESULT_SUCCESS );
+        REQUIRE( maxSizeBuffers == DSL_DEFAULT_QUEUE_MAX_SIZE_BUFFERS );
+        REQUIRE( maxSizeTime == DSL_DEFAULT_QUEUE_MAX_SIZE_TIME );
+        REQUIRE( leaky == DSL_QUEUE_LEAKY_NO );
+        REQUIRE( latencyBudget == 0 );
+        REQUIRE( dsl_component_queue_dropped_get(sinkName.c_str(), &dropped) == DSL_RESULT_SUCCESS );
+        REQUIRE( dropped == 0 );
+
+        WHEN( "A new Queue policy is set for the Sink and the Branch" ) 
+        {
+            REQUIRE( dsl_component_queue_policy_set(sinkName.c_str(), 
+                2, 0, DSL_QUEUE_LEAKY_DOWNSTREAM, 100) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_component_queue_policy_set(branchName.c_str(), 
+                4, 500, DSL_QUEUE_LEAKY_UPSTREAM, 0) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same values are returned on get" ) 
+            {
+                REQUIRE( dsl_component_queue_policy_get(sinkName.c_str(), &maxSizeBuffers, 
+                    &maxSizeTime, &leaky, &latencyBudget) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxSizeBuffers == 2 );
+                REQUIRE( maxSizeTime == 0 );
+                REQUIRE( leaky == DSL_QUEUE_LEAKY_DOWNSTREAM );
+                REQUIRE( latencyBudget == 100 );
+
+                REQUIRE( dsl_component_queue_policy_get(branchName.c_str(), &maxSizeBuffers, 
+                    &maxSizeTime, &leaky, &latencyBudget) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxSizeBuffers == 4 );
+                REQUIRE( maxSizeTime == 500 );
+                REQUIRE( leaky == DSL_QUEUE_LEAKY_UPSTREAM );
+                REQUIRE( latencyBudget == 0 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "An invalid leaky value is set" ) 
+        {
+            THEN( "The service fails and the policy is unchanged" ) 
+            {
+                REQUIRE( dsl_component_queue_policy_set(sinkName.c_str(), 
+                    2, 0, DSL_QUEUE_LEAKY_DOWNSTREAM+1, 0) == 
+                    DSL_RESULT_COMPONENT_QUEUE_POLICY_SET_FAILED );
+                REQUIRE( dsl_component_queue_policy_get(sinkName.c_str(), &maxSizeBuffers, 
+                    &maxSizeTime, &leaky, &latencyBudget) == DSL_RESULT_SUCCESS );
+                REQUIRE( maxSizeBuffers == DSL_DEFAULT_QUEUE_MAX_SIZE_BUFFERS );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        WHEN( "The Queue policy services are called for the Tracker" ) 
+        {
+            THEN( "The services fail" ) 
+            {
+                REQUIRE( dsl_component_queue_policy_get(trackerName.c_str(), &maxSizeBuffers, 
+                    &maxSizeTime, &leaky, &latencyBudget) == 
+                    DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_component_queue_policy_set(trackerName.c_str(), 
+                    2, 0, DSL_QUEUE_LEAKY_NO, 0) == DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+                REQUIRE( dsl_component_queue_dropped_get(trackerName.c_str(), &dropped) == 
+                    DSL_RESULT_COMPONENT_NOT_THE_CORRECT_TYPE );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}    
@@ -0,0 +1,83 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+
+#define NUM_COMPONENTS 100
+
+SCENARIO( "The time to load a 100 Component definition is reported", 
+    "[.][benchmark][component-api]" )
+{
+    GIVEN( "A definition of a Pipeline with mostly unused File and RTSP Sinks" ) 
+    {
+        // One Pipeline with a Tiler and Fake Sink, all other components are 
+        // pre-declared optional Sinks that are never linked.
+        std::wstring definition(
+            L"[pipeline]\ntype=pipeline\ncomponents=tiler;fake-sink\n"
+            L"[tiler]\ntype=tiler\nwidth=1280\nheight=720\n"
+            L"[fake-sink]\ntype=sink-fake\n");
+            
+        for (uint i = 3; i < NUM_COMPONENTS; i++)
+        {
+            if (i % 2)
+            {
+                definition += L"[file-sink-" + std::to_wstring(i) + L"]\n"
+                    L"type=sink-file\nfile-path=./output.mp4\ncodec=0\ncontainer=0\n"
+                    L"bitrate=2000000\ninterval=0\n";
+            }
+            else
+            {
+                definition += L"[rtsp-sink-" + std::to_wstring(i) + L"]\n"
+                    L"type=sink-rtsp\nhost=224.224.255.255\nudp-port=" + 
+                    std::to_wstring(5400 + i) + L"\nrtsp-port=" + 
+                    std::to_wstring(8554 + i) + L"\ncodec=0\nbitrate=4000000\ninterval=0\n";
+            }
+        }
+
+        WHEN( "The definition is loaded" ) 
+        {
+            const wchar_t* report(NULL);
+            
+            auto start = std::chrono::steady_clock::now();
+            REQUIRE( dsl_pipeline_load_definition(definition.c_str(), 
+                &report) == DSL_RESULT_SUCCESS );
+            auto duration = std::chrono::steady_clock::now() - start;
+
+            THEN( "The load time is reported" )
+            {
+                std::cout << "dsl_pipeline_load_definition, " << NUM_COMPONENTS 
+                    << " components: " << std::chrono::duration<double, 
+                    std::milli>(duration).count() << " ms\n";
+
+                REQUIRE( dsl_component_list_size() == NUM_COMPONENTS - 1 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+
+using namespace DSL;
+
+#define NUM_ITERATIONS 1000000
+
+/**
+ * @brief Baseline copy of the previous LogFunc, which formatted the method 
+ * name at runtime and logged through a stringstream on every call.
+ */
+class BaselineLogFunc
+{
+public:
+    BaselineLogFunc(const std::string& prettyFunction)
+    {
+        size_t colons = prettyFunction.find("::");
+        size_t begin = prettyFunction.substr(0,colons).rfind(" ") + 1;
+        size_t end = prettyFunction.rfind("(") - begin;
+
+        m_logMessage << prettyFunction.substr(begin,end) + "()";
+        GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
+            m_logMessage.str().c_str(), "");
+    };
+    
+    ~BaselineLogFunc()
+    {
+        GST_CAT_LEVEL_LOG(GST_CAT_DSL, GST_LEVEL_DEBUG, NULL, 
+            m_logMessage.str().c_str(), "");
+    };
+    
+private:
+    std::stringstream m_logMessage; 
+};
+
+static void __attribute__ ((noinline)) BaselineLoggedFunction()
+{
+    BaselineLogFunc lf(__PRETTY_FUNCTION__);
+}
+
+static void __attribute__ ((noinline)) LoggedFunction()
+{
+    LOG_FUNC();
+}
+
+/**
+ * @brief Returns the average cost of calling a function, in nanoseconds
+ */
+template<typename Function>
+static double NanosecondsPerCall(Function function)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (uint i = 0; i < NUM_ITERATIONS; i++)
+    {
+        function();
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    
+    return std::chrono::duration<double, std::nano>(duration).count() / NUM_ITERATIONS;
+}
+
+SCENARIO( "The cost of function logging is reported with the DSL category disabled", 
+    "[.][benchmark][logging]" )
+{
+    GIVEN( "The Services instance with its debug category initialized" ) 
+    {
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "Logged functions are called with logging disabled" ) 
+        {
+            GstDebugLevel threshold = gst_debug_category_get_threshold(GST_CAT_DSL);
+            gst_debug_category_set_threshold(GST_CAT_DSL, GST_LEVEL_NONE);
+            
+            double baselineCost = NanosecondsPerCall(BaselineLoggedFunction);
+            double logFuncCost = NanosecondsPerCall(LoggedFunction);
+            double apiCallCost = NanosecondsPerCall(dsl_component_list_size);
+            
+            gst_debug_category_set_threshold(GST_CAT_DSL, threshold);
+
+            THEN( "The costs per call are reported" )
+            {
+                std::cout << "Baseline LOG_FUNC: " << baselineCost << " ns/call\n";
+                std::cout << "LOG_FUNC: " << logFuncCost << " ns/call\n";
+                std::cout << "dsl_component_list_size: " << apiCallCost << " ns/call\n";
+                
+                REQUIRE( logFuncCost < baselineCost );
+            }
+        }
+    }
+}
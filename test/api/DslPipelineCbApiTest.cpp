@@ -23,7 +23,12 @@ THE SOFTWARE.
 */
 
 #include "catch.hpp"
+#include "Dsl.h"
 #include "DslApi.h"
+#include <poll.h>
+
+#define TIME_TO_BLOCK_FOR std::chrono::milliseconds(3000)
+#define TIME_TO_SLEEP_FOR std::chrono::milliseconds(1000)
 
 SCENARIO( "A state-change-listener must be unique", "[pipeline-cb-api]" )
 {
@@ -133,6 +138,60 @@ SCENARIO( "A EOS-listener can be removed", "[pipeline-cb-api]" )
     }
 }
 
+SCENARIO( "A Perf-listener must be unique", "[pipeline-cb-api]" )
+{
+    std::wstring pipelineName = L"test-pipeline";
+    dsl_perf_listener_cb listener;
+
+    GIVEN( "A Pipeline in memory" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "A Perf-listner is added" )
+        {
+            REQUIRE( dsl_pipeline_perf_listener_add(pipelineName.c_str(),
+                listener, (void*)0x12345678) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same listner can't be added again" ) 
+            {
+                REQUIRE( dsl_pipeline_perf_listener_add(pipelineName.c_str(),
+                    listener, NULL) == DSL_RESULT_PIPELINE_CALLBACK_ADD_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}    
+
+SCENARIO( "A Perf-listener can be removed", "[pipeline-cb-api]" )
+{
+    std::wstring pipelineName = L"test-pipeline";
+    dsl_perf_listener_cb listener;
+
+    GIVEN( "A Pipeline with one Perf-listener" )
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_perf_listener_add(pipelineName.c_str(),
+            listener, (void*)0x12345678) == DSL_RESULT_SUCCESS );
+
+        WHEN( "A Perf-listner is removed" )
+        {
+            REQUIRE( dsl_pipeline_perf_listener_remove(pipelineName.c_str(),
+                listener) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same handler can't be removed again" ) 
+            {
+                REQUIRE( dsl_pipeline_perf_listener_remove(pipelineName.c_str(),
+                    listener) == DSL_RESULT_PIPELINE_CALLBACK_REMOVE_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A XWindow Key Event Handler must be unique", "[pipeline-cb-api]" )
 {
     std::wstring pipelineName = L"test-pipeline";
@@ -297,3 +356,197 @@ SCENARIO( "A XWindow Delete Event Handler can be removed", "[pipeline-cb-api]" )
         }
     }
 }
+
+SCENARIO( "A Pipeline's dedicated main context can be enabled and disabled", "[pipeline-cb-api]" )
+{
+    std::wstring pipelineName = L"test-pipeline";
+
+    GIVEN( "A Pipeline in memory" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pipeline_main_context_enabled_get(pipelineName.c_str(),
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+
+        WHEN( "The main context is enabled" )
+        {
+            REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(),
+                true) == DSL_RESULT_SUCCESS );
+
+            THEN( "The correct setting is returned and it can't be enabled twice" ) 
+            {
+                REQUIRE( dsl_pipeline_main_context_enabled_get(pipelineName.c_str(),
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(),
+                    true) == DSL_RESULT_PIPELINE_MAIN_CONTEXT_SET_FAILED );
+
+                REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(),
+                    false) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_main_context_enabled_get(pipelineName.c_str(),
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == false );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static std::atomic<uint> slowListenerCount(0);
+static std::atomic<uint> fastListenerCount(0);
+
+static void slow_state_change_listener(uint old_state, uint new_state, void* user_data)
+{
+    if (new_state == DSL_STATE_PLAYING)
+    {
+        slowListenerCount++;
+        std::this_thread::sleep_for(TIME_TO_BLOCK_FOR);
+    }
+}
+
+static void fast_state_change_listener(uint old_state, uint new_state, void* user_data)
+{
+    if (new_state == DSL_STATE_PLAYING)
+    {
+        fastListenerCount++;
+    }
+}
+
+SCENARIO( "A slow listener on one Pipeline does not delay the listeners of another", "[pipeline-cb-api]" )
+{
+    GIVEN( "Two Pipelines, each with a URI Source, Tiled Display and Fake Sink" ) 
+    {
+        std::wstring uri(L"./test/streams/sample_1080p_h264.mp4");
+        std::wstring slowPipelineName(L"slow-pipeline");
+        std::wstring fastPipelineName(L"fast-pipeline");
+
+        REQUIRE( dsl_source_uri_new(L"uri-source-1", uri.c_str(), false, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(L"uri-source-2", uri.c_str(), false, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(L"tiler-1", 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(L"tiler-2", 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(L"fake-sink-1") == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(L"fake-sink-2") == DSL_RESULT_SUCCESS );
+
+        const wchar_t* slowComponents[] = {L"uri-source-1", L"tiler-1", L"fake-sink-1", NULL};
+        const wchar_t* fastComponents[] = {L"uri-source-2", L"tiler-2", L"fake-sink-2", NULL};
+
+        REQUIRE( dsl_pipeline_new_component_add_many(slowPipelineName.c_str(), 
+            slowComponents) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new_component_add_many(fastPipelineName.c_str(), 
+            fastComponents) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_pipeline_state_change_listener_add(slowPipelineName.c_str(),
+            slow_state_change_listener, NULL) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_state_change_listener_add(fastPipelineName.c_str(),
+            fast_state_change_listener, NULL) == DSL_RESULT_SUCCESS );
+            
+        slowListenerCount = 0;
+        fastListenerCount = 0;
+
+        WHEN( "Both Pipelines have a dedicated main context and are played" )
+        {
+            REQUIRE( dsl_pipeline_main_context_enabled_set(slowPipelineName.c_str(),
+                true) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_main_context_enabled_set(fastPipelineName.c_str(),
+                true) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_play(slowPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+            REQUIRE( slowListenerCount.load() == 1 );
+
+            REQUIRE( dsl_pipeline_play(fastPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+            
+            THEN( "The fast listener is called while the slow listener is still blocked" ) 
+            {
+                REQUIRE( fastListenerCount.load() == 1 );
+
+                REQUIRE( dsl_pipeline_stop(slowPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_stop(fastPipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static std::atomic<uint> dispatchedListenerCount(0);
+
+static void dispatched_state_change_listener(uint old_state, uint new_state, void* user_data)
+{
+    if (new_state == DSL_STATE_PLAYING)
+    {
+        dispatchedListenerCount++;
+    }
+}
+
+SCENARIO( "A Pipeline's events can be dispatched from a client poll loop", "[pipeline-cb-api]" )
+{
+    GIVEN( "A Pipeline with a URI Source, Tiled Display, Fake Sink, and state-change-listener" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring uri(L"./test/streams/sample_1080p_h264.mp4");
+
+        REQUIRE( dsl_source_uri_new(L"uri-source", uri.c_str(), false, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(L"tiler", 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(L"fake-sink") == DSL_RESULT_SUCCESS );
+
+        const wchar_t* components[] = {L"uri-source", L"tiler", L"fake-sink", NULL};
+
+        REQUIRE( dsl_pipeline_new_component_add_many(pipelineName.c_str(), 
+            components) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_state_change_listener_add(pipelineName.c_str(),
+            dispatched_state_change_listener, NULL) == DSL_RESULT_SUCCESS );
+            
+        dispatchedListenerCount = 0;
+
+        WHEN( "The Pipeline's event fd is created" )
+        {
+            int fd(-1), retFd(-1);
+            REQUIRE( dsl_pipeline_event_fd_get(pipelineName.c_str(), &fd) == DSL_RESULT_SUCCESS );
+            REQUIRE( fd >= 0 );
+            REQUIRE( dsl_pipeline_event_fd_get(pipelineName.c_str(), &retFd) == DSL_RESULT_SUCCESS );
+            REQUIRE( retFd == fd );
+            REQUIRE( dsl_pipeline_main_context_enabled_set(pipelineName.c_str(),
+                true) == DSL_RESULT_PIPELINE_MAIN_CONTEXT_SET_FAILED );
+            
+            uint count(99);
+            REQUIRE( dsl_pipeline_events_dispatch(pipelineName.c_str(), &count) == DSL_RESULT_SUCCESS );
+            REQUIRE( count == 0 );
+
+            THEN( "State changes are dispatched once the fd becomes readable" ) 
+            {
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                
+                struct pollfd pfd = {fd, POLLIN, 0};
+                uint totalCount(0);
+                for (uint i = 0; i < 10 and !dispatchedListenerCount.load(); i++)
+                {
+                    if (poll(&pfd, 1, 500) > 0)
+                    {
+                        REQUIRE( dsl_pipeline_events_dispatch(pipelineName.c_str(), 
+                            &count) == DSL_RESULT_SUCCESS );
+                        totalCount += count;
+                    }
+                }
+                REQUIRE( totalCount > 0 );
+                REQUIRE( dispatchedListenerCount.load() == 1 );
+
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
@@ -77,3 +77,121 @@ SCENARIO( "A Pipeline's graph can be dumped to .dot with and without timestamp",
         }
     }
 }
+
+SCENARIO( "A Pipeline's latency tracing can be enabled and reported", "[pipeline-dbg-api]" )
+{
+    std::wstring pipelineName  = L"test-pipeline";
+
+    GIVEN( "A new Pipeline with latency tracing disabled by default" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pipeline_latency_tracing_enabled_get(pipelineName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        
+        WHEN( "Latency tracing is enabled" ) 
+        {
+            REQUIRE( dsl_pipeline_latency_tracing_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+
+            THEN( "The setting is updated and an empty report is returned" )
+            {
+                REQUIRE( dsl_pipeline_latency_tracing_enabled_get(pipelineName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                
+                const wchar_t* report;
+                REQUIRE( dsl_pipeline_latency_report_get(pipelineName.c_str(), 
+                    &report) == DSL_RESULT_SUCCESS );
+                REQUIRE( std::wstring(report) == L"" );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline's performance metering can be enabled and configured", "[pipeline-dbg-api]" )
+{
+    std::wstring pipelineName  = L"test-pipeline";
+
+    GIVEN( "A new Pipeline with performance metering disabled by default" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pipeline_perf_enabled_get(pipelineName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        
+        uint interval(0);
+        REQUIRE( dsl_pipeline_perf_interval_get(pipelineName.c_str(), 
+            &interval) == DSL_RESULT_SUCCESS );
+        REQUIRE( interval == DSL_DEFAULT_PERF_INTERVAL );
+        
+        WHEN( "Performance metering is enabled with a new interval" ) 
+        {
+            REQUIRE( dsl_pipeline_perf_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_perf_interval_set(pipelineName.c_str(), 
+                5000) == DSL_RESULT_SUCCESS );
+
+            THEN( "The settings are updated and no perf is available until played" )
+            {
+                REQUIRE( dsl_pipeline_perf_enabled_get(pipelineName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                REQUIRE( dsl_pipeline_perf_interval_get(pipelineName.c_str(), 
+                    &interval) == DSL_RESULT_SUCCESS );
+                REQUIRE( interval == 5000 );
+                REQUIRE( dsl_pipeline_perf_interval_set(pipelineName.c_str(), 
+                    0) == DSL_RESULT_PIPELINE_PERF_SET_FAILED );
+                
+                double fps(0), p50(0), p95(0), p99(0);
+                uint drops(0);
+                REQUIRE( dsl_pipeline_perf_get(pipelineName.c_str(), 0, 
+                    &fps, &p50, &p95, &p99, &drops) == DSL_RESULT_PIPELINE_PERF_GET_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline can start and stop a timeline trace", "[pipeline-dbg-api]" )
+{
+    std::wstring pipelineName  = L"test-pipeline";
+    std::wstring pipelineName2  = L"test-pipeline-2";
+    std::wstring filePath = L"./test-trace.json";
+
+    GIVEN( "Two new Pipelines" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new(pipelineName2.c_str()) == DSL_RESULT_SUCCESS );
+        
+        REQUIRE( dsl_pipeline_trace_stop(pipelineName.c_str()) == DSL_RESULT_PIPELINE_TRACE_FAILED );
+        REQUIRE( dsl_pipeline_trace_start(pipelineName.c_str(), filePath.c_str(),
+            DSL_TRACE_FORMAT_PERFETTO+1) == DSL_RESULT_PIPELINE_TRACE_FAILED );
+
+        WHEN( "A trace is started for the first Pipeline" ) 
+        {
+            REQUIRE( dsl_pipeline_trace_start(pipelineName.c_str(), filePath.c_str(),
+                DSL_TRACE_FORMAT_CHROME_JSON) == DSL_RESULT_SUCCESS );
+
+            THEN( "A second trace can't be started until the first is stopped" )
+            {
+                REQUIRE( dsl_pipeline_trace_start(pipelineName2.c_str(), filePath.c_str(),
+                    DSL_TRACE_FORMAT_CHROME_JSON) == DSL_RESULT_PIPELINE_TRACE_FAILED );
+                REQUIRE( dsl_pipeline_trace_stop(pipelineName2.c_str()) == DSL_RESULT_PIPELINE_TRACE_FAILED );
+                REQUIRE( dsl_pipeline_trace_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_trace_start(pipelineName2.c_str(), filePath.c_str(),
+                    DSL_TRACE_FORMAT_PERFETTO) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_trace_stop(pipelineName2.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
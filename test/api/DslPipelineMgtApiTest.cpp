@@ -23,6 +23,7 @@ THE SOFTWARE.
 */
 
 #include "catch.hpp"
+#include "Dsl.h"
 #include "DslApi.h"
 
 SCENARIO( "A single Pipeline is created and deleted correctly", "[PipelineMgt]" )
@@ -144,3 +145,645 @@ SCENARIO( "A non-unique Pipeline name fails when creating Many Pipelines", "[Pip
         REQUIRE( dsl_pipeline_list_size() == 0 );
     }
 }
+
+SCENARIO( "A Pipeline's classification cache can be enabled and configured", "[PipelineMgt]" )
+{
+    std::wstring pipelineName  = L"test-pipeline";
+
+    GIVEN( "A new Pipeline" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        boolean enabled(true);
+        REQUIRE( dsl_pipeline_classification_cache_enabled_get(pipelineName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        
+        uint minCount(0), ttl(0);
+        double minConfidence(0);
+        REQUIRE( dsl_pipeline_classification_cache_settings_get(pipelineName.c_str(), 
+            &minCount, &minConfidence, &ttl) == DSL_RESULT_SUCCESS );
+        REQUIRE( minCount == DSL_DEFAULT_CLASSIFICATION_CACHE_MIN_COUNT );
+        REQUIRE( minConfidence == DSL_DEFAULT_CLASSIFICATION_CACHE_MIN_CONFIDENCE );
+        REQUIRE( ttl == DSL_DEFAULT_CLASSIFICATION_CACHE_TTL );
+
+        double hitRate(1);
+        uint entries(1);
+        REQUIRE( dsl_pipeline_classification_cache_stats_get(pipelineName.c_str(), 
+            &hitRate, &entries) == DSL_RESULT_PIPELINE_CACHE_GET_FAILED );
+        
+        WHEN( "The classification cache is enabled with new settings" ) 
+        {
+            REQUIRE( dsl_pipeline_classification_cache_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_classification_cache_settings_set(pipelineName.c_str(), 
+                5, 0.9, 1000) == DSL_RESULT_SUCCESS );
+
+            THEN( "The settings are updated and the cache is empty" )
+            {
+                REQUIRE( dsl_pipeline_classification_cache_enabled_get(pipelineName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                REQUIRE( dsl_pipeline_classification_cache_settings_get(pipelineName.c_str(), 
+                    &minCount, &minConfidence, &ttl) == DSL_RESULT_SUCCESS );
+                REQUIRE( minCount == 5 );
+                REQUIRE( minConfidence == 0.9 );
+                REQUIRE( ttl == 1000 );
+                REQUIRE( dsl_pipeline_classification_cache_settings_set(pipelineName.c_str(), 
+                    5, 1.1, 1000) == DSL_RESULT_PIPELINE_CACHE_SET_FAILED );
+                REQUIRE( dsl_pipeline_classification_cache_settings_set(pipelineName.c_str(), 
+                    0, 0.9, 1000) == DSL_RESULT_PIPELINE_CACHE_SET_FAILED );
+                
+                REQUIRE( dsl_pipeline_classification_cache_stats_get(pipelineName.c_str(), 
+                    &hitRate, &entries) == DSL_RESULT_SUCCESS );
+                REQUIRE( hitRate == 0 );
+                REQUIRE( entries == 0 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Transaction can be committed and aborted", "[PipelineMgt]" )
+{
+    GIVEN( "A new Pipeline, Source, Tiler, and Sink created within a Transaction" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring sourceName(L"uri-source");
+        std::wstring tilerName(L"tiler");
+        std::wstring sinkName(L"fake-sink");
+
+        REQUIRE( dsl_transaction_commit() == DSL_RESULT_TRANSACTION_NOT_IN_PROGRESS );
+        REQUIRE( dsl_transaction_abort() == DSL_RESULT_TRANSACTION_NOT_IN_PROGRESS );
+
+        REQUIRE( dsl_transaction_begin() == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_transaction_begin() == DSL_RESULT_TRANSACTION_IN_PROGRESS );
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), 
+            L"./test/streams/sample_1080p_h264.mp4", false, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        const wchar_t* components[] = {L"uri-source", L"tiler", L"fake-sink", NULL};
+        REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), 
+            components) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_delete(pipelineName.c_str()) == DSL_RESULT_TRANSACTION_IN_PROGRESS );
+
+        WHEN( "The Transaction is committed" ) 
+        {
+            REQUIRE( dsl_transaction_commit() == DSL_RESULT_SUCCESS );
+
+            THEN( "The Pipeline and its Components remain" )
+            {
+                REQUIRE( dsl_pipeline_list_size() == 1 );
+                REQUIRE( dsl_component_list_size() == 3 );
+                REQUIRE( dsl_component_delete(tilerName.c_str()) == DSL_RESULT_COMPONENT_IN_USE );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "The Transaction is aborted" ) 
+        {
+            REQUIRE( dsl_transaction_abort() == DSL_RESULT_SUCCESS );
+
+            THEN( "The Pipeline and its Components are removed" )
+            {
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Transaction abort restores Components and undoes edits of existing Pipelines", "[PipelineMgt]" )
+{
+    GIVEN( "A Pipeline with a Tiler, and an unused Sink" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring tilerName(L"tiler");
+        std::wstring sinkName(L"fake-sink");
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+            tilerName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Tiler is removed and the Sink deleted within an aborted Transaction" ) 
+        {
+            REQUIRE( dsl_transaction_begin() == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_component_remove(pipelineName.c_str(), 
+                tilerName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_component_delete(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_transaction_abort() == DSL_RESULT_SUCCESS );
+
+            THEN( "The Tiler is back in use and the Sink is restored" )
+            {
+                REQUIRE( dsl_component_list_size() == 2 );
+                REQUIRE( dsl_component_delete(tilerName.c_str()) == DSL_RESULT_COMPONENT_IN_USE );
+                REQUIRE( dsl_component_delete(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Transaction abort restores the handle of a deleted Component", "[PipelineMgt]" )
+{
+    GIVEN( "A Tiler and its handle" ) 
+    {
+        std::wstring tilerName(L"tiler");
+        DslHandle handle(0);
+        uint width(0), height(0);
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_component_handle_get(tilerName.c_str(), &handle) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Tiler is deleted within an aborted Transaction" ) 
+        {
+            REQUIRE( dsl_transaction_begin() == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_component_delete(tilerName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_transaction_abort() == DSL_RESULT_SUCCESS );
+
+            THEN( "The original handle resolves to the restored Tiler" )
+            {
+                REQUIRE( dsl_tiler_dimensions_get_by_handle(handle, 
+                    &width, &height) == DSL_RESULT_SUCCESS );
+                REQUIRE( width == 1280 );
+                REQUIRE( height == 720 );
+
+                DslHandle restoredHandle(0);
+                REQUIRE( dsl_component_handle_get(tilerName.c_str(), 
+                    &restoredHandle) == DSL_RESULT_SUCCESS );
+                REQUIRE( restoredHandle == handle );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_tiler_dimensions_get_by_handle(handle, 
+                    &width, &height) != DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A failed add-many leaves no Components added", "[PipelineMgt]" )
+{
+    GIVEN( "A Pipeline and a Tiler" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring tilerName(L"tiler");
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Tiler is added with a Component that does not exist" ) 
+        {
+            const wchar_t* components[] = {L"tiler", L"non-existent", NULL};
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), 
+                components) == DSL_RESULT_COMPONENT_NAME_NOT_FOUND );
+
+            THEN( "The Tiler is not in use and the Pipeline remains" )
+            {
+                REQUIRE( dsl_pipeline_list_size() == 1 );
+                REQUIRE( dsl_component_delete(tilerName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A failed remove-many leaves all Components in place", "[PipelineMgt]" )
+{
+    GIVEN( "A Pipeline with a Tiler and a Fake Sink" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(L"tiler", 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(L"fake-sink") == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"tiler", L"fake-sink", NULL};
+        REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), 
+            components) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Tiler is removed with a Component that does not exist" ) 
+        {
+            const wchar_t* removes[] = {L"tiler", L"non-existent", NULL};
+            REQUIRE( dsl_pipeline_component_remove_many(pipelineName.c_str(), 
+                removes) == DSL_RESULT_COMPONENT_NAME_NOT_FOUND );
+
+            THEN( "The Tiler is still in use" )
+            {
+                REQUIRE( dsl_component_delete(L"tiler") == DSL_RESULT_COMPONENT_IN_USE );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Transaction blocks other threads until it ends", "[PipelineMgt]" )
+{
+    GIVEN( "A Fake Sink created within a Transaction" ) 
+    {
+        std::wstring sinkName(L"fake-sink");
+
+        REQUIRE( dsl_transaction_begin() == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(sinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "Another thread deletes the Sink" ) 
+        {
+            std::atomic<bool> deleted(false);
+            DslReturnType deleteResult(DSL_RESULT_COMPONENT_RESULT);
+            std::thread otherThread([&]()
+            {
+                deleteResult = dsl_component_delete(sinkName.c_str());
+                deleted = true;
+            });
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+            THEN( "The delete waits for the commit, then succeeds" )
+            {
+                REQUIRE( deleted == false );
+                REQUIRE( dsl_component_list_size() == 1 );
+                REQUIRE( dsl_transaction_commit() == DSL_RESULT_SUCCESS );
+                
+                otherThread.join();
+                REQUIRE( deleted == true );
+                REQUIRE( deleteResult == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Transaction with an invalid graph fails validation on commit", "[PipelineMgt]" )
+{
+    GIVEN( "A new Pipeline with a Tiler and no Sources or Sink created within a Transaction" ) 
+    {
+        std::wstring pipelineName(L"test-pipeline");
+        std::wstring tilerName(L"tiler");
+
+        REQUIRE( dsl_transaction_begin() == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+            tilerName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The Transaction is committed" ) 
+        {
+            REQUIRE( dsl_transaction_commit() == DSL_RESULT_TRANSACTION_VALIDATION_FAILED );
+
+            THEN( "All changes are undone" )
+            {
+                REQUIRE( dsl_transaction_abort() == DSL_RESULT_TRANSACTION_NOT_IN_PROGRESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline definition can be loaded, saved, and reloaded", "[PipelineMgt]" )
+{
+    GIVEN( "A Pipeline definition with a Tiler, a Branch and Tee, and Fake Sinks" ) 
+    {
+        std::wstring definition(
+            L"[test-pipeline]\n"
+            L"type=pipeline\n"
+            L"components=tiler;splitter\n"
+            L"[tiler]\n"
+            L"type=tiler\n"
+            L"width=1280\n"
+            L"height=720\n"
+            L"columns=2\n"
+            L"rows=1\n"
+            L"[splitter]\n"
+            L"type=tee-splitter\n"
+            L"branches=branch;fake-sink-1\n"
+            L"[branch]\n"
+            L"type=branch\n"
+            L"components=fake-sink-2\n"
+            L"[fake-sink-1]\n"
+            L"type=sink-fake\n"
+            L"[fake-sink-2]\n"
+            L"type=sink-fake\n");
+        std::wstring path(L"./test-pipeline-definition.txt");
+
+        WHEN( "The definition is loaded" ) 
+        {
+            const wchar_t* report(NULL);
+            REQUIRE( dsl_pipeline_load_definition(definition.c_str(), 
+                &report) == DSL_RESULT_SUCCESS );
+
+            THEN( "All components are created and added, and the definition can be reloaded" )
+            {
+                REQUIRE( std::wstring(report) == 
+                    L"test-pipeline;tiler;splitter;branch;fake-sink-1;fake-sink-2" );
+                REQUIRE( dsl_pipeline_list_size() == 1 );
+                REQUIRE( dsl_component_list_size() == 5 );
+                REQUIRE( dsl_component_delete(L"tiler") == DSL_RESULT_COMPONENT_IN_USE );
+                REQUIRE( dsl_component_delete(L"fake-sink-2") == DSL_RESULT_COMPONENT_IN_USE );
+                
+                uint cols(0), rows(0);
+                REQUIRE( dsl_tiler_tiles_get(L"tiler", &cols, &rows) == DSL_RESULT_SUCCESS );
+                REQUIRE( cols == 2 );
+                REQUIRE( rows == 1 );
+
+                REQUIRE( dsl_pipeline_save_definition(L"test-pipeline", 
+                    path.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_load_definition(path.c_str(), 
+                    &report) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 1 );
+                REQUIRE( dsl_component_list_size() == 5 );
+                REQUIRE( dsl_component_delete(L"tiler") == DSL_RESULT_COMPONENT_IN_USE );
+                REQUIRE( dsl_component_delete(L"fake-sink-2") == DSL_RESULT_COMPONENT_IN_USE );
+                REQUIRE( dsl_tiler_tiles_get(L"tiler", &cols, &rows) == DSL_RESULT_SUCCESS );
+                REQUIRE( cols == 2 );
+                REQUIRE( rows == 1 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                std::remove("./test-pipeline-definition.txt");
+            }
+        }
+        WHEN( "A definition with a Component of unknown type is loaded" ) 
+        {
+            const wchar_t* report(NULL);
+            std::wstring badDefinition(definition + L"[bad-sink]\ntype=sink-unknown\n");
+            REQUIRE( dsl_pipeline_load_definition(badDefinition.c_str(), 
+                &report) == DSL_RESULT_PIPELINE_DEFINITION_LOAD_FAILED );
+
+            THEN( "No Pipelines or Components are created" )
+            {
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline definition saves and reloads settings made after construction", 
+    "[PipelineMgt]" )
+{
+    GIVEN( "A Pipeline with an RTSP Source and a Fake Sink, with updated settings" ) 
+    {
+        std::wstring path(L"./test-pipeline-settings.txt");
+
+        REQUIRE( dsl_pipeline_new(L"test-pipeline") == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_rtsp_new(L"rtsp-source", L"rtsp://127.0.0.1:8554/test", 
+            DSL_RTP_ALL, DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_source_decode_rtsp_config_set(L"rtsp-source", 500, true, true,
+            DSL_RTP_TCP, DSL_RTSP_BUFFER_MODE_SLAVE, 2000) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(L"fake-sink") == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"rtsp-source", L"fake-sink", NULL};
+        REQUIRE( dsl_pipeline_component_add_many(L"test-pipeline", 
+            components) == DSL_RESULT_SUCCESS );
+            
+        REQUIRE( dsl_pipeline_streammux_batch_properties_set(L"test-pipeline", 
+            4, 40000) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_streammux_dimensions_set(L"test-pipeline", 
+            1280, 720) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_perf_interval_set(L"test-pipeline", 
+            3000) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_component_queue_policy_set(L"fake-sink", 
+            10, 100, DSL_QUEUE_LEAKY_DOWNSTREAM, 50) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The definition is saved and reloaded" ) 
+        {
+            const wchar_t* report(NULL);
+            REQUIRE( dsl_pipeline_save_definition(L"test-pipeline", 
+                path.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_load_definition(path.c_str(), 
+                &report) == DSL_RESULT_SUCCESS );
+
+            THEN( "The reloaded settings match those saved" )
+            {
+                uint values[4]{0};
+                boolean flags[2]{false};
+                REQUIRE( dsl_pipeline_streammux_batch_properties_get(L"test-pipeline", 
+                    &values[0], &values[1]) == DSL_RESULT_SUCCESS );
+                REQUIRE( values[0] == 4 );
+                REQUIRE( values[1] == 40000 );
+                REQUIRE( dsl_pipeline_streammux_dimensions_get(L"test-pipeline", 
+                    &values[0], &values[1]) == DSL_RESULT_SUCCESS );
+                REQUIRE( values[0] == 1280 );
+                REQUIRE( values[1] == 720 );
+                REQUIRE( dsl_pipeline_perf_interval_get(L"test-pipeline", 
+                    &values[0]) == DSL_RESULT_SUCCESS );
+                REQUIRE( values[0] == 3000 );
+                
+                uint latency(0), protocols(0), bufferMode(0), timeout(0);
+                REQUIRE( dsl_source_decode_rtsp_config_get(L"rtsp-source", &latency,
+                    &flags[0], &flags[1], &protocols, &bufferMode, 
+                    &timeout) == DSL_RESULT_SUCCESS );
+                REQUIRE( latency == 500 );
+                REQUIRE( flags[0] == true );
+                REQUIRE( flags[1] == true );
+                REQUIRE( protocols == DSL_RTP_TCP );
+                REQUIRE( bufferMode == DSL_RTSP_BUFFER_MODE_SLAVE );
+                REQUIRE( timeout == 2000 );
+                
+                REQUIRE( dsl_component_queue_policy_get(L"fake-sink", &values[0], 
+                    &values[1], &values[2], &values[3]) == DSL_RESULT_SUCCESS );
+                REQUIRE( values[0] == 10 );
+                REQUIRE( values[1] == 100 );
+                REQUIRE( values[2] == DSL_QUEUE_LEAKY_DOWNSTREAM );
+                REQUIRE( values[3] == 50 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                std::remove("./test-pipeline-settings.txt");
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline definition with a malformed value fails to load", "[PipelineMgt]" )
+{
+    GIVEN( "A Pipeline definition with a negative and a non-numeric value" ) 
+    {
+        std::wstring negativeWidth(
+            L"[test-pipeline]\n"
+            L"type=pipeline\n"
+            L"components=tiler\n"
+            L"[tiler]\n"
+            L"type=tiler\n"
+            L"width=-1\n"
+            L"height=720\n");
+        std::wstring textInterval(
+            L"[test-pipeline]\n"
+            L"type=pipeline\n"
+            L"perf-interval=abc\n");
+
+        WHEN( "Either definition is loaded" ) 
+        {
+            const wchar_t* report(NULL);
+            REQUIRE( dsl_pipeline_load_definition(negativeWidth.c_str(), 
+                &report) == DSL_RESULT_PIPELINE_DEFINITION_INVALID );
+            REQUIRE( dsl_pipeline_load_definition(textInterval.c_str(), 
+                &report) == DSL_RESULT_PIPELINE_DEFINITION_INVALID );
+
+            THEN( "No Pipelines or Components are created" )
+            {
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+/**
+ * @brief Builds a Pipeline of numSources URI Sources with a Tiler and Fake Sink
+ * @return the API time taken in milliseconds
+ */
+static double BuildPipeline(uint numSources, bool useTransaction)
+{
+    auto start = std::chrono::steady_clock::now();
+    
+    if (useTransaction)
+    {
+        REQUIRE( dsl_transaction_begin() == DSL_RESULT_SUCCESS );
+    }
+    REQUIRE( dsl_pipeline_new(L"test-pipeline") == DSL_RESULT_SUCCESS );
+    for (uint i = 0; i < numSources; i++)
+    {
+        std::wstring sourceName(L"uri-source-" + std::to_wstring(i));
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), 
+            L"./test/streams/sample_1080p_h264.mp4", false, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add(L"test-pipeline", 
+            sourceName.c_str()) == DSL_RESULT_SUCCESS );
+    }
+    REQUIRE( dsl_tiler_new(L"tiler", 1920, 1080) == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_sink_fake_new(L"fake-sink") == DSL_RESULT_SUCCESS );
+    
+    const wchar_t* components[] = {L"tiler", L"fake-sink", NULL};
+    REQUIRE( dsl_pipeline_component_add_many(L"test-pipeline", 
+        components) == DSL_RESULT_SUCCESS );
+    
+    if (useTransaction)
+    {
+        REQUIRE( dsl_transaction_commit() == DSL_RESULT_SUCCESS );
+    }
+    auto duration = std::chrono::steady_clock::now() - start;
+    
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+SCENARIO( "The API time to build a 64 Source Pipeline is reported", 
+    "[.][benchmark][PipelineMgt]" )
+{
+    GIVEN( "A Source in-use maximum of 64" ) 
+    {
+        uint numSources(64);
+        uint currentMax = dsl_source_num_in_use_max_get();
+        REQUIRE( dsl_source_num_in_use_max_set(numSources) == true );
+
+        WHEN( "The Pipeline is built with and without a Transaction" ) 
+        {
+            double withoutTransaction = BuildPipeline(numSources, false);
+            REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+
+            double withTransaction = BuildPipeline(numSources, true);
+            REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+
+            THEN( "The build times are reported" )
+            {
+                std::cout << "Without transaction: " << withoutTransaction << " ms\n";
+                std::cout << "With transaction: " << withTransaction << " ms\n";
+
+                REQUIRE( dsl_source_num_in_use_max_set(currentMax) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline's link optimization can be enabled", "[PipelineMgt]" )
+{
+    std::wstring pipelineName  = L"test-pipeline";
+
+    GIVEN( "A new Pipeline with link optimization disabled by default" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        boolean enabled(true);
+        REQUIRE( dsl_pipeline_link_optimization_enabled_get(pipelineName.c_str(), 
+            &enabled) == DSL_RESULT_SUCCESS );
+        REQUIRE( enabled == false );
+        
+        WHEN( "Link optimization is enabled" ) 
+        {
+            REQUIRE( dsl_pipeline_link_optimization_enabled_set(pipelineName.c_str(), 
+                true) == DSL_RESULT_SUCCESS );
+
+            THEN( "The setting is updated and an empty report is returned" )
+            {
+                REQUIRE( dsl_pipeline_link_optimization_enabled_get(pipelineName.c_str(), 
+                    &enabled) == DSL_RESULT_SUCCESS );
+                REQUIRE( enabled == true );
+                
+                const wchar_t* report;
+                REQUIRE( dsl_pipeline_link_optimization_report_get(pipelineName.c_str(), 
+                    &report) == DSL_RESULT_SUCCESS );
+                REQUIRE( std::wstring(report) == L"" );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A Pipeline's streaming thread settings can be updated", "[PipelineMgt]" )
+{
+    std::wstring pipelineName  = L"test-pipeline";
+
+    GIVEN( "A new Pipeline" ) 
+    {
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+        WHEN( "A role's affinity is set" ) 
+        {
+            REQUIRE( dsl_pipeline_thread_role_affinity_set(pipelineName.c_str(), 
+                DSL_THREAD_ROLE_DECODE, L"0-1", 5) == DSL_RESULT_SUCCESS );
+
+            THEN( "The same settings are returned and an empty report is returned" )
+            {
+                const wchar_t* cpus;
+                int priority(0);
+                REQUIRE( dsl_pipeline_thread_role_affinity_get(pipelineName.c_str(), 
+                    DSL_THREAD_ROLE_DECODE, &cpus, &priority) == DSL_RESULT_SUCCESS );
+                REQUIRE( std::wstring(cpus) == L"0-1" );
+                REQUIRE( priority == 5 );
+                
+                REQUIRE( dsl_pipeline_thread_role_affinity_set(pipelineName.c_str(), 
+                    DSL_THREAD_ROLE_DECODE, L"1-0", 5) == 
+                    DSL_RESULT_PIPELINE_THREAD_AFFINITY_SET_FAILED );
+                
+                const wchar_t* report;
+                REQUIRE( dsl_pipeline_thread_report_get(pipelineName.c_str(), 
+                    &report) == DSL_RESULT_SUCCESS );
+                REQUIRE( std::wstring(report) == L"" );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
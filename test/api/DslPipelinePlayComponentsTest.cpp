@@ -82,6 +82,70 @@ SCENARIO( "A new Pipeline with a URI File Source, FakeSink, and Tiled Display ca
     }
 }
 
+SCENARIO( "An On-Screen Display can be added to and removed from a Playing Pipeline", "[pipeline-play]" )
+{
+    GIVEN( "A Pipeline, URI source, Fake Sink, Tiled Display, and On-Screen Display" ) 
+    {
+        std::wstring sourceName1(L"uri-source");
+        std::wstring uri(L"./test/streams/sample_1080p_h264.mp4");
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        std::wstring tilerName(L"tiler");
+        uint width(1280);
+        uint height(720);
+
+        std::wstring fakeSinkName(L"fake-sink");
+        
+        std::wstring onScreenDisplayName(L"on-screen-display");
+        bool isClockEnabled(false);
+
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(sourceName1.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+        
+        REQUIRE( dsl_osd_new(onScreenDisplayName.c_str(), isClockEnabled) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"uri-source", L"tiler", L"fake-sink", NULL};
+        
+        WHEN( "When the Pipeline is Assembled and Playing" ) 
+        {
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+
+            THEN( "The On-Screen Display is relinked in place without stopping the Pipeline" )
+            {
+                REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+                    onScreenDisplayName.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+
+                REQUIRE( dsl_pipeline_component_remove(pipelineName.c_str(), 
+                    onScreenDisplayName.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
 SCENARIO( "A new Pipeline with a URI File Source, OverlaySink, and Tiled Display can play", "[pipeline-play]" )
 {
     GIVEN( "A Pipeline, URI source, Overlay Sink, and Tiled Display" ) 
@@ -723,6 +787,88 @@ SCENARIO( "A new Pipeline with a URI File Source, DSL_CODEC_H264 RTSP Sink, and
     }
 }
 
+SCENARIO( "A new Pipeline with an RTSP Source, served on loopback, and FakeSink reports RTSP stats", "[pipeline-play]" )
+{
+    GIVEN( "A loopback RTSP server, a Pipeline, RTSP Source, and Fake Sink" ) 
+    {
+        // Serve the sample stream, H264 over RTP, on a private main context
+        GMainContext* pServerContext = g_main_context_new();
+        GMainLoop* pServerLoop = g_main_loop_new(pServerContext, FALSE);
+        GstRTSPServer* pServer = gst_rtsp_server_new();
+        gst_rtsp_server_set_service(pServer, "8556");
+        
+        GstRTSPMediaFactory* pFactory = gst_rtsp_media_factory_new();
+        gst_rtsp_media_factory_set_launch(pFactory, "( filesrc "
+            "location=./test/streams/sample_1080p_h264.mp4 ! qtdemux ! h264parse ! "
+            "rtph264pay name=pay0 pt=96 )");
+        gst_rtsp_media_factory_set_shared(pFactory, TRUE);
+        GstRTSPMountPoints* pMounts = gst_rtsp_server_get_mount_points(pServer);
+        gst_rtsp_mount_points_add_factory(pMounts, "/test", pFactory);
+        g_object_unref(pMounts);
+        
+        guint serverId = gst_rtsp_server_attach(pServer, pServerContext);
+        REQUIRE( serverId != 0 );
+        std::thread serverThread(g_main_loop_run, pServerLoop);
+
+        std::wstring sourceName(L"rtsp-source");
+        std::wstring uri(L"rtsp://127.0.0.1:8556/test");
+        std::wstring fakeSinkName(L"fake-sink");
+        std::wstring pipelineName(L"test-pipeline");
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_rtsp_new(sourceName.c_str(), uri.c_str(), DSL_RTP_ALL, 
+            DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+        
+        const wchar_t* components[] = {L"rtsp-source", L"fake-sink", NULL};
+        
+        WHEN( "When the Pipeline is Assembled and played" ) 
+        {
+            REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), 
+                components) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            std::this_thread::sleep_for(std::chrono::milliseconds(3000));
+
+            THEN( "Stats are reported for the session, and zeroed once stopped" )
+            {
+                double jitter(0);
+                uint packetsReceived(0), packetsLost(0);
+                REQUIRE( dsl_source_decode_rtsp_stats_get(sourceName.c_str(), &jitter,
+                    &packetsReceived, &packetsLost) == DSL_RESULT_SUCCESS );
+                REQUIRE( packetsReceived > 0 );
+                REQUIRE( jitter >= 0 );
+                
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_decode_rtsp_stats_get(sourceName.c_str(), &jitter,
+                    &packetsReceived, &packetsLost) == DSL_RESULT_SUCCESS );
+                REQUIRE( packetsReceived == 0 );
+                REQUIRE( packetsLost == 0 );
+                
+                // A new session reports its own stats once played again
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(std::chrono::milliseconds(3000));
+                REQUIRE( dsl_source_decode_rtsp_stats_get(sourceName.c_str(), &jitter,
+                    &packetsReceived, &packetsLost) == DSL_RESULT_SUCCESS );
+                REQUIRE( packetsReceived > 0 );
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_list_size() == 0 );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+        g_source_destroy(g_main_context_find_source_by_id(pServerContext, serverId));
+        g_main_loop_quit(pServerLoop);
+        serverThread.join();
+        g_object_unref(pServer);
+        g_main_loop_unref(pServerLoop);
+        g_main_context_unref(pServerContext);
+    }
+}
+
 //SCENARIO( "A new Pipeline with a URI File Source, DSL_CODEC_H265 RTSP Sink, and Tiled Display can play", "[pipeline-play]" )
 //{
 //    GIVEN( "A Pipeline, URI source, DSL_CODEC_H265 RTSP Sink, and Tiled Display" ) 
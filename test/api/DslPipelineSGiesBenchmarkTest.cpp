@@ -0,0 +1,136 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+
+#define TIME_TO_RUN_FOR std::chrono::milliseconds(10000)
+
+/**
+ * @brief Secondary GIE configs used in rotation for benchmarks with more
+ * SGIEs than unique models. Each SGIE gets a unique name and id.
+ */
+static const wchar_t* sgieConfigs[][2] = 
+{
+    {L"./test/configs/config_infer_secondary_carcolor_nano.txt", 
+        L"./test/models/Secondary_CarColor/resnet18.caffemodel"},
+    {L"./test/configs/config_infer_secondary_carmake_nano.txt", 
+        L"./test/models/Secondary_CarMake/resnet18.caffemodel"},
+    {L"./test/configs/config_infer_secondary_vehicletypes_nano.txt", 
+        L"./test/models/Secondary_VehicleTypes/resnet18.caffemodel"}
+};
+
+/**
+ * @brief Runs a URI Source, Primary GIE, Tracker, Secondary GIEs and Fake Sink 
+ * Pipeline for a fixed time with performance metering enabled
+ * @param[in] numSgies number of Secondary GIEs to add
+ * @param[in] linkMode one of the DSL_SGIE_LINK_MODE constant values
+ * @param[out] fps rolling frames per second over the last interval
+ * @param[out] p50 50th percentile capture-to-sink latency in ms
+ * @param[out] p99 99th percentile capture-to-sink latency in ms
+ */
+static void RunSgieBenchmark(uint numSgies, uint linkMode, 
+    double* fps, double* p50, double* p99)
+{
+    std::wstring pipelineName(L"sgie-benchmark");
+    std::wstring primaryGieName(L"primary-gie");
+    
+    REQUIRE( dsl_source_uri_new(L"uri-source", L"./test/streams/sample_1080p_h264.mp4", 
+        false, DSL_CUDADEC_MEMTYPE_DEVICE, false, 0) == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_gie_primary_new(primaryGieName.c_str(), 
+        L"./test/configs/config_infer_primary_nano.txt", 
+        L"./test/models/Primary_Detector_Nano/resnet10.caffemodel_b1_fp16.engine", 
+        0) == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_tracker_ktl_new(L"ktl-tracker", 480, 272) == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_tiler_new(L"tiler", 1280, 720) == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_sink_fake_new(L"fake-sink") == DSL_RESULT_SUCCESS );
+
+    REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+    const wchar_t* components[] = {L"uri-source", L"primary-gie", L"ktl-tracker", 
+        L"tiler", L"fake-sink", NULL};
+    REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), 
+        components) == DSL_RESULT_SUCCESS );
+    
+    for (uint i = 0; i < numSgies; i++)
+    {
+        std::wstring sgieName = L"secondary-gie-" + std::to_wstring(i);
+        REQUIRE( dsl_gie_secondary_new(sgieName.c_str(), sgieConfigs[i%3][0], 
+            sgieConfigs[i%3][1], primaryGieName.c_str(), 0) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+            sgieName.c_str()) == DSL_RESULT_SUCCESS );
+    }
+    REQUIRE( dsl_pipeline_sgie_link_mode_set(pipelineName.c_str(), 
+        linkMode) == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_pipeline_perf_enabled_set(pipelineName.c_str(), 
+        true) == DSL_RESULT_SUCCESS );
+
+    REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+    std::this_thread::sleep_for(TIME_TO_RUN_FOR);
+    
+    double p95(0);
+    uint drops(0);
+    REQUIRE( dsl_pipeline_perf_get(pipelineName.c_str(), 0, 
+        fps, p50, &p95, p99, &drops) == DSL_RESULT_SUCCESS );
+        
+    REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+    REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+}
+
+SCENARIO( "Parallel and serial SGIE link modes are benchmarked with 1 to 6 SGIEs", 
+    "[.][benchmark][pipeline-sgies]" )
+{
+    GIVEN( "A Pipeline with a URI Source, Primary GIE, Tracker, and Fake Sink" ) 
+    {
+        WHEN( "The Pipeline is played with each link mode for 1 to 6 SGIEs" ) 
+        {
+            std::vector<double> parallelFps, serialFps;
+            
+            for (uint numSgies = 1; numSgies <= 6; numSgies++)
+            {
+                double fps(0), p50(0), p99(0);
+                
+                RunSgieBenchmark(numSgies, DSL_SGIE_LINK_MODE_PARALLEL, &fps, &p50, &p99);
+                std::cout << numSgies << " SGIEs, parallel: " << fps << " fps, p50 = " 
+                    << p50 << " ms, p99 = " << p99 << " ms" << std::endl;
+                parallelFps.push_back(fps);
+                
+                RunSgieBenchmark(numSgies, DSL_SGIE_LINK_MODE_SERIAL, &fps, &p50, &p99);
+                std::cout << numSgies << " SGIEs, serial:   " << fps << " fps, p50 = " 
+                    << p50 << " ms, p99 = " << p99 << " ms" << std::endl;
+                serialFps.push_back(fps);
+            }
+            
+            THEN( "Every run is measured" )
+            {
+                for (uint i = 0; i < 6; i++)
+                {
+                    REQUIRE( parallelFps[i] > 0 );
+                    REQUIRE( serialFps[i] > 0 );
+                }
+            }
+        }
+    }
+}
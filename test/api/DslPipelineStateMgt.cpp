@@ -88,3 +88,82 @@ SCENARIO( "A new Pipeline with minimal components can Play", "[PipelineStateMgt]
     }
 }
 
+
+static std::atomic<uint> prepareResult(0xFFFFFFFF);
+
+static void prepare_complete_cb(uint result, void* user_data)
+{
+    prepareResult = result;
+}
+
+SCENARIO( "A new Pipeline with minimal components can be Prepared and then Played", "[PipelineStateMgt]" )
+{
+    GIVEN( "A Pipeline with minimal components" ) 
+    {
+        std::wstring sourceName = L"test-uri-source";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(2);
+
+        std::wstring tilerName = L"tiler";
+        uint width(1280);
+        uint height(720);
+
+        std::wstring windowSinkName = L"window-sink";
+        uint offsetX(0);
+        uint offsetY(0);
+        uint sinkW(1280);
+        uint sinkH(720);
+
+        std::wstring pipelineName  = L"test-pipeline";
+        
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), uri.c_str(), cudadecMemType, 
+            false, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), width, height) == DSL_RESULT_SUCCESS );
+    
+        REQUIRE( dsl_sink_window_new(windowSinkName.c_str(), 
+            offsetX, offsetY, sinkW, sinkH) == DSL_RESULT_SUCCESS );
+            
+        const wchar_t* components[] = {L"test-uri-source", L"tiler", L"window-sink", NULL};
+        
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+    
+        REQUIRE( dsl_pipeline_component_add_many(pipelineName.c_str(), components) == DSL_RESULT_SUCCESS );
+
+        WHEN( "When the Pipeline is Prepared" ) 
+        {
+            prepareResult = 0xFFFFFFFF;
+            REQUIRE( dsl_pipeline_prepare(pipelineName.c_str(), 
+                prepare_complete_cb, NULL) == DSL_RESULT_SUCCESS );
+                
+            // A second prepare must fail while the first is in progress or complete
+            REQUIRE( dsl_pipeline_prepare(pipelineName.c_str(), 
+                NULL, NULL) == DSL_RESULT_PIPELINE_FAILED_TO_PREPARE );
+
+            THEN( "The Pipeline reports completion and can be Played and Stopped" )
+            {
+                for (uint i = 0; i < 100 and prepareResult == 0xFFFFFFFF; i++)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                }
+                REQUIRE( prepareResult == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                
+                const wchar_t* report;
+                REQUIRE( dsl_pipeline_prepare_report_get(pipelineName.c_str(), 
+                    &report) == DSL_RESULT_SUCCESS );
+                REQUIRE( std::wstring(report).size() > 0 );
+                std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+            
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
@@ -109,4 +109,95 @@ SCENARIO( "The Batch Size for a Pipeline with multiple-sources can be updated",
             }
         }
     }
-}
\ No newline at end of file
+}
+SCENARIO( "A Pipeline's surface memory budget is applied on play", "[pipeline-streammux]" )
+{
+    GIVEN( "A Pipeline with a source and a sink" ) 
+    {
+        std::wstring sourceName = L"test-uri-source";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        std::wstring fakeSinkName = L"fake-sink";
+        std::wstring pipelineName  = L"test-pipeline";
+        
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), uri.c_str(), false, 
+            cudadecMemType, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_sink_fake_new(fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_new(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+            sourceName.c_str()) == DSL_RESULT_SUCCESS );
+        REQUIRE( dsl_pipeline_component_add(pipelineName.c_str(), 
+            fakeSinkName.c_str()) == DSL_RESULT_SUCCESS );
+
+        uint budget(99), policy(99);
+        REQUIRE( dsl_pipeline_surface_budget_get(pipelineName.c_str(), 
+            &budget, &policy) == DSL_RESULT_SUCCESS );
+        REQUIRE( budget == 0 );
+        REQUIRE( policy == DSL_SURFACE_BUDGET_POLICY_REFUSE );
+        
+        uint size(0);
+        REQUIRE( dsl_pipeline_surface_memory_get(pipelineName.c_str(), &size) == DSL_RESULT_SUCCESS );
+        REQUIRE( size > 0 );
+        
+        WHEN( "The Source's surfaces are reduced" ) 
+        {
+            REQUIRE( dsl_source_decode_surfaces_set(sourceName.c_str(), 8, 0) == DSL_RESULT_SUCCESS );
+
+            THEN( "The projected surface memory is reduced" )
+            {
+                uint numDecodeSurfaces(0), numExtraSurfaces(0);
+                REQUIRE( dsl_source_decode_surfaces_get(sourceName.c_str(), 
+                    &numDecodeSurfaces, &numExtraSurfaces) == DSL_RESULT_SUCCESS );
+                REQUIRE( numDecodeSurfaces == 8 );
+                REQUIRE( numExtraSurfaces == 0 );
+                
+                uint newSize(0);
+                REQUIRE( dsl_pipeline_surface_memory_get(pipelineName.c_str(), &newSize) == DSL_RESULT_SUCCESS );
+                REQUIRE( newSize < size );
+                REQUIRE( dsl_source_decode_surfaces_set(sourceName.c_str(), 0, 0) == DSL_RESULT_SOURCE_SET_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A budget below the projected surface memory is set with the refuse policy" ) 
+        {
+            REQUIRE( dsl_pipeline_surface_budget_set(pipelineName.c_str(), 
+                1, DSL_SURFACE_BUDGET_POLICY_REFUSE) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Pipeline fails to play" )
+            {
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_PIPELINE_FAILED_TO_PLAY );
+                REQUIRE( dsl_pipeline_surface_budget_set(pipelineName.c_str(), 
+                    1, DSL_SURFACE_BUDGET_POLICY_SHRINK+1) == DSL_RESULT_PIPELINE_SURFACE_BUDGET_SET_FAILED );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A budget just below the projected surface memory is set with the shrink policy" ) 
+        {
+            REQUIRE( dsl_pipeline_surface_budget_set(pipelineName.c_str(), 
+                size-1, DSL_SURFACE_BUDGET_POLICY_SHRINK) == DSL_RESULT_SUCCESS );
+
+            THEN( "The Pipeline plays and the Source's surface counts are unchanged" )
+            {
+                REQUIRE( dsl_pipeline_play(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                std::this_thread::sleep_for(TIME_TO_SLEEP_FOR);
+                REQUIRE( dsl_pipeline_stop(pipelineName.c_str()) == DSL_RESULT_SUCCESS );
+                
+                uint numDecodeSurfaces(0), numExtraSurfaces(0);
+                REQUIRE( dsl_source_decode_surfaces_get(sourceName.c_str(), 
+                    &numDecodeSurfaces, &numExtraSurfaces) == DSL_RESULT_SUCCESS );
+                REQUIRE( numDecodeSurfaces == 16 );
+                REQUIRE( numExtraSurfaces == 1 );
+
+                REQUIRE( dsl_pipeline_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
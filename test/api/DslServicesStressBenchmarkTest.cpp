@@ -0,0 +1,148 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "Dsl.h"
+#include "DslApi.h"
+
+#include <thread>
+#include <atomic>
+
+#define TIME_TO_RUN_FOR std::chrono::milliseconds(5000)
+#define NUM_READER_THREADS 4
+#define NUM_WRITER_THREADS 2
+
+/**
+ * @brief Reader thread function, polling the getters of a shared Tiler and
+ * the Services counters until signaled to stop.
+ */
+static void ServicesReader(std::atomic<bool>* pStop, std::atomic<uint64_t>* pOps)
+{
+    std::wstring tilerName(L"shared-tiler");
+    uint width(0), height(0);
+    
+    while (!*pStop)
+    {
+        dsl_tiler_dimensions_get(tilerName.c_str(), &width, &height);
+        dsl_source_num_in_use_get();
+        dsl_component_list_size();
+        dsl_pipeline_list_size();
+        (*pOps) += 4;
+    }
+}
+
+/**
+ * @brief Writer thread function, creating, updating, and deleting
+ * uniquely named Components until signaled to stop.
+ */
+static void ServicesWriter(uint id, std::atomic<bool>* pStop, std::atomic<uint64_t>* pOps)
+{
+    std::wstring tilerName(L"tiler-" + std::to_wstring(id));
+    std::wstring sinkName(L"fake-sink-" + std::to_wstring(id));
+    
+    while (!*pStop)
+    {
+        if (dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS)
+        {
+            (*pOps)++;
+        }
+        if (dsl_tiler_dimensions_set(tilerName.c_str(), 1920, 1080) == DSL_RESULT_SUCCESS)
+        {
+            (*pOps)++;
+        }
+        if (dsl_sink_fake_new(sinkName.c_str()) == DSL_RESULT_SUCCESS)
+        {
+            (*pOps)++;
+        }
+        if (dsl_component_delete(tilerName.c_str()) == DSL_RESULT_SUCCESS)
+        {
+            (*pOps)++;
+        }
+        if (dsl_component_delete(sinkName.c_str()) == DSL_RESULT_SUCCESS)
+        {
+            (*pOps)++;
+        }
+    }
+}
+
+SCENARIO( "Concurrent readers and writers make progress through the Services API", 
+    "[.][benchmark][services]" )
+{
+    GIVEN( "A shared Tiler and a set of reader and writer threads" ) 
+    {
+        std::wstring tilerName(L"shared-tiler");
+        
+        REQUIRE( dsl_tiler_new(tilerName.c_str(), 1280, 720) == DSL_RESULT_SUCCESS );
+
+        std::atomic<bool> stop(false);
+        std::atomic<uint64_t> readerOps[NUM_READER_THREADS];
+        std::atomic<uint64_t> writerOps[NUM_WRITER_THREADS];
+        std::vector<std::thread> threads;
+
+        WHEN( "The readers and writers run concurrently for a fixed time" ) 
+        {
+            for (uint i = 0; i < NUM_READER_THREADS; i++)
+            {
+                readerOps[i] = 0;
+                threads.push_back(std::thread(ServicesReader, &stop, &readerOps[i]));
+            }
+            for (uint i = 0; i < NUM_WRITER_THREADS; i++)
+            {
+                writerOps[i] = 0;
+                threads.push_back(std::thread(ServicesWriter, i, &stop, &writerOps[i]));
+            }
+            std::this_thread::sleep_for(TIME_TO_RUN_FOR);
+            stop = true;
+            
+            for (auto& thread: threads)
+            {
+                thread.join();
+            }
+            
+            THEN( "Every thread completes operations and the throughput is reported" )
+            {
+                double seconds = std::chrono::duration<double>(TIME_TO_RUN_FOR).count();
+                uint64_t totalReaderOps(0), totalWriterOps(0);
+                
+                for (uint i = 0; i < NUM_READER_THREADS; i++)
+                {
+                    REQUIRE( readerOps[i] > 0 );
+                    totalReaderOps += readerOps[i];
+                }
+                for (uint i = 0; i < NUM_WRITER_THREADS; i++)
+                {
+                    REQUIRE( writerOps[i] > 0 );
+                    totalWriterOps += writerOps[i];
+                }
+                std::cout << "Readers: " << NUM_READER_THREADS << " threads, " 
+                    << totalReaderOps/seconds << " ops/sec\n";
+                std::cout << "Writers: " << NUM_WRITER_THREADS << " threads, " 
+                    << totalWriterOps/seconds << " ops/sec\n";
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
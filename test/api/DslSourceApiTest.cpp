@@ -585,3 +585,170 @@ SCENARIO( "Adding an invalid Dewarper to a Decode Source Component fails", "[sou
         }
     }
 }
+
+SCENARIO( "A new Multi Image Source can be created and queried for stats", "[source-api]" )
+{
+    GIVEN( "A location with image files" )
+    {
+        std::wstring sourceName = L"multi-image-source";
+        std::wstring location = L"./Images/*.png";
+
+        REQUIRE( dsl_component_list_size() == 0 );
+
+        WHEN( "A new Multi Image Source is created" ) 
+        {
+            REQUIRE( dsl_source_image_multi_new(sourceName.c_str(), location.c_str(), 
+                DSL_DEFAULT_MULTI_IMAGE_READAHEAD) == DSL_RESULT_SUCCESS );
+
+            THEN( "The stats are initialized correctly" )
+            {
+                uint filesRead(99);
+                double filesPerSecond(99);
+                REQUIRE( dsl_source_image_multi_stats_get(sourceName.c_str(), 
+                    &filesRead, &filesPerSecond) == DSL_RESULT_SUCCESS );
+                REQUIRE( filesRead == 0 );
+                REQUIRE( filesPerSecond == 0 );
+                REQUIRE( dsl_source_is_live(sourceName.c_str()) == false );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+        WHEN( "A new Multi Image Source is created with an invalid location" ) 
+        {
+            std::wstring badLocation = L"./Images/no-such-folder";
+            
+            THEN( "The create call fails" )
+            {
+                REQUIRE( dsl_source_image_multi_new(sourceName.c_str(), badLocation.c_str(), 
+                    DSL_DEFAULT_MULTI_IMAGE_READAHEAD) == DSL_RESULT_SOURCE_FILE_NOT_FOUND );
+                REQUIRE( dsl_component_list_size() == 0 );
+            }
+        }
+    }
+}
+
+static void playlist_file_listener_cb(uint event, 
+    const wchar_t* uri, uint frames, double fps, void* user_data)
+{
+}
+
+SCENARIO( "A URI Source's playlist can be updated", "[source-api]" )
+{
+    GIVEN( "A new URI Source" )
+    {
+        std::wstring sourceName = L"uri-source";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), uri.c_str(), false, 
+            cudadecMemType, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        WHEN( "Files and a file listener are added to the playlist" ) 
+        {
+            REQUIRE( dsl_source_uri_playlist_add(sourceName.c_str(), uri.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_source_uri_playlist_add(sourceName.c_str(), uri.c_str()) == DSL_RESULT_SUCCESS );
+            REQUIRE( dsl_source_uri_playlist_file_listener_add(sourceName.c_str(), 
+                playlist_file_listener_cb, NULL) == DSL_RESULT_SUCCESS );
+
+            THEN( "The playlist size is correct and the playlist can be cleared" )
+            {
+                uint size(0);
+                REQUIRE( dsl_source_uri_playlist_size_get(sourceName.c_str(), &size) == DSL_RESULT_SUCCESS );
+                REQUIRE( size == 2 );
+                REQUIRE( dsl_source_uri_playlist_add(sourceName.c_str(), 
+                    L"./no-such-file.mp4") == DSL_RESULT_SOURCE_FILE_NOT_FOUND );
+                
+                REQUIRE( dsl_source_uri_playlist_clear(sourceName.c_str()) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_uri_playlist_size_get(sourceName.c_str(), &size) == DSL_RESULT_SUCCESS );
+                REQUIRE( size == 0 );
+
+                REQUIRE( dsl_source_uri_playlist_file_listener_add(sourceName.c_str(), 
+                    playlist_file_listener_cb, NULL) == DSL_RESULT_SOURCE_CALLBACK_ADD_FAILED );
+                REQUIRE( dsl_source_uri_playlist_file_listener_remove(sourceName.c_str(), 
+                    playlist_file_listener_cb) == DSL_RESULT_SUCCESS );
+                REQUIRE( dsl_source_uri_playlist_file_listener_remove(sourceName.c_str(), 
+                    playlist_file_listener_cb) == DSL_RESULT_SOURCE_CALLBACK_REMOVE_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "A URI Source can be switched to a new URI", "[source-api]" )
+{
+    GIVEN( "A new URI Source" )
+    {
+        std::wstring sourceName = L"uri-source";
+        std::wstring uri = L"./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        REQUIRE( dsl_source_uri_new(sourceName.c_str(), uri.c_str(), false, 
+            cudadecMemType, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The URI Source is switched while not playing" ) 
+        {
+            REQUIRE( dsl_source_uri_switch(sourceName.c_str(), uri.c_str()) == DSL_RESULT_SUCCESS );
+
+            THEN( "No switch latency is reported and an invalid URI fails" )
+            {
+                uint latency(99);
+                REQUIRE( dsl_source_uri_switch_latency_get(sourceName.c_str(), &latency) == DSL_RESULT_SUCCESS );
+                REQUIRE( latency == 0 );
+                REQUIRE( dsl_source_uri_switch(sourceName.c_str(), 
+                    L"./no-such-file.mp4") == DSL_RESULT_SOURCE_SWITCH_FAILED );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
+
+SCENARIO( "An RTSP Source's RTSP config can be updated", "[source-api]" )
+{
+    GIVEN( "A new RTSP Source" )
+    {
+        std::wstring sourceName = L"rtsp-source";
+        std::wstring uri = L"rtsp://127.0.0.1:8554/test";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        REQUIRE( dsl_source_rtsp_new(sourceName.c_str(), uri.c_str(), DSL_RTP_ALL, 
+            cudadecMemType, intrDecode, dropFrameInterval) == DSL_RESULT_SUCCESS );
+
+        WHEN( "The robust RTSP preset is set" ) 
+        {
+            REQUIRE( dsl_source_decode_rtsp_preset_set(sourceName.c_str(), 
+                DSL_RTSP_PRESET_ROBUST) == DSL_RESULT_SUCCESS );
+
+            THEN( "The robust RTSP config is returned" )
+            {
+                uint latency(0), protocols(0), bufferMode(0), timeout(0);
+                boolean dropOnLatency(true), doRetransmission(false);
+                REQUIRE( dsl_source_decode_rtsp_config_get(sourceName.c_str(), &latency, 
+                    &dropOnLatency, &doRetransmission, &protocols, &bufferMode, 
+                    &timeout) == DSL_RESULT_SUCCESS );
+                REQUIRE( latency == 2000 );
+                REQUIRE( dropOnLatency == false );
+                REQUIRE( doRetransmission == true );
+                REQUIRE( protocols == DSL_RTP_ALL );
+                
+                REQUIRE( dsl_source_decode_rtsp_preset_set(sourceName.c_str(), 
+                    DSL_RTSP_PRESET_ROBUST+1) == DSL_RESULT_SOURCE_SET_FAILED );
+
+                double jitter(0);
+                uint packetsReceived(0), packetsLost(0);
+                REQUIRE( dsl_source_decode_rtsp_stats_get(sourceName.c_str(), &jitter,
+                    &packetsReceived, &packetsLost) == DSL_RESULT_SUCCESS );
+                REQUIRE( packetsReceived == 0 );
+
+                REQUIRE( dsl_component_delete_all() == DSL_RESULT_SUCCESS );
+            }
+        }
+    }
+}
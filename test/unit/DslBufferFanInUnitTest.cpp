@@ -0,0 +1,325 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslBufferFanIn.h"
+
+using namespace DSL;
+
+SCENARIO( "A BufferFanIn completes a buffer once all branches complete", "[BufferFanIn]" )
+{
+    GIVEN( "A new BufferFanIn and a buffer pending on three branches" ) 
+    {
+        BufferFanIn fanIn("fan-in");
+        GstBuffer* pBuffer = gst_buffer_new();
+        
+        fanIn.Expect(pBuffer, 3);
+
+        WHEN( "All branches complete the buffer" )
+        {
+            fanIn.Complete(pBuffer);
+            fanIn.Complete(pBuffer);
+            fanIn.Complete(pBuffer);
+            
+            THEN( "The wait returns without blocking" )
+            {
+                REQUIRE( fanIn.Wait(pBuffer) == true );
+            }
+        }
+        WHEN( "The last branch completes the buffer on another thread" )
+        {
+            fanIn.Complete(pBuffer);
+            fanIn.Complete(pBuffer);
+            
+            std::thread branch([&fanIn, pBuffer]()
+            {
+                g_usleep(10000);
+                fanIn.Complete(pBuffer);
+            });
+            
+            THEN( "The waiting thread is signaled" )
+            {
+                REQUIRE( fanIn.Wait(pBuffer) == true );
+                branch.join();
+            }
+        }
+        WHEN( "The last branch completes the buffer after the warning interval" )
+        {
+            fanIn.Complete(pBuffer);
+            fanIn.Complete(pBuffer);
+            
+            std::thread branch([&fanIn, pBuffer]()
+            {
+                g_usleep((DSL_FAN_IN_MAX_WAIT_MS + 100) * 1000);
+                fanIn.Complete(pBuffer);
+            });
+            
+            THEN( "The waiting thread holds the buffer until completion" )
+            {
+                REQUIRE( fanIn.Wait(pBuffer) == true );
+                branch.join();
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+SCENARIO( "A BufferFanIn unblocks a waiting thread on EOS and Flush", "[BufferFanIn]" )
+{
+    GIVEN( "A new BufferFanIn and a buffer pending on two branches" ) 
+    {
+        BufferFanIn fanIn("fan-in");
+        GstBuffer* pBuffer = gst_buffer_new();
+        
+        fanIn.Expect(pBuffer, 2);
+        fanIn.Complete(pBuffer);
+
+        WHEN( "The BufferFanIn is stopped while waiting" )
+        {
+            std::thread eos([&fanIn]()
+            {
+                g_usleep(10000);
+                fanIn.SetStopped();
+            });
+            
+            THEN( "The wait returns incomplete" )
+            {
+                REQUIRE( fanIn.Wait(pBuffer) == false );
+                eos.join();
+            }
+        }
+        WHEN( "The BufferFanIn is flushed while waiting" )
+        {
+            std::thread flush([&fanIn]()
+            {
+                g_usleep(10000);
+                fanIn.SetFlushing(true);
+            });
+            
+            THEN( "The wait returns incomplete until flush-stop" )
+            {
+                REQUIRE( fanIn.Wait(pBuffer) == false );
+                flush.join();
+                
+                fanIn.SetFlushing(false);
+                fanIn.Expect(pBuffer, 1);
+                fanIn.Complete(pBuffer);
+                REQUIRE( fanIn.Wait(pBuffer) == true );
+            }
+        }
+        gst_buffer_unref(pBuffer);
+    }
+}
+
+/**
+ * @brief Shared state for the SGIE fan-in benchmark. Stand-in branches of
+ * queue ! identity ! fakesink replace the Secondary GIEs.
+ */
+struct FanInBenchmark
+{
+    BufferFanIn* pFanIn;
+    uint numBranches;
+    bool polling;
+    GMutex mutex;
+    GCond cond;
+    std::map<GstBuffer*, gint64> entryTimes;
+    gint64 totalLatency;
+    uint numBatches;
+};
+
+static GstPadProbeReturn FanInBenchmarkTeeCB(GstPad* pPad, 
+    GstPadProbeInfo* pInfo, gpointer pData)
+{
+    FanInBenchmark* pBenchmark = static_cast<FanInBenchmark*>(pData);
+    GstBuffer* pBuffer = GST_BUFFER(pInfo->data);
+    
+    LOCK_MUTEX_FOR_CURRENT_SCOPE(&pBenchmark->mutex);
+    pBenchmark->entryTimes[pBuffer] = g_get_monotonic_time();
+    if (!pBenchmark->polling)
+    {
+        pBenchmark->pFanIn->Expect(pBuffer, pBenchmark->numBranches);
+    }
+    return GST_PAD_PROBE_OK;
+}
+
+static GstPadProbeReturn FanInBenchmarkBranchCB(GstPad* pPad, 
+    GstPadProbeInfo* pInfo, gpointer pData)
+{
+    FanInBenchmark* pBenchmark = static_cast<FanInBenchmark*>(pData);
+    if (!pBenchmark->polling)
+    {
+        pBenchmark->pFanIn->Complete(GST_BUFFER(pInfo->data));
+    }
+    return GST_PAD_PROBE_OK;
+}
+
+static GstPadProbeReturn FanInBenchmarkWaitCB(GstPad* pPad, 
+    GstPadProbeInfo* pInfo, gpointer pData)
+{
+    FanInBenchmark* pBenchmark = static_cast<FanInBenchmark*>(pData);
+    GstBuffer* pBuffer = GST_BUFFER(pInfo->data);
+    
+    if (pBenchmark->polling)
+    {
+        // the previous refcount polling implementation, for comparison
+        LOCK_MUTEX_FOR_CURRENT_SCOPE(&pBenchmark->mutex);
+        while (GST_OBJECT_REFCOUNT_VALUE(pBuffer) > 1)
+        {
+            gint64 endtime(g_get_monotonic_time() + G_TIME_SPAN_SECOND / 1000);
+            g_cond_wait_until(&pBenchmark->cond, &pBenchmark->mutex, endtime);
+        }
+    }
+    else
+    {
+        pBenchmark->pFanIn->Wait(pBuffer);
+    }
+    return GST_PAD_PROBE_OK;
+}
+
+static GstPadProbeReturn FanInBenchmarkExitCB(GstPad* pPad, 
+    GstPadProbeInfo* pInfo, gpointer pData)
+{
+    FanInBenchmark* pBenchmark = static_cast<FanInBenchmark*>(pData);
+    GstBuffer* pBuffer = GST_BUFFER(pInfo->data);
+    
+    LOCK_MUTEX_FOR_CURRENT_SCOPE(&pBenchmark->mutex);
+    auto entry = pBenchmark->entryTimes.find(pBuffer);
+    if (entry != pBenchmark->entryTimes.end())
+    {
+        pBenchmark->totalLatency += g_get_monotonic_time() - entry->second;
+        pBenchmark->numBatches++;
+        pBenchmark->entryTimes.erase(entry);
+    }
+    return GST_PAD_PROBE_OK;
+}
+
+static void AddFanInBenchmarkProbe(GstElement* pBin, const char* elementName, 
+    const char* padName, GstPadProbeCallback callback, FanInBenchmark* pBenchmark)
+{
+    GstElement* pElement = gst_bin_get_by_name(GST_BIN(pBin), elementName);
+    GstPad* pPad = gst_element_get_static_pad(pElement, padName);
+    gst_pad_add_probe(pPad, GST_PAD_PROBE_TYPE_BUFFER, callback, pBenchmark, NULL);
+    gst_object_unref(pPad);
+    gst_object_unref(pElement);
+}
+
+/**
+ * @brief Runs the stand-in pipeline to EOS and returns the mean latency,
+ * in microseconds, from the Tee to the output of the shared-buffer Queue.
+ */
+static double RunFanInBenchmark(uint numBranches, bool polling)
+{
+    std::ostringstream launch;
+    launch << "videotestsrc num-buffers=300 ! video/x-raw,width=320,height=240 ! "
+        << "tee name=tee tee. ! queue name=queue ! fakesink name=out sync=false ";
+    for (uint i = 0; i < numBranches; i++)
+    {
+        launch << "tee. ! queue ! identity sleep-time=" << 500 * (i + 1) 
+            << " ! fakesink name=branch" << i 
+            << " sync=false async=false enable-last-sample=false ";
+    }
+    GstElement* pPipeline = gst_parse_launch(launch.str().c_str(), NULL);
+    
+    BufferFanIn fanIn("benchmark");
+    FanInBenchmark benchmark{&fanIn, numBranches, polling};
+    g_mutex_init(&benchmark.mutex);
+    g_cond_init(&benchmark.cond);
+    
+    AddFanInBenchmarkProbe(pPipeline, "tee", "sink", FanInBenchmarkTeeCB, &benchmark);
+    AddFanInBenchmarkProbe(pPipeline, "queue", "src", FanInBenchmarkWaitCB, &benchmark);
+    AddFanInBenchmarkProbe(pPipeline, "out", "sink", FanInBenchmarkExitCB, &benchmark);
+    for (uint i = 0; i < numBranches; i++)
+    {
+        std::string branchName = "branch" + std::to_string(i);
+        AddFanInBenchmarkProbe(pPipeline, branchName.c_str(), "sink", 
+            FanInBenchmarkBranchCB, &benchmark);
+    }
+    
+    gst_element_set_state(pPipeline, GST_STATE_PLAYING);
+    GstBus* pBus = gst_element_get_bus(pPipeline);
+    GstMessage* pMessage = gst_bus_timed_pop_filtered(pBus, 30 * GST_SECOND, 
+        (GstMessageType)(GST_MESSAGE_EOS | GST_MESSAGE_ERROR));
+    if (pMessage)
+    {
+        gst_message_unref(pMessage);
+    }
+    gst_object_unref(pBus);
+    gst_element_set_state(pPipeline, GST_STATE_NULL);
+    gst_object_unref(pPipeline);
+    
+    g_cond_clear(&benchmark.cond);
+    g_mutex_clear(&benchmark.mutex);
+    
+    return benchmark.numBatches ? (double)benchmark.totalLatency / benchmark.numBatches : 0;
+}
+
+SCENARIO( "Per-batch SGIE fan-in latency is benchmarked with 1, 3 and 6 branches", 
+    "[.][benchmark][BufferFanIn]" )
+{
+    GIVEN( "Stand-in SGIE branches of increasing processing time" ) 
+    {
+        WHEN( "The pipeline is run with 1 branch" )
+        {
+            double signaledLatency = RunFanInBenchmark(1, false);
+            double pollingLatency = RunFanInBenchmark(1, true);
+            
+            std::cout << "SGIE fan-in, 1 branch: signaled = " << signaledLatency 
+                << "us, polling = " << pollingLatency << "us per batch" << std::endl;
+            
+            THEN( "Every batch is measured" )
+            {
+                REQUIRE( signaledLatency > 0 );
+                REQUIRE( pollingLatency > 0 );
+            }
+        }
+        WHEN( "The pipeline is run with 3 branches" )
+        {
+            double signaledLatency = RunFanInBenchmark(3, false);
+            double pollingLatency = RunFanInBenchmark(3, true);
+            
+            std::cout << "SGIE fan-in, 3 branches: signaled = " << signaledLatency 
+                << "us, polling = " << pollingLatency << "us per batch" << std::endl;
+            
+            THEN( "Every batch is measured" )
+            {
+                REQUIRE( signaledLatency > 0 );
+                REQUIRE( pollingLatency > 0 );
+            }
+        }
+        WHEN( "The pipeline is run with 6 branches" )
+        {
+            double signaledLatency = RunFanInBenchmark(6, false);
+            double pollingLatency = RunFanInBenchmark(6, true);
+            
+            std::cout << "SGIE fan-in, 6 branches: signaled = " << signaledLatency 
+                << "us, polling = " << pollingLatency << "us per batch" << std::endl;
+            
+            THEN( "Every batch is measured" )
+            {
+                REQUIRE( signaledLatency > 0 );
+                REQUIRE( pollingLatency > 0 );
+            }
+        }
+    }
+}
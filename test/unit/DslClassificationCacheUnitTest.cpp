@@ -0,0 +1,142 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslClassificationCache.h"
+
+using namespace DSL;
+
+static std::vector<CachedLabel> NewLabels(gint componentId, guint classId, gfloat probability)
+{
+    CachedLabel label{componentId, 0, 12, classId, probability, "blue"};
+    return std::vector<CachedLabel>{label};
+}
+
+SCENARIO( "A ClassificationCache freezes an object after N confident classifications", 
+    "[ClassificationCache]" )
+{
+    GIVEN( "A new ClassificationCache with one classifier" ) 
+    {
+        DSL_CLASSIFICATION_CACHE_PTR pCache = DSL_CLASSIFICATION_CACHE_NEW("pipeline");
+        REQUIRE( pCache->SetSettings(3, 0.8, 1000) == true );
+        pCache->SetNumClassifiers(1);
+        
+        std::vector<CachedLabel> labels;
+        
+        WHEN( "An object is classified consistently three times" )
+        {
+            for (uint i = 0; i < 3; i++)
+            {
+                REQUIRE( pCache->Lookup(0, 1, i*1000) == false );
+                pCache->Observe(0, 1, NewLabels(2, 4, 0.9), i*1000);
+            }
+            
+            THEN( "The object is frozen with its labels" )
+            {
+                REQUIRE( pCache->Lookup(0, 1, 4000) == true );
+                REQUIRE( pCache->GetLabels(0, 1, labels) == true );
+                REQUIRE( labels.size() == 1 );
+                REQUIRE( labels[0].componentId == 2 );
+                REQUIRE( labels[0].classId == 4 );
+                REQUIRE( labels[0].label == "blue" );
+                
+                // The same object-id from another source is not frozen
+                REQUIRE( pCache->Lookup(1, 1, 4000) == false );
+                
+                uint64_t hits(0), misses(0);
+                uint entries(0);
+                pCache->GetStats(&hits, &misses, &entries);
+                REQUIRE( hits == 1 );
+                REQUIRE( misses == 4 );
+                REQUIRE( entries == 1 );
+            }
+        }
+        WHEN( "An object's class changes or is classified with low confidence" )
+        {
+            pCache->Observe(0, 1, NewLabels(2, 4, 0.9), 0);
+            pCache->Observe(0, 1, NewLabels(2, 5, 0.9), 1000);
+            pCache->Observe(0, 1, NewLabels(2, 5, 0.5), 2000);
+            pCache->Observe(0, 1, NewLabels(2, 5, 0.9), 3000);
+            pCache->Observe(0, 1, NewLabels(2, 5, 0.9), 4000);
+            
+            THEN( "The object is not frozen" )
+            {
+                REQUIRE( pCache->Lookup(0, 1, 5000) == false );
+                REQUIRE( pCache->GetLabels(0, 1, labels) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ClassificationCache requires all classifiers before freezing", 
+    "[ClassificationCache]" )
+{
+    GIVEN( "A new ClassificationCache with two classifiers" ) 
+    {
+        DSL_CLASSIFICATION_CACHE_PTR pCache = DSL_CLASSIFICATION_CACHE_NEW("pipeline");
+        REQUIRE( pCache->SetSettings(1, 0.8, 1000) == true );
+        pCache->SetNumClassifiers(2);
+        
+        WHEN( "Only one classifier labels the object" )
+        {
+            pCache->Observe(0, 1, NewLabels(2, 4, 0.9), 0);
+            
+            THEN( "The object is not frozen until the second classifier labels it" )
+            {
+                REQUIRE( pCache->Lookup(0, 1, 0) == false );
+                pCache->Observe(0, 1, NewLabels(3, 1, 0.9), 0);
+                REQUIRE( pCache->Lookup(0, 1, 0) == true );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ClassificationCache evicts objects not seen within the TTL", 
+    "[ClassificationCache]" )
+{
+    GIVEN( "A new ClassificationCache with a frozen object" ) 
+    {
+        DSL_CLASSIFICATION_CACHE_PTR pCache = DSL_CLASSIFICATION_CACHE_NEW("pipeline");
+        REQUIRE( pCache->SetSettings(1, 0.8, 100) == true );
+        pCache->SetNumClassifiers(1);
+        pCache->Observe(0, 1, NewLabels(2, 4, 0.9), 0);
+        pCache->Observe(0, 2, NewLabels(2, 4, 0.9), 0);
+        
+        WHEN( "Only the first object is seen again before the TTL expires" )
+        {
+            REQUIRE( pCache->Lookup(0, 1, 90*G_TIME_SPAN_MILLISECOND) == true );
+            pCache->Evict(150*G_TIME_SPAN_MILLISECOND);
+            
+            THEN( "The second object is evicted as a lost track" )
+            {
+                uint64_t hits(0), misses(0);
+                uint entries(0);
+                pCache->GetStats(&hits, &misses, &entries);
+                REQUIRE( entries == 1 );
+                REQUIRE( pCache->Lookup(0, 1, 150*G_TIME_SPAN_MILLISECOND) == true );
+                REQUIRE( pCache->Lookup(0, 2, 150*G_TIME_SPAN_MILLISECOND) == false );
+            }
+        }
+    }
+}
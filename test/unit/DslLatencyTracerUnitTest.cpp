@@ -0,0 +1,88 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslLatencyTracer.h"
+
+using namespace DSL;
+
+SCENARIO( "A LatencyTracer measures buffers by PTS from entry to exit", "[LatencyTracer]" )
+{
+    GIVEN( "A new LatencyTracer with an entry and exit pad" ) 
+    {
+        std::string tracerName("test-tracer");
+        
+        GstPad* pSinkPad = gst_pad_new("sink", GST_PAD_SINK);
+        GstPad* pSrcPad = gst_pad_new("src", GST_PAD_SRC);
+
+        DSL_LATENCY_TRACER_PTR pTracer = DSL_LATENCY_TRACER_NEW(tracerName.c_str());
+        pTracer->AddEntryPad(pSinkPad, DSL_LATENCY_BATCHED);
+        pTracer->AddExitPad(pSrcPad);
+
+        double p50(99), p95(99), p99(99);
+        uint count(99);
+        pTracer->GetPercentiles(&p50, &p95, &p99, &count);
+        REQUIRE( count == 0 );
+        REQUIRE( p50 == 0 );
+        REQUIRE( p99 == 0 );
+        
+        WHEN( "Buffers enter and exit the traced component" )
+        {
+            for (uint i = 0; i < 10; i++)
+            {
+                GstBuffer* pBuffer = gst_buffer_new();
+                GST_BUFFER_PTS(pBuffer) = i * GST_MSECOND * 33;
+                pTracer->HandleEntry(pSinkPad, pBuffer);
+                pTracer->HandleExit(pBuffer);
+                gst_buffer_unref(pBuffer);
+            }
+            
+            THEN( "The latency of each buffer is measured" )
+            {
+                pTracer->GetPercentiles(&p50, &p95, &p99, &count);
+                REQUIRE( pTracer->GetName() == tracerName );
+                REQUIRE( count == 10 );
+                REQUIRE( p50 > 0 );
+                REQUIRE( p50 <= p95 );
+                REQUIRE( p95 <= p99 );
+            }
+        }
+        WHEN( "Buffers exit without a matching entry" )
+        {
+            GstBuffer* pBuffer = gst_buffer_new();
+            GST_BUFFER_PTS(pBuffer) = GST_MSECOND;
+            pTracer->HandleExit(pBuffer);
+            gst_buffer_unref(pBuffer);
+            
+            THEN( "No latency is measured" )
+            {
+                pTracer->GetPercentiles(&p50, &p95, &p99, &count);
+                REQUIRE( count == 0 );
+            }
+        }
+        pTracer = nullptr;
+        gst_object_unref(pSinkPad);
+        gst_object_unref(pSrcPad);
+    }
+}
@@ -298,3 +298,34 @@ SCENARIO( "All GST Resources are released on MultiSinksBintr destruction", "[Mul
         }
     }
 }
+
+SCENARIO( "A Sink can be removed from a linked MultiSinksBintr with its Tee elided", "[MultiSinksBintr]" )
+{
+    GIVEN( "A linked MultiSinksBintr with a single Sink and Tee elision enabled" ) 
+    {
+        std::string sinkName = "fake-sink";
+        std::string multiSinksBintrName = "multi-sinks";
+
+        DSL_MULTI_SINKS_PTR pMultiSinksBintr = DSL_MULTI_SINKS_NEW(multiSinksBintrName.c_str());
+        DSL_FAKE_SINK_PTR pSinkBintr = DSL_FAKE_SINK_NEW(sinkName.c_str());
+
+        pMultiSinksBintr->SetTeeElisionEnabled(true);
+        REQUIRE( pMultiSinksBintr->AddChild(std::dynamic_pointer_cast<Bintr>(pSinkBintr)) == true );
+        REQUIRE( pMultiSinksBintr->LinkAll() == true );
+        REQUIRE( pMultiSinksBintr->IsTeeElided() == true );
+        REQUIRE( pSinkBintr->IsLinkedToSource() == false );
+
+        WHEN( "The Sink is removed while linked" )
+        {
+            REQUIRE( pMultiSinksBintr->RemoveChild(std::dynamic_pointer_cast<Bintr>(pSinkBintr)) == true );
+
+            THEN( "The Tee is restored and the Sink is unlinked and removed" )
+            {
+                REQUIRE( pMultiSinksBintr->IsTeeElided() == false );
+                REQUIRE( pMultiSinksBintr->GetNumChildren() == 0 );
+                REQUIRE( pSinkBintr->IsInUse() == false );
+                REQUIRE( pSinkBintr->IsLinkedToSource() == false );
+            }
+        }
+    }
+}
@@ -0,0 +1,118 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslPerfMeter.h"
+
+using namespace DSL;
+
+SCENARIO( "SourcePerfCounters count unique frames and drops", "[PerfMeter]" )
+{
+    GIVEN( "New SourcePerfCounters" ) 
+    {
+        DSL_SOURCE_PERF_COUNTERS_PTR pCounters = DSL_SOURCE_PERF_COUNTERS_NEW();
+        
+        REQUIRE( pCounters->m_frameCount.load() == 0 );
+        REQUIRE( pCounters->m_dropCount.load() == 0 );
+        REQUIRE( pCounters->m_lastFrameNum.load() == -1 );
+        
+        WHEN( "Frames are measured at two sinks with one missing frame" )
+        {
+            for (gint frameNum = 0; frameNum < 10; frameNum++)
+            {
+                if (frameNum == 5)
+                {
+                    continue;
+                }
+                GstClockTime pts = frameNum * GST_MSECOND * 33;
+                pCounters->Stamp(pts);
+                pCounters->Measure(pts, frameNum);
+                pCounters->Measure(pts, frameNum);
+            }
+            
+            THEN( "Each frame is counted once and the missing frame is dropped" )
+            {
+                REQUIRE( pCounters->m_frameCount.load() == 9 );
+                REQUIRE( pCounters->m_dropCount.load() == 1 );
+                REQUIRE( pCounters->m_lastFrameNum.load() == 9 );
+                
+                // latency is measured at both sinks
+                REQUIRE( pCounters->m_latencyCount.load() == 18 );
+            }
+        }
+        WHEN( "The histogram is taken after each interval" )
+        {
+            for (gint frameNum = 0; frameNum < 10; frameNum++)
+            {
+                GstClockTime pts = frameNum * GST_MSECOND * 33;
+                pCounters->Stamp(pts);
+                pCounters->Measure(pts, frameNum);
+            }
+            uint histogram[DSL_LATENCY_NUM_BUCKETS];
+            REQUIRE( pCounters->TakeHistogram(histogram) == 10 );
+            
+            THEN( "Each interval only holds the latencies measured within it" )
+            {
+                REQUIRE( pCounters->TakeHistogram(histogram) == 0 );
+                
+                GstClockTime pts = 10 * GST_MSECOND * 33;
+                pCounters->Stamp(pts);
+                pCounters->Measure(pts, 10);
+                REQUIRE( pCounters->TakeHistogram(histogram) == 1 );
+                REQUIRE( pCounters->m_latencyCount.load() == 11 );
+            }
+        }
+        WHEN( "Frames are measured without being stamped" )
+        {
+            pCounters->Measure(GST_MSECOND, 0);
+            
+            THEN( "The frame is counted without a latency" )
+            {
+                REQUIRE( pCounters->m_frameCount.load() == 1 );
+                REQUIRE( pCounters->m_latencyCount.load() == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A PerfMeter with no sources reports no performance", "[PerfMeter]" )
+{
+    GIVEN( "A new PerfMeter" ) 
+    {
+        DSL_PERF_METER_PTR pPerfMeter = DSL_PERF_METER_NEW("test-pipeline");
+        
+        WHEN( "The PerfMeter is updated" )
+        {
+            pPerfMeter->Update();
+            
+            THEN( "No source-ids or reports are available" )
+            {
+                double fps(0), p50(0), p95(0), p99(0);
+                uint drops(0);
+                REQUIRE( pPerfMeter->GetSourceIds().size() == 0 );
+                REQUIRE( pPerfMeter->GetReport(0, &fps, &p50, &p95, &p99, &drops) == false );
+            }
+        }
+    }
+}
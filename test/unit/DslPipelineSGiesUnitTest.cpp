@@ -442,3 +442,77 @@ SCENARIO( "A PipelineSGiesBintr with several SecondaryGieBintrs can UnlinkAll",
         }
     }
 }
+
+SCENARIO( "A PipelineSGiesBintr with several SecondaryGieBintrs can LinkAll in series", "[PipelineSGiesBintr]" )
+{
+    GIVEN( "A new PipelineSGiesBintr in serial link mode with three SecondaryGieBintrs" ) 
+    {
+        std::string pipelineSGiesName = "pipeline-sgies";
+
+        std::string primaryGieName = "primary-gie";
+        std::string pgieInferConfigFile = "./test/configs/config_infer_primary_nano.txt";
+        std::string pgieModelEngineFile = "./test/models/Primary_Detector_Nano/resnet10.caffemodel";
+
+        std::string secondaryGieName1 = "secondary-gie-1";
+        std::string secondaryGieName2 = "secondary-gie-2";
+        std::string secondaryGieName3 = "secondary-gie-3";
+        std::string inferConfigFile = "./test/configs/config_infer_secondary_carcolor.txt";
+        std::string modelEngineFile = "./test/models/Secondary_CarColor/resnet18.caffemodel";
+        uint interval(0);
+
+        DSL_PRIMARY_GIE_PTR pPrimaryGieBintr = 
+            DSL_PRIMARY_GIE_NEW(primaryGieName.c_str(), pgieInferConfigFile.c_str(), 
+            pgieModelEngineFile.c_str(), interval);
+
+        DSL_SECONDARY_GIE_PTR pSecondaryGieBintr1 = 
+            DSL_SECONDARY_GIE_NEW(secondaryGieName1.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), primaryGieName.c_str(), interval);
+
+        DSL_SECONDARY_GIE_PTR pSecondaryGieBintr2 = 
+            DSL_SECONDARY_GIE_NEW(secondaryGieName2.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), primaryGieName.c_str(), interval);
+
+        DSL_SECONDARY_GIE_PTR pSecondaryGieBintr3 = 
+            DSL_SECONDARY_GIE_NEW(secondaryGieName3.c_str(), inferConfigFile.c_str(), 
+            modelEngineFile.c_str(), primaryGieName.c_str(), interval);
+
+        DSL_PIPELINE_SGIES_PTR pPipelineSGiesBintr = 
+            DSL_PIPELINE_SGIES_NEW(pipelineSGiesName.c_str());
+
+        REQUIRE( pPipelineSGiesBintr->GetLinkMode() == DSL_SGIE_LINK_MODE_PARALLEL );
+        REQUIRE( pPipelineSGiesBintr->SetLinkMode(DSL_SGIE_LINK_MODE_SERIAL+1) == false );
+        REQUIRE( pPipelineSGiesBintr->SetLinkMode(DSL_SGIE_LINK_MODE_SERIAL) == true );
+
+        pPipelineSGiesBintr->SetInferOnGieId(pPrimaryGieBintr->GetUniqueId());
+        pPipelineSGiesBintr->SetBatchSize(3);
+
+        REQUIRE( pPipelineSGiesBintr->AddChild(pSecondaryGieBintr1) == true );
+        REQUIRE( pPipelineSGiesBintr->AddChild(pSecondaryGieBintr2) == true );
+        REQUIRE( pPipelineSGiesBintr->AddChild(pSecondaryGieBintr3) == true );
+
+        WHEN( "The pPipelineSGiesBintr is Linked" )
+        {
+            REQUIRE( pPipelineSGiesBintr->LinkAll() == true );
+            REQUIRE( pPipelineSGiesBintr->IsLinked() == true );
+                
+            THEN( "The SGIEs are chained and the link mode can't be changed until Unlinked" )
+            {
+                REQUIRE( pPipelineSGiesBintr->SetLinkMode(DSL_SGIE_LINK_MODE_PARALLEL) == false );
+                
+                // Only the first SGIE is linked to the Tee, with no Infer Engine left unlinked
+                REQUIRE( pSecondaryGieBintr1->GetQueueElementr()->IsLinkedToSource() == true );
+                REQUIRE( pSecondaryGieBintr2->GetQueueElementr()->IsLinkedToSource() == false );
+                REQUIRE( pSecondaryGieBintr3->GetQueueElementr()->IsLinkedToSource() == false );
+                REQUIRE( pSecondaryGieBintr1->GetInferEngineElementr()->IsLinkedToSink() == true );
+                REQUIRE( pSecondaryGieBintr2->GetInferEngineElementr()->IsLinkedToSink() == true );
+                REQUIRE( pSecondaryGieBintr3->GetInferEngineElementr()->IsLinkedToSink() == true );
+                
+                pPipelineSGiesBintr->UnlinkAll();
+                REQUIRE( pPipelineSGiesBintr->IsLinked() == false );
+                REQUIRE( pSecondaryGieBintr1->IsLinked() == false );
+                REQUIRE( pSecondaryGieBintr3->GetInferEngineElementr()->IsLinkedToSink() == false );
+                REQUIRE( pPipelineSGiesBintr->SetLinkMode(DSL_SGIE_LINK_MODE_PARALLEL) == true );
+            }
+        }
+    }
+}
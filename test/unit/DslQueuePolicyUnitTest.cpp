@@ -0,0 +1,113 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslQueuePolicy.h"
+
+using namespace DSL;
+
+SCENARIO( "A QueuePolicy applies its settings to a Queue once set", "[QueuePolicy]" )
+{
+    GIVEN( "A QueuePolicy attached to a new Queue" )
+    {
+        GstElement* pQueue = gst_element_factory_make("queue", "test-queue");
+        g_object_set(pQueue, "max-size-buffers", 7, NULL);
+
+        DSL_QUEUE_POLICY_PTR pQueuePolicy = DSL_QUEUE_POLICY_NEW("test-component");
+        pQueuePolicy->Attach(pQueue);
+
+        guint maxSizeBuffers(0), leaky(99);
+        guint64 maxSizeTime(0);
+
+        REQUIRE( pQueuePolicy->IsSet() == false );
+        g_object_get(pQueue, "max-size-buffers", &maxSizeBuffers, NULL);
+        REQUIRE( maxSizeBuffers == 7 );
+
+        WHEN( "The policy's settings are set" )
+        {
+            REQUIRE( pQueuePolicy->SetSettings(3, 250, DSL_QUEUE_LEAKY_DOWNSTREAM, 0) == true );
+
+            THEN( "The settings are applied to the Queue" )
+            {
+                REQUIRE( pQueuePolicy->IsSet() == true );
+                g_object_get(pQueue, "max-size-buffers", &maxSizeBuffers,
+                    "max-size-time", &maxSizeTime, "leaky", &leaky, NULL);
+                REQUIRE( maxSizeBuffers == 3 );
+                REQUIRE( maxSizeTime == 250 * GST_MSECOND );
+                REQUIRE( leaky == DSL_QUEUE_LEAKY_DOWNSTREAM );
+                REQUIRE( pQueuePolicy->GetDropped() == 0 );
+
+                pQueuePolicy->Detach();
+                gst_object_unref(pQueue);
+            }
+        }
+        WHEN( "An invalid leaky value is set" )
+        {
+            THEN( "The settings are refused" )
+            {
+                REQUIRE( pQueuePolicy->SetSettings(3, 250, DSL_QUEUE_LEAKY_DOWNSTREAM+1, 0) == false );
+                REQUIRE( pQueuePolicy->IsSet() == false );
+
+                pQueuePolicy->Detach();
+                gst_object_unref(pQueue);
+            }
+        }
+    }
+}
+
+SCENARIO( "A QueuePolicy finds the Queue behind a Bin's sink ghost pad", "[QueuePolicy]" )
+{
+    GIVEN( "A Bin with a Queue and a Bin without" )
+    {
+        GstElement* pQueueBin = gst_bin_new("queue-bin");
+        GstElement* pQueue = gst_element_factory_make("queue", "bin-queue");
+        gst_bin_add(GST_BIN(pQueueBin), pQueue);
+        GstPad* pSinkPad = gst_element_get_static_pad(pQueue, "sink");
+        gst_element_add_pad(pQueueBin, gst_ghost_pad_new("sink", pSinkPad));
+        gst_object_unref(pSinkPad);
+
+        GstElement* pOtherBin = gst_bin_new("other-bin");
+        GstElement* pIdentity = gst_element_factory_make("identity", "bin-identity");
+        gst_bin_add(GST_BIN(pOtherBin), pIdentity);
+        pSinkPad = gst_element_get_static_pad(pIdentity, "sink");
+        gst_element_add_pad(pOtherBin, gst_ghost_pad_new("sink", pSinkPad));
+        gst_object_unref(pSinkPad);
+
+        WHEN( "Each Bin is searched for a Queue" )
+        {
+            GstElement* pFoundQueue = QueuePolicy::FindQueue(pQueueBin);
+            GstElement* pNotFound = QueuePolicy::FindQueue(pOtherBin);
+
+            THEN( "Only the Bin's Queue is found" )
+            {
+                REQUIRE( pFoundQueue == pQueue );
+                REQUIRE( pNotFound == NULL );
+
+                gst_object_unref(pFoundQueue);
+                gst_object_unref(pQueueBin);
+                gst_object_unref(pOtherBin);
+            }
+        }
+    }
+}
@@ -671,3 +671,210 @@ SCENARIO( "A UriSourceBintr can Set and Get its URI",  "[UriSourceBintr]" )
         }
     }
 }
+
+SCENARIO( "A new MultiImageSourceBintr is created correctly",  "[MultiImageSourceBintr]" )
+{
+    GIVEN( "A glob of image files for a new MultiImageSourceBintr" ) 
+    {
+        std::string sourceName = "test-multi-image-source";
+        std::string location = "./Images/*.png";
+        uint readahead(DSL_DEFAULT_MULTI_IMAGE_READAHEAD);
+
+        WHEN( "The MultiImageSourceBintr is created " )
+        {
+            DSL_MULTI_IMAGE_SOURCE_PTR pSourceBintr = DSL_MULTI_IMAGE_SOURCE_NEW(
+                sourceName.c_str(), location.c_str(), readahead);
+
+            THEN( "All memeber variables are initialized correctly" )
+            {
+                REQUIRE( pSourceBintr->GetGstObject() != NULL );
+                REQUIRE( pSourceBintr->IsInUse() == false );
+                REQUIRE( pSourceBintr->IsLive() == false );
+                
+                uint filesRead(99);
+                double filesPerSecond(99);
+                pSourceBintr->GetStats(&filesRead, &filesPerSecond);
+                REQUIRE( filesRead == 0 );
+                REQUIRE( filesPerSecond == 0 );
+            }
+        }
+    }
+}
+
+SCENARIO( "A MultiImageSourceBintr can LinkAll and UnlinkAll child Elementrs correctly",  "[MultiImageSourceBintr]" )
+{
+    GIVEN( "A new MultiImageSourceBintr in memory" ) 
+    {
+        std::string sourceName = "test-multi-image-source";
+        std::string location = "./Images";
+        uint readahead(DSL_DEFAULT_MULTI_IMAGE_READAHEAD);
+
+        DSL_MULTI_IMAGE_SOURCE_PTR pSourceBintr = DSL_MULTI_IMAGE_SOURCE_NEW(
+            sourceName.c_str(), location.c_str(), readahead);
+
+        WHEN( "The MultiImageSourceBintr is called to LinkAll" )
+        {
+            REQUIRE( pSourceBintr->LinkAll() == true );
+            REQUIRE( pSourceBintr->IsLinked() == true );
+
+            THEN( "The MultiImageSourceBintr can UnlinkAll" )
+            {
+                pSourceBintr->UnlinkAll();
+                REQUIRE( pSourceBintr->IsLinked() == false );
+            }
+        }
+    }
+}
+
+static void playlist_file_listener_cb(uint event, 
+    const wchar_t* uri, uint frames, double fps, void* user_data)
+{
+    std::cout << "Playlist file event " << event << "\n";
+}
+
+SCENARIO( "A UriSourceBintr can add and clear playlist URIs",  "[UriSourceBintr]" )
+{
+    GIVEN( "A new UriSourceBintr in memory" ) 
+    {
+        std::string sourceName = "test-uri-source";
+        std::string uri = "./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        DSL_URI_SOURCE_PTR pSourceBintr = DSL_URI_SOURCE_NEW(
+            sourceName.c_str(), uri.c_str(), false, cudadecMemType, intrDecode, dropFrameInterval);
+
+        REQUIRE( pSourceBintr->GetPlaylistSize() == 0 );
+
+        WHEN( "Two file URIs are added to the playlist" )
+        {
+            REQUIRE( pSourceBintr->AddPlaylistUri(uri.c_str()) == true );
+            REQUIRE( pSourceBintr->AddPlaylistUri(uri.c_str()) == true );
+            
+            THEN( "The playlist size is updated and can be cleared" )
+            {
+                REQUIRE( pSourceBintr->GetPlaylistSize() == 2 );
+                REQUIRE( pSourceBintr->AddPlaylistUri("./no-such-file.mp4") == false );
+                REQUIRE( pSourceBintr->GetPlaylistSize() == 2 );
+                
+                pSourceBintr->ClearPlaylist();
+                REQUIRE( pSourceBintr->GetPlaylistSize() == 0 );
+            }
+        }
+        WHEN( "A playlist file listener is added" )
+        {
+            REQUIRE( pSourceBintr->AddPlaylistFileListener(playlist_file_listener_cb, NULL) == true );
+
+            THEN( "The same listener can't be added twice and can be removed once" )
+            {
+                REQUIRE( pSourceBintr->AddPlaylistFileListener(playlist_file_listener_cb, NULL) == false );
+                REQUIRE( pSourceBintr->RemovePlaylistFileListener(playlist_file_listener_cb) == true );
+                REQUIRE( pSourceBintr->RemovePlaylistFileListener(playlist_file_listener_cb) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A UriSourceBintr can switch its URI when not linked",  "[UriSourceBintr]" )
+{
+    GIVEN( "A new UriSourceBintr in memory" ) 
+    {
+        std::string sourceName = "test-uri-source";
+        std::string uri = "./test/streams/sample_1080p_h264.mp4";
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        DSL_URI_SOURCE_PTR pSourceBintr = DSL_URI_SOURCE_NEW(
+            sourceName.c_str(), uri.c_str(), false, cudadecMemType, intrDecode, dropFrameInterval);
+
+        REQUIRE( pSourceBintr->GetSwitchLatency() == 0 );
+
+        WHEN( "The UriSourceBintr is switched to a new file URI" )
+        {
+            REQUIRE( pSourceBintr->SwitchUri(uri.c_str()) == true );
+            
+            THEN( "The URI is set directly and no switch latency is reported" )
+            {
+                std::string returnedUri = pSourceBintr->GetUri();
+                REQUIRE( returnedUri.find("sample_1080p_h264.mp4") != std::string::npos );
+                REQUIRE( pSourceBintr->GetSwitchLatency() == 0 );
+                REQUIRE( pSourceBintr->SwitchUri("./no-such-file.mp4") == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A RtspSourceBintr can Get and Set its RTSP config",  "[RtspSourceBintr]" )
+{
+    GIVEN( "A new RtspSourceBintr in memory" ) 
+    {
+        std::string sourceName("test-rtps-source");
+        std::string uri("rtsp://127.0.0.1:8554/test");
+        uint cudadecMemType(DSL_CUDADEC_MEMTYPE_DEVICE);
+        uint intrDecode(false);
+        uint dropFrameInterval(0);
+
+        DSL_RTSP_SOURCE_PTR pSourceBintr = DSL_RTSP_SOURCE_NEW(
+            sourceName.c_str(), uri.c_str(), DSL_RTP_TCP, cudadecMemType, intrDecode, dropFrameInterval);
+
+        uint latency(0), protocols(0), bufferMode(0), timeout(0);
+        bool dropOnLatency(false), doRetransmission(true);
+        pSourceBintr->GetRtspConfig(&latency, &dropOnLatency, &doRetransmission,
+            &protocols, &bufferMode, &timeout);
+        REQUIRE( latency == 100 );
+        REQUIRE( dropOnLatency == true );
+        REQUIRE( doRetransmission == false );
+        REQUIRE( protocols == DSL_RTP_TCP );
+        REQUIRE( bufferMode == DSL_RTSP_BUFFER_MODE_AUTO );
+        REQUIRE( timeout == DSL_DEFAULT_RTSP_TIMEOUT );
+
+        WHEN( "The RTSP config is set" )
+        {
+            REQUIRE( pSourceBintr->SetRtspConfig(250, false, true, 
+                DSL_RTP_ALL, DSL_RTSP_BUFFER_MODE_SLAVE, 3000) == true );
+
+            THEN( "The new RTSP config is returned" )
+            {
+                pSourceBintr->GetRtspConfig(&latency, &dropOnLatency, &doRetransmission,
+                    &protocols, &bufferMode, &timeout);
+                REQUIRE( latency == 250 );
+                REQUIRE( dropOnLatency == false );
+                REQUIRE( doRetransmission == true );
+                REQUIRE( protocols == DSL_RTP_ALL );
+                REQUIRE( bufferMode == DSL_RTSP_BUFFER_MODE_SLAVE );
+                REQUIRE( timeout == 3000 );
+                REQUIRE( pSourceBintr->SetRtspConfig(250, false, true, DSL_RTP_ALL, 
+                    DSL_RTSP_BUFFER_MODE_SYNCED+1, 3000) == false );
+            }
+        }
+        WHEN( "The RTSP ultra-low-latency preset is set" )
+        {
+            REQUIRE( pSourceBintr->SetRtspPreset(DSL_RTSP_PRESET_ULTRA_LOW_LATENCY) == true );
+
+            THEN( "The latency is reduced and late packets are dropped" )
+            {
+                pSourceBintr->GetRtspConfig(&latency, &dropOnLatency, &doRetransmission,
+                    &protocols, &bufferMode, &timeout);
+                REQUIRE( latency == 50 );
+                REQUIRE( dropOnLatency == true );
+                REQUIRE( bufferMode == DSL_RTSP_BUFFER_MODE_NONE );
+                REQUIRE( pSourceBintr->SetRtspPreset(DSL_RTSP_PRESET_ROBUST+1) == false );
+            }
+        }
+        WHEN( "The RTSP session has not been established" )
+        {
+            double jitter(1);
+            uint packetsReceived(1), packetsLost(1);
+            pSourceBintr->GetRtspStats(&jitter, &packetsReceived, &packetsLost);
+
+            THEN( "All network statistics are 0" )
+            {
+                REQUIRE( jitter == 0 );
+                REQUIRE( packetsReceived == 0 );
+                REQUIRE( packetsLost == 0 );
+            }
+        }
+    }
+}
@@ -0,0 +1,168 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslSurfacePlanner.h"
+
+using namespace DSL;
+
+SCENARIO( "The SurfaceMemoryPlanner calculates aligned surface sizes correctly", "[SurfaceMemoryPlanner]" )
+{
+    GIVEN( "Aligned and unaligned surface dimensions" ) 
+    {
+        WHEN( "The surface sizes are calculated" )
+        {
+            THEN( "Pitch is aligned to 256 bytes and height to 16 lines" )
+            {
+                REQUIRE( SurfaceMemoryPlanner::GetSurfaceSize(1280, 720, 
+                    DSL_SURFACE_FORMAT_NV12) == 1280*720*3/2 );
+                REQUIRE( SurfaceMemoryPlanner::GetSurfaceSize(1920, 1080, 
+                    DSL_SURFACE_FORMAT_NV12) == 2048*1088*3/2 );
+                REQUIRE( SurfaceMemoryPlanner::GetSurfaceSize(1280, 720, 
+                    DSL_SURFACE_FORMAT_RGBA) == 1280*4*720 );
+                REQUIRE( SurfaceMemoryPlanner::GetSurfaceSize(1920, 1080, 
+                    DSL_SURFACE_FORMAT_RGBA) == 7680*1088 );
+            }
+        }
+    }
+}
+
+SCENARIO( "The SurfaceMemoryPlanner projects memory for decoders, StreamMux and Sinks", "[SurfaceMemoryPlanner]" )
+{
+    GIVEN( "A new SurfaceMemoryPlanner" ) 
+    {
+        SurfaceMemoryPlanner planner;
+        uint64_t nv12Size = SurfaceMemoryPlanner::GetSurfaceSize(1280, 720, DSL_SURFACE_FORMAT_NV12);
+        uint64_t rgbaSize = SurfaceMemoryPlanner::GetSurfaceSize(1280, 720, DSL_SURFACE_FORMAT_RGBA);
+        
+        REQUIRE( planner.GetProjectedSize() == 0 );
+
+        WHEN( "Two decoders, a StreamMux and a Sink are added" )
+        {
+            planner.AddDecoder("source-1", 1280, 720, 16, 1, false);
+            planner.AddDecoder("source-2", 1280, 720, 16, 1, false);
+            planner.AddStreamMux(1280, 720, 2);
+            planner.AddSink(1280, 720);
+            
+            THEN( "The projected memory is the sum of all surfaces" )
+            {
+                REQUIRE( planner.GetProjectedSize() == nv12Size*17*2 + 
+                    nv12Size*2*DSL_STREAMMUX_POOL_SIZE + rgbaSize*DSL_SINK_POOL_SIZE );
+                
+                uint numDecodeSurfaces(0), numExtraSurfaces(0);
+                REQUIRE( planner.GetDecoderSurfaces("source-1", 
+                    &numDecodeSurfaces, &numExtraSurfaces) == true );
+                REQUIRE( numDecodeSurfaces == 16 );
+                REQUIRE( numExtraSurfaces == 1 );
+                REQUIRE( planner.GetDecoderSurfaces("source-3", 
+                    &numDecodeSurfaces, &numExtraSurfaces) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "The SurfaceMemoryPlanner shrinks decoder surfaces to fit a budget", "[SurfaceMemoryPlanner]" )
+{
+    GIVEN( "A SurfaceMemoryPlanner with a large and a small decoder" ) 
+    {
+        SurfaceMemoryPlanner planner;
+        uint64_t largeSize = SurfaceMemoryPlanner::GetSurfaceSize(1920, 1080, DSL_SURFACE_FORMAT_NV12);
+        uint64_t smallSize = SurfaceMemoryPlanner::GetSurfaceSize(640, 480, DSL_SURFACE_FORMAT_NV12);
+        
+        planner.AddDecoder("large-source", 1920, 1080, 16, 2, false);
+        planner.AddDecoder("small-source", 640, 480, 16, 2, false);
+        
+        uint numDecodeSurfaces(0), numExtraSurfaces(0);
+
+        WHEN( "The budget can be met by removing the extra surfaces" )
+        {
+            REQUIRE( planner.FitToBudget(largeSize*16 + smallSize*16) == true );
+            
+            THEN( "All extra surfaces are removed and decode surfaces are unchanged" )
+            {
+                planner.GetDecoderSurfaces("large-source", &numDecodeSurfaces, &numExtraSurfaces);
+                REQUIRE( numDecodeSurfaces == 16 );
+                REQUIRE( numExtraSurfaces == 0 );
+                planner.GetDecoderSurfaces("small-source", &numDecodeSurfaces, &numExtraSurfaces);
+                REQUIRE( numDecodeSurfaces == 16 );
+                REQUIRE( numExtraSurfaces == 0 );
+            }
+        }
+        WHEN( "The budget requires decode surfaces to be removed" )
+        {
+            REQUIRE( planner.FitToBudget(largeSize*10 + smallSize*16) == true );
+            
+            THEN( "Decode surfaces are removed from the largest decoder first" )
+            {
+                planner.GetDecoderSurfaces("large-source", &numDecodeSurfaces, &numExtraSurfaces);
+                REQUIRE( numDecodeSurfaces == 10 );
+                planner.GetDecoderSurfaces("small-source", &numDecodeSurfaces, &numExtraSurfaces);
+                REQUIRE( numDecodeSurfaces == 16 );
+                REQUIRE( planner.GetProjectedSize() <= largeSize*10 + smallSize*16 );
+            }
+        }
+        WHEN( "The budget is below the minimum decode surfaces" )
+        {
+            THEN( "The planner fails to fit the budget" )
+            {
+                REQUIRE( planner.FitToBudget(largeSize*DSL_MIN_DECODE_SURFACES) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "The SurfaceMemoryPlanner does not shrink fixed decode surfaces", "[SurfaceMemoryPlanner]" )
+{
+    GIVEN( "A SurfaceMemoryPlanner with a fixed and an adjustable decoder" ) 
+    {
+        SurfaceMemoryPlanner planner;
+        uint64_t surfaceSize = SurfaceMemoryPlanner::GetSurfaceSize(1920, 1080, DSL_SURFACE_FORMAT_NV12);
+        
+        planner.AddDecoder("fixed-source", 1920, 1080, 16, 2, true);
+        planner.AddDecoder("adjustable-source", 1920, 1080, 16, 0, false);
+        
+        uint numDecodeSurfaces(0), numExtraSurfaces(0);
+
+        WHEN( "The budget requires decode surfaces to be removed" )
+        {
+            REQUIRE( planner.FitToBudget(surfaceSize*16 + surfaceSize*10) == true );
+            
+            THEN( "Decode surfaces are only removed from the adjustable decoder" )
+            {
+                planner.GetDecoderSurfaces("fixed-source", &numDecodeSurfaces, &numExtraSurfaces);
+                REQUIRE( numDecodeSurfaces == 16 );
+                REQUIRE( numExtraSurfaces == 0 );
+                planner.GetDecoderSurfaces("adjustable-source", &numDecodeSurfaces, &numExtraSurfaces);
+                REQUIRE( numDecodeSurfaces == 10 );
+            }
+        }
+        WHEN( "The budget can only be met by shrinking the fixed decoder" )
+        {
+            THEN( "The planner fails to fit the budget" )
+            {
+                REQUIRE( planner.FitToBudget(surfaceSize*16) == false );
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslThreadManager.h"
+
+using namespace DSL;
+
+static void PostStreamStatus(DSL_THREAD_MANAGER_PTR pThreadManager,
+    GstElement* pOwner, GstStreamStatusType type)
+{
+    GstMessage* pMessage = gst_message_new_stream_status(GST_OBJECT(pOwner),
+        type, pOwner);
+    pThreadManager->HandleStreamStatus(pMessage);
+    gst_message_unref(pMessage);
+}
+
+SCENARIO( "A ThreadManager validates its role affinity settings", "[ThreadManager]" )
+{
+    GIVEN( "A new ThreadManager" )
+    {
+        DSL_THREAD_MANAGER_PTR pThreadManager = DSL_THREAD_MANAGER_NEW("pipeline");
+
+        const char* cpus(NULL);
+        int priority(99);
+        REQUIRE( pThreadManager->GetRoleAffinity(DSL_THREAD_ROLE_DECODE,
+            &cpus, &priority) == true );
+        REQUIRE( std::string(cpus) == "" );
+        REQUIRE( priority == 0 );
+
+        WHEN( "Valid settings are set" )
+        {
+            REQUIRE( pThreadManager->SetRoleAffinity(DSL_THREAD_ROLE_INFERENCE,
+                "0-3,6", -5) == true );
+
+            THEN( "The same settings are returned" )
+            {
+                REQUIRE( pThreadManager->GetRoleAffinity(DSL_THREAD_ROLE_INFERENCE,
+                    &cpus, &priority) == true );
+                REQUIRE( std::string(cpus) == "0-3,6" );
+                REQUIRE( priority == -5 );
+            }
+        }
+        WHEN( "Invalid settings are set" )
+        {
+            THEN( "The settings are refused" )
+            {
+                REQUIRE( pThreadManager->SetRoleAffinity(DSL_THREAD_NUM_ROLES,
+                    "0", 0) == false );
+                REQUIRE( pThreadManager->SetRoleAffinity(DSL_THREAD_ROLE_SINK,
+                    "3-1", 0) == false );
+                REQUIRE( pThreadManager->SetRoleAffinity(DSL_THREAD_ROLE_SINK,
+                    "0,", 0) == false );
+                REQUIRE( pThreadManager->SetRoleAffinity(DSL_THREAD_ROLE_SINK,
+                    "a", 0) == false );
+                REQUIRE( pThreadManager->SetRoleAffinity(DSL_THREAD_ROLE_SINK,
+                    "0", 20) == false );
+                REQUIRE( pThreadManager->GetRoleAffinity(DSL_THREAD_NUM_ROLES,
+                    &cpus, &priority) == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "A ThreadManager reports each thread by its innermost component",
+    "[ThreadManager]" )
+{
+    GIVEN( "A ThreadManager with a Sink component containing a Queue" )
+    {
+        DSL_THREAD_MANAGER_PTR pThreadManager = DSL_THREAD_MANAGER_NEW("pipeline");
+
+        GstElement* pSinkBin = gst_bin_new("sink-bin");
+        GstElement* pQueue = gst_element_factory_make("queue", "sink-queue");
+        gst_bin_add(GST_BIN(pSinkBin), pQueue);
+        pThreadManager->AddComponent(GST_OBJECT(pSinkBin), "my-sink", DSL_THREAD_ROLE_SINK);
+
+        WHEN( "A thread owned by the Queue enters and leaves" )
+        {
+            std::thread streamingThread([&]()
+            {
+                PostStreamStatus(pThreadManager, pQueue, GST_STREAM_STATUS_TYPE_ENTER);
+                PostStreamStatus(pThreadManager, pQueue, GST_STREAM_STATUS_TYPE_LEAVE);
+            });
+            streamingThread.join();
+
+            THEN( "The thread is reported against the Sink component" )
+            {
+                std::string report(pThreadManager->GetReport());
+                REQUIRE( report.find("my-sink owner=sink-queue role=sink") == 0 );
+                REQUIRE( report.find(" left\n") != std::string::npos );
+
+                pThreadManager->ClearComponents();
+                REQUIRE( std::string(pThreadManager->GetReport()) == "" );
+
+                gst_object_unref(pSinkBin);
+            }
+        }
+    }
+}
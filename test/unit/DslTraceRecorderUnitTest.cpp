@@ -0,0 +1,149 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslApi.h"
+#include "DslTraceRecorder.h"
+
+using namespace DSL;
+
+SCENARIO( "The TraceRecorder records events only while active", "[TraceRecorder]" )
+{
+    GIVEN( "The TraceRecorder with no active trace" ) 
+    {
+        std::string owner("test-pipeline");
+        std::string filePath("./test-trace-recorder.json");
+        
+        TraceRecorder* pRecorder = TraceRecorder::GetRecorder();
+        
+        REQUIRE( TraceRecorder::IsActive() == false );
+        REQUIRE( pRecorder->IsOwner(owner.c_str()) == false );
+        REQUIRE( pRecorder->Stop(owner.c_str()) == false );
+        
+        WHEN( "A Chrome JSON trace is started and events are recorded" )
+        {
+            REQUIRE( pRecorder->Start(owner.c_str(), filePath.c_str(), 
+                DSL_TRACE_FORMAT_CHROME_JSON) == true );
+            REQUIRE( TraceRecorder::IsActive() == true );
+            REQUIRE( pRecorder->IsOwner(owner.c_str()) == true );
+            {
+                TRACE_SCOPE("test", "test-scope");
+                TRACE_INSTANT("test", "test-instant");
+            }
+            REQUIRE( pRecorder->Stop(owner.c_str()) == true );
+            
+            THEN( "The events are written to file" )
+            {
+                REQUIRE( TraceRecorder::IsActive() == false );
+                
+                std::ifstream istream(filePath);
+                std::string trace((std::istreambuf_iterator<char>(istream)),
+                    std::istreambuf_iterator<char>());
+                    
+                REQUIRE( trace.find("\"traceEvents\"") != std::string::npos );
+                REQUIRE( trace.find("\"name\":\"test-scope\",\"cat\":\"test\",\"ph\":\"X\"") 
+                    != std::string::npos );
+                REQUIRE( trace.find("\"name\":\"test-instant\",\"cat\":\"test\",\"ph\":\"i\"") 
+                    != std::string::npos );
+            }
+        }
+        WHEN( "A Perfetto trace is started and events are recorded" )
+        {
+            REQUIRE( pRecorder->Start(owner.c_str(), filePath.c_str(), 
+                DSL_TRACE_FORMAT_PERFETTO) == true );
+            {
+                TRACE_SCOPE("test", "test-scope");
+            }
+            REQUIRE( pRecorder->Stop(owner.c_str()) == true );
+            
+            THEN( "The trace file starts with a Trace packet" )
+            {
+                std::ifstream istream(filePath, std::ios::binary);
+                std::string trace((std::istreambuf_iterator<char>(istream)),
+                    std::istreambuf_iterator<char>());
+                    
+                REQUIRE( trace.size() > 0 );
+                REQUIRE( trace[0] == (char)((1 << 3) | 2) );
+                REQUIRE( trace.find("test-scope") != std::string::npos );
+            }
+        }
+        WHEN( "Events are recorded with no active trace" )
+        {
+            {
+                TRACE_SCOPE("test", "test-scope");
+            }
+            
+            THEN( "A trace can't be started with an invalid format" )
+            {
+                REQUIRE( pRecorder->Start(owner.c_str(), filePath.c_str(), 
+                    DSL_TRACE_FORMAT_PERFETTO+1) == false );
+                REQUIRE( TraceRecorder::IsActive() == false );
+            }
+        }
+    }
+}
+
+SCENARIO( "The TraceRecorder writes only the events of the current session", "[TraceRecorder]" )
+{
+    GIVEN( "A trace session with events recorded by the main and a second thread" ) 
+    {
+        std::string owner("test-pipeline");
+        std::string filePath("./test-trace-recorder.json");
+        
+        TraceRecorder* pRecorder = TraceRecorder::GetRecorder();
+        
+        REQUIRE( pRecorder->Start(owner.c_str(), filePath.c_str(), 
+            DSL_TRACE_FORMAT_CHROME_JSON) == true );
+        {
+            TRACE_INSTANT("test", "first-session-main");
+            std::thread producer([]()
+            {
+                TRACE_INSTANT("test", "first-session-producer");
+            });
+            producer.join();
+        }
+        REQUIRE( pRecorder->Stop(owner.c_str()) == true );
+        
+        WHEN( "A second session is started and events are recorded" )
+        {
+            REQUIRE( pRecorder->Start(owner.c_str(), filePath.c_str(), 
+                DSL_TRACE_FORMAT_CHROME_JSON) == true );
+            {
+                TRACE_INSTANT("test", "second-session-main");
+            }
+            REQUIRE( pRecorder->Stop(owner.c_str()) == true );
+            
+            THEN( "Only the events of the second session are written" )
+            {
+                std::ifstream istream(filePath);
+                std::string trace((std::istreambuf_iterator<char>(istream)),
+                    std::istreambuf_iterator<char>());
+                    
+                REQUIRE( trace.find("second-session-main") != std::string::npos );
+                REQUIRE( trace.find("first-session-main") == std::string::npos );
+                REQUIRE( trace.find("first-session-producer") == std::string::npos );
+            }
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/*
+The MIT License
+
+Copyright (c) 2019-Present, ROBERT HOWELL
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in-
+all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+THE SOFTWARE.
+*/
+
+#include "catch.hpp"
+#include "DslXWindowEventDispatcher.h"
+
+using namespace DSL;
+
+/**
+ * @brief test client for the XWindowEventDispatcher
+ */
+struct TestDisplayClient
+{
+    Display* pDisplay;
+    std::atomic<uint> handlerCount;
+    std::atomic<uint> clientMessageCount;
+    std::atomic<gint64> lastEventTime;
+};
+
+static void test_display_event_handler(gpointer pClient)
+{
+    TestDisplayClient* pTestClient = static_cast<TestDisplayClient*>(pClient);
+    
+    pTestClient->handlerCount++;
+    while (XPending(pTestClient->pDisplay))
+    {
+        XEvent xEvent;
+        XNextEvent(pTestClient->pDisplay, &xEvent);
+        if (xEvent.type == ClientMessage)
+        {
+            pTestClient->clientMessageCount++;
+            pTestClient->lastEventTime = g_get_monotonic_time();
+        }
+    }
+}
+
+SCENARIO( "A Display can be added to and removed from the XWindowEventDispatcher", "[XWindowEventDispatcher]" )
+{
+    GIVEN( "An open X Display" ) 
+    {
+        TestDisplayClient testClient;
+        testClient.pDisplay = XOpenDisplay(NULL);
+        testClient.handlerCount = 0;
+        REQUIRE( testClient.pDisplay != NULL );
+        
+        XWindowEventDispatcher* pDispatcher = XWindowEventDispatcher::GetDispatcher();
+
+        WHEN( "The Display is added" )
+        {
+            REQUIRE( pDispatcher->AddDisplay(testClient.pDisplay, 
+                test_display_event_handler, &testClient) == true );
+            
+            THEN( "The handler is called on wake-up and the Display can't be added twice" )
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                REQUIRE( testClient.handlerCount.load() > 0 );
+                
+                REQUIRE( pDispatcher->AddDisplay(testClient.pDisplay, 
+                    test_display_event_handler, &testClient) == false );
+                REQUIRE( pDispatcher->RemoveDisplay(testClient.pDisplay) == true );
+                REQUIRE( pDispatcher->RemoveDisplay(testClient.pDisplay) == false );
+                
+                XCloseDisplay(testClient.pDisplay);
+            }
+        }
+    }
+}
+
+SCENARIO( "The XWindowEventDispatcher calls the handler as soon as an event arrives", "[XWindowEventDispatcher]" )
+{
+    GIVEN( "A Display with an XWindow added to the XWindowEventDispatcher" ) 
+    {
+        TestDisplayClient testClient;
+        testClient.pDisplay = XOpenDisplay(NULL);
+        testClient.handlerCount = 0;
+        testClient.clientMessageCount = 0;
+        REQUIRE( testClient.pDisplay != NULL );
+        
+        Window xWindow = XCreateSimpleWindow(testClient.pDisplay, 
+            RootWindow(testClient.pDisplay, DefaultScreen(testClient.pDisplay)), 
+            0, 0, 320, 240, 0, 0, 0);
+        XSync(testClient.pDisplay, TRUE);
+        
+        XWindowEventDispatcher* pDispatcher = XWindowEventDispatcher::GetDispatcher();
+        REQUIRE( pDispatcher->AddDisplay(testClient.pDisplay, 
+            test_display_event_handler, &testClient) == true );
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+        WHEN( "A Client Message is sent to the XWindow from another connection" )
+        {
+            Display* pSenderDisplay = XOpenDisplay(NULL);
+            REQUIRE( pSenderDisplay != NULL );
+            
+            XEvent xEvent = {0};
+            xEvent.xclient.type = ClientMessage;
+            xEvent.xclient.window = xWindow;
+            xEvent.xclient.format = 32;
+            
+            gint64 sendTime = g_get_monotonic_time();
+            XSendEvent(pSenderDisplay, xWindow, False, NoEventMask, &xEvent);
+            XFlush(pSenderDisplay);
+            
+            THEN( "The handler receives the event well within the previous 50 ms polling period" )
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                REQUIRE( testClient.clientMessageCount.load() == 1 );
+                REQUIRE( (testClient.lastEventTime.load() - sendTime) < 25000 );
+                
+                REQUIRE( pDispatcher->RemoveDisplay(testClient.pDisplay) == true );
+                XCloseDisplay(pSenderDisplay);
+                XDestroyWindow(testClient.pDisplay, xWindow);
+                XCloseDisplay(testClient.pDisplay);
+            }
+        }
+    }
+}